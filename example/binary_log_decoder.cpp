@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include <Elite/BinaryLog.hpp>
+#include <Elite/EliteException.hpp>
+
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ELITE;
+namespace po = boost::program_options;
+
+static const char* levelString(LogLevel level) {
+    switch (level) {
+        case LogLevel::ELI_DEBUG:
+            return "DEBUG";
+        case LogLevel::ELI_INFO:
+            return "INFO";
+        case LogLevel::ELI_WARN:
+            return "WARN";
+        case LogLevel::ELI_ERROR:
+            return "ERROR";
+        case LogLevel::ELI_FATAL:
+            return "FATAL";
+        default:
+            return "NONE";
+    }
+}
+
+// "YYYY-mm-dd HH:MM:SS.uuuuuu", local time
+static std::string timeString(std::chrono::system_clock::time_point time) {
+    using namespace std::chrono;
+    auto us = duration_cast<microseconds>(time.time_since_epoch()).count() % 1000000;
+    std::time_t t = system_clock::to_time_t(time);
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &t);
+#else
+    localtime_r(&t, &tm);
+#endif
+    char buffer[48];
+    size_t n = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &tm);
+    std::snprintf(buffer + n, sizeof(buffer) - n, ".%06d", static_cast<int>(us));
+    return buffer;
+}
+
+static std::string jsonString(const std::string& text) {
+    std::string out = "\"";
+    for (unsigned char c : text) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (c < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out += escaped;
+                } else {
+                    out += static_cast<char>(c);
+                }
+                break;
+        }
+    }
+    out += "\"";
+    return out;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> files;
+    bool json = false;
+
+    // Parser param
+    po::options_description desc(
+        "Usage:\n"
+        "\t./binary_log_decoder [--json] <file.elog>...\n"
+        "Parameters:");
+    desc.add_options()
+        ("help,h", "Print help message")
+        ("json", po::bool_switch(&json), "\tOptional. Print one JSON object per line instead of text.")
+        ("files", po::value<std::vector<std::string>>(&files)->required(), "\tRequired. The binary log files, in order.");
+    po::positional_options_description positional;
+    positional.add("files", -1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return 0;
+        }
+        po::notify(vm);
+    } catch (const po::error& e) {
+        std::cerr << "Argument error: " << e.what() << "\n\n";
+        std::cerr << desc << "\n";
+        return 1;
+    }
+
+    int result = 0;
+    for (auto& path : files) {
+        try {
+            BinaryLogReader reader(path);
+            BinaryLogEntry entry;
+            while (reader.next(entry)) {
+                if (json) {
+                    auto us = std::chrono::duration_cast<std::chrono::microseconds>(entry.time.time_since_epoch()).count();
+                    std::cout << "{\"time_us\":" << us << ",\"level\":\"" << levelString(entry.level)
+                              << "\",\"file\":" << jsonString(entry.file) << ",\"line\":" << entry.line
+                              << ",\"thread\":" << entry.thread << ",\"message\":" << jsonString(entry.message) << "}\n";
+                } else {
+                    std::cout << "[" << timeString(entry.time) << " " << levelString(entry.level) << "] [T" << entry.thread
+                              << "] " << entry.file << ":" << entry.line << ": " << entry.message << "\n";
+                }
+            }
+            if (reader.isBroken()) {
+                std::cerr << path << ": stopped at a broken record\n";
+                result = 1;
+            }
+        } catch (const EliteException& e) {
+            std::cerr << e.what() << "\n";
+            result = 1;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include <Elite/FleetOrchestrator.hpp>
+#include <Elite/Log.hpp>
+
+#include <boost/program_options.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ELITE;
+namespace po = boost::program_options;
+
+static const char* stageString(FleetStage stage) {
+    switch (stage) {
+        case FleetStage::CONNECT:
+            return "connect";
+        case FleetStage::UPLOAD:
+            return "upload";
+        case FleetStage::INSTALL:
+            return "install";
+        case FleetStage::DOWNLOAD:
+            return "download";
+        case FleetStage::DONE:
+            return "done";
+        default:
+            return "failed";
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> ips;
+    std::string pw;
+    std::string upgrade_file;
+    std::string log_dir;
+    size_t workers = 8;
+    uint64_t limit_kib = 0;
+    // Parser param
+    po::options_description desc(
+        "Usage:\n"
+        "\t./fleet_example <--ssh-pw=password> [--upgrade-file=file] [--log-dir=dir] [--workers=8] [--limit-kib=0] <ip>...\n"
+        "Parameters:");
+    desc.add_options()
+        ("help,h", "Print help message")
+        ("ips", po::value<std::vector<std::string>>(&ips)->required(), "\tRequired. IP addresses of the robots.")
+        ("ssh-pw", po::value<std::string>(&pw)->required(), "\tRequired. Controller box OS ssh password.")
+        ("upgrade-file", po::value<std::string>(&upgrade_file)->default_value(""), "\tOptional. Upgrade the robots with this file.")
+        ("log-dir", po::value<std::string>(&log_dir)->default_value(""), "\tOptional. Download the system logs into this directory.")
+        ("workers", po::value<size_t>(&workers)->default_value(8), "\tOptional. Robots handled at the same time.")
+        ("limit-kib", po::value<uint64_t>(&limit_kib)->default_value(0), "\tOptional. Total KiB per second of the transfers, 0 is no limit.");
+    po::positional_options_description positional;
+    positional.add("ips", -1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return 0;
+        }
+
+        po::notify(vm);
+    } catch (const po::error& e) {
+        std::cerr << "Argument error: " << e.what() << "\n\n";
+        std::cerr << desc << "\n";
+        return 1;
+    }
+
+    FleetOptions options;
+    options.max_workers = workers;
+    options.max_bytes_per_second = limit_kib * 1024;
+    FleetOrchestrator fleet(options);
+    fleet.setProgressCallback([](const std::string& ip, FleetStage stage, uint64_t total, uint64_t done, const char* err) {
+        if (stage == FleetStage::UPLOAD || stage == FleetStage::DOWNLOAD) {
+            // Every 10 %
+            if (total == 0 || done * 10 / total == (done - 1) * 10 / total) {
+                return;
+            }
+            ELITE_LOG_INFO("%s %s %llu/%llu", ip.c_str(), stageString(stage), static_cast<unsigned long long>(done),
+                           static_cast<unsigned long long>(total));
+        } else if (err) {
+            ELITE_LOG_ERROR("%s %s: %s", ip.c_str(), stageString(stage), err);
+        } else {
+            ELITE_LOG_INFO("%s %s", ip.c_str(), stageString(stage));
+        }
+    });
+
+    int result = 0;
+    if (!log_dir.empty()) {
+        auto summary = fleet.downloadSystemLogs(ips, log_dir, pw);
+        std::cout << "Download system logs: " << summary.toString();
+        result |= summary.failed > 0;
+    }
+    if (!upgrade_file.empty()) {
+        auto summary = fleet.upgradeControlSoftware(ips, upgrade_file, pw);
+        std::cout << "Upgrade control software: " << summary.toString();
+        result |= summary.failed > 0;
+    }
+    return result;
+}
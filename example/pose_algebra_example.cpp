@@ -43,7 +43,7 @@ void printPoseMatrix(const std::string& name, const PoseMatrix& value) {
 bool checkResult(const std::string& operation, bool ok, const PoseAlgebraResult& result) {
     if (!ok) {
         ELITE_LOG_ERROR("%s failed. error=%d, message=%s", operation.c_str(), static_cast<int>(result.error),
-                        result.message.c_str());
+                        result.message().c_str());
         return false;
     }
     return true;
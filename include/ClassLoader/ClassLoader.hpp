@@ -8,9 +8,47 @@
 
 #include <memory>
 #include <string>
+#include <typeinfo>
 #include <Elite/ClassRegistry.hpp>
 
 namespace ELITE {
+
+/**
+ * @brief The factory of a plugin class, looked up once in the class registry.
+ *   Keep it to create instances without the lookup of ClassLoader::createUniqueInstance(). It is valid while the
+ *   ClassLoader that returned it keeps the library loaded.
+ *
+ * @tparam Base The base class type
+ */
+template <typename Base>
+class ClassFactory {
+   public:
+    ClassFactory() = default;
+
+    explicit ClassFactory(INTERNAL::ClassRegistry::Factory factory) : factory_(factory) {}
+
+    /**
+     * @brief Check if the factory was found
+     *
+     */
+    explicit operator bool() const { return factory_ != nullptr; }
+
+    /**
+     * @brief Create a object
+     *
+     * @return std::unique_ptr<Base> The created object pointer, nullptr if the factory was not found
+     */
+    std::unique_ptr<Base> createUniqueInstance() const {
+        if (!factory_) {
+            return nullptr;
+        }
+        return std::unique_ptr<Base>(static_cast<Base*>(factory_()));
+    }
+
+   private:
+    INTERNAL::ClassRegistry::Factory factory_ = nullptr;
+};
+
 class ELITE_EXPORT ClassLoader {
    private:
     class Impl;
@@ -49,11 +87,22 @@ class ELITE_EXPORT ClassLoader {
      */
     template <typename Base>
     std::unique_ptr<Base> createUniqueInstance(const std::string& derived_class_name) {
-        auto factory = INTERNAL::ClassRegistry::instance().getFactory(derived_class_name, typeid(Base).name());
-        if (!hasLoadedLib() || !factory) {
-            return nullptr;
+        return getClassFactory<Base>(derived_class_name).createUniqueInstance();
+    }
+
+    /**
+     * @brief Look up the factory of a class once, to create many objects without a lookup each
+     *
+     * @tparam Base The base class type
+     * @param derived_class_name Derived class name
+     * @return ClassFactory<Base> The factory, empty if the library is not loaded or the class is not registered
+     */
+    template <typename Base>
+    ClassFactory<Base> getClassFactory(const std::string& derived_class_name) const {
+        if (!hasLoadedLib()) {
+            return ClassFactory<Base>();
         }
-        return std::unique_ptr<Base>(static_cast<Base*>(factory()));
+        return ClassFactory<Base>(INTERNAL::ClassRegistry::instance().getFactory(derived_class_name, typeid(Base).name()));
     }
 };
 
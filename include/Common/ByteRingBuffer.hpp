@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// ByteRingBuffer.hpp
+// Provides a fixed capacity byte ring buffer, filled in place by socket reads.
+#ifndef __ELITE__BYTE_RING_BUFFER_HPP__
+#define __ELITE__BYTE_RING_BUFFER_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace ELITE {
+
+/**
+ * @brief A byte ring buffer of fixed capacity. Not thread safe.
+ * The free space is given as a contiguous span, so a socket can read into the buffer without a copy.
+ *
+ */
+class ByteRingBuffer {
+   private:
+    std::vector<uint8_t> data_;
+    // Index of the first byte
+    size_t head_ = 0;
+    size_t size_ = 0;
+
+    uint8_t at(size_t index) const { return data_[(head_ + index) % data_.size()]; }
+
+   public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    explicit ByteRingBuffer(size_t capacity) : data_(capacity) {}
+
+    size_t size() const { return size_; }
+
+    size_t capacity() const { return data_.size(); }
+
+    size_t space() const { return data_.size() - size_; }
+
+    void clear() {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    /**
+     * @brief The contiguous free space after the data
+     *
+     * @return std::pair<uint8_t*, size_t> The start and the size, which is 0 if the buffer is full
+     */
+    std::pair<uint8_t*, size_t> writeSpan() {
+        if (size_ == 0) {
+            // Keep the data contiguous as long as possible
+            head_ = 0;
+        }
+        size_t tail = (head_ + size_) % data_.size();
+        if (size_ == data_.size()) {
+            return {data_.data() + tail, 0};
+        }
+        return {data_.data() + tail, tail >= head_ ? data_.size() - tail : head_ - tail};
+    }
+
+    /**
+     * @brief Add the bytes written into the writeSpan() to the data
+     *
+     */
+    void commit(size_t n) { size_ += n; }
+
+    /**
+     * @brief Copy bytes without removing them
+     *
+     * @return size_t The bytes copied
+     */
+    size_t peek(uint8_t* out, size_t n) const {
+        n = std::min(n, size_);
+        size_t first = std::min(n, data_.size() - head_);
+        std::memcpy(out, data_.data() + head_, first);
+        std::memcpy(out + first, data_.data(), n - first);
+        return n;
+    }
+
+    /**
+     * @brief Remove bytes from the front
+     *
+     */
+    void consume(size_t n) {
+        n = std::min(n, size_);
+        head_ = (head_ + n) % data_.size();
+        size_ -= n;
+    }
+
+    /**
+     * @brief Copy and remove bytes
+     *
+     * @return size_t The bytes read
+     */
+    size_t read(uint8_t* out, size_t n) {
+        n = peek(out, n);
+        consume(n);
+        return n;
+    }
+
+    /**
+     * @brief Find a byte sequence in the data
+     *
+     * @param pattern The bytes, not empty
+     * @param length The length of the bytes
+     * @param from Search from this index
+     * @return size_t The index of the first match, npos if not found
+     */
+    size_t find(const uint8_t* pattern, size_t length, size_t from = 0) const {
+        for (size_t i = from; i + length <= size_; i++) {
+            if (at(i) != pattern[0]) {
+                continue;
+            }
+            size_t j = 1;
+            while (j < length && at(i + j) == pattern[j]) {
+                j++;
+            }
+            if (j == length) {
+                return i;
+            }
+        }
+        return npos;
+    }
+};
+
+}  // namespace ELITE
+
+#endif
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// SshSessionPool.hpp
+// Provides the pool of authenticated SSH connections shared by the SSH utilities.
+#ifndef __ELITE__SSH_SESSION_POOL_HPP__
+#define __ELITE__SSH_SESSION_POOL_HPP__
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Common/SshTransfer.hpp"
+
+namespace ELITE {
+
+namespace SSH_UTILS {
+
+/**
+ * @brief Keeps one authenticated connection per host and user, so the commands and transfers to a robot do not log in
+ * again each time.
+ * @verbatim
+ *  The connections returned by acquire() find their session in the pool for every command: a session that was lost is
+ *  logged in again, and the commands of several threads are multiplexed as channels of the same session.
+ *  A background thread sends keep-alives to the sessions every keep-alive interval, and closes the sessions that ran no
+ *  command during the idle timeout. The thread stops when the pool is empty.
+ * @endverbatim
+ *
+ */
+class SshSessionPool {
+   public:
+    using Connector =
+        std::function<std::shared_ptr<SshConnection>(const std::string& host, const std::string& user, const std::string& password)>;
+
+    /**
+     * @brief The pool used by the SSH utilities
+     *
+     */
+    static SshSessionPool& instance();
+
+    /**
+     * @brief Construct a new Ssh Session Pool object
+     *
+     * @param connector Logs in to a server, SSH_UTILS::connect() by default
+     * @param idle_timeout Sessions without commands for this time are closed
+     * @param keep_alive_interval Interval of the keep-alives and of the idle check
+     */
+    explicit SshSessionPool(Connector connector = Connector(),
+                            std::chrono::milliseconds idle_timeout = std::chrono::milliseconds(60000),
+                            std::chrono::milliseconds keep_alive_interval = std::chrono::milliseconds(15000));
+
+    /**
+     * @brief Close all the sessions
+     *
+     */
+    ~SshSessionPool();
+
+    /**
+     * @brief Get a connection to a server. The session is logged in now if the pool has none.
+     *
+     * @param host SSH server IP
+     * @param user User name
+     * @param password User password. A different password than the pooled session's logs in again.
+     * @return std::shared_ptr<SshConnection> The connection, nullptr if the login fails
+     */
+    std::shared_ptr<SshConnection> acquire(const std::string& host, const std::string& user, const std::string& password);
+
+    /**
+     * @brief Replace the function logging in to the servers, for the next logins
+     *
+     * @param connector The function, SSH_UTILS::connect() if it is empty
+     */
+    void setConnector(Connector connector);
+
+    /**
+     * @brief Close the sessions that are not running a command
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of sessions in the pool
+     *
+     */
+    size_t size();
+
+   private:
+    class PooledConnection;
+
+    struct Entry {
+        std::string password;
+        std::shared_ptr<SshConnection> connection;
+        std::chrono::steady_clock::time_point last_used;
+    };
+
+    Connector connector_;
+    std::chrono::milliseconds idle_timeout_;
+    std::chrono::milliseconds keep_alive_interval_;
+
+    std::mutex mutex_;
+    // Logins are slow, they run under the lock of their host instead of mutex_
+    std::map<std::string, std::shared_ptr<std::mutex>> connect_mutexes_;
+    std::map<std::string, Entry> entries_;
+
+    std::condition_variable maintain_cv_;
+    std::thread maintain_thread_;
+    bool maintain_running_ = false;
+    bool stopping_ = false;
+
+    std::shared_ptr<SshConnection> session(const std::string& host, const std::string& user, const std::string& password);
+    void invalidate(const std::string& key, const std::shared_ptr<SshConnection>& connection);
+    void maintainLoop();
+};
+
+}  // namespace SSH_UTILS
+
+}  // namespace ELITE
+
+#endif
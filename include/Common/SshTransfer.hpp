@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// SshTransfer.hpp
+// Provides the SSH connection, and the resumable file transfer running on it.
+#ifndef __ELITE__SSH_TRANSFER_HPP__
+#define __ELITE__SSH_TRANSFER_HPP__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ELITE {
+
+namespace SSH_UTILS {
+
+/**
+ * @brief A command running on the server, with its standard input and output.
+ *
+ */
+class SshChannel {
+   public:
+    virtual ~SshChannel() = default;
+
+    /**
+     * @brief Read the standard output of the command
+     *
+     * @param buffer Buffer
+     * @param size Buffer size
+     * @param timeout_ms Time to wait for data, values <= 0 wait without timeout
+     * @return int The bytes read, 0 at the end of the output, -1 on error or timeout
+     */
+    virtual int read(char* buffer, int size, int timeout_ms) = 0;
+
+    /**
+     * @brief Write all the data to the standard input of the command
+     *
+     * @return true success
+     * @return false fail
+     */
+    virtual bool write(const char* buffer, int size) = 0;
+
+    /**
+     * @brief Close the standard input of the command
+     *
+     */
+    virtual void closeInput() = 0;
+
+    /**
+     * @brief Wait for the command to exit
+     *
+     * @return int The exit status, -1 if it is unknown
+     */
+    virtual int wait() = 0;
+};
+
+/**
+ * @brief One authenticated connection to a server. Every command runs on its own channel of the connection, no login per
+ * command. Several threads can run commands on a connection at the same time.
+ *
+ */
+class SshConnection {
+   public:
+    virtual ~SshConnection() = default;
+
+    /**
+     * @brief Run a command on the server
+     *
+     * @param cmd The command line
+     * @return std::unique_ptr<SshChannel> The channel of the command, nullptr on failure
+     */
+    virtual std::unique_ptr<SshChannel> exec(const std::string& cmd) = 0;
+
+    /**
+     * @brief Keep the connection from timing out and check that it is still usable
+     *
+     * @return true the connection is usable
+     * @return false the connection is lost
+     */
+    virtual bool keepAlive() { return true; }
+};
+
+/**
+ * @brief Log in to the server.
+ *      With libssh it is a libssh session. Otherwise, on Linux, it is an OpenSSH master connection ("ControlMaster") opened
+ * with `sshpass`, and the commands run with `ssh` through the master connection.
+ *
+ * @param host SSH server IP
+ * @param user User name
+ * @param password User password
+ * @return std::shared_ptr<SshConnection> The connection, nullptr on failure
+ */
+std::shared_ptr<SshConnection> connect(const std::string& host, const std::string& user, const std::string& password);
+
+/**
+ * @brief Start a local process with its standard input and output connected to a channel.
+ *
+ * @param argv The program and its arguments
+ * @return std::unique_ptr<SshChannel> The channel, nullptr on failure or if the platform is not supported
+ */
+std::unique_ptr<SshChannel> spawnProcess(const std::vector<std::string>& argv);
+
+/**
+ * @brief Quote a string for the POSIX shell of the server
+ *
+ */
+std::string shellQuote(const std::string& text);
+
+/**
+ * @brief The SHA-256 of a local file
+ *
+ * @return std::string Lower case hex digest, empty if the file can not be read
+ */
+std::string sha256File(const std::string& path);
+
+/**
+ * @brief The SHA-256 of data in memory
+ *
+ * @return std::string Lower case hex digest
+ */
+std::string sha256Data(const char* data, size_t size);
+
+/**
+ * @brief Limits the bytes per second of the transfers sharing it. A transfer waits for its time slot before each block.
+ *
+ */
+class BandwidthLimiter {
+   private:
+    uint64_t bytes_per_second_;
+    std::mutex mutex_;
+    std::chrono::steady_clock::time_point next_;
+
+   public:
+    /**
+     * @param bytes_per_second The limit, 0 is no limit
+     */
+    explicit BandwidthLimiter(uint64_t bytes_per_second);
+
+    /**
+     * @brief Wait until the bytes may be transferred
+     *
+     */
+    void consume(uint64_t bytes);
+};
+
+/**
+ * @brief Options of SshTransfer
+ *
+ */
+struct TransferOptions {
+    // Bytes read from the file and written to the channel at a time
+    size_t chunk_size = 256 * 1024;
+    // Attempts after the first failure. Each attempt continues from the bytes already transferred.
+    int retries = 3;
+    // Compare the SHA-256 of both sides when the transfer ends
+    bool verify = true;
+    // Time without data from the server after which a read fails, in milliseconds. A stalled transfer is then retried,
+    // and a stalled command fails. Values <= 0 wait without timeout.
+    int read_timeout_ms = 30000;
+    // Accept a transfer whose remote SHA-256 can't be computed (no sha256sum on the server). Otherwise the transfer fails
+    // and the ".part" file is kept.
+    bool allow_unverified = false;
+    // Shared by the transfers whose total bandwidth is limited, nullptr is no limit
+    std::shared_ptr<BandwidthLimiter> limiter;
+};
+
+/**
+ * @brief Progress of a transfer
+ *      total: File size.
+ *      done: Bytes transferred, including the bytes of previous attempts.
+ *      err: Error information (nullptr when there is no error)
+ */
+using TransferProgress = std::function<void(uint64_t total, uint64_t done, const char* err)>;
+
+/**
+ * @brief Commands and file transfers on one connection.
+ * @verbatim
+ *  The file content is streamed through a command channel ("tail -c +<offset>" to download, "cat >>" to upload), so the
+ *  data flows continuously up to the SSH window, with no round trip per block.
+ *  The data is written to "<path>.part" first. When a transfer fails it is retried from the size of the ".part" file, and
+ *  a ".part" file left by a previous call is continued too. When all the bytes are transferred the SHA-256 of both sides
+ *  is compared (with `sha256sum` on the server), then the ".part" file is renamed to the target path. When the server
+ *  can't compute the SHA-256 the transfer fails, unless TransferOptions::allow_unverified is set.
+ * @endverbatim
+ *
+ */
+class SshTransfer {
+   private:
+    std::shared_ptr<SshConnection> connection_;
+    TransferOptions options_;
+
+    enum class VerifyResult { MATCH, MISMATCH, UNAVAILABLE };
+
+    bool remoteSize(const std::string& path, uint64_t& size);
+    VerifyResult remoteVerify(const std::string& remote_path, uint64_t size, const std::string& sha256);
+    bool uploadFrom(const std::function<size_t(uint64_t offset, char* buffer, size_t size)>& read, uint64_t total,
+                    const std::string& sha256, const std::string& name, const std::string& remote_path, TransferProgress progress);
+
+   public:
+    explicit SshTransfer(std::shared_ptr<SshConnection> connection, const TransferOptions& options = TransferOptions());
+
+    /**
+     * @brief Execute a command and return its output
+     *
+     * @param cmd The command line
+     * @param status The exit status of the command, -1 if it did not run or its output stalled for
+     * TransferOptions::read_timeout_ms. Can be nullptr.
+     * @return std::string The standard output of the command
+     */
+    std::string execute(const std::string& cmd, int* status = nullptr);
+
+    /**
+     * @brief Download a file
+     *
+     * @param remote_path Remote file path
+     * @param local_path Save path (the file name needs to be included)
+     * @param progress Progress callback, can be nullptr
+     * @return true success
+     * @return false fail
+     */
+    bool download(const std::string& remote_path, const std::string& local_path, TransferProgress progress);
+
+    /**
+     * @brief Upload a file
+     *
+     * @param local_path Local file path
+     * @param remote_path Remote file path (the file name needs to be included)
+     * @param progress Progress callback, can be nullptr
+     * @return true success
+     * @return false fail
+     */
+    bool upload(const std::string& local_path, const std::string& remote_path, TransferProgress progress);
+
+    /**
+     * @brief Upload data in memory, so a file read once can be sent to several servers
+     *
+     * @param data The data, kept valid until the call returns
+     * @param size Data size
+     * @param sha256 The SHA-256 of the data (lower case hex). If it is empty it is computed when it is needed.
+     * @param remote_path Remote file path (the file name needs to be included)
+     * @param progress Progress callback, can be nullptr
+     * @return true success
+     * @return false fail
+     */
+    bool upload(const char* data, size_t size, const std::string& sha256, const std::string& remote_path,
+                TransferProgress progress);
+};
+
+}  // namespace SSH_UTILS
+
+}  // namespace ELITE
+
+#endif
@@ -12,7 +12,11 @@
 #include "TcpServer.hpp"
 
 #include <boost/asio.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 
 namespace ELITE {
 
@@ -24,13 +28,30 @@ class ScriptCommandInterface : public ReversePort {
         SET_TOOL_VOLTAGE = 2,
         START_FORCE_MODE = 3,
         END_FORCE_MODE = 4,
+        START_TOOL_RS485 = 5,
+        END_TOOL_RS485 = 6,
+        START_BOARD_RS485 = 7,
+        END_BOARD_RS485 = 8,
     };
 
     enum class SerialResult {
         START = 1,
         END = 2,
+        // Sent by the script at once with the command, the result follows when socat is done
+        ACCEPTED = 3,
     };
 
+    // One serial command at a time, its acknowledgements are the result type and a value
+    std::mutex serial_command_mutex_;
+    std::mutex serial_result_mutex_;
+    std::condition_variable serial_result_cv_;
+    std::deque<int32_t> serial_results_;
+
+    bool waitSerialResult(SerialResult expected, std::chrono::steady_clock::time_point deadline, int32_t& value);
+
+    bool serialCommand(Cmd cmd, const SerialConfig* config, int tcp_port, SerialResult expected, int accept_timeout_ms,
+                       int timeout_ms, int32_t& value);
+
    public:
     static constexpr int SCRIPT_COMMAND_DATA_SIZE = 26;
 
@@ -108,6 +129,51 @@ class ScriptCommandInterface : public ReversePort {
      * @return false fail
      */
     bool endForceMode();
+
+    /**
+     * @brief Start the socat process of the tool RS485 by the external control script, and wait for its acknowledgement.
+     * The script accepts the command at once and hands it to its socat thread, which configures the tool serial port,
+     * replaces the socat processes of the port and acknowledges once the TCP port listens, so it can be connected at once.
+     * A script without the serial commands never accepts, so it only costs `accept_timeout_ms`.
+     *
+     * @param config Serial configuration
+     * @param tcp_port Socat TCP port
+     * @param accept_timeout_ms Time to wait for the script to accept the command
+     * @param timeout_ms Time to wait for the acknowledgement after the command is accepted
+     * @return int The socat PID, -1 if it fails or times out
+     */
+    int startToolRs485(const SerialConfig& config, int tcp_port, int accept_timeout_ms, int timeout_ms);
+
+    /**
+     * @brief Stop the socat processes of the tool RS485 by the external control script
+     *
+     * @param accept_timeout_ms Time to wait for the script to accept the command
+     * @param timeout_ms Time to wait for the acknowledgement after the command is accepted
+     * @return true success
+     * @return false fail or timeout
+     */
+    bool endToolRs485(int accept_timeout_ms, int timeout_ms);
+
+    /**
+     * @brief Start the socat process of the board RS485 by the external control script, like startToolRs485().
+     *
+     * @param config Serial configuration
+     * @param tcp_port Socat TCP port
+     * @param accept_timeout_ms Time to wait for the script to accept the command
+     * @param timeout_ms Time to wait for the acknowledgement after the command is accepted
+     * @return int The socat PID, -1 if it fails or times out
+     */
+    int startBoardRs485(const SerialConfig& config, int tcp_port, int accept_timeout_ms, int timeout_ms);
+
+    /**
+     * @brief Stop the socat processes of the board RS485 by the external control script
+     *
+     * @param accept_timeout_ms Time to wait for the script to accept the command
+     * @param timeout_ms Time to wait for the acknowledgement after the command is accepted
+     * @return true success
+     * @return false fail or timeout
+     */
+    bool endBoardRs485(int accept_timeout_ms, int timeout_ms);
 };
 
 }  // namespace ELITE
@@ -11,11 +11,29 @@
 #include <Elite/EliteOptions.hpp>
 
 #include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ELITE {
 
+class DashboardResponseMatcher;
+class DashboardStateSource;
+
+/**
+ * @brief The robot status queried by DashboardClient::getStatus() in one round-trip
+ *
+ */
+struct DashboardStatus {
+    RobotMode robot_mode = RobotMode::UNKNOWN;
+    SafetyMode safety_mode = SafetyMode::UNKNOWN;
+    TaskStatus task_status = TaskStatus::UNKNOWN;
+    // The target speed fraction, percent
+    int speed_scaling = 0;
+};
+
 class DashboardClient {
    public:
     ELITE_EXPORT explicit DashboardClient();
@@ -318,15 +336,60 @@ class DashboardClient {
      */
     ELITE_EXPORT std::string sendAndReceive(const std::string& cmd);
 
+    /**
+     * @brief Send a dashboard command without waiting for the response. The responses are matched to the commands in the
+     * order they were sent, so several commands can be written back-to-back.
+     * @verbatim
+     *  The response is read when the future's get() is called, wait_for() and wait_until() return
+     *  std::future_status::deferred. A socket error or response timeout is thrown by get().
+     *  The replies of "status", "help" and "usage" have several lines. An "echo" command is sent after them, and the reply
+     *  is every line up to the answer of "echo".
+     * @endverbatim
+     *
+     * @param cmd Dashboard command
+     * @return std::future<std::string> Response
+     */
+    ELITE_EXPORT std::future<std::string> sendAsync(const std::string& cmd);
+
+    /**
+     * @brief Send several dashboard commands in one write and receive their responses.
+     *
+     * @param cmds Dashboard commands
+     * @return std::vector<std::string> Responses, in the order of the commands
+     */
+    ELITE_EXPORT std::vector<std::string> sendAndReceiveBatch(const std::vector<std::string>& cmds);
+
+    /**
+     * @brief Get the robot mode, safety mode, task status and speed scaling in one round-trip
+     *
+     * @return DashboardStatus
+     */
+    ELITE_EXPORT DashboardStatus getStatus();
+
+    /**
+     * @brief Set a robot state source, like RtsiDashboardStateSource. After commands such as powerOn(), brakeRelease(),
+     * playProgram() and setSpeedScaling() the client waits on the state source instead of polling the dashboard every 100ms.
+     * When the source is unavailable the dashboard is polled as before.
+     *
+     * @param source The state source, nullptr to poll the dashboard only
+     */
+    ELITE_EXPORT void setStateSource(std::shared_ptr<DashboardStateSource> source);
+
    private:
     class Impl;
     std::unique_ptr<Impl> impl_;
 
     std::string asyncReadLine(unsigned timeout_ms = 10000);
     void sendCommand(const std::string& cmd);
+    void readReplies(const std::shared_future<std::string>& reply);
 
-    std::string sendAndRequest(const std::string& cmd, const std::string& expected = "");
-    bool waitForReply(const std::string& cmd, const std::string& expected,
+    std::string sendAndRequest(const std::string& cmd);
+    std::string sendAndRequest(const std::string& cmd, const DashboardResponseMatcher& expected);
+    bool waitForReply(const std::string& cmd, const DashboardResponseMatcher& expected,
+                      const std::chrono::duration<double> timeout = std::chrono::seconds(30));
+    std::shared_ptr<DashboardStateSource> stateSource();
+    bool waitForState(const std::function<bool(const DashboardStatus&)>& predicate, const std::string& cmd,
+                      const DashboardResponseMatcher& expected,
                       const std::chrono::duration<double> timeout = std::chrono::seconds(30));
 };
 
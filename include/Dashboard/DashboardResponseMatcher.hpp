@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// DashboardResponseMatcher.hpp
+// Provides precompiled matchers and typed parsers for dashboard responses.
+#ifndef __ELITE__DASHBOARD_RESPONSE_MATCHER_HPP__
+#define __ELITE__DASHBOARD_RESPONSE_MATCHER_HPP__
+
+#include <Elite/DataType.hpp>
+
+#include <memory>
+#include <regex>
+#include <string>
+
+namespace ELITE {
+
+/**
+ * @brief A dashboard response matcher built once and reused for every response.
+ * Literal and prefix matchers compare characters directly, the regex matcher is the fallback for
+ * responses which can't be described by them.
+ *
+ */
+class DashboardResponseMatcher {
+   public:
+    enum class Kind {
+        // The response equals or contains the text
+        LITERAL,
+        // The text followed by the rest of the line, like the regex "text.*"
+        LINE_PREFIX,
+        REGEX
+    };
+
+    /**
+     * @brief Match a response which is (or contains) the text
+     *
+     * @param text The literal text, regex special characters have no meaning
+     */
+    static DashboardResponseMatcher literal(const std::string& text);
+
+    /**
+     * @brief Match the text and the rest of its line, the same as the regex "text.*"
+     *
+     * @param text The literal prefix
+     */
+    static DashboardResponseMatcher linePrefix(const std::string& text);
+
+    /**
+     * @brief Match with a regex, compiled once
+     *
+     * @param pattern ECMAScript regex
+     */
+    static DashboardResponseMatcher regex(const std::string& pattern);
+
+    /**
+     * @brief Search the response, the same as std::regex_search() of the equivalent regex
+     *
+     * @param response Dashboard response
+     * @param matched The matched text. Can be nullptr.
+     * @return true matched
+     * @return false not matched
+     */
+    bool search(const std::string& response, std::string* matched = nullptr) const;
+
+    /**
+     * @brief Match the whole response, the same as std::regex_match() of the equivalent regex
+     *
+     * @param response Dashboard response
+     * @return true matched
+     * @return false not matched
+     */
+    bool matchAll(const std::string& response) const;
+
+    /**
+     * @brief The text or regex pattern, for messages
+     */
+    const std::string& pattern() const { return pattern_; }
+
+    Kind kind() const { return kind_; }
+
+   private:
+    DashboardResponseMatcher(Kind kind, const std::string& pattern);
+
+    Kind kind_;
+    std::string pattern_;
+    std::shared_ptr<const std::regex> regex_;
+};
+
+/**
+ * @brief Parsers of the typed dashboard responses. The value is read from the text after ": " of the matched
+ * response line, without copying it.
+ *
+ */
+namespace DASHBOARD_RESPONSE {
+
+/**
+ * @brief Parse "robotMode: <mode>"
+ *
+ * @return RobotMode RobotMode::UNKNOWN if the mode is unknown
+ */
+RobotMode parseRobotMode(const std::string& response);
+
+/**
+ * @brief Parse "Safety status: <mode>"
+ *
+ * @return SafetyMode SafetyMode::UNKNOWN if the mode is unknown
+ */
+SafetyMode parseSafetyMode(const std::string& response);
+
+/**
+ * @brief Parse "Task is <status>" of the "task -s" command
+ *
+ * @return TaskStatus TaskStatus::STOPPED if the status is unknown
+ */
+TaskStatus parseTaskStatus(const std::string& response);
+
+/**
+ * @brief Parse "RunningStatus: <status>" of the "status" command
+ *
+ * @return TaskStatus TaskStatus::STOPPED if the status is unknown
+ */
+TaskStatus parseRunningStatus(const std::string& response);
+
+/**
+ * @brief Parse the leading integer after ": ", like "Target Speed Fraction: 80"
+ *
+ * @param response Dashboard response
+ * @param value Parsed value
+ * @return true success
+ * @return false no integer
+ */
+bool parseIntValue(const std::string& response, int& value);
+
+}  // namespace DASHBOARD_RESPONSE
+
+}  // namespace ELITE
+
+#endif
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// DashboardStateSource.hpp
+// Provides robot state streams that DashboardClient can wait on instead of polling the dashboard.
+#ifndef __ELITE__DASHBOARD_STATE_SOURCE_HPP__
+#define __ELITE__DASHBOARD_STATE_SOURCE_HPP__
+
+#include <Elite/DashboardClient.hpp>
+#include <Elite/DataType.hpp>
+#include <Elite/EliteOptions.hpp>
+#include <Elite/RtsiIOInterface.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace ELITE {
+
+/**
+ * @brief A source of the robot state which reports changes as soon as the controller sends them.
+ * DashboardClient waits on it after commands like powerOn() and playProgram().
+ *
+ */
+class DashboardStateSource {
+   public:
+    enum class WaitResult {
+        // The predicate is true
+        MATCHED,
+        TIMEOUT,
+        // The source can't provide the state now, DashboardClient polls the dashboard instead
+        UNAVAILABLE
+    };
+
+    DashboardStateSource() = default;
+    virtual ~DashboardStateSource() = default;
+
+    /**
+     * @brief Wait until the predicate is true for the newest state
+     *
+     * @param predicate Checks the state
+     * @param timeout Timeout
+     * @return WaitResult
+     */
+    virtual WaitResult waitUntil(const std::function<bool(const DashboardStatus&)>& predicate,
+                                 std::chrono::milliseconds timeout) = 0;
+};
+
+/**
+ * @brief The robot state from the RTSI output recipe.
+ * The output recipe must include "robot_mode", "safety_status", "runtime_state" and "target_speed_fraction",
+ * otherwise the source is unavailable.
+ *
+ */
+class RtsiDashboardStateSource : public DashboardStateSource {
+   public:
+    /**
+     * @brief Construct a new RTSI dashboard state source
+     *
+     * @param rtsi A RTSI IO interface, it should be connected before waiting
+     */
+    ELITE_EXPORT explicit RtsiDashboardStateSource(std::shared_ptr<RtsiIOInterface> rtsi);
+    ELITE_EXPORT virtual ~RtsiDashboardStateSource() = default;
+
+    ELITE_EXPORT WaitResult waitUntil(const std::function<bool(const DashboardStatus&)>& predicate,
+                                      std::chrono::milliseconds timeout) override;
+
+   private:
+    std::shared_ptr<RtsiIOInterface> rtsi_;
+
+    bool readState(DashboardStatus& state);
+};
+
+}  // namespace ELITE
+
+#endif
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// AsyncLogQueue.hpp
+// Provides the bounded lock-free multi-producer queue of log records used by the asynchronous logger.
+#ifndef __ELITE__ASYNC_LOG_QUEUE_HPP__
+#define __ELITE__ASYNC_LOG_QUEUE_HPP__
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "Log.hpp"
+
+namespace ELITE {
+
+/**
+ * @brief A log message. The message holds either the format string and the raw arguments (see LogFormat.hpp), or the
+ * formatted text truncated to fit the record.
+ *
+ */
+struct LogRecord {
+    static constexpr size_t MESSAGE_SIZE = 480;
+
+    std::chrono::system_clock::time_point time;
+    // Points to __FILE__, a string literal
+    const char* file;
+    int line;
+    LogLevel level;
+    // The message is formatted by the writer thread
+    bool deferred;
+    char message[MESSAGE_SIZE];
+};
+
+/**
+ * @brief Bounded multi-producer queue (Dmitry Vyukov's sequence-per-cell ring). Producers never block and never allocate:
+ * when the ring is full the push fails. The records are written in place, between reserve() and commit().
+ *
+ */
+class AsyncLogQueue {
+   private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    // Avoid false sharing between producers and the consumer
+    alignas(64) std::atomic<size_t> enqueue_pos_;
+    alignas(64) std::atomic<size_t> dequeue_pos_;
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+
+   public:
+    /**
+     * @brief A reserved cell, fill the record and commit it
+     *
+     */
+    struct Slot {
+        LogRecord* record = nullptr;
+        size_t pos = 0;
+    };
+
+    /**
+     * @brief Construct a new queue
+     *
+     * @param capacity Number of records, rounded up to a power of 2
+     */
+    explicit AsyncLogQueue(size_t capacity) : enqueue_pos_(0), dequeue_pos_(0) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        cells_.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        mask_ = size - 1;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+    /**
+     * @brief Reserve a cell for a new record
+     *
+     * @param slot The reserved cell
+     * @return true success
+     * @return false the queue is full
+     */
+    bool reserve(Slot& slot) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.record = &cell.record;
+                    slot.pos = pos;
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Publish a reserved record to the consumer
+     *
+     */
+    void commit(const Slot& slot) { cells_[slot.pos & mask_].sequence.store(slot.pos + 1, std::memory_order_release); }
+
+    /**
+     * @brief Consume the oldest record in place. Only one thread may consume.
+     *
+     * @param func Called with the record
+     * @return true a record was consumed
+     * @return false empty, or the oldest record is not committed yet
+     */
+    template <typename Func>
+    bool consume(Func&& func) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[pos & mask_];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+            return false;
+        }
+        func(static_cast<const LogRecord&>(cell.record));
+        dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+        cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+}  // namespace ELITE
+
+#endif
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// BinaryLog.hpp
+// Provides a log handler writing compact binary records to rotating memory-mapped files, and the reader of those files.
+#ifndef __ELITE__BINARY_LOG_HPP__
+#define __ELITE__BINARY_LOG_HPP__
+
+#include <Elite/EliteOptions.hpp>
+#include <Elite/Log.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ELITE {
+
+/**
+ * @brief A log handler that writes binary records to rotating memory-mapped files.
+ * @verbatim
+ *  The files are named "<path_prefix>.<YYYYmmdd-HHMMSS>.<index>.elog", with the time the handler was created and a
+ *  four digits index, so the names sort in the order the files were written. Each file starts with a 16 bytes header
+ *  ("ELITELOG", the format version), followed by records:
+ *   - Site record: the source file and line of a log statement, written once per file with a small id.
+ *   - Message record: the time (microseconds, delta of the previous record), the level, the site id, the thread id
+ *     (numbered by the handler) and the message.
+ *  The integers are LEB128 varints. A file is self-contained, the reader needs no other file.
+ *  Records are copied into the mapped file, there is no write() call per message. When a file is full it is cut to the
+ *  used size, and the next file is opened.
+ *  Use BinaryLogReader or the "binary_log_decoder" example to read the files.
+ * @endverbatim
+ *
+ */
+class BinaryLogHandler : public LogHandler {
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+
+   public:
+    /**
+     * @brief Construct a new Binary Log Handler object and open the first file
+     *
+     * @param path_prefix The path and the name of the files, without the index and the extension
+     * @param file_size Size of each file in bytes, at least 4 KiB
+     * @param max_files The number of files kept, the oldest file written by this handler is deleted when a new one is
+     * opened. 0 keeps all the files. The files of other handlers and of previous runs are not deleted.
+     * @throws EliteException FILE_OPEN_FAIL if the first file can not be created
+     */
+    ELITE_EXPORT explicit BinaryLogHandler(const std::string& path_prefix, size_t file_size = 16 * 1024 * 1024,
+                                           size_t max_files = 8);
+
+    /**
+     * @brief Cut the current file to the used size and close it
+     *
+     */
+    ELITE_EXPORT ~BinaryLogHandler();
+
+    /**
+     * @brief Write a message record
+     *
+     */
+    ELITE_EXPORT void log(const char* file, int line, LogLevel loglevel, const char* log) override;
+
+    /**
+     * @brief Ask the operating system to write the mapped file to disk
+     *
+     */
+    ELITE_EXPORT void flush();
+
+    /**
+     * @brief Get the path of the file being written
+     *
+     * @return std::string The path, empty if no file is open
+     */
+    ELITE_EXPORT std::string currentFile();
+
+    /**
+     * @brief Get the number of messages lost because a new file could not be opened
+     *
+     * @return uint64_t The number of lost messages
+     */
+    ELITE_EXPORT uint64_t lostCount();
+};
+
+/**
+ * @brief A message read from a binary log file
+ *
+ */
+struct BinaryLogEntry {
+    std::chrono::system_clock::time_point time;
+    LogLevel level;
+    std::string file;
+    int line;
+    // The thread number, in the order the threads first logged
+    uint32_t thread;
+    std::string message;
+};
+
+/**
+ * @brief Reads the files written by BinaryLogHandler
+ *
+ */
+class BinaryLogReader {
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+
+   public:
+    /**
+     * @brief Construct a new Binary Log Reader object and read the file
+     *
+     * @param path The path of the file
+     * @throws EliteException FILE_OPEN_FAIL if the file can not be read, or is not a binary log file
+     */
+    ELITE_EXPORT explicit BinaryLogReader(const std::string& path);
+
+    ELITE_EXPORT ~BinaryLogReader();
+
+    /**
+     * @brief Read the next message
+     *
+     * @param entry The message
+     * @return true success
+     * @return false the end of the file, or a broken record
+     */
+    ELITE_EXPORT bool next(BinaryLogEntry& entry);
+
+    /**
+     * @brief Whether the reading stopped at a broken record instead of the end of the data
+     *
+     * @return true a broken record was found
+     */
+    ELITE_EXPORT bool isBroken();
+};
+
+}  // namespace ELITE
+
+#endif
@@ -26,8 +26,8 @@ class ControllerLog {
      *      err: Error information (nullptr when there is no error)
      * @return true success
      * @return false fail
-     *      1. On Linux, if `libssh` is not installed, you need to ensure that the computer running the SDK has the `scp`, `ssh`,
-     * and `sshpass` commands available.
+     *      1. On Linux, if `libssh` is not installed, you need to ensure that the computer running the SDK has the `ssh` and
+     * `sshpass` commands available.
      *      2. In Windows, if libssh is not installed, then this interface will not be available.
      */
     ELITE_EXPORT static bool downloadSystemLog(const std::string &robot_ip, const std::string &password, const std::string &path,
@@ -7,61 +7,79 @@
 #define __ELITE__DEFATULT_LOG_HPP__
 
 #include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
-#include <iomanip>
 #include <iostream>
-#include <sstream>
-#include <string>
 #include "Log.hpp"
 
 namespace ELITE {
 
 class DefaultLogHandler : public LogHandler {
    private:
-    std::string getCurrentTimeStringMs() {
+    // "YYYY-mm-dd HH:MM:SS.mmm"
+    static void formatTime(std::chrono::system_clock::time_point time, char* out, size_t size) {
         using namespace std::chrono;
-        auto now = std::chrono::system_clock::now();
-        auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
-        std::time_t t = system_clock::to_time_t(now);
+        auto ms = duration_cast<milliseconds>(time.time_since_epoch()) % 1000;
+        std::time_t t = system_clock::to_time_t(time);
         std::tm tm;
 #ifdef _WIN32
         localtime_s(&tm, &t);
 #else
         localtime_r(&t, &tm);
 #endif
-        std::ostringstream oss;
-        oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S") << '.' << std::setw(3) << std::setfill('0') << ms.count();
-        return oss.str();
+        size_t n = std::strftime(out, size, "%Y-%m-%d %H:%M:%S", &tm);
+        std::snprintf(out + n, size - n, ".%03d", static_cast<int>(ms.count()));
     }
 
-   public:
-    DefaultLogHandler() = default;
-    ~DefaultLogHandler() = default;
-
-    void log(const char* file, int line, LogLevel level, const char* log) {
-        std::string time_str = getCurrentTimeStringMs();
+    static const char* levelString(LogLevel level) {
         switch (level) {
             case LogLevel::ELI_DEBUG:
-                std::cout << "[" << time_str << " DEBUG] " << file << ":" << line << ": " << log << std::endl;
-                break;
+                return "DEBUG";
             case LogLevel::ELI_INFO:
-                std::cout << "[" << time_str << " INFO ] " << file << ":" << line << ": " << log << std::endl;
-                break;
+                return "INFO ";
             case LogLevel::ELI_WARN:
-                std::cout << "[" << time_str << " WARN ] " << file << ":" << line << ": " << log << std::endl;
-                break;
+                return "WARN ";
             case LogLevel::ELI_ERROR:
-                std::cout << "[" << time_str << " ERROR] " << file << ":" << line << ": " << log << std::endl;
-                break;
+                return "ERROR";
             case LogLevel::ELI_FATAL:
-                std::cout << "[" << time_str << " FATAL] " << file << ":" << line << ": " << log << std::endl;
-                break;
+                return "FATAL";
             case LogLevel::ELI_NONE:
-                std::cout << "[" << time_str << " NONE ] " << file << ":" << line << ": " << log << std::endl;
-                break;
+                return "NONE ";
             default:
-                break;
+                return nullptr;
+        }
+    }
+
+   public:
+    DefaultLogHandler() = default;
+    ~DefaultLogHandler() = default;
+
+    void log(const char* file, int line, LogLevel level, const char* log) {
+        this->log(std::chrono::system_clock::now(), file, line, level, log);
+    }
+
+    /**
+     * @brief Log a message with the time it was logged, the asynchronous logger passes the time of the record
+     *
+     */
+    void log(std::chrono::system_clock::time_point time, const char* file, int line, LogLevel level, const char* log) {
+        const char* level_str = levelString(level);
+        if (!level_str) {
+            return;
+        }
+        char time_str[32];
+        formatTime(time, time_str, sizeof(time_str));
+        // Format the head once instead of streaming every field, the Logger serializes the calls
+        char head[256];
+        int head_len = std::snprintf(head, sizeof(head), "[%s %s] %s:%d: ", time_str, level_str, file, line);
+        if (head_len < 0) {
+            return;
         }
+        std::cout.write(head, head_len < static_cast<int>(sizeof(head)) ? head_len : sizeof(head) - 1);
+        std::cout.write(log, strlen(log));
+        std::cout.put('\n');
+        std::cout.flush();
     }
 };
 
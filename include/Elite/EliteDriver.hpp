@@ -69,6 +69,9 @@ class EliteDriverConfig {
     // Stable duration [S] required before locking hold position after extrapolation speed reaches zero.
     float servoj_hold_stable_time = 0.04;
 
+    // Reconnect policy of the primary port when the connection to the robot is lost.
+    PrimaryReconnectPolicy primary_reconnect_policy;
+
     EliteDriverConfig() = default;
     ~EliteDriverConfig() = default;
 };
@@ -379,8 +382,10 @@ class EliteDriver {
     /**
      * @brief Start tool RS485 communication.
      * This function will start a socat process on the robot control cabinet, mapping the serial port to the TCP port you specified.
-     * If you want to use this feature, it is recommended to install libssh. If you are using it on a non-Linux system, you must
-     * install the libssh library.
+     * When the external control script is running, the script starts socat and acknowledges when the port listens, and the
+     * returned object is connected already. A script that doesn't accept the command within 200 ms falls back to SSH.
+     * Otherwise socat is started by SSH: it is recommended to install libssh, and if you
+     * are using it on a non-Linux system, you must install the libssh library.
      *
      * @param config Serial configuration
      * @param ssh_password SSH password for robot control cabinet
@@ -392,8 +397,8 @@ class EliteDriver {
 
     /**
      * @brief End tool RS485 communication
-     * If you want to use this feature, it is recommended to install libssh. If you are using it on a non-Linux system, you must
-     * install the libssh library.
+     * When the external control script is running, the script stops socat. Otherwise socat is stopped by SSH: it is
+     * recommended to install libssh, and if you are using it on a non-Linux system, you must install the libssh library.
      *
      * @param com TCP communication object for RS485 communication.
      * @param ssh_password SSH password for robot control cabinet
@@ -405,8 +410,10 @@ class EliteDriver {
     /**
      * @brief Start board RS485 communication.
      * This function will start a socat process on the robot control cabinet, mapping the serial port to the TCP port you specified.
-     * If you want to use this feature, it is recommended to install libssh. If you are using it on a non-Linux system, you must
-     * install the libssh library.
+     * When the external control script is running, the script starts socat and acknowledges when the port listens, and the
+     * returned object is connected already. A script that doesn't accept the command within 200 ms falls back to SSH.
+     * Otherwise socat is started by SSH: it is recommended to install libssh, and if you
+     * are using it on a non-Linux system, you must install the libssh library.
      *
      * @param config Serial configuration
      * @param ssh_password SSH password for robot control cabinet
@@ -418,8 +425,8 @@ class EliteDriver {
 
     /**
      * @brief End board RS485 communication
-     * If you want to use this feature, it is recommended to install libssh. If you are using it on a non-Linux system, you must
-     * install the libssh library.
+     * When the external control script is running, the script stops socat. Otherwise socat is stopped by SSH: it is
+     * recommended to install libssh, and if you are using it on a non-Linux system, you must install the libssh library.
      *
      * @param com TCP communication object for RS485 communication.
      * @param ssh_password SSH password for robot control cabinet
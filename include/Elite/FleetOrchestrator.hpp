@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// FleetOrchestrator.hpp
+// Provides the FleetOrchestrator class for upgrading and collecting the logs of many robots in parallel.
+#ifndef __ELITE__FLEET_ORCHESTRATOR_HPP__
+#define __ELITE__FLEET_ORCHESTRATOR_HPP__
+
+#include <Elite/EliteOptions.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ELITE {
+
+/**
+ * @brief The stage of a robot in a fleet task
+ *
+ */
+enum class FleetStage {
+    // Logging in via SSH
+    CONNECT,
+    // Uploading the upgrade package
+    UPLOAD,
+    // Running the upgrade package
+    INSTALL,
+    // Downloading the system log
+    DOWNLOAD,
+    // Finished successfully
+    DONE,
+    // Failed, the error is given
+    FAILED
+};
+
+/**
+ * @brief The result of a robot in a fleet task
+ *
+ */
+struct FleetHostResult {
+    std::string ip;
+    bool success = false;
+    // Error information, empty on success
+    std::string error;
+    // Bytes uploaded or downloaded
+    uint64_t bytes = 0;
+    std::chrono::milliseconds duration{0};
+};
+
+/**
+ * @brief The results of a fleet task
+ *
+ */
+struct FleetSummary {
+    // The results, in the order of the ip list
+    std::vector<FleetHostResult> hosts;
+    size_t succeeded = 0;
+    size_t failed = 0;
+    // Bytes transferred by all the robots
+    uint64_t bytes = 0;
+    std::chrono::milliseconds elapsed{0};
+
+    /**
+     * @brief A text report: the totals, then a line per robot
+     *
+     */
+    ELITE_EXPORT std::string toString() const;
+};
+
+/**
+ * @brief Options of FleetOrchestrator
+ *
+ */
+struct FleetOptions {
+    // The number of robots handled at the same time
+    size_t max_workers = 8;
+    // Total bytes per second of all the transfers, 0 is no limit
+    uint64_t max_bytes_per_second = 0;
+};
+
+/**
+ * @brief Progress of a robot. It is called from the worker threads, one call at a time.
+ *      ip: The robot.
+ *      stage: The stage of the robot.
+ *      total: File size of the UPLOAD and DOWNLOAD stages, 0 otherwise.
+ *      done: Bytes transferred of the UPLOAD and DOWNLOAD stages, 0 otherwise.
+ *      err: Error information of the FAILED stage, nullptr otherwise.
+ */
+using FleetProgressCallback =
+    std::function<void(const std::string& ip, FleetStage stage, uint64_t total, uint64_t done, const char* err)>;
+
+/**
+ * @brief Upgrades the control software and downloads the system logs of many robots in parallel.
+ *      The robots are handled by a bounded pool of worker threads. Each robot uses its pooled SSH session, transfers are
+ * resumed when they are interrupted and checked with their SHA-256 (see ControllerLog and UPGRADE).
+ *      On Linux, if `libssh` is not installed, the `ssh` and `sshpass` commands are needed. On Windows, libssh is needed.
+ *
+ */
+class FleetOrchestrator {
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+
+   public:
+    ELITE_EXPORT explicit FleetOrchestrator(const FleetOptions& options = FleetOptions());
+    ELITE_EXPORT ~FleetOrchestrator();
+
+    /**
+     * @brief Set the progress callback
+     *
+     * @param cb The callback, nullptr for none
+     */
+    ELITE_EXPORT void setProgressCallback(FleetProgressCallback cb);
+
+    /**
+     * @brief Upgrade the control software of the robots, like UPGRADE::upgradeControlSoftware() for each robot.
+     *      The upgrade file is read from disk once, and the same data is uploaded to all the robots.
+     *
+     * @param ips Robot ip addresses
+     * @param file Upgrade file
+     * @param password Robot controller ssh password
+     * @return FleetSummary The results. If the file can't be read, every robot fails.
+     */
+    ELITE_EXPORT FleetSummary upgradeControlSoftware(const std::vector<std::string>& ips, const std::string& file,
+                                                     const std::string& password);
+
+    /**
+     * @brief Download the system logs of the robots, like ControllerLog::downloadSystemLog() for each robot.
+     *
+     * @param ips Robot ip addresses
+     * @param directory An existing directory, the log of a robot is saved as "<directory>/<ip>_log_history.csv"
+     * @param password Robot controller ssh password
+     * @return FleetSummary The results
+     */
+    ELITE_EXPORT FleetSummary downloadSystemLogs(const std::vector<std::string>& ips, const std::string& directory,
+                                                 const std::string& password);
+};
+
+}  // namespace ELITE
+
+#endif
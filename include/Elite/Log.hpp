@@ -7,17 +7,56 @@
 #define __ELITE__LOG_HPP__
 
 #include <Elite/EliteOptions.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 #ifndef __REL_FILE__
 #define __REL_FILE__ __FILE__
 #endif
 
-#define ELITE_LOG_DEBUG(...) ELITE::log(__REL_FILE__, __LINE__, ELITE::LogLevel::ELI_DEBUG, __VA_ARGS__)
-#define ELITE_LOG_WARN(...) ELITE::log(__REL_FILE__, __LINE__, ELITE::LogLevel::ELI_WARN, __VA_ARGS__)
-#define ELITE_LOG_INFO(...) ELITE::log(__REL_FILE__, __LINE__, ELITE::LogLevel::ELI_INFO, __VA_ARGS__)
-#define ELITE_LOG_ERROR(...) ELITE::log(__REL_FILE__, __LINE__, ELITE::LogLevel::ELI_ERROR, __VA_ARGS__)
-#define ELITE_LOG_FATAL(...) ELITE::log(__REL_FILE__, __LINE__, ELITE::LogLevel::ELI_FATAL, __VA_ARGS__)
+#ifndef ELITE_LOG_COMPILE_LEVEL
+#define ELITE_LOG_COMPILE_LEVEL 0
+#endif
+
+// The runtime level is checked before the arguments are evaluated
+#define ELITE_LOG_AT_LEVEL(level, ...)                                \
+    do {                                                              \
+        if ((level) >= ELITE::getLogLevel()) {                        \
+            ELITE::log(__REL_FILE__, __LINE__, (level), __VA_ARGS__); \
+        }                                                             \
+    } while (0)
+// A macro below ELITE_LOG_COMPILE_LEVEL is compiled out, its arguments are not evaluated
+#define ELITE_LOG_DISABLED(...) \
+    do {                        \
+    } while (0)
+
+#if ELITE_LOG_COMPILE_LEVEL <= 0
+#define ELITE_LOG_DEBUG(...) ELITE_LOG_AT_LEVEL(ELITE::LogLevel::ELI_DEBUG, __VA_ARGS__)
+#else
+#define ELITE_LOG_DEBUG(...) ELITE_LOG_DISABLED(__VA_ARGS__)
+#endif
+#if ELITE_LOG_COMPILE_LEVEL <= 1
+#define ELITE_LOG_INFO(...) ELITE_LOG_AT_LEVEL(ELITE::LogLevel::ELI_INFO, __VA_ARGS__)
+#else
+#define ELITE_LOG_INFO(...) ELITE_LOG_DISABLED(__VA_ARGS__)
+#endif
+#if ELITE_LOG_COMPILE_LEVEL <= 2
+#define ELITE_LOG_WARN(...) ELITE_LOG_AT_LEVEL(ELITE::LogLevel::ELI_WARN, __VA_ARGS__)
+#else
+#define ELITE_LOG_WARN(...) ELITE_LOG_DISABLED(__VA_ARGS__)
+#endif
+#if ELITE_LOG_COMPILE_LEVEL <= 3
+#define ELITE_LOG_ERROR(...) ELITE_LOG_AT_LEVEL(ELITE::LogLevel::ELI_ERROR, __VA_ARGS__)
+#else
+#define ELITE_LOG_ERROR(...) ELITE_LOG_DISABLED(__VA_ARGS__)
+#endif
+#if ELITE_LOG_COMPILE_LEVEL <= 4
+#define ELITE_LOG_FATAL(...) ELITE_LOG_AT_LEVEL(ELITE::LogLevel::ELI_FATAL, __VA_ARGS__)
+#else
+#define ELITE_LOG_FATAL(...) ELITE_LOG_DISABLED(__VA_ARGS__)
+#endif
 
 namespace ELITE {
 
@@ -80,6 +119,60 @@ ELITE_EXPORT void log(const char* file, int line, LogLevel level, const char* fm
  */
 ELITE_EXPORT void setLogLevel(LogLevel level);
 
+/**
+ * @brief Limit the messages of each log statement, such as a warning repeated on every reconnect attempt.
+ * @verbatim
+ *  A statement (its source file and line) logs at most `burst` messages in each interval, the others are dropped
+ *  before they are formatted. When the statement logs again in a later interval, a message with the number of
+ *  suppressed messages is logged first. The limit is approximate, the statements are hashed into a fixed table.
+ * @endverbatim
+ *
+ * @param burst The number of messages of one statement per interval, 0 disables the limit (default)
+ * @param interval The interval
+ */
+ELITE_EXPORT void setLogRateLimit(unsigned burst, std::chrono::milliseconds interval = std::chrono::milliseconds(1000));
+
+/**
+ * @brief Get the log level set by setLogLevel(). The ELITE_LOG_* macros check it before evaluating their arguments.
+ *
+ * @return LogLevel The log level
+ */
+ELITE_EXPORT LogLevel getLogLevel();
+
+/**
+ * @brief Enable or disable asynchronous logging.
+ * @verbatim
+ *  In asynchronous mode the ELITE_LOG_* macros copy the format string and the raw arguments into a bounded lock-free
+ *  queue and return, a background thread formats the message and calls the log handler. The logging thread never
+ *  blocks and never allocates: when the queue is full the message is dropped and counted, and the background thread
+ *  reports the number of dropped messages.
+ *  A message whose format string and arguments (including the copied strings) do not fit in 480 bytes is formatted
+ *  by the logging thread instead, and truncated to 479 characters.
+ *  Disabling writes the queued messages before returning.
+ * @endverbatim
+ *
+ * @param enable true enable, false disable
+ * @param queue_capacity The number of messages the queue holds, rounded up to a power of 2. Only used when asynchronous
+ * logging is enabled the first time.
+ */
+ELITE_EXPORT void setAsyncLogging(bool enable, size_t queue_capacity = 1024);
+
+/**
+ * @brief Wait for the background thread to handle the queued messages. Does nothing in synchronous mode.
+ *
+ * @param timeout Timeout
+ * @return true all the queued messages are handled
+ * @return false timeout
+ */
+ELITE_EXPORT bool flushLog(std::chrono::milliseconds timeout = std::chrono::milliseconds(1000));
+
+/**
+ * @brief Get the number of messages dropped because the asynchronous log queue was full
+ *
+ * @return uint64_t The number of dropped messages
+ */
+ELITE_EXPORT uint64_t getDroppedLogCount();
+
 }  // namespace ELITE
 
 #endif
\ No newline at end of file
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// LogFormat.hpp
+// Provides the deferred log record format: the format string and the raw arguments, formatted later by the log writer.
+#ifndef __ELITE__LOG_FORMAT_HPP__
+#define __ELITE__LOG_FORMAT_HPP__
+
+#include <cstdarg>
+#include <cstddef>
+#include <string>
+
+namespace ELITE {
+
+namespace LOG_FORMAT {
+
+/**
+ * @brief Copy a printf() format string and its arguments into a buffer without formatting them. The strings of the "%s"
+ * conversions are copied, the other arguments are stored by value.
+ *
+ * @param buffer The buffer
+ * @param size Size of the buffer
+ * @param fmt Format string
+ * @param args The arguments, consumed
+ * @return true success
+ * @return false the record does not fit, or the format uses a conversion that can not be deferred ("%n", wide
+ * characters, positional arguments). Format the message immediately.
+ */
+bool encode(char* buffer, size_t size, const char* fmt, va_list args);
+
+/**
+ * @brief Format a buffer written by encode()
+ *
+ * @param buffer The buffer
+ * @param out The formatted message
+ */
+void format(const char* buffer, std::string& out);
+
+}  // namespace LOG_FORMAT
+
+}  // namespace ELITE
+
+#endif
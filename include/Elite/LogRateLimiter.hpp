@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// LogRateLimiter.hpp
+// Provides the per log statement rate limiter of the logger.
+#ifndef __ELITE__LOG_RATE_LIMITER_HPP__
+#define __ELITE__LOG_RATE_LIMITER_HPP__
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ELITE {
+
+/**
+ * @brief Limits the messages of each log statement, identified by its file and line, to a burst per interval.
+ * The statements are hashed into a fixed table of atomic counters, no lock and no allocation on the logging path.
+ * The limit is approximate: two statements sharing a slot restart each other's window, and concurrent threads may
+ * let a few more messages through at a window boundary.
+ *
+ */
+class LogRateLimiter {
+   private:
+    static constexpr size_t SLOT_COUNT = 1024;
+
+    struct Slot {
+        std::atomic<uint64_t> key{0};
+        std::atomic<int64_t> window_start{0};
+        std::atomic<uint32_t> count{0};
+        std::atomic<uint32_t> suppressed{0};
+    };
+
+    std::atomic<uint32_t> burst_{0};
+    std::atomic<int64_t> interval_ns_{0};
+    std::unique_ptr<Slot[]> slots_;
+
+    static int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+   public:
+    LogRateLimiter() : slots_(new Slot[SLOT_COUNT]) {}
+
+    /**
+     * @brief Set the limit
+     *
+     * @param burst Messages of one statement per interval, 0 disables the limit
+     * @param interval The interval
+     */
+    void configure(uint32_t burst, std::chrono::nanoseconds interval) {
+        interval_ns_.store(interval.count(), std::memory_order_relaxed);
+        burst_.store(burst, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Count a message of a statement
+     *
+     * @param file The file of the statement
+     * @param line The line of the statement
+     * @param suppressed The number of messages suppressed in the previous interval of the statement, to be reported
+     * @return true log the message
+     * @return false drop the message
+     */
+    bool allow(const char* file, int line, uint32_t& suppressed) {
+        suppressed = 0;
+        uint32_t burst = burst_.load(std::memory_order_relaxed);
+        if (burst == 0) {
+            return true;
+        }
+        uint64_t key = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(file)) * 0x9E3779B97F4A7C15ULL) ^
+                       (static_cast<uint64_t>(line) * 0xC2B2AE3D27D4EB4FULL);
+        key |= 1;
+        Slot& slot = slots_[(key ^ (key >> 29)) & (SLOT_COUNT - 1)];
+        int64_t now = nowNs();
+        if (slot.key.load(std::memory_order_relaxed) != key) {
+            slot.key.store(key, std::memory_order_relaxed);
+            slot.window_start.store(now, std::memory_order_relaxed);
+            slot.count.store(0, std::memory_order_relaxed);
+            slot.suppressed.store(0, std::memory_order_relaxed);
+        }
+        int64_t start = slot.window_start.load(std::memory_order_relaxed);
+        if (now - start >= interval_ns_.load(std::memory_order_relaxed) &&
+            slot.window_start.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+            slot.count.store(0, std::memory_order_relaxed);
+            suppressed = slot.suppressed.exchange(0, std::memory_order_relaxed);
+        }
+        if (slot.count.fetch_add(1, std::memory_order_relaxed) < burst) {
+            return true;
+        }
+        slot.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+};
+
+}  // namespace ELITE
+
+#endif
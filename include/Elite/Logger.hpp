@@ -6,38 +6,85 @@
 #ifndef __ELITE__LOGGER_HPP__
 #define __ELITE__LOGGER_HPP__
 
+#include "AsyncLogQueue.hpp"
 #include "DefaultLogHandler.hpp"
+#include "LogRateLimiter.hpp"
 #include "Log.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <mutex>
+#include <string>
+#include <thread>
+
 namespace ELITE {
 
 class Logger {
    private:
-    LogLevel level_;
+    std::atomic<LogLevel> level_;
+    LogRateLimiter rate_limiter_;
+    // Guards the handler, the logging threads only take it in synchronous mode
+    std::mutex handler_mutex_;
     std::unique_ptr<LogHandler> handler_;
+    // Set when handler_ is the default handler, it can use the time of the record
+    DefaultLogHandler* default_handler_;
+
+    // Asynchronous mode. The queue is kept once created, a logging thread may still hold it.
+    std::atomic<bool> async_;
+    std::unique_ptr<AsyncLogQueue> queue_;
+    std::unique_ptr<std::thread> writer_thread_;
+    std::atomic<bool> writer_running_;
+    std::atomic<bool> writer_sleeping_;
+    // Serializes setAsync()
+    std::mutex writer_mutex_;
+    std::mutex sleep_mutex_;
+    std::condition_variable writer_cv_;
+    std::atomic<uint64_t> committed_;
+    std::atomic<uint64_t> handled_;
+    std::atomic<uint64_t> dropped_;
+    uint64_t reported_dropped_;
+    // The writer thread formats the deferred records here
+    std::string deferred_message_;
+
+    void handle(std::chrono::system_clock::time_point time, const char* file, int line, LogLevel level, const char* log);
+    void writerLoop();
+    void reportDropped();
 
    public:
-    Logger() {
-        level_ = LogLevel::ELI_INFO;
-        handler_.reset(new DefaultLogHandler);
-    };
+    Logger();
+    ~Logger();
+
+    void setLevel(LogLevel level) { level_.store(level, std::memory_order_relaxed); }
+
+    LogLevel getLogLevel() { return level_.load(std::memory_order_relaxed); }
+
+    LogRateLimiter& rateLimiter() { return rate_limiter_; }
+
+    void registerHandler(std::unique_ptr<LogHandler>& handler);
+
+    void unregisterHandler();
 
-    ~Logger() = default;
+    /**
+     * @brief Log a formatted message synchronously
+     *
+     */
+    void log(const char* file, int line, LogLevel level, const char* log);
 
-    void setLevel(LogLevel level) { level_ = level; }
+    /**
+     * @brief Format and log a message. In asynchronous mode the format string and the arguments are copied into the
+     * queue, the writer thread formats them.
+     *
+     */
+    void vlog(const char* file, int line, LogLevel level, const char* fmt, va_list args);
 
-    void registerHandler(std::unique_ptr<LogHandler>& handler) { handler_ = std::move(handler); }
+    void setAsync(bool enable, size_t queue_capacity);
 
-    void unregisterHandler() { handler_.reset(new DefaultLogHandler); }
+    bool isAsync() { return async_.load(std::memory_order_acquire); }
 
-    void log(const char* file, int line, LogLevel level, const char* log) {
-        if (!handler_) {
-            handler_.reset(new DefaultLogHandler());
-        }
-        handler_->log(file, line, level, log);
-    }
+    bool flush(std::chrono::milliseconds timeout);
 
-    LogLevel getLogLevel() { return level_; }
+    uint64_t getDroppedCount() { return dropped_.load(std::memory_order_relaxed); }
 };
 
 Logger& getLogger();
@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// ModbusRtuClient.hpp
+// Provides the ModbusRtuClient class, a Modbus RTU master over the RS485 serial communication of the robot.
+#ifndef __ELITE__MODBUS_RTU_CLIENT_HPP__
+#define __ELITE__MODBUS_RTU_CLIENT_HPP__
+
+#include <Elite/EliteOptions.hpp>
+#include <Elite/SerialCommunication.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ELITE {
+
+/**
+ * @brief Modbus function codes supported by ModbusRtuClient
+ *
+ */
+enum class ModbusFunction : uint8_t {
+    READ_COILS = 0x01,
+    READ_DISCRETE_INPUTS = 0x02,
+    READ_HOLDING_REGISTERS = 0x03,
+    READ_INPUT_REGISTERS = 0x04,
+    WRITE_SINGLE_COIL = 0x05,
+    WRITE_SINGLE_REGISTER = 0x06,
+    WRITE_MULTIPLE_COILS = 0x0F,
+    WRITE_MULTIPLE_REGISTERS = 0x10
+};
+
+/**
+ * @brief The data tables of a Modbus slave
+ *
+ */
+enum class ModbusTable : uint8_t { COIL, DISCRETE_INPUT, HOLDING_REGISTER, INPUT_REGISTER };
+
+/**
+ * @brief A Modbus request and its result
+ *
+ */
+struct ModbusRequest {
+    // Slave ID. 0 is a broadcast, for the write functions only, it has no response.
+    uint8_t slave = 1;
+    ModbusFunction function = ModbusFunction::READ_HOLDING_REGISTERS;
+    uint16_t address = 0;
+    // Number of registers or coils to read. The write functions use values.size().
+    uint16_t count = 0;
+    // Values to write. A coil is 0 or 1.
+    std::vector<uint16_t> values;
+
+    // Result: true if the slave answered the request
+    bool success = false;
+    // Result: the Modbus exception code of the slave, 0 if there is none
+    uint8_t exception = 0;
+    // Result: the values read. A coil or a discrete input is 0 or 1.
+    std::vector<uint16_t> result;
+};
+
+/**
+ * @brief Options of ModbusRtuClient
+ *
+ */
+struct ModbusRtuOptions {
+    // Baud rate of the serial port, gives the silent interval between frames (3.5 characters, 1.75 ms above 19200)
+    SerialConfig::BaudRate baud_rate = SerialConfig::BaudRate::BR_115200;
+    // Time to wait for a response
+    int response_timeout_ms = 500;
+    // Attempts after a timeout or a broken response. A request answered with an exception is not retried.
+    int retries = 1;
+    // Requests sent before their responses are read. Only the devices (or gateways) queueing the requests allow more than 1.
+    int pipeline_depth = 1;
+};
+
+/**
+ * @brief Called when a value of the register image changes, or is read for the first time.
+ *      slave: Slave ID.
+ *      table: The table of the value.
+ *      address: Address of the value.
+ *      value: The new value. A coil or a discrete input is 0 or 1.
+ */
+using ModbusChangeCallback = std::function<void(uint8_t slave, ModbusTable table, uint16_t address, uint16_t value)>;
+
+/**
+ * @brief Modbus RTU master over a SerialCommunication, e.g. from EliteDriver::startToolRs485().
+ * @verbatim
+ *  The frames are built with their CRC16, separated by the silent interval of the baud rate, and the responses are
+ *  checked (slave, function, length, CRC) and read with a timeout. After a broken response the stale bytes are discarded
+ *  and the request is retried.
+ *  The values read and written are kept in a register image. Polls read ranges of registers periodically on a background
+ *  thread, and the change callback is called with the values that changed.
+ *  The functions can be called from several threads, the requests are sent one group at a time.
+ * @endverbatim
+ *
+ */
+class ModbusRtuClient {
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+
+   public:
+    /**
+     * @brief Construct a new Modbus Rtu Client object
+     *
+     * @param serial A connected serial communication. The client reads all the data received by it.
+     * @param options Options
+     */
+    ELITE_EXPORT explicit ModbusRtuClient(SerialCommunicationSharedPtr serial, const ModbusRtuOptions& options = ModbusRtuOptions());
+
+    /**
+     * @brief Stop the polling. The serial communication is not disconnected.
+     *
+     */
+    ELITE_EXPORT ~ModbusRtuClient();
+
+    /**
+     * @brief The Modbus CRC16 of data (polynomial 0xA001, initial value 0xFFFF). It is sent low byte first.
+     *
+     */
+    ELITE_EXPORT static uint16_t crc16(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Send requests and wait for their responses. Up to `pipeline_depth` requests are sent before their responses
+     * are read, the responses are matched in order.
+     *
+     * @param requests The requests, their results are set
+     * @return true all the requests succeeded
+     * @return false a request failed, see its result
+     */
+    ELITE_EXPORT bool transact(std::vector<ModbusRequest>& requests);
+
+    /**
+     * @brief Read coils (function 0x01)
+     *
+     * @param slave Slave ID
+     * @param address Address of the first coil
+     * @param count Number of coils, 1 to 2000
+     * @param values The coils read
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool readCoils(uint8_t slave, uint16_t address, uint16_t count, std::vector<bool>& values);
+
+    /**
+     * @brief Read discrete inputs (function 0x02)
+     *
+     * @param slave Slave ID
+     * @param address Address of the first input
+     * @param count Number of inputs, 1 to 2000
+     * @param values The inputs read
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool readDiscreteInputs(uint8_t slave, uint16_t address, uint16_t count, std::vector<bool>& values);
+
+    /**
+     * @brief Read holding registers (function 0x03)
+     *
+     * @param slave Slave ID
+     * @param address Address of the first register
+     * @param count Number of registers, 1 to 125
+     * @param values The registers read
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool readHoldingRegisters(uint8_t slave, uint16_t address, uint16_t count, std::vector<uint16_t>& values);
+
+    /**
+     * @brief Read input registers (function 0x04)
+     *
+     * @param slave Slave ID
+     * @param address Address of the first register
+     * @param count Number of registers, 1 to 125
+     * @param values The registers read
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool readInputRegisters(uint8_t slave, uint16_t address, uint16_t count, std::vector<uint16_t>& values);
+
+    /**
+     * @brief Write a coil (function 0x05)
+     *
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool writeSingleCoil(uint8_t slave, uint16_t address, bool value);
+
+    /**
+     * @brief Write a holding register (function 0x06)
+     *
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool writeSingleRegister(uint8_t slave, uint16_t address, uint16_t value);
+
+    /**
+     * @brief Write coils (function 0x0F)
+     *
+     * @param slave Slave ID
+     * @param address Address of the first coil
+     * @param values The coils, 1 to 1968
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool writeMultipleCoils(uint8_t slave, uint16_t address, const std::vector<bool>& values);
+
+    /**
+     * @brief Write holding registers (function 0x10)
+     *
+     * @param slave Slave ID
+     * @param address Address of the first register
+     * @param values The registers, 1 to 123
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool writeMultipleRegisters(uint8_t slave, uint16_t address, const std::vector<uint16_t>& values);
+
+    /**
+     * @brief Get the exception code of the last failed request of the calling thread
+     *
+     * @return uint8_t The Modbus exception code, 0 if the slave did not answer with an exception
+     */
+    ELITE_EXPORT uint8_t getLastException() const;
+
+    /**
+     * @brief Read a range of a slave periodically on the polling thread. The due polls are sent together, as one
+     * transact() call.
+     *
+     * @param slave Slave ID
+     * @param table The table to read
+     * @param address Address of the first value
+     * @param count Number of values
+     * @param period_ms Period in milliseconds
+     * @return int The poll ID, -1 if the range is invalid
+     */
+    ELITE_EXPORT int addPoll(uint8_t slave, ModbusTable table, uint16_t address, uint16_t count, int period_ms);
+
+    /**
+     * @brief Remove a poll
+     *
+     * @param id The poll ID returned by addPoll()
+     */
+    ELITE_EXPORT void removePoll(int id);
+
+    /**
+     * @brief Start the polling thread
+     *
+     */
+    ELITE_EXPORT void startPolling();
+
+    /**
+     * @brief Stop the polling thread, after the requests being sent
+     *
+     */
+    ELITE_EXPORT void stopPolling();
+
+    /**
+     * @brief Get a value of the register image, as last read or written
+     *
+     * @param slave Slave ID
+     * @param table The table of the value
+     * @param address Address of the value
+     * @param value The value
+     * @return true the value is in the image
+     * @return false the value was never read or written
+     */
+    ELITE_EXPORT bool getCachedValue(uint8_t slave, ModbusTable table, uint16_t address, uint16_t& value);
+
+    /**
+     * @brief Set the change callback. It is called from the thread that read or wrote the value, without locks held.
+     *
+     * @param cb The callback, nullptr for none
+     */
+    ELITE_EXPORT void setChangeCallback(ModbusChangeCallback cb);
+};
+
+}  // namespace ELITE
+
+#endif
@@ -21,8 +21,8 @@ namespace UPGRADE {
  * @return true success
  * @return false fail
  * @note
- *      1. On Linux, if `libssh` is not installed, you need to ensure that the computer running the SDK has the `scp`, `ssh`, and
- * `sshpass` commands available.
+ *      1. On Linux, if `libssh` is not installed, you need to ensure that the computer running the SDK has the `ssh` and `sshpass`
+ * commands available.
  *      2. In Windows, if libssh is not installed, then this interface will not be available.
  */
 ELITE_EXPORT bool upgradeControlSoftware(std::string ip, std::string file, std::string password);
@@ -63,6 +63,7 @@ class SerialConfig {
  * @brief RS485 communication class.
  *
  * This class provides an interface for RS485 communication over TCP.
+ * After connect() a background thread keeps receiving into a buffer, the read functions take the data from the buffer.
  *
  */
 class SerialCommunication {
@@ -80,7 +81,7 @@ class SerialCommunication {
     ELITE_EXPORT virtual ~SerialCommunication() = default;
 
     /**
-     * @brief Connect to the RS485 TCP server.
+     * @brief Connect to the RS485 TCP server. If it is connected already, the connection is kept.
      *
      * @param timeout_ms Timeout in milliseconds.
      * @return true success
@@ -104,15 +105,56 @@ class SerialCommunication {
     ELITE_EXPORT virtual int write(const uint8_t* data, size_t size) = 0;
 
     /**
-     * @brief Read data from the RS485 TCP server.
+     * @brief Read data from the RS485 TCP server. Same as readExact().
      *
      * @param data data buffer
      * @param size data size
-     * @param timeout_ms timeout in milliseconds
-     * @return int success read size, -1 fail
+     * @param timeout_ms timeout in milliseconds, values <= 0 wait without timeout
+     * @return int success read size, 0 timeout, -1 fail
      */
     ELITE_EXPORT virtual int read(uint8_t* data, size_t size, int timeout_ms) = 0;
 
+    /**
+     * @brief Read the received data, waiting until at least one byte is received.
+     *
+     * @param data data buffer
+     * @param size data buffer size, the maximum read size
+     * @param timeout_ms timeout in milliseconds, values <= 0 wait without timeout
+     * @return int success read size, 0 timeout, -1 fail or disconnected
+     */
+    ELITE_EXPORT virtual int readSome(uint8_t* data, size_t size, int timeout_ms) = 0;
+
+    /**
+     * @brief Read up to and including a delimiter.
+     *
+     * @param data data buffer
+     * @param size data buffer size
+     * @param delimiter delimiter bytes, not empty (e.g. "\r\n")
+     * @param timeout_ms timeout in milliseconds, values <= 0 wait without timeout
+     * @return int success read size (including the delimiter), 0 timeout, -1 fail, disconnected or the delimiter is not
+     * in the first `size` bytes, -2 the receive buffer is full without a delimiter. On timeout and -1 no data is consumed.
+     * On -2 the buffered bytes are dropped (except a possible partial delimiter at the end), so the next call resynchronises.
+     */
+    ELITE_EXPORT virtual int readUntil(uint8_t* data, size_t size, const std::string& delimiter, int timeout_ms) = 0;
+
+    /**
+     * @brief Read exactly `size` bytes.
+     *
+     * @param data data buffer
+     * @param size data size
+     * @param timeout_ms timeout in milliseconds, values <= 0 wait without timeout
+     * @return int `size` success, 0 timeout, -1 fail or disconnected. On timeout no data is consumed, the bytes received
+     * so far are kept for the next read.
+     */
+    ELITE_EXPORT virtual int readExact(uint8_t* data, size_t size, int timeout_ms) = 0;
+
+    /**
+     * @brief Get the number of received bytes that have not been read
+     *
+     * @return size_t The number of bytes
+     */
+    ELITE_EXPORT virtual size_t available() = 0;
+
     /**
      * @brief Check if connected to the RS485 TCP server.
      *
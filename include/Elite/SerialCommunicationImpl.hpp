@@ -9,7 +9,13 @@
 
 #include <Elite/SerialCommunication.hpp>
 #include <boost/asio.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <thread>
+
+#include "Common/ByteRingBuffer.hpp"
 
 namespace ELITE {
 
@@ -24,11 +30,28 @@ class SerialCommunicationImpl : public SerialCommunication {
     int tcp_port_;
     int socat_pid_;
     std::string robot_ip_;
+    // Serializes connect, disconnect and write
     std::mutex socket_mutex_;
     boost::asio::io_context io_context_;
     boost::asio::ip::tcp::socket socket_;
-    
+    // Runs io_context_ while connected, all the socket operations run on this thread
+    std::thread io_thread_;
+    std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> work_guard_;
+
+    // Received data. One read is always pending while the buffer has space.
+    std::mutex buffer_mutex_;
+    std::condition_variable buffer_cv_;
+    ByteRingBuffer buffer_;
+    bool receiving_ = false;
+    bool read_paused_ = false;
+
     void socketDisconnect();
+    void startRead();
+    void resumeRead();
+    // Wait until pred() or the end of the receiving, the buffer lock is held. Return false on timeout.
+    template <typename Pred>
+    bool waitData(std::unique_lock<std::mutex>& lock, int timeout_ms, Pred pred);
+
    public:
     /**
      * @brief Construct a new Serial Communication object
@@ -72,10 +95,18 @@ class SerialCommunicationImpl : public SerialCommunication {
      * @param data data buffer
      * @param size data size
      * @param timeout_ms timeout in milliseconds
-     * @return int success read size, -1 fail
+     * @return int success read size, 0 timeout, -1 fail
      */
     virtual int read(uint8_t* data, size_t size, int timeout_ms);
 
+    virtual int readSome(uint8_t* data, size_t size, int timeout_ms);
+
+    virtual int readUntil(uint8_t* data, size_t size, const std::string& delimiter, int timeout_ms);
+
+    virtual int readExact(uint8_t* data, size_t size, int timeout_ms);
+
+    virtual size_t available();
+
     /**
      * @brief Check if connected to the RS485 TCP server.
      *
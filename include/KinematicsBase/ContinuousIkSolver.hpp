@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// ContinuousIkSolver.hpp
+// Provides the ContinuousIkSolver class, IK of a stream of close poses warm started from the previous solutions.
+#ifndef __ELITE__CONTINUOUS_IK_SOLVER_HPP__
+#define __ELITE__CONTINUOUS_IK_SOLVER_HPP__
+
+#include <Elite/DataType.hpp>
+#include <Elite/EliteOptions.hpp>
+#include <Elite/IkSolutionCache.hpp>
+#include <Elite/JacobianAlgebra.hpp>
+#include <Elite/KinematicsBase.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace ELITE {
+
+/**
+ * @brief Options of ContinuousIkSolver
+ *
+ */
+struct ContinuousIkOptions {
+    // Newton iterations per call of solve(), shared by its attempts (cached seed, then the seed given). It bounds the time
+    // of a solve() that does not fall back to the full IK.
+    int max_iterations = 6;
+    // Convergence tolerance of the position, in meters
+    double position_tolerance = 1e-7;
+    // Convergence tolerance of the orientation, in radians
+    double orientation_tolerance = 1e-7;
+    // Damping of the Newton steps
+    double damping = KinematicsBase::DEFAULT_DAMPING;
+    // The Jacobian factorization is kept while the joints stay this close to where it was computed, in radians
+    double jacobian_refresh = 0.02;
+    // A warm solution moving a joint farther than this from the previous solution is rejected, in radians. It keeps
+    // the solver on the branch of the previous solution.
+    double max_joint_step = 0.5;
+    // Solve with KinematicsBase::getPositionIK() when the warm start fails. The full IK has no time bound, so it is off
+    // by default: the time of solve() is bounded by max_iterations, and solve() fails instead.
+    bool allow_fallback = false;
+    // Slots of the solution cache, 0 disables the cache
+    size_t cache_capacity = 4096;
+    // Edge of a position voxel of the cache, in meters
+    double cache_position_resolution = 0.001;
+    // Size of an orientation bin of the cache, in radians
+    double cache_orientation_resolution = 0.01;
+};
+
+/**
+ * @brief Counters of ContinuousIkSolver
+ *
+ */
+struct ContinuousIkStats {
+    // Calls of solve()
+    uint64_t calls = 0;
+    // Solved by iterating from the predicted joints
+    uint64_t warm_solutions = 0;
+    // Solved by iterating from a solution of the cache
+    uint64_t cache_solutions = 0;
+    // Solved by iterating from near, on a cold start
+    uint64_t cold_solutions = 0;
+    // Solved by KinematicsBase::getPositionIK()
+    uint64_t fallbacks = 0;
+    // Not solved
+    uint64_t failures = 0;
+    // Newton iterations
+    uint64_t iterations = 0;
+    // Jacobian factorizations
+    uint64_t factorizations = 0;
+    // Lookups of the cache that found a solution
+    uint64_t cache_hits = 0;
+    // Lookups of the cache that found nothing
+    uint64_t cache_misses = 0;
+
+    /**
+     * @brief Cache hits over cache lookups, 0 before the first lookup
+     *
+     */
+    double cacheHitRate() const {
+        const uint64_t lookups = cache_hits + cache_misses;
+        return lookups ? static_cast<double>(cache_hits) / lookups : 0.0;
+    }
+
+    /**
+     * @brief Calls solved from the predicted joints or the cache over all the calls. Cold starts solved from near
+     * are not counted.
+     *
+     */
+    double warmRate() const { return calls ? static_cast<double>(warm_solutions + cache_solutions) / calls : 0.0; }
+};
+
+/**
+ * @brief IK of a stream of close poses, e.g. the Cartesian targets of a servo loop converted for writeServoj().
+ * @verbatim
+ *  A call predicts the joints from the two previous solutions (constant joint velocity) and refines them with Newton
+ *  steps on the Jacobian of the solver. The damped least squares factorization of the Jacobian is kept between the
+ *  steps and the calls while the joints stay within jacobian_refresh of it, so a step usually costs one FK.
+ *  A call without a previous solution (the first one, or after reset()) looks for the pose in a cache of the recent
+ *  solutions, so a target visited before, e.g. the pick and place poses of a cycle, is solved as it was the previous
+ *  time. When the warm start does not converge in max_iterations steps, the call fails, unless allow_fallback is set:
+ *  then it falls back to the full IK of the solver, seeded with the prediction.
+ *  A solver keeps the state of one stream and is not thread safe. Call reset() when the stream is interrupted or after
+ *  KinematicsBase::setMDH().
+ * @endverbatim
+ *
+ */
+class ContinuousIkSolver {
+   public:
+    /**
+     * @brief Construct the solver
+     *
+     * @param kinematics The kinematics solver, with its MDH set
+     * @param options The options
+     */
+    ELITE_EXPORT explicit ContinuousIkSolver(KinematicsBaseSharedPtr kinematics,
+                                             const ContinuousIkOptions& options = ContinuousIkOptions());
+
+    /**
+     * @brief Compute the joints of the next pose of the stream
+     *
+     * @param pose The pose [x, y, z, roll, pitch, yaw]
+     * @param near The seed when there is no previous solution, e.g. the current joints of the robot
+     * @param solution The solution
+     * @param result The result of the query
+     * @return true solved
+     * @return false not solved, the state of the stream is kept
+     */
+    ELITE_EXPORT bool solve(const vector6d_t& pose, const vector6d_t& near, vector6d_t& solution, KinematicsResult& result);
+
+    /**
+     * @brief Forget the previous solutions, the next call is a cold start. The cache is kept.
+     *
+     */
+    ELITE_EXPORT void reset();
+
+    /**
+     * @brief Restart the stream at known joints, e.g. the current joints of the robot. The joint velocity is zero.
+     *
+     * @param joints The joints
+     */
+    ELITE_EXPORT void reset(const vector6d_t& joints);
+
+    /**
+     * @brief Remove the solutions of the cache
+     *
+     */
+    ELITE_EXPORT void clearCache();
+
+    ELITE_EXPORT const ContinuousIkStats& getStats() const { return stats_; }
+
+    ELITE_EXPORT void resetStats() { stats_ = ContinuousIkStats(); }
+
+   private:
+    KinematicsBaseSharedPtr kinematics_;
+    ContinuousIkOptions options_;
+    std::unique_ptr<IkSolutionCache> cache_;
+    ContinuousIkStats stats_;
+
+    // The last two solutions
+    vector6d_t previous_{};
+    vector6d_t before_previous_{};
+    int history_ = 0;
+
+    // The kept factorization and where it was computed
+    matrix6d_t jacobian_{};
+    matrix6d_t factor_{};
+    vector6d_t factored_joints_{};
+    bool factored_ = false;
+
+    bool refactor(const vector6d_t& joints);
+
+    // Newton steps from the seed, each one takes one from the budget
+    bool iterate(const vector6d_t& seed, const vector6d_t& pose, vector6d_t& joints, int& budget);
+
+    void accept(const vector6d_t& pose, const vector6d_t& solution);
+};
+
+}  // namespace ELITE
+
+#endif  // __ELITE__CONTINUOUS_IK_SOLVER_HPP__
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// IkSolutionCache.hpp
+// Provides the IkSolutionCache class, a hashed voxel and orientation grid of recent pose to joint solutions.
+#ifndef __ELITE__IK_SOLUTION_CACHE_HPP__
+#define __ELITE__IK_SOLUTION_CACHE_HPP__
+
+#include <Elite/DataType.hpp>
+#include <Elite/EliteOptions.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ELITE {
+
+/**
+ * @brief A cache of IK solutions keyed by the cell of the pose in a grid of position voxels and orientation bins.
+ * @verbatim
+ *  The table has a fixed number of slots, allocated by the constructor, and a cell maps to one slot: an insert replaces
+ *  the solution of the slot, a lookup compares one key. Both run in constant time without allocation.
+ *  A hit gives the solution of a pose in the same cell, within about the resolution of the looked up pose, so it is a
+ *  seed to refine rather than a solution. Two poses close to each other but on both sides of a cell border miss.
+ *  The object is not thread safe.
+ * @endverbatim
+ *
+ */
+class IkSolutionCache {
+   public:
+    /**
+     * @brief Construct the cache
+     *
+     * @param capacity Number of slots, rounded up to a power of two
+     * @param position_resolution Edge of a position voxel, in meters
+     * @param orientation_resolution Size of an orientation bin, in radians
+     */
+    ELITE_EXPORT explicit IkSolutionCache(size_t capacity = 4096, double position_resolution = 0.001,
+                                          double orientation_resolution = 0.01);
+
+    /**
+     * @brief Find the solution of the cell of a pose
+     *
+     * @param pose The pose [x, y, z, roll, pitch, yaw]
+     * @param joints The solution stored for the cell
+     * @return true hit
+     * @return false miss
+     */
+    ELITE_EXPORT bool lookup(const vector6d_t& pose, vector6d_t& joints);
+
+    /**
+     * @brief Store the solution of a pose, it replaces the solution of the slot of the cell
+     *
+     * @param pose The pose [x, y, z, roll, pitch, yaw]
+     * @param joints The solution
+     */
+    ELITE_EXPORT void insert(const vector6d_t& pose, const vector6d_t& joints);
+
+    /**
+     * @brief Remove all the solutions and reset the counters
+     *
+     */
+    ELITE_EXPORT void clear();
+
+    ELITE_EXPORT uint64_t hits() const { return hits_; }
+    ELITE_EXPORT uint64_t misses() const { return misses_; }
+
+    /**
+     * @brief Hits over lookups, 0 before the first lookup
+     *
+     */
+    ELITE_EXPORT double hitRate() const {
+        const uint64_t lookups = hits_ + misses_;
+        return lookups ? static_cast<double>(hits_) / lookups : 0.0;
+    }
+
+    ELITE_EXPORT size_t size() const { return size_; }
+    ELITE_EXPORT size_t capacity() const { return slots_.size(); }
+
+   private:
+    struct Slot {
+        uint64_t key = 0;
+        bool used = false;
+        vector6d_t joints{};
+    };
+
+    std::vector<Slot> slots_;
+    double position_resolution_;
+    double quaternion_resolution_;
+    size_t size_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+
+    uint64_t cellKey(const vector6d_t& pose) const;
+};
+
+}  // namespace ELITE
+
+#endif  // __ELITE__IK_SOLUTION_CACHE_HPP__
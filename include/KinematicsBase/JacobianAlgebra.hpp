@@ -0,0 +1,275 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// JacobianAlgebra.hpp
+// Provides the fixed-size linear algebra of a 6x6 Jacobian: twist, damped least squares, manipulability, condition number.
+#ifndef __ELITE__JACOBIAN_ALGEBRA_HPP__
+#define __ELITE__JACOBIAN_ALGEBRA_HPP__
+
+#include <Elite/DataType.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace ELITE {
+
+/**
+ * @brief A 6x6 matrix, [row][column]. A Jacobian has the rows vx, vy, vz, wx, wy, wz and a column per joint.
+ *
+ */
+using matrix6d_t = std::array<vector6d_t, 6>;
+
+/**
+ * @brief Linear algebra of a 6x6 Jacobian. Fixed-size, no allocation, a bounded number of operations.
+ *
+ */
+class JacobianAlgebra {
+   public:
+    // Sweeps of the Jacobi eigenvalue iteration, it converges in 5 to 8 for a 6x6 matrix
+    static constexpr int MAX_JACOBI_SWEEPS = 12;
+
+    /**
+     * @brief twist = J * qd
+     *
+     */
+    static void twist(const matrix6d_t& jacobian, const vector6d_t& qd, vector6d_t& twist) {
+        for (size_t i = 0; i < 6; i++) {
+            double sum = 0;
+            for (size_t j = 0; j < 6; j++) {
+                sum += jacobian[i][j] * qd[j];
+            }
+            twist[i] = sum;
+        }
+    }
+
+    /**
+     * @brief J * J^T
+     *
+     */
+    static matrix6d_t gram(const matrix6d_t& jacobian) {
+        matrix6d_t out;
+        for (size_t i = 0; i < 6; i++) {
+            for (size_t j = i; j < 6; j++) {
+                double sum = 0;
+                for (size_t k = 0; k < 6; k++) {
+                    sum += jacobian[i][k] * jacobian[j][k];
+                }
+                out[i][j] = out[j][i] = sum;
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief Damped least squares joint velocity: qd = J^T * (J * J^T + damping^2 * I)^-1 * twist
+     *
+     * @param jacobian The Jacobian
+     * @param twist The desired twist
+     * @param damping The damping, 0 for the exact inverse. It bounds the joint velocity near a singularity.
+     * @param qd The joint velocity
+     * @return true success
+     * @return false the matrix is singular, only possible without damping
+     */
+    static bool dampedLeastSquares(const matrix6d_t& jacobian, const vector6d_t& twist, double damping, vector6d_t& qd) {
+        matrix6d_t factor;
+        if (!dampedFactor(jacobian, damping, factor)) {
+            return false;
+        }
+        dampedLeastSquares(jacobian, factor, twist, qd);
+        return true;
+    }
+
+    /**
+     * @brief Solve a * x = b for a symmetric positive definite a
+     *
+     * @return false a is not positive definite
+     */
+    static bool choleskySolve(matrix6d_t a, const vector6d_t& b, vector6d_t& x) {
+        if (!choleskyFactor(a)) {
+            return false;
+        }
+        choleskySubstitute(a, b, x);
+        return true;
+    }
+
+    /**
+     * @brief Factor a symmetric positive definite a = L * L^T in place, L is stored in the lower triangle of a. The factor
+     * can be kept to solve for several right-hand sides with choleskySubstitute().
+     *
+     * @return false a is not positive definite
+     */
+    static bool choleskyFactor(matrix6d_t& a) {
+        for (size_t j = 0; j < 6; j++) {
+            double diagonal = a[j][j];
+            for (size_t k = 0; k < j; k++) {
+                diagonal -= a[j][k] * a[j][k];
+            }
+            if (!(diagonal > std::numeric_limits<double>::min())) {
+                return false;
+            }
+            a[j][j] = std::sqrt(diagonal);
+            for (size_t i = j + 1; i < 6; i++) {
+                double sum = a[i][j];
+                for (size_t k = 0; k < j; k++) {
+                    sum -= a[i][k] * a[j][k];
+                }
+                a[i][j] = sum / a[j][j];
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Solve L * L^T * x = b with the factor of choleskyFactor()
+     *
+     */
+    static void choleskySubstitute(const matrix6d_t& l, const vector6d_t& b, vector6d_t& x) {
+        vector6d_t y;
+        for (size_t i = 0; i < 6; i++) {
+            double sum = b[i];
+            for (size_t k = 0; k < i; k++) {
+                sum -= l[i][k] * y[k];
+            }
+            y[i] = sum / l[i][i];
+        }
+        for (size_t n = 6; n-- > 0;) {
+            double sum = y[n];
+            for (size_t k = n + 1; k < 6; k++) {
+                sum -= l[k][n] * x[k];
+            }
+            x[n] = sum / l[n][n];
+        }
+    }
+
+    /**
+     * @brief Damped least squares with a kept factor: qd = J^T * (L * L^T)^-1 * twist, L the factor of
+     * J * J^T + damping^2 * I by dampedFactor()
+     *
+     */
+    static void dampedLeastSquares(const matrix6d_t& jacobian, const matrix6d_t& factor, const vector6d_t& twist,
+                                   vector6d_t& qd) {
+        vector6d_t y;
+        choleskySubstitute(factor, twist, y);
+        for (size_t j = 0; j < 6; j++) {
+            double sum = 0;
+            for (size_t i = 0; i < 6; i++) {
+                sum += jacobian[i][j] * y[i];
+            }
+            qd[j] = sum;
+        }
+    }
+
+    /**
+     * @brief The Cholesky factor of J * J^T + damping^2 * I, for dampedLeastSquares() with a kept factor
+     *
+     * @return false the matrix is singular, only possible without damping
+     */
+    static bool dampedFactor(const matrix6d_t& jacobian, double damping, matrix6d_t& factor) {
+        factor = gram(jacobian);
+        for (size_t i = 0; i < 6; i++) {
+            factor[i][i] += damping * damping;
+        }
+        return choleskyFactor(factor);
+    }
+
+    /**
+     * @brief The singular values of the Jacobian, in descending order
+     *
+     */
+    static void singularValues(const matrix6d_t& jacobian, vector6d_t& sigma) {
+        // Eigenvalues of J * J^T by cyclic Jacobi rotations
+        matrix6d_t a = gram(jacobian);
+        for (int sweep = 0; sweep < MAX_JACOBI_SWEEPS; sweep++) {
+            double off = 0;
+            double scale = 0;
+            for (size_t i = 0; i < 6; i++) {
+                scale += a[i][i] * a[i][i];
+                for (size_t j = i + 1; j < 6; j++) {
+                    off += a[i][j] * a[i][j];
+                }
+            }
+            if (off <= 1e-30 * scale) {
+                break;
+            }
+            for (size_t p = 0; p < 5; p++) {
+                for (size_t q = p + 1; q < 6; q++) {
+                    if (a[p][q] == 0) {
+                        continue;
+                    }
+                    const double theta = (a[q][q] - a[p][p]) / (2 * a[p][q]);
+                    const double t = (theta >= 0 ? 1.0 : -1.0) / (std::fabs(theta) + std::sqrt(theta * theta + 1));
+                    const double c = 1 / std::sqrt(t * t + 1);
+                    const double s = t * c;
+                    for (size_t k = 0; k < 6; k++) {
+                        const double akp = a[k][p];
+                        const double akq = a[k][q];
+                        a[k][p] = c * akp - s * akq;
+                        a[k][q] = s * akp + c * akq;
+                    }
+                    for (size_t k = 0; k < 6; k++) {
+                        const double apk = a[p][k];
+                        const double aqk = a[q][k];
+                        a[p][k] = c * apk - s * aqk;
+                        a[q][k] = s * apk + c * aqk;
+                    }
+                }
+            }
+        }
+        for (size_t i = 0; i < 6; i++) {
+            sigma[i] = std::sqrt(std::max(0.0, a[i][i]));
+        }
+        std::sort(sigma.begin(), sigma.end(), [](double l, double r) { return l > r; });
+    }
+
+    /**
+     * @brief Yoshikawa manipulability sqrt(det(J * J^T)), 0 at a singularity
+     *
+     */
+    static double manipulability(const matrix6d_t& jacobian) {
+        // det(J * J^T) = det(J)^2 for a square J
+        matrix6d_t a = jacobian;
+        double det = 1;
+        for (size_t col = 0; col < 6; col++) {
+            size_t pivot = col;
+            for (size_t row = col + 1; row < 6; row++) {
+                if (std::fabs(a[row][col]) > std::fabs(a[pivot][col])) {
+                    pivot = row;
+                }
+            }
+            if (a[pivot][col] == 0) {
+                return 0;
+            }
+            if (pivot != col) {
+                std::swap(a[pivot], a[col]);
+                det = -det;
+            }
+            det *= a[col][col];
+            for (size_t row = col + 1; row < 6; row++) {
+                const double f = a[row][col] / a[col][col];
+                for (size_t k = col; k < 6; k++) {
+                    a[row][k] -= f * a[col][k];
+                }
+            }
+        }
+        return std::fabs(det);
+    }
+
+    /**
+     * @brief The condition number, largest over smallest singular value. Infinity at a singularity.
+     *
+     */
+    static double conditionNumber(const matrix6d_t& jacobian) {
+        vector6d_t sigma;
+        singularValues(jacobian, sigma);
+        if (sigma[5] <= sigma[0] * std::numeric_limits<double>::epsilon()) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return sigma[0] / sigma[5];
+    }
+};
+
+}  // namespace ELITE
+
+#endif  // __ELITE__JACOBIAN_ALGEBRA_HPP__
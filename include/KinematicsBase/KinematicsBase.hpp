@@ -8,6 +8,9 @@
 
 #include <Elite/DataType.hpp>
 #include <Elite/EliteOptions.hpp>
+#include <Elite/JacobianAlgebra.hpp>
+#include <Elite/MdhKinematics.hpp>
+#include <cstddef>
 #include <vector>
 #include <memory>
 
@@ -43,6 +46,9 @@ class KinematicsBase {
    public:
     static constexpr double DEFAULT_TIMEOUT = 1.0; // seconds
 
+    // Damping of getJointVelocity(), the twist error is below 1e-4 along the directions with a singular value of 0.1 or more
+    static constexpr double DEFAULT_DAMPING = 1e-3;
+
     KinematicsBase() : default_timeout_(DEFAULT_TIMEOUT) {}
 
     virtual ~KinematicsBase() = default;
@@ -93,6 +99,137 @@ class KinematicsBase {
     ELITE_EXPORT virtual bool getPositionIK(const vector6d_t& pose, const vector6d_t& near, std::vector<vector6d_t>& solutions,
                                KinematicsResult& result) const = 0;
 
+    // Virtual functions added later are declared after the ones above, so the vtable slots of plugins built against an
+    // older header don't move.
+
+    /**
+     * @brief Compute the poses of many joint configurations. The default implementation calls getPositionFK() for each of
+     * them, plugins override it with a batch kernel (see MdhKinematics).
+     *
+     * @param q The joint angles of the configurations
+     * @param poses The resultant poses, poses[i] is the pose of q[i]
+     * @param n The number of configurations
+     * @return True if all the poses were computed, false otherwise
+     */
+    ELITE_EXPORT virtual bool getPositionFKBatch(const vector6d_t* q, vector6d_t* poses, size_t n) const {
+        for (size_t i = 0; i < n; i++) {
+            if (!getPositionFK(q[i], poses[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compute the geometric Jacobian in the base frame. The rows are the linear velocity of the flange origin and
+     * the angular velocity of the flange, a column per joint. The default implementation differentiates getPositionFK()
+     * numerically, plugins override it with the closed form (see MdhKinematics::jacobian()).
+     *
+     * @param joint_angles The joint angles
+     * @param jacobian The resultant Jacobian
+     * @return True if the Jacobian was computed, false otherwise
+     */
+    ELITE_EXPORT virtual bool getJacobian(const vector6d_t& joint_angles, matrix6d_t& jacobian) const {
+        const double step = 1e-6;
+        for (size_t j = 0; j < 6; j++) {
+            vector6d_t q = joint_angles;
+            vector6d_t forward, backward;
+            q[j] = joint_angles[j] + step;
+            if (!getPositionFK(q, forward)) {
+                return false;
+            }
+            q[j] = joint_angles[j] - step;
+            if (!getPositionFK(q, backward)) {
+                return false;
+            }
+            double rf[9], rb[9];
+            MdhKinematics::rpyToRotation(forward[3], forward[4], forward[5], rf);
+            MdhKinematics::rpyToRotation(backward[3], backward[4], backward[5], rb);
+            // Rf * Rb^T = I + [w * 2 * step]x
+            double m[9];
+            for (size_t r = 0; r < 3; r++) {
+                for (size_t c = 0; c < 3; c++) {
+                    m[r * 3 + c] = rf[r * 3] * rb[c * 3] + rf[r * 3 + 1] * rb[c * 3 + 1] + rf[r * 3 + 2] * rb[c * 3 + 2];
+                }
+            }
+            for (size_t i = 0; i < 3; i++) {
+                jacobian[i][j] = (forward[i] - backward[i]) / (2 * step);
+            }
+            jacobian[3][j] = (m[7] - m[5]) / (4 * step);
+            jacobian[4][j] = (m[2] - m[6]) / (4 * step);
+            jacobian[5][j] = (m[3] - m[1]) / (4 * step);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compute the twist of the flange, [vx, vy, vz, wx, wy, wz] in the base frame, of a joint velocity
+     *
+     * @param joint_angles The joint angles
+     * @param joint_velocity The joint velocity
+     * @param twist The resultant twist
+     * @return True if the twist was computed, false otherwise
+     */
+    ELITE_EXPORT virtual bool getTwist(const vector6d_t& joint_angles, const vector6d_t& joint_velocity, vector6d_t& twist) const {
+        matrix6d_t jacobian;
+        if (!getJacobian(joint_angles, jacobian)) {
+            return false;
+        }
+        JacobianAlgebra::twist(jacobian, joint_velocity, twist);
+        return true;
+    }
+
+    /**
+     * @brief Compute the joint velocity of a twist of the flange by damped least squares. Near a singularity the damping
+     * trades accuracy of the twist for a bounded joint velocity.
+     *
+     * @param joint_angles The joint angles
+     * @param twist The desired twist, [vx, vy, vz, wx, wy, wz] in the base frame
+     * @param joint_velocity The resultant joint velocity
+     * @param damping The damping, 0 for the exact inverse which fails at a singularity
+     * @return True if the joint velocity was computed, false otherwise
+     */
+    ELITE_EXPORT virtual bool getJointVelocity(const vector6d_t& joint_angles, const vector6d_t& twist, vector6d_t& joint_velocity,
+                                               double damping = DEFAULT_DAMPING) const {
+        matrix6d_t jacobian;
+        if (!getJacobian(joint_angles, jacobian)) {
+            return false;
+        }
+        return JacobianAlgebra::dampedLeastSquares(jacobian, twist, damping, joint_velocity);
+    }
+
+    /**
+     * @brief Compute the manipulability sqrt(det(J * J^T)) of a configuration, 0 at a singularity
+     *
+     * @param joint_angles The joint angles
+     * @param manipulability The resultant manipulability
+     * @return True if the manipulability was computed, false otherwise
+     */
+    ELITE_EXPORT virtual bool getManipulability(const vector6d_t& joint_angles, double& manipulability) const {
+        matrix6d_t jacobian;
+        if (!getJacobian(joint_angles, jacobian)) {
+            return false;
+        }
+        manipulability = JacobianAlgebra::manipulability(jacobian);
+        return true;
+    }
+
+    /**
+     * @brief Compute the condition number of the Jacobian of a configuration, infinity at a singularity
+     *
+     * @param joint_angles The joint angles
+     * @param condition_number The resultant condition number
+     * @return True if the condition number was computed, false otherwise
+     */
+    ELITE_EXPORT virtual bool getConditionNumber(const vector6d_t& joint_angles, double& condition_number) const {
+        matrix6d_t jacobian;
+        if (!getJacobian(joint_angles, jacobian)) {
+            return false;
+        }
+        condition_number = JacobianAlgebra::conditionNumber(jacobian);
+        return true;
+    }
+
     /**
      * @brief For functions that require a timeout specified but one is not specified using arguments,
      * a default timeout is used, as set by this function (and initialized to KinematicsBase::DEFAULT_TIMEOUT)
@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// MdhKinematics.hpp
+// Provides native MDH forward kinematics and Jacobian of a 6-axis arm, for one configuration or batches of them.
+#ifndef __ELITE__MDH_KINEMATICS_HPP__
+#define __ELITE__MDH_KINEMATICS_HPP__
+
+#include <Elite/DataType.hpp>
+#include <Elite/JacobianAlgebra.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace ELITE {
+
+/**
+ * @brief Forward kinematics of the MDH chain of a 6-axis arm.
+ * @verbatim
+ *  Each joint i is T_i = RotX(alpha_i) * Trans(a_i, 0, d_i) * RotZ(q_i), the same chain as KdlKinematicsPlugin, and the
+ *  pose is [x, y, z, roll, pitch, yaw] like KDL::Rotation::GetRPY().
+ *  The batch functions evaluate BLOCK configurations at once in structure-of-arrays form, the lanes of a block are
+ *  independent so the compiler vectorizes the loops. The object is immutable once built and can be shared by threads.
+ *  The Jacobian is the geometric one in the base frame: the rows are the linear velocity of the flange origin and the
+ *  angular velocity of the flange.
+ * @endverbatim
+ *
+ */
+class MdhKinematics {
+   public:
+    // Configurations evaluated together by the batch kernel
+    static constexpr size_t BLOCK = 8;
+
+    // Minimum configurations per thread before forwardBatch() starts more threads
+    static constexpr size_t MIN_CONFIGS_PER_THREAD = 4096;
+
+    MdhKinematics() : MdhKinematics(vector6d_t{}, vector6d_t{}, vector6d_t{}) {}
+
+    /**
+     * @brief Construct the model from the MDH parameters, e.g. of KinematicsInfo
+     *
+     * @param alpha MDH alpha parameter
+     * @param a MDH a parameter
+     * @param d MDH d parameter
+     */
+    MdhKinematics(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d) : alpha_(alpha), a_(a), d_(d) {
+        for (size_t i = 0; i < 6; i++) {
+            cos_alpha_[i] = std::cos(alpha[i]);
+            sin_alpha_[i] = std::sin(alpha[i]);
+        }
+    }
+
+    const vector6d_t& alpha() const { return alpha_; }
+    const vector6d_t& a() const { return a_; }
+    const vector6d_t& d() const { return d_; }
+
+    /**
+     * @brief Convert a row-major rotation matrix to roll, pitch, yaw, the same way as KDL::Rotation::GetRPY()
+     *
+     */
+    static void rotationToRPY(const double r[9], double& roll, double& pitch, double& yaw) {
+        const double HALF_PI = 1.57079632679489661923;
+        const double epsilon = 1e-12;
+        pitch = std::atan2(-r[6], std::sqrt(r[0] * r[0] + r[3] * r[3]));
+        if (std::fabs(pitch) > (HALF_PI - epsilon)) {
+            yaw = std::atan2(-r[1], r[4]);
+            roll = 0.0;
+        } else {
+            roll = std::atan2(r[7], r[8]);
+            yaw = std::atan2(r[3], r[0]);
+        }
+    }
+
+    /**
+     * @brief Convert roll, pitch, yaw to a row-major rotation matrix, the same way as KDL::Rotation::RPY()
+     *
+     */
+    static void rpyToRotation(double roll, double pitch, double yaw, double r[9]) {
+        const double cr = std::cos(roll), sr = std::sin(roll);
+        const double cp = std::cos(pitch), sp = std::sin(pitch);
+        const double cy = std::cos(yaw), sy = std::sin(yaw);
+        r[0] = cy * cp, r[1] = cy * sp * sr - sy * cr, r[2] = cy * sp * cr + sy * sr;
+        r[3] = sy * cp, r[4] = sy * sp * sr + cy * cr, r[5] = sy * sp * cr - cy * sr;
+        r[6] = -sp, r[7] = cp * sr, r[8] = cp * cr;
+    }
+
+    /**
+     * @brief Forward kinematics of one configuration
+     *
+     * @param q Joint angles
+     * @param r Output rotation, row-major
+     * @param p Output translation
+     */
+    void forward(const vector6d_t& q, double r[9], double p[3]) const {
+        r[0] = 1, r[1] = 0, r[2] = 0;
+        r[3] = 0, r[4] = 1, r[5] = 0;
+        r[6] = 0, r[7] = 0, r[8] = 1;
+        p[0] = p[1] = p[2] = 0;
+        for (size_t j = 0; j < 6; j++) {
+            const double ca = cos_alpha_[j];
+            const double sa = sin_alpha_[j];
+            const double ty = -sa * d_[j];
+            const double tz = ca * d_[j];
+            const double c = std::cos(q[j]);
+            const double s = std::sin(q[j]);
+            for (size_t row = 0; row < 3; row++) {
+                double* rr = r + row * 3;
+                p[row] += rr[0] * a_[j] + rr[1] * ty + rr[2] * tz;
+                // R * RotX(alpha) * RotZ(q)
+                const double m1 = ca * rr[1] + sa * rr[2];
+                const double m2 = -sa * rr[1] + ca * rr[2];
+                const double m0 = rr[0];
+                rr[0] = c * m0 + s * m1;
+                rr[1] = -s * m0 + c * m1;
+                rr[2] = m2;
+            }
+        }
+    }
+
+    /**
+     * @brief Forward kinematics of one configuration
+     *
+     * @param q Joint angles
+     * @param pose Output pose [x, y, z, roll, pitch, yaw]
+     */
+    void forward(const vector6d_t& q, vector6d_t& pose) const {
+        double r[9];
+        double p[3];
+        forward(q, r, p);
+        pose[0] = p[0];
+        pose[1] = p[1];
+        pose[2] = p[2];
+        rotationToRPY(r, pose[3], pose[4], pose[5]);
+    }
+
+    /**
+     * @brief Geometric Jacobian of one configuration, column i is [z_i x (p - o_i); z_i] with z_i and o_i the axis and
+     * origin of joint i and p the flange origin
+     *
+     * @param q Joint angles
+     * @param jacobian Output Jacobian
+     */
+    void jacobian(const vector6d_t& q, matrix6d_t& jacobian) const {
+        double r[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+        double p[3] = {0, 0, 0};
+        double axis[6][3];
+        double origin[6][3];
+        for (size_t j = 0; j < 6; j++) {
+            const double ca = cos_alpha_[j];
+            const double sa = sin_alpha_[j];
+            const double ty = -sa * d_[j];
+            const double tz = ca * d_[j];
+            const double c = std::cos(q[j]);
+            const double s = std::sin(q[j]);
+            for (size_t row = 0; row < 3; row++) {
+                double* rr = r + row * 3;
+                p[row] += rr[0] * a_[j] + rr[1] * ty + rr[2] * tz;
+                const double m1 = ca * rr[1] + sa * rr[2];
+                const double m2 = -sa * rr[1] + ca * rr[2];
+                const double m0 = rr[0];
+                rr[0] = c * m0 + s * m1;
+                rr[1] = -s * m0 + c * m1;
+                rr[2] = m2;
+                // RotZ(q) keeps the z axis, it is the axis of joint j
+                axis[j][row] = m2;
+                origin[j][row] = p[row];
+            }
+        }
+        for (size_t j = 0; j < 6; j++) {
+            const double* z = axis[j];
+            const double dx = p[0] - origin[j][0];
+            const double dy = p[1] - origin[j][1];
+            const double dz = p[2] - origin[j][2];
+            jacobian[0][j] = z[1] * dz - z[2] * dy;
+            jacobian[1][j] = z[2] * dx - z[0] * dz;
+            jacobian[2][j] = z[0] * dy - z[1] * dx;
+            jacobian[3][j] = z[0];
+            jacobian[4][j] = z[1];
+            jacobian[5][j] = z[2];
+        }
+    }
+
+    /**
+     * @brief Forward kinematics of up to BLOCK configurations in structure-of-arrays form
+     *
+     * @param q Joint angles of the configurations
+     * @param poses Output poses
+     * @param count Number of configurations, at most BLOCK
+     */
+    void forwardBlock(const vector6d_t* q, vector6d_t* poses, size_t count) const {
+        alignas(64) double r[9][BLOCK];
+        alignas(64) double p[3][BLOCK];
+        alignas(64) double c[BLOCK];
+        alignas(64) double s[BLOCK];
+        for (size_t k = 0; k < BLOCK; k++) {
+            for (size_t e = 0; e < 9; e++) {
+                r[e][k] = (e % 4 == 0) ? 1.0 : 0.0;
+            }
+            p[0][k] = p[1][k] = p[2][k] = 0.0;
+        }
+
+        for (size_t j = 0; j < 6; j++) {
+            // The unused lanes compute with zero angles, so every loop runs the full block width
+            for (size_t k = 0; k < BLOCK; k++) {
+                const double angle = k < count ? q[k][j] : 0.0;
+                c[k] = std::cos(angle);
+                s[k] = std::sin(angle);
+            }
+            const double a = a_[j];
+            const double ca = cos_alpha_[j];
+            const double sa = sin_alpha_[j];
+            const double ty = -sa * d_[j];
+            const double tz = ca * d_[j];
+            for (size_t row = 0; row < 3; row++) {
+                double* r0 = r[row * 3];
+                double* r1 = r[row * 3 + 1];
+                double* r2 = r[row * 3 + 2];
+                double* pr = p[row];
+                for (size_t k = 0; k < BLOCK; k++) {
+                    pr[k] += r0[k] * a + r1[k] * ty + r2[k] * tz;
+                    const double m0 = r0[k];
+                    const double m1 = ca * r1[k] + sa * r2[k];
+                    const double m2 = -sa * r1[k] + ca * r2[k];
+                    r0[k] = c[k] * m0 + s[k] * m1;
+                    r1[k] = -s[k] * m0 + c[k] * m1;
+                    r2[k] = m2;
+                }
+            }
+        }
+
+        for (size_t k = 0; k < count; k++) {
+            double rot[9];
+            for (size_t e = 0; e < 9; e++) {
+                rot[e] = r[e][k];
+            }
+            poses[k][0] = p[0][k];
+            poses[k][1] = p[1][k];
+            poses[k][2] = p[2][k];
+            rotationToRPY(rot, poses[k][3], poses[k][4], poses[k][5]);
+        }
+    }
+
+    /**
+     * @brief Forward kinematics of many configurations
+     *
+     * @param q Joint angles of the configurations
+     * @param poses Output poses, poses[i] is the pose of q[i]
+     * @param n Number of configurations
+     * @param threads Threads to use, 0 for the hardware concurrency. A thread gets at least MIN_CONFIGS_PER_THREAD
+     * configurations, so small batches run on the calling thread only.
+     */
+    void forwardBatch(const vector6d_t* q, vector6d_t* poses, size_t n, unsigned threads = 1) const {
+        if (threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        size_t thread_count = std::min<size_t>(threads, std::max<size_t>(1, n / MIN_CONFIGS_PER_THREAD));
+        if (thread_count <= 1) {
+            forwardRange(q, poses, n);
+            return;
+        }
+        // Whole blocks per thread
+        size_t chunk = (n + thread_count - 1) / thread_count;
+        chunk = (chunk + BLOCK - 1) / BLOCK * BLOCK;
+        const size_t first = chunk < n ? chunk : n;
+        std::vector<std::thread> workers;
+        for (size_t begin = chunk; begin < n; begin += chunk) {
+            size_t count = n - begin < chunk ? n - begin : chunk;
+            workers.emplace_back([this, q, poses, begin, count]() { forwardRange(q + begin, poses + begin, count); });
+        }
+        forwardRange(q, poses, first);
+        for (auto& t : workers) {
+            t.join();
+        }
+    }
+
+   private:
+    vector6d_t alpha_;
+    vector6d_t a_;
+    vector6d_t d_;
+    vector6d_t cos_alpha_;
+    vector6d_t sin_alpha_;
+
+    void forwardRange(const vector6d_t* q, vector6d_t* poses, size_t n) const {
+        for (size_t i = 0; i < n; i += BLOCK) {
+            size_t count = n - i < BLOCK ? n - i : BLOCK;
+            forwardBlock(q + i, poses + i, count);
+        }
+    }
+};
+
+}  // namespace ELITE
+
+#endif  // __ELITE__MDH_KINEMATICS_HPP__
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -55,15 +56,136 @@ enum class PoseAlgebraError {
     INTERNAL_ERROR,           // Unexpected internal failure.
 };
 
+/**
+ * @brief Static description of a pose algebra error code.
+ *
+ * @param error The error code.
+ * @return const char* The description, e.g. "singular matrix".
+ */
+inline const char* poseAlgebraErrorToString(PoseAlgebraError error) {
+    switch (error) {
+        case PoseAlgebraError::SUCCESS:
+            return "success";
+        case PoseAlgebraError::INVALID_INPUT:
+            return "invalid input";
+        case PoseAlgebraError::SINGULAR_MATRIX:
+            return "singular matrix";
+        case PoseAlgebraError::INVALID_ROTATION_MATRIX:
+            return "invalid rotation matrix";
+        case PoseAlgebraError::NUMERICAL_ERROR:
+            return "numerical error";
+        case PoseAlgebraError::UNSUPPORTED_OPERATION:
+            return "unsupported operation";
+        case PoseAlgebraError::INTERNAL_ERROR:
+            return "internal error";
+    }
+    return "unknown error";
+}
+
 /**
  * @brief Detailed status for pose algebra operations.
+ *
+ * A failure is recorded with static strings and indices, so the error path of an operation does not allocate.
+ * message() formats them into a text when it is called.
  */
 struct PoseAlgebraResult {
+    /// Value of an index that is not set.
+    static constexpr size_t NO_INDEX = static_cast<size_t>(-1);
+
     /// Operation status code.
     PoseAlgebraError error{PoseAlgebraError::SUCCESS};
 
-    /// Human-readable details for failures or diagnostics.
-    std::string message;
+    /// Static name of the failing operand, e.g. "left pose", or nullptr.
+    const char* operand{nullptr};
+
+    /// Static failure detail, appended to the operand name, or nullptr.
+    const char* detail{nullptr};
+
+    /// Index of the failing value in the operand, appended to the detail: 0-5 in a vector, row * 4 + column in a
+    /// matrix. NO_INDEX when not set.
+    size_t value_index{NO_INDEX};
+
+    /// Index of the failing element of a batch operation, NO_INDEX when not set.
+    size_t batch_index{NO_INDEX};
+
+    /// Operand name or message given as a std::string, used in place of operand. Empty for the static failures.
+    std::string text;
+
+    /**
+     * @brief Format the details of the failure, e.g. "element 9: output pose contains non-finite values". Builds a
+     * string on each call.
+     *
+     * @return std::string The details, or the description of the error code when there are none. Empty on success.
+     */
+    std::string message() const {
+        std::string out;
+        if (error == PoseAlgebraError::SUCCESS) {
+            return out;
+        }
+        if (batch_index != NO_INDEX) {
+            out.append("element ").append(std::to_string(batch_index)).append(": ");
+        }
+        if (operand) {
+            out.append(operand);
+        } else {
+            out.append(text);
+        }
+        if (detail) {
+            out.append(detail);
+        }
+        if (!operand && text.empty() && !detail) {
+            out.append(poseAlgebraErrorToString(error));
+        }
+        if (value_index != NO_INDEX) {
+            out.append(std::to_string(value_index));
+        }
+        return out;
+    }
+};
+
+/**
+ * @brief Validation policy of a pose algebra instance.
+ */
+enum class PoseAlgebraValidation {
+    /// Validate the inputs and outputs of every operation (default).
+    CHECKED,
+    /// Skip all the validation, for trusted inputs in hot loops. Invalid inputs give undefined results.
+    UNCHECKED
+};
+
+/**
+ * @brief Raw function pointers to the batch kernels of a pose algebra plugin.
+ *
+ * A kernel runs without virtual dispatch, validation or result reporting, like the batch operations of an instance
+ * with PoseAlgebraValidation::UNCHECKED. The pointers stay valid while the plugin library is loaded. A plugin without
+ * native kernels leaves them null.
+ */
+struct PoseAlgebraKernels {
+    /// out_poses[i] = left_pose * in_poses[i]. For worldToLocal pass the inverse of the reference pose as left_pose.
+    void (*compose_matrices)(const PoseMatrix& left_pose, const PoseMatrix* in_poses, PoseMatrix* out_poses,
+                             size_t n) = nullptr;
+
+    /// out_poses[i] = left_pose * in_poses[i], on [x, y, z, roll, pitch, yaw] poses.
+    void (*compose_vectors)(const vector6d_t& left_pose, const vector6d_t* in_poses, vector6d_t* out_poses,
+                            size_t n) = nullptr;
+
+    /// The conversion of vectorToMatrix() for n poses.
+    void (*vector_to_matrix)(const vector6d_t* pose_vectors, PoseMatrix* pose_matrices, size_t n) = nullptr;
+
+    /// The conversion of matrixToVector() for n poses.
+    void (*matrix_to_vector)(const PoseMatrix* pose_matrices, vector6d_t* pose_vectors, size_t n) = nullptr;
+
+    /// out_points[i] = R * points[i] + t, out_points may be points.
+    void (*transform_points)(const PoseMatrix& pose, const vector3d_t* points, vector3d_t* out_points, size_t n) = nullptr;
+
+    /**
+     * @brief Check if all the kernels are set.
+     *
+     * @return true if no pointer is null.
+     */
+    bool complete() const {
+        return compose_matrices && compose_vectors && vector_to_matrix && matrix_to_vector && transform_points;
+    }
 };
 
 /**
@@ -73,7 +195,8 @@ struct PoseAlgebraResult {
  * - PoseMatrix: 4x4 homogeneous transform
  * - vector6d_t: [x, y, z, roll, pitch, yaw]
  *
- * Concrete implementations should report detailed status through PoseAlgebraResult.
+ * Concrete implementations should report detailed status through PoseAlgebraResult, and honor the validation policy
+ * of the instance: with PoseAlgebraValidation::UNCHECKED an operation runs without checking its inputs or outputs.
  */
 class PoseAlgebraBase {
    public:
@@ -86,26 +209,95 @@ class PoseAlgebraBase {
     /// Numerical tolerance used by validation and rotation checks.
     static constexpr double ZERO_TOLERANCE = 1e-6;
 
+    /// Static failure details of the pose checks, appended to the name of the checked operand.
+    static constexpr const char* NON_FINITE_DETAIL = " contains non-finite values";
+    static constexpr const char* NON_FINITE_VALUE_DETAIL = " contains a non-finite value at index ";
+    static constexpr const char* NOT_HOMOGENEOUS_DETAIL = " is not a valid homogeneous pose matrix";
+    static constexpr const char* NON_ORTHONORMAL_DETAIL = " contains a non-orthonormal rotation matrix";
+    static constexpr const char* SINGULAR_DETAIL = " rotation matrix is singular and cannot be inverted";
+    static constexpr const char* DETERMINANT_DETAIL = " rotation determinant is not close to +1";
+
+    /**
+     * @brief Set the validation policy of this instance.
+     *
+     * @param validation PoseAlgebraValidation::CHECKED (default) or PoseAlgebraValidation::UNCHECKED.
+     */
+    void setValidation(PoseAlgebraValidation validation) { validation_ = validation; }
+
+    /**
+     * @brief Get the validation policy of this instance.
+     *
+     * @return PoseAlgebraValidation The validation policy.
+     */
+    PoseAlgebraValidation getValidation() const { return validation_; }
+
+    /**
+     * @brief Check whether the operations of this instance validate their inputs and outputs.
+     *
+     * @return true if the validation policy is PoseAlgebraValidation::CHECKED.
+     */
+    bool isChecked() const { return validation_ == PoseAlgebraValidation::CHECKED; }
+
     /**
      * @brief Mark an operation as successful.
      *
      * @param result Result object to update.
      */
-    static void setSuccess(PoseAlgebraResult& result) {
-        result.error = PoseAlgebraError::SUCCESS;
-        result.message.clear();
-    }
+    static void setSuccess(PoseAlgebraResult& result) { setError(result, PoseAlgebraError::SUCCESS, nullptr, nullptr); }
 
     /**
-     * @brief Mark an operation as failed with details.
+     * @brief Mark an operation as failed with details. The message is copied into the result.
      *
      * @param result Result object to update.
      * @param error Error code to set.
      * @param message Human-readable failure detail.
      */
     static void setError(PoseAlgebraResult& result, PoseAlgebraError error, const std::string& message) {
+        setError(result, error, nullptr, nullptr);
+        result.text = message;
+    }
+
+    /**
+     * @brief Mark an operation as failed with a static message. Only the pointer is kept, nothing is allocated.
+     *
+     * @param result Result object to update.
+     * @param error Error code to set.
+     * @param message Static failure detail.
+     */
+    static void setError(PoseAlgebraResult& result, PoseAlgebraError error, const char* message) {
+        setError(result, error, nullptr, message);
+    }
+
+    /**
+     * @brief Mark an operation as failed with the name of the failing operand and a static detail, e.g.
+     * NOT_HOMOGENEOUS_DETAIL. Only the pointers are kept, nothing is allocated.
+     *
+     * @param result Result object to update.
+     * @param error Error code to set.
+     * @param name Static name of the failing operand.
+     * @param detail Static failure detail appended to the name.
+     * @param value_index Index of the failing value in the operand, appended to the detail, or NO_INDEX.
+     */
+    static void setError(PoseAlgebraResult& result, PoseAlgebraError error, const char* name, const char* detail,
+                         size_t value_index = PoseAlgebraResult::NO_INDEX) {
         result.error = error;
-        result.message = message;
+        result.operand = name;
+        result.detail = detail;
+        result.value_index = value_index;
+        result.batch_index = PoseAlgebraResult::NO_INDEX;
+        result.text.clear();
+    }
+
+    /**
+     * @brief Mark a batch operation as failed at an element, after the failure of the element is set in the result.
+     *
+     * @param result Result object holding the failure of the element.
+     * @param index Index of the element in the batch.
+     * @return false, for chaining in return statements.
+     */
+    static bool setBatchError(PoseAlgebraResult& result, size_t index) {
+        result.batch_index = index;
+        return false;
     }
 
     /**
@@ -142,17 +334,26 @@ class PoseAlgebraBase {
      * @param name Name of the vector for error reporting.
      * @return true if all elements are finite, false otherwise.
      */
-    static bool validateVectorFinite(const vector6d_t& pose, PoseAlgebraResult& result, const std::string& name) {
+    static bool validateVectorFinite(const vector6d_t& pose, PoseAlgebraResult& result, const char* name) {
         for (size_t i = 0; i < pose.size(); ++i) {
             if (!std::isfinite(pose[i])) {
-                setError(result, PoseAlgebraError::INVALID_INPUT,
-                         name + " contains non-finite value at index " + std::to_string(i));
+                setError(result, PoseAlgebraError::INVALID_INPUT, name, NON_FINITE_VALUE_DETAIL, i);
                 return false;
             }
         }
         return true;
     }
 
+    /// @copydoc validateVectorFinite(const vector6d_t&, PoseAlgebraResult&, const char*)
+    static bool validateVectorFinite(const vector6d_t& pose, PoseAlgebraResult& result, const std::string& name) {
+        if (validateVectorFinite(pose, result, static_cast<const char*>(nullptr))) {
+            return true;
+        }
+        // The name does not outlive the call
+        result.text = name;
+        return false;
+    }
+
     /**
      * @brief Validate that all elements of a pose matrix are finite.
      * 
@@ -161,12 +362,12 @@ class PoseAlgebraBase {
      * @param name Name of the matrix for error reporting.
      * @return true if all elements are finite, false otherwise.
      */
-    static bool validateMatrixFinite(const PoseMatrix& pose, PoseAlgebraResult& result, const std::string& name) {
+    static bool validateMatrixFinite(const PoseMatrix& pose, PoseAlgebraResult& result, const char* name) {
         for (size_t i = 0; i < pose.data.size(); ++i) {
             for (size_t j = 0; j < pose.data[i].size(); ++j) {
                 if (!std::isfinite(pose.data[i][j])) {
-                    setError(result, PoseAlgebraError::INVALID_INPUT,
-                             name + " contains non-finite value at [" + std::to_string(i) + "][" + std::to_string(j) + "]");
+                    setError(result, PoseAlgebraError::INVALID_INPUT, name, NON_FINITE_VALUE_DETAIL,
+                             i * pose.data[i].size() + j);
                     return false;
                 }
             }
@@ -174,6 +375,16 @@ class PoseAlgebraBase {
         return true;
     }
 
+    /// @copydoc validateMatrixFinite(const PoseMatrix&, PoseAlgebraResult&, const char*)
+    static bool validateMatrixFinite(const PoseMatrix& pose, PoseAlgebraResult& result, const std::string& name) {
+        if (validateMatrixFinite(pose, result, static_cast<const char*>(nullptr))) {
+            return true;
+        }
+        // The name does not outlive the call
+        result.text = name;
+        return false;
+    }
+
     /**
      * @brief Compute the determinant of a 3x3 pose matrix.
      *
@@ -409,6 +620,199 @@ class PoseAlgebraBase {
      */
     ELITE_EXPORT virtual bool localToWorld(const vector6d_t& world_ref_pose, const vector6d_t& local_pose,
                                            vector6d_t& world_pose, PoseAlgebraResult& result) const = 0;
+
+    // Batch operations over contiguous arrays. The default implementations call the single pose operations for each
+    // element and stop at the first failure; plugins override them with kernels that validate the shared operand once.
+
+    /**
+     * @brief Compose a pose matrix with many: out_poses[i] = left_pose * right_poses[i].
+     *
+     * @param left_pose The left operand, shared by all the elements.
+     * @param right_poses The right operands, n elements.
+     * @param out_poses The output poses, n elements.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool multiplyBatch(const PoseMatrix& left_pose, const PoseMatrix* right_poses, PoseMatrix* out_poses,
+                                            size_t n, PoseAlgebraResult& result) const {
+        for (size_t i = 0; i < n; ++i) {
+            if (!multiply(left_pose, right_poses[i], out_poses[i], result)) {
+                return setBatchError(result, i);
+            }
+        }
+        setSuccess(result);
+        return true;
+    }
+
+    /**
+     * @brief Compose a 6D pose vector with many: out_poses[i] = left_pose * right_poses[i].
+     *
+     * @param left_pose The left operand (xyz + rpy), shared by all the elements.
+     * @param right_poses The right operands (xyz + rpy), n elements.
+     * @param out_poses The output poses (xyz + rpy), n elements.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool multiplyBatch(const vector6d_t& left_pose, const vector6d_t* right_poses, vector6d_t* out_poses,
+                                            size_t n, PoseAlgebraResult& result) const {
+        for (size_t i = 0; i < n; ++i) {
+            if (!multiply(left_pose, right_poses[i], out_poses[i], result)) {
+                return setBatchError(result, i);
+            }
+        }
+        setSuccess(result);
+        return true;
+    }
+
+    /**
+     * @brief Convert many poses from world coordinates to the local coordinates of one reference frame.
+     *
+     * @param world_ref_pose The local reference frame pose expressed in world coordinates, inverted once.
+     * @param world_poses The target poses expressed in world coordinates, n elements.
+     * @param local_poses The output target poses expressed in the local reference frame, n elements.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool worldToLocalBatch(const PoseMatrix& world_ref_pose, const PoseMatrix* world_poses,
+                                                PoseMatrix* local_poses, size_t n, PoseAlgebraResult& result) const {
+        PoseMatrix inverse_world_ref_pose;
+        if (!inverse(world_ref_pose, inverse_world_ref_pose, result)) {
+            return false;
+        }
+        return multiplyBatch(inverse_world_ref_pose, world_poses, local_poses, n, result);
+    }
+
+    /**
+     * @brief Convert many 6D poses from world coordinates to the local coordinates of one reference frame.
+     *
+     * @param world_ref_pose The local reference frame pose (xyz + rpy) expressed in world coordinates, inverted once.
+     * @param world_poses The target poses (xyz + rpy) expressed in world coordinates, n elements.
+     * @param local_poses The output target poses (xyz + rpy) expressed in the local reference frame, n elements.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool worldToLocalBatch(const vector6d_t& world_ref_pose, const vector6d_t* world_poses,
+                                                vector6d_t* local_poses, size_t n, PoseAlgebraResult& result) const {
+        vector6d_t inverse_world_ref_pose;
+        if (!inverse(world_ref_pose, inverse_world_ref_pose, result)) {
+            return false;
+        }
+        return multiplyBatch(inverse_world_ref_pose, world_poses, local_poses, n, result);
+    }
+
+    /**
+     * @brief Convert many poses from the local coordinates of one reference frame to world coordinates.
+     *
+     * @param world_ref_pose The local reference frame pose expressed in world coordinates.
+     * @param local_poses The target poses expressed in the local reference frame, n elements.
+     * @param world_poses The output target poses expressed in world coordinates, n elements.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool localToWorldBatch(const PoseMatrix& world_ref_pose, const PoseMatrix* local_poses,
+                                                PoseMatrix* world_poses, size_t n, PoseAlgebraResult& result) const {
+        return multiplyBatch(world_ref_pose, local_poses, world_poses, n, result);
+    }
+
+    /**
+     * @brief Convert many 6D poses from the local coordinates of one reference frame to world coordinates.
+     *
+     * @param world_ref_pose The local reference frame pose (xyz + rpy) expressed in world coordinates.
+     * @param local_poses The target poses (xyz + rpy) expressed in the local reference frame, n elements.
+     * @param world_poses The output target poses (xyz + rpy) expressed in world coordinates, n elements.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool localToWorldBatch(const vector6d_t& world_ref_pose, const vector6d_t* local_poses,
+                                                vector6d_t* world_poses, size_t n, PoseAlgebraResult& result) const {
+        return multiplyBatch(world_ref_pose, local_poses, world_poses, n, result);
+    }
+
+    /**
+     * @brief Convert many 6D pose vectors (xyz + rpy) to 4x4 pose matrices.
+     *
+     * @param pose_vectors The input pose vectors, n elements.
+     * @param pose_matrices The output pose matrices, n elements.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool vectorToMatrixBatch(const vector6d_t* pose_vectors, PoseMatrix* pose_matrices, size_t n,
+                                                  PoseAlgebraResult& result) const {
+        for (size_t i = 0; i < n; ++i) {
+            if (!vectorToMatrix(pose_vectors[i], pose_matrices[i], result)) {
+                return setBatchError(result, i);
+            }
+        }
+        setSuccess(result);
+        return true;
+    }
+
+    /**
+     * @brief Convert many 4x4 pose matrices to 6D pose vectors (xyz + rpy).
+     *
+     * @param pose_matrices The input pose matrices, n elements.
+     * @param pose_vectors The output pose vectors, n elements.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool matrixToVectorBatch(const PoseMatrix* pose_matrices, vector6d_t* pose_vectors, size_t n,
+                                                  PoseAlgebraResult& result) const {
+        for (size_t i = 0; i < n; ++i) {
+            if (!matrixToVector(pose_matrices[i], pose_vectors[i], result)) {
+                return setBatchError(result, i);
+            }
+        }
+        setSuccess(result);
+        return true;
+    }
+
+    /**
+     * @brief Transform many points by one pose: out_points[i] = R * points[i] + t, e.g. a scan into the base frame.
+     *
+     * @param pose The pose applied to all the points.
+     * @param points The input points, n elements.
+     * @param out_points The output points, n elements. It may be the same array as points.
+     * @param n Number of elements.
+     * @param result Detailed result of the operation. On failure batch_index is the index of the element.
+     * @return true if the operation is successful for all the elements, false otherwise.
+     */
+    ELITE_EXPORT virtual bool transformPointsBatch(const PoseMatrix& pose, const vector3d_t* points, vector3d_t* out_points,
+                                                   size_t n, PoseAlgebraResult& result) const {
+        if (isChecked() && !validateMatrixFinite(pose, result, "pose")) {
+            return false;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            const vector3d_t point = points[i];
+            for (size_t row = 0; row < 3; ++row) {
+                out_points[i][row] = pose.data[row][0] * point[0] + pose.data[row][1] * point[1] +
+                                     pose.data[row][2] * point[2] + pose.data[row][3];
+                if (isChecked() && !std::isfinite(out_points[i][row])) {
+                    setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output point contains non-finite values");
+                    return setBatchError(result, i);
+                }
+            }
+        }
+        setSuccess(result);
+        return true;
+    }
+
+    /**
+     * @brief Get raw function pointers to the batch kernels, to call them in inner loops without virtual dispatch.
+     *
+     * @return PoseAlgebraKernels The kernels of the plugin. The default implementation returns null pointers.
+     */
+    ELITE_EXPORT virtual PoseAlgebraKernels getKernelTable() const { return PoseAlgebraKernels(); }
+
+   private:
+    PoseAlgebraValidation validation_ = PoseAlgebraValidation::CHECKED;
 };
 
 using PoseAlgebraBaseSharedPtr = std::shared_ptr<PoseAlgebraBase>;
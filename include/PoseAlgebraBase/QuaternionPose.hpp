@@ -0,0 +1,320 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+
+/**
+ * @file QuaternionPose.hpp
+ * @brief Compact pose of a translation and a unit quaternion, chained without RPY conversions.
+ */
+#ifndef __ELITE__QUATERNION_POSE_HPP__
+#define __ELITE__QUATERNION_POSE_HPP__
+
+#include <Elite/DataType.hpp>
+#include <Elite/PoseAlgebraBase.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace ELITE {
+
+/**
+ * @brief A rigid transform as a translation and a unit quaternion.
+ *
+ * The pose APIs of the controller and of PoseAlgebraBase use vector6d_t [x, y, z, roll, pitch, yaw], so a chain of
+ * multiply() calls converts RPY to a matrix and back at every step. A QuaternionPose composes with 16 multiplications
+ * and no trigonometry: convert the poses once with fromRpy(), chain them with operator*, inverse() and interpolate(),
+ * and convert the result once with toRpy(), e.g. for writeServoj(..., cartesian=true).
+ *
+ * The RPY convention is the one of the controller: R = Rz(yaw) * Ry(pitch) * Rx(roll).
+ * Composition keeps the quaternion unit up to rounding. The conversions out of the type are exact for a quaternion
+ * that drifted from unit length, call normalize() to keep a long lived pose bounded.
+ */
+struct QuaternionPose {
+    /// Translation [x, y, z].
+    vector3d_t position{{0.0, 0.0, 0.0}};
+
+    /// Unit quaternion [w, x, y, z].
+    std::array<double, 4> orientation{{1.0, 0.0, 0.0, 0.0}};
+
+    /**
+     * @brief Compose two poses: the result maps a point of the right pose frame through right, then through this pose.
+     *
+     * @param right The right operand.
+     * @return QuaternionPose this * right.
+     */
+    QuaternionPose operator*(const QuaternionPose& right) const {
+        QuaternionPose out;
+        const double w = orientation[0], x = orientation[1], y = orientation[2], z = orientation[3];
+        const double rw = right.orientation[0], rx = right.orientation[1], ry = right.orientation[2], rz = right.orientation[3];
+        out.orientation[0] = w * rw - x * rx - y * ry - z * rz;
+        out.orientation[1] = w * rx + x * rw + y * rz - z * ry;
+        out.orientation[2] = w * ry - x * rz + y * rw + z * rx;
+        out.orientation[3] = w * rz + x * ry - y * rx + z * rw;
+        out.position = transform(right.position);
+        return out;
+    }
+
+    /**
+     * @brief The inverse transform.
+     *
+     * @return QuaternionPose The pose p such that p * (*this) is the identity.
+     */
+    QuaternionPose inverse() const {
+        QuaternionPose out;
+        out.orientation = {orientation[0], -orientation[1], -orientation[2], -orientation[3]};
+        const vector3d_t rotated = out.rotate(position);
+        out.position = {-rotated[0], -rotated[1], -rotated[2]};
+        return out;
+    }
+
+    /**
+     * @brief Rotate a vector by the orientation.
+     *
+     * @param v The vector.
+     * @return vector3d_t R * v.
+     */
+    vector3d_t rotate(const vector3d_t& v) const {
+        // v + 2 * q.xyz x (q.xyz x v + w * v)
+        const double w = orientation[0], x = orientation[1], y = orientation[2], z = orientation[3];
+        const double tx = y * v[2] - z * v[1] + w * v[0];
+        const double ty = z * v[0] - x * v[2] + w * v[1];
+        const double tz = x * v[1] - y * v[0] + w * v[2];
+        return {v[0] + 2.0 * (y * tz - z * ty), v[1] + 2.0 * (z * tx - x * tz), v[2] + 2.0 * (x * ty - y * tx)};
+    }
+
+    /**
+     * @brief Transform a point by the pose.
+     *
+     * @param point The point.
+     * @return vector3d_t R * point + t.
+     */
+    vector3d_t transform(const vector3d_t& point) const {
+        const vector3d_t rotated = rotate(point);
+        return {rotated[0] + position[0], rotated[1] + position[1], rotated[2] + position[2]};
+    }
+
+    /**
+     * @brief Scale the quaternion back to unit length.
+     *
+     */
+    void normalize() {
+        const double norm = std::sqrt(orientation[0] * orientation[0] + orientation[1] * orientation[1] +
+                                      orientation[2] * orientation[2] + orientation[3] * orientation[3]);
+        if (norm > 0.0) {
+            for (auto& q : orientation) {
+                q /= norm;
+            }
+        } else {
+            orientation = {1.0, 0.0, 0.0, 0.0};
+        }
+    }
+
+    /**
+     * @brief Interpolate between two poses: linear in the translation, slerp on the shortest arc in the orientation.
+     *
+     * @param from The pose at t = 0.
+     * @param to The pose at t = 1.
+     * @param t The interpolation parameter, usually in [0, 1].
+     * @return QuaternionPose The interpolated pose.
+     */
+    static QuaternionPose interpolate(const QuaternionPose& from, const QuaternionPose& to, double t) {
+        QuaternionPose out;
+        for (size_t i = 0; i < 3; ++i) {
+            out.position[i] = from.position[i] + t * (to.position[i] - from.position[i]);
+        }
+
+        std::array<double, 4> target = to.orientation;
+        double cos_theta = from.orientation[0] * target[0] + from.orientation[1] * target[1] +
+                           from.orientation[2] * target[2] + from.orientation[3] * target[3];
+        // q and -q are the same rotation, take the shorter arc
+        if (cos_theta < 0.0) {
+            cos_theta = -cos_theta;
+            for (auto& q : target) {
+                q = -q;
+            }
+        }
+        double from_weight = 1.0 - t;
+        double to_weight = t;
+        // Close quaternions are interpolated linearly, sin(theta) would lose the precision
+        if (cos_theta < 1.0 - PoseAlgebraBase::ZERO_TOLERANCE) {
+            const double theta = std::acos(cos_theta);
+            const double sin_theta = std::sin(theta);
+            from_weight = std::sin((1.0 - t) * theta) / sin_theta;
+            to_weight = std::sin(t * theta) / sin_theta;
+        }
+        for (size_t i = 0; i < 4; ++i) {
+            out.orientation[i] = from_weight * from.orientation[i] + to_weight * target[i];
+        }
+        out.normalize();
+        return out;
+    }
+
+    /**
+     * @brief Convert a pose of the controller format.
+     *
+     * @param pose The pose [x, y, z, roll, pitch, yaw].
+     * @return QuaternionPose The pose.
+     */
+    static QuaternionPose fromRpy(const vector6d_t& pose) {
+        const double cr = std::cos(pose[3] * 0.5), sr = std::sin(pose[3] * 0.5);
+        const double cp = std::cos(pose[4] * 0.5), sp = std::sin(pose[4] * 0.5);
+        const double cy = std::cos(pose[5] * 0.5), sy = std::sin(pose[5] * 0.5);
+        QuaternionPose out;
+        out.position = {pose[0], pose[1], pose[2]};
+        out.orientation = {cr * cp * cy + sr * sp * sy, sr * cp * cy - cr * sp * sy, cr * sp * cy + sr * cp * sy,
+                           cr * cp * sy - sr * sp * cy};
+        return out;
+    }
+
+    /**
+     * @brief Convert to the pose format of the controller.
+     *
+     * @return vector6d_t The pose [x, y, z, roll, pitch, yaw]. At pitch = +-pi/2 the yaw is 0.
+     */
+    vector6d_t toRpy() const {
+        double r[9];
+        toRotation(r);
+        vector6d_t pose{};
+        pose[0] = position[0];
+        pose[1] = position[1];
+        pose[2] = position[2];
+        // The extraction of ElitePoseAlgebra::matrixToVector()
+        const double pitch = std::atan2(-r[6], std::sqrt(r[0] * r[0] + r[3] * r[3]));
+        if (std::fabs(std::cos(pitch)) > PoseAlgebraBase::ZERO_TOLERANCE) {
+            pose[3] = std::atan2(r[7], r[8]);
+            pose[5] = std::atan2(r[3], r[0]);
+        } else {
+            pose[3] = (pitch > 0.0) ? std::atan2(r[1], r[4]) : -std::atan2(r[1], r[4]);
+            pose[5] = 0.0;
+        }
+        pose[4] = pitch;
+        return pose;
+    }
+
+    /**
+     * @brief Convert a pose with a rotation vector orientation.
+     *
+     * @param pose The pose [x, y, z, rx, ry, rz], the rotation vector is the axis times the angle.
+     * @return QuaternionPose The pose.
+     */
+    static QuaternionPose fromRotationVector(const vector6d_t& pose) {
+        QuaternionPose out;
+        out.position = {pose[0], pose[1], pose[2]};
+        const double angle = std::sqrt(pose[3] * pose[3] + pose[4] * pose[4] + pose[5] * pose[5]);
+        // sin(angle / 2) / angle, its series close to 0
+        const double scale = angle > PoseAlgebraBase::ZERO_TOLERANCE ? std::sin(angle * 0.5) / angle : 0.5 - angle * angle / 48.0;
+        out.orientation = {std::cos(angle * 0.5), pose[3] * scale, pose[4] * scale, pose[5] * scale};
+        return out;
+    }
+
+    /**
+     * @brief Convert to a pose with a rotation vector orientation.
+     *
+     * @return vector6d_t The pose [x, y, z, rx, ry, rz], with an angle in [0, pi].
+     */
+    vector6d_t toRotationVector() const {
+        double w = orientation[0], x = orientation[1], y = orientation[2], z = orientation[3];
+        if (w < 0.0) {
+            w = -w, x = -x, y = -y, z = -z;
+        }
+        const double sin_half = std::sqrt(x * x + y * y + z * z);
+        const double angle = 2.0 * std::atan2(sin_half, w);
+        // angle / sin(angle / 2), its limit close to 0 for a unit quaternion
+        const double scale = sin_half > PoseAlgebraBase::ZERO_TOLERANCE ? angle / sin_half : 2.0 / w;
+        return {position[0], position[1], position[2], x * scale, y * scale, z * scale};
+    }
+
+    /**
+     * @brief Convert a homogeneous pose matrix, its rotation part must be orthonormal.
+     *
+     * @param pose The pose matrix.
+     * @return QuaternionPose The pose.
+     */
+    static QuaternionPose fromMatrix(const PoseMatrix& pose) {
+        const auto& m = pose.data;
+        QuaternionPose out;
+        out.position = {m[0][3], m[1][3], m[2][3]};
+        // Shepperd's method: divide by the largest of the four candidates
+        const double trace = m[0][0] + m[1][1] + m[2][2];
+        if (trace > 0.0) {
+            const double s = 2.0 * std::sqrt(trace + 1.0);
+            out.orientation = {0.25 * s, (m[2][1] - m[1][2]) / s, (m[0][2] - m[2][0]) / s, (m[1][0] - m[0][1]) / s};
+        } else if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+            const double s = 2.0 * std::sqrt(1.0 + m[0][0] - m[1][1] - m[2][2]);
+            out.orientation = {(m[2][1] - m[1][2]) / s, 0.25 * s, (m[0][1] + m[1][0]) / s, (m[0][2] + m[2][0]) / s};
+        } else if (m[1][1] > m[2][2]) {
+            const double s = 2.0 * std::sqrt(1.0 + m[1][1] - m[0][0] - m[2][2]);
+            out.orientation = {(m[0][2] - m[2][0]) / s, (m[0][1] + m[1][0]) / s, 0.25 * s, (m[1][2] + m[2][1]) / s};
+        } else {
+            const double s = 2.0 * std::sqrt(1.0 + m[2][2] - m[0][0] - m[1][1]);
+            out.orientation = {(m[1][0] - m[0][1]) / s, (m[0][2] + m[2][0]) / s, (m[1][2] + m[2][1]) / s, 0.25 * s};
+        }
+        return out;
+    }
+
+    /**
+     * @brief Convert to a homogeneous pose matrix.
+     *
+     * @return PoseMatrix The pose matrix.
+     */
+    PoseMatrix toMatrix() const {
+        double r[9];
+        toRotation(r);
+        PoseMatrix pose;
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                pose.data[i][j] = r[i * 3 + j];
+            }
+            pose.data[i][3] = position[i];
+        }
+        return pose;
+    }
+
+    /**
+     * @brief Convert many poses of the controller format.
+     *
+     * @param poses The poses [x, y, z, roll, pitch, yaw], n elements.
+     * @param out The poses, n elements.
+     * @param n Number of elements.
+     */
+    static void fromRpyBatch(const vector6d_t* poses, QuaternionPose* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = fromRpy(poses[i]);
+        }
+    }
+
+    /**
+     * @brief Convert many poses to the pose format of the controller.
+     *
+     * @param poses The poses, n elements.
+     * @param out The poses [x, y, z, roll, pitch, yaw], n elements.
+     * @param n Number of elements.
+     */
+    static void toRpyBatch(const QuaternionPose* poses, vector6d_t* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = poses[i].toRpy();
+        }
+    }
+
+   private:
+    // The row-major rotation matrix, scaled by 2 / |q|^2 so a quaternion that drifted from unit length still gives a
+    // rotation
+    void toRotation(double r[9]) const {
+        const double w = orientation[0], x = orientation[1], y = orientation[2], z = orientation[3];
+        const double norm2 = w * w + x * x + y * y + z * z;
+        const double s = norm2 > 0.0 ? 2.0 / norm2 : 0.0;
+        r[0] = 1.0 - s * (y * y + z * z);
+        r[1] = s * (x * y - w * z);
+        r[2] = s * (x * z + w * y);
+        r[3] = s * (x * y + w * z);
+        r[4] = 1.0 - s * (x * x + z * z);
+        r[5] = s * (y * z - w * x);
+        r[6] = s * (x * z - w * y);
+        r[7] = s * (y * z + w * x);
+        r[8] = 1.0 - s * (x * x + y * y);
+    }
+};
+
+}  // namespace ELITE
+
+#endif  // __ELITE__QUATERNION_POSE_HPP__
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// PrimaryConnectionHealth.hpp
+// Provides the reconnect policy, connection state and connection metrics of the robot primary port.
+#ifndef __ELITE__PRIMARY_CONNECTION_HEALTH_HPP__
+#define __ELITE__PRIMARY_CONNECTION_HEALTH_HPP__
+
+#include <cstdint>
+
+namespace ELITE {
+
+/**
+ * @brief The state of the primary port connection.
+ *
+ */
+enum class PrimaryConnectionState : int {
+    DISCONNECTED = 0,  // Not connected, or the last connect attempt failed.
+    CONNECTING = 1,    // A connect attempt is in progress.
+    CONNECTED = 2,     // Connected and receiving messages.
+    BACKOFF = 3        // Waiting before the next reconnect attempt.
+};
+
+/**
+ * @brief Reconnect policy of the primary port.
+ *  The delay before the n-th consecutive reconnect attempt is
+ *  min(max_delay_ms, initial_delay_ms * multiplier^(n-1)), randomly spread by +/- jitter.
+ */
+class PrimaryReconnectPolicy {
+   public:
+    // The delay [ms] before the first reconnect attempt after the connection was lost.
+    int initial_delay_ms = 100;
+
+    // The upper bound [ms] of the delay between two reconnect attempts.
+    int max_delay_ms = 5000;
+
+    // The growth factor of the delay after each failed attempt. Values below 1 are treated as 1.
+    double multiplier = 2.0;
+
+    // The relative random spread of each delay, range [0, 1]. 0.2 means +/-20%.
+    double jitter = 0.2;
+
+    // The timeout [ms] of a single connect attempt.
+    int connect_timeout_ms = 500;
+
+    PrimaryReconnectPolicy() = default;
+    ~PrimaryReconnectPolicy() = default;
+};
+
+/**
+ * @brief Statistics of the primary port connection.
+ *
+ */
+class PrimaryConnectionMetrics {
+   public:
+    // Current connection state.
+    PrimaryConnectionState state = PrimaryConnectionState::DISCONNECTED;
+
+    // Number of connect attempts, including the first connect().
+    uint64_t connect_attempts = 0;
+
+    // Number of failed connect attempts.
+    uint64_t connect_failures = 0;
+
+    // Number of times the connection was restored by the background thread.
+    uint64_t reconnect_successes = 0;
+
+    // Number of times an established connection was lost.
+    uint64_t disconnections = 0;
+
+    // Number of failed attempts since the connection was lost.
+    uint32_t consecutive_failures = 0;
+
+    // The delay [ms] of the current (or last) backoff.
+    int current_backoff_ms = 0;
+
+    // The duration [ms] of the last outage, from connection lost to connection restored.
+    uint64_t last_downtime_ms = 0;
+
+    PrimaryConnectionMetrics() = default;
+    ~PrimaryConnectionMetrics() = default;
+};
+
+}  // namespace ELITE
+
+#endif
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// PrimaryMessageCapture.hpp
+// Provides the reader and writer of timestamped primary port message captures.
+#ifndef __ELITE__PRIMARY_MESSAGE_CAPTURE_HPP__
+#define __ELITE__PRIMARY_MESSAGE_CAPTURE_HPP__
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ELITE {
+
+/**
+ * @brief One raw primary port message in a capture.
+ *
+ */
+struct PrimaryCaptureRecord {
+    // Receive time [us] since epoch
+    uint64_t timestamp_us = 0;
+    // The whole message, including the 5 bytes package head
+    std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Capture file layout (all integers are big-endian, the same as the primary port):
+ *  file   = magic record*
+ *  magic  = "ELIPCAP1" (8 bytes)
+ *  record = uint64 timestamp_us, uint32 length, uint8[length] message
+ */
+class PrimaryCaptureWriter {
+   private:
+    std::ofstream file_;
+
+   public:
+    PrimaryCaptureWriter() = default;
+    ~PrimaryCaptureWriter() { close(); }
+
+    /**
+     * @brief Create or truncate a capture file and write the magic.
+     *
+     * @param path File path
+     * @return true success
+     * @return false fail
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Append one message. The message is given in two parts so the port can pass head and body without copying.
+     *
+     * @param timestamp_us Receive time [us]
+     * @param head First part of the message
+     * @param head_len Length of the first part
+     * @param body Second part of the message
+     * @param body_len Length of the second part
+     * @return true success
+     * @return false fail
+     */
+    bool write(uint64_t timestamp_us, const uint8_t* head, size_t head_len, const uint8_t* body = nullptr, size_t body_len = 0);
+
+    /**
+     * @brief Flush and close the file
+     *
+     */
+    void close();
+
+    bool isOpen() const { return file_.is_open(); }
+};
+
+class PrimaryCaptureReader {
+   private:
+    std::ifstream file_;
+
+   public:
+    // Records longer than this are treated as a corrupt file
+    static constexpr uint32_t MAX_RECORD_LENGTH = 1 << 24;
+
+    PrimaryCaptureReader() = default;
+    ~PrimaryCaptureReader() = default;
+
+    /**
+     * @brief Open a capture file and check the magic.
+     *
+     * @param path File path
+     * @return true success
+     * @return false fail or not a capture file
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Read the next record
+     *
+     * @param record Output record
+     * @return true success
+     * @return false end of file or corrupt record
+     */
+    bool next(PrimaryCaptureRecord& record);
+
+    /**
+     * @brief Read a whole capture file
+     *
+     * @param path File path
+     * @param records Output records
+     * @return true success
+     * @return false fail
+     */
+    static bool load(const std::string& path, std::vector<PrimaryCaptureRecord>& records);
+};
+
+}  // namespace ELITE
+
+#endif
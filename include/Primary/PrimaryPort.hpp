@@ -7,10 +7,16 @@
 #define __ELITE__PRIMARY_PORT_HPP__
 
 #include "DataType.hpp"
+#include "PrimaryConnectionHealth.hpp"
+#include "PrimaryMessageCapture.hpp"
 #include "PrimaryPackage.hpp"
+#include "ReconnectBackoff.hpp"
 #include "RobotException.hpp"
 
+#include <atomic>
 #include <boost/asio.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -29,6 +35,10 @@ class PrimaryPort {
     static constexpr int ROBOT_STATE_MSG_TYPE = 16;
     // The type of 'RobotException' package
     static constexpr int ROBOT_EXCEPTION_MSG_TYPE = 20;
+    // The sub-package head length of 'RobotState' package
+    static constexpr int SUB_HEAD_LENGTH = 5;
+    // Upper bound of a package length. A larger value means the stream is corrupt, don't allocate for it.
+    static constexpr uint32_t MAX_PACKAGE_LENGTH = 1 << 20;
 
     std::mutex socket_mutex_;
     boost::asio::io_context io_context_;
@@ -43,9 +53,25 @@ class PrimaryPort {
 
     // When getPackage() be called, insert a sub-package data to get
     std::unordered_map<int, std::shared_ptr<PrimaryPackage>> parser_sub_msg_;
+    // Packages added by subscribePackage(). They are updated by every 'RobotState' package and
+    // are kept across reconnects, so subscribers continue to receive data once the link is back.
+    std::unordered_map<int, std::vector<std::shared_ptr<PrimaryPackage>>> subscribed_msg_;
     std::unique_ptr<std::thread> socket_async_thread_;
     std::mutex mutex_;
-    bool socket_async_thread_alive_;
+    std::atomic<bool> socket_async_thread_alive_;
+
+    // Protects the reconnect backoff, metrics and state callback.
+    std::mutex health_mutex_;
+    // Wakes the background thread from a backoff wait when disconnect() is called.
+    std::condition_variable backoff_cv_;
+    ReconnectBackoff backoff_;
+    PrimaryConnectionMetrics metrics_;
+    std::chrono::steady_clock::time_point connection_lost_time_;
+    std::function<void(PrimaryConnectionState)> connection_state_cb_;
+
+    // Raw message capture, see startCapture()
+    std::mutex capture_mutex_;
+    std::unique_ptr<PrimaryCaptureWriter> capture_;
 
     /**
      * @brief The background thread.
@@ -56,8 +82,11 @@ class PrimaryPort {
     /**
      * @brief Receive and parser package.
      *
+     * @param received Set to true if a package head was received.
+     * @return true The connection is fine
+     * @return false The connection is broken or the stream is corrupt
      */
-    bool parserMessage();
+    bool parserMessage(bool& received);
 
     /**
      * @brief Receive and parser package body.
@@ -67,6 +96,29 @@ class PrimaryPort {
      */
     bool parserMessageBody(int type, int package_len);
 
+    /**
+     * @brief Parser the sub-packages of the 'RobotState' package in message_body_.
+     *
+     */
+    void parserRobotState();
+
+    /**
+     * @brief Read exactly len bytes with a 500ms timeout.
+     *
+     * @param data Output buffer
+     * @param len Bytes to read
+     * @return true success
+     * @return false fail or timeout
+     */
+    bool receiveWithTimeout(uint8_t* data, size_t len);
+
+    /**
+     * @brief Write the current message to the capture file if capture is enabled.
+     *
+     * @param with_body Whether message_body_ belongs to the message
+     */
+    void captureMessage(bool with_body);
+
     /**
      * @brief Connect to robot primary port.
      *
@@ -84,7 +136,45 @@ class PrimaryPort {
      */
     void socketDisconnect();
 
-    bool socketReconnect(const std::string& ip, int port, bool is_last_connect_success);
+    /**
+     * @brief Wait for the backoff delay and try to connect once.
+     *
+     * @param ip The robot ip
+     * @param port The port(30001 or 30002)
+     * @return true Connection restored
+     * @return false Attempt failed or disconnect() was called
+     */
+    bool socketReconnect(const std::string& ip, int port);
+
+    /**
+     * @brief Sleep for the backoff delay. Return early when disconnect() is called.
+     *
+     * @param delay Backoff delay
+     * @return true The background thread should continue
+     * @return false disconnect() was called
+     */
+    bool waitBackoff(std::chrono::milliseconds delay);
+
+    /**
+     * @brief Record the lost connection and report 'ROBOT_DISCONNECTED' exception.
+     *
+     */
+    void onConnectionLost();
+
+    /**
+     * @brief Update the connection state and call the state callback if the state changed.
+     *
+     * @param state New state
+     */
+    void setConnectionState(PrimaryConnectionState state);
+
+    /**
+     * @brief Update the connection state without calling the state callback.
+     *  For callers that hold socket_mutex_: the callback may call back into the port, so run it after the lock is released.
+     * @param state New state
+     * @return The callback to call with the state, empty if the state didn't change or no callback is registered
+     */
+    std::function<void(PrimaryConnectionState)> recordConnectionState(PrimaryConnectionState state);
 
     RobotExceptionSharedPtr parserException(const std::vector<uint8_t>& msg_body);
 
@@ -153,6 +243,71 @@ class PrimaryPort {
      *           representing the received exception.
      */
     void registerRobotExceptionCallback(std::function<void(RobotExceptionSharedPtr)> cb) { robot_exception_cb_ = cb; }
+
+    /**
+     * @brief Start to write every received raw message to a capture file (see PrimaryMessageCapture.hpp).
+     *  Captures can be replayed with PrimaryReplayServer.
+     * @param path Capture file path. An existing file is truncated.
+     * @return true success
+     * @return false fail
+     */
+    bool startCapture(const std::string& path);
+
+    /**
+     * @brief Stop capture and close the file.
+     *
+     */
+    void stopCapture();
+
+    /**
+     * @brief Subscribe a primary sub-package.
+     *  Unlike getPackage(), the package is updated by every 'RobotState' package until unsubscribePackage() is called,
+     *  and the subscription survives reconnects.
+     * @param pkg Primary sub-package.
+     */
+    void subscribePackage(std::shared_ptr<PrimaryPackage> pkg);
+
+    /**
+     * @brief Remove a subscription added by subscribePackage().
+     *
+     * @param pkg Primary sub-package.
+     */
+    void unsubscribePackage(std::shared_ptr<PrimaryPackage> pkg);
+
+    /**
+     * @brief Set the reconnect policy of the background thread.
+     *
+     * @param policy Reconnect policy
+     */
+    void setReconnectPolicy(const PrimaryReconnectPolicy& policy);
+
+    /**
+     * @brief Get the reconnect policy
+     *
+     * @return PrimaryReconnectPolicy Reconnect policy
+     */
+    PrimaryReconnectPolicy getReconnectPolicy();
+
+    /**
+     * @brief Get the connection state
+     *
+     * @return PrimaryConnectionState Connection state
+     */
+    PrimaryConnectionState getConnectionState();
+
+    /**
+     * @brief Get the connection metrics
+     *
+     * @return PrimaryConnectionMetrics Connection metrics
+     */
+    PrimaryConnectionMetrics getConnectionMetrics();
+
+    /**
+     * @brief Registers a callback for connection state changes.
+     *  The callback is called from the background thread, don't block in it.
+     * @param cb Callback
+     */
+    void registerConnectionStateCallback(std::function<void(PrimaryConnectionState)> cb);
 };
 
 }  // namespace ELITE
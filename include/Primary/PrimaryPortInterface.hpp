@@ -7,6 +7,7 @@
 #define __ELITE__PRIMARY_PORT_INTERFACE_HPP__
 
 #include <Elite/EliteOptions.hpp>
+#include <Elite/PrimaryConnectionHealth.hpp>
 #include <Elite/PrimaryPackage.hpp>
 #include <Elite/RobotException.hpp>
 #include <functional>
@@ -82,6 +83,71 @@ class PrimaryPortInterface {
      *           representing the received exception.
      */
     ELITE_EXPORT void registerRobotExceptionCallback(std::function<void(RobotExceptionSharedPtr)> cb);
+
+    /**
+     * @brief Start to write every received raw message, with a receive timestamp, to a capture file.
+     *  A capture recorded on a real robot can be replayed offline to reproduce parsing problems.
+     * @param path Capture file path. An existing file is truncated.
+     * @return true success
+     * @return false fail
+     */
+    ELITE_EXPORT bool startCapture(const std::string& path);
+
+    /**
+     * @brief Stop capture and close the file.
+     *
+     */
+    ELITE_EXPORT void stopCapture();
+
+    /**
+     * @brief Subscribe a primary sub-package.
+     *  Unlike getPackage(), the package is updated by every 'RobotState' package until unsubscribePackage() is called,
+     *  and the subscription survives reconnects. Use PrimaryPackage::waitUpdate() to wait for data.
+     * @param pkg Primary sub-package.
+     */
+    ELITE_EXPORT void subscribePackage(std::shared_ptr<PrimaryPackage> pkg);
+
+    /**
+     * @brief Remove a subscription added by subscribePackage().
+     *
+     * @param pkg Primary sub-package.
+     */
+    ELITE_EXPORT void unsubscribePackage(std::shared_ptr<PrimaryPackage> pkg);
+
+    /**
+     * @brief Set the reconnect policy used when the connection is lost.
+     *  The background thread waits with a jittered exponential backoff between reconnect attempts.
+     * @param policy Reconnect policy
+     */
+    ELITE_EXPORT void setReconnectPolicy(const PrimaryReconnectPolicy& policy);
+
+    /**
+     * @brief Get the reconnect policy
+     *
+     * @return PrimaryReconnectPolicy Reconnect policy
+     */
+    ELITE_EXPORT PrimaryReconnectPolicy getReconnectPolicy();
+
+    /**
+     * @brief Get the connection state
+     *
+     * @return PrimaryConnectionState Connection state
+     */
+    ELITE_EXPORT PrimaryConnectionState getConnectionState();
+
+    /**
+     * @brief Get the connection metrics, such as reconnect attempts and the last downtime.
+     *
+     * @return PrimaryConnectionMetrics Connection metrics
+     */
+    ELITE_EXPORT PrimaryConnectionMetrics getConnectionMetrics();
+
+    /**
+     * @brief Registers a callback for connection state changes.
+     *  The callback is called from the background thread, don't block in it.
+     * @param cb A callback function that takes the new state.
+     */
+    ELITE_EXPORT void registerConnectionStateCallback(std::function<void(PrimaryConnectionState)> cb);
 };
 
 }  // namespace ELITE
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// PrimaryReplayServer.hpp
+// Provides a local TCP server that replays captured primary port messages, for tests and benchmarks.
+#ifndef __ELITE__PRIMARY_REPLAY_SERVER_HPP__
+#define __ELITE__PRIMARY_REPLAY_SERVER_HPP__
+
+#include "PrimaryMessageCapture.hpp"
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ELITE {
+
+class PrimaryReplayServer {
+   private:
+    std::vector<PrimaryCaptureRecord> records_;
+    double speed_;
+    int repeat_;
+
+    boost::asio::io_context io_context_;
+    std::unique_ptr<boost::asio::ip::tcp::acceptor> acceptor_;
+    std::shared_ptr<boost::asio::ip::tcp::socket> client_;
+    std::mutex client_mutex_;
+    std::unique_ptr<std::thread> thread_;
+    std::atomic<bool> running_;
+    std::atomic<uint64_t> sent_messages_;
+    std::atomic<int> sessions_;
+
+    void serveLoop();
+    void replay(std::shared_ptr<boost::asio::ip::tcp::socket> client);
+
+   public:
+    /**
+     * @brief Construct a new Primary Replay Server object
+     *
+     * @param records Messages to replay, in order.
+     */
+    explicit PrimaryReplayServer(std::vector<PrimaryCaptureRecord> records);
+    ~PrimaryReplayServer();
+
+    /**
+     * @brief Set the replay speed.
+     *
+     * @param speed 0 sends as fast as possible, 1 keeps the captured timing, 2 is twice as fast.
+     */
+    void setSpeed(double speed) { speed_ = speed; }
+
+    /**
+     * @brief Set how many times the records are sent to each client.
+     *
+     * @param repeat Repeat count. 0 repeats until the client disconnects.
+     */
+    void setRepeat(int repeat) { repeat_ = repeat; }
+
+    /**
+     * @brief Listen on the loopback address and start the replay thread.
+     *  Every accepted client gets the records from the beginning.
+     * @param port Listen port. 0 picks a free ephemeral port.
+     * @return int The listen port, or -1 on failure.
+     */
+    int start(int port = 0);
+
+    /**
+     * @brief Close the client and stop the replay thread.
+     *
+     */
+    void stop();
+
+    /**
+     * @brief Get the listen port
+     *
+     * @return int Listen port, -1 if not started
+     */
+    int getPort();
+
+    /**
+     * @brief Number of messages sent to all clients.
+     *
+     */
+    uint64_t sentMessages() const { return sent_messages_; }
+
+    /**
+     * @brief Number of accepted clients.
+     *
+     */
+    int sessions() const { return sessions_; }
+};
+
+}  // namespace ELITE
+
+#endif
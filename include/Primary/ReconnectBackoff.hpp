@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// ReconnectBackoff.hpp
+// Provides the ReconnectBackoff class that computes jittered exponential reconnect delays.
+#ifndef __ELITE__RECONNECT_BACKOFF_HPP__
+#define __ELITE__RECONNECT_BACKOFF_HPP__
+
+#include "PrimaryConnectionHealth.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+namespace ELITE {
+
+class ReconnectBackoff {
+   private:
+    PrimaryReconnectPolicy policy_;
+    uint32_t attempts_;
+    std::mt19937 random_;
+
+   public:
+    /**
+     * @brief Construct a new Reconnect Backoff object
+     *
+     * @param policy Reconnect policy
+     * @param seed Random seed of the jitter
+     */
+    explicit ReconnectBackoff(const PrimaryReconnectPolicy& policy, uint32_t seed = std::random_device{}());
+
+    /**
+     * @brief Set a new policy. The attempt counter is kept.
+     *
+     * @param policy Reconnect policy
+     */
+    void setPolicy(const PrimaryReconnectPolicy& policy);
+
+    /**
+     * @brief Get the policy
+     *
+     * @return const PrimaryReconnectPolicy& Reconnect policy
+     */
+    const PrimaryReconnectPolicy& getPolicy() const { return policy_; }
+
+    /**
+     * @brief Get the delay before the next attempt and count the attempt.
+     *
+     * @return std::chrono::milliseconds Delay
+     */
+    std::chrono::milliseconds nextDelay();
+
+    /**
+     * @brief Restart from the initial delay. Call it after a successful connection.
+     *
+     */
+    void reset() { attempts_ = 0; }
+
+    /**
+     * @brief Get the number of attempts since the last reset.
+     *
+     * @return uint32_t Attempts
+     */
+    uint32_t attempts() const { return attempts_; }
+};
+
+}  // namespace ELITE
+
+#endif
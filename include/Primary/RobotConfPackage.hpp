@@ -59,6 +59,43 @@ class KinematicsInfo : public RobotConfPackage {
     ELITE_EXPORT void parser(int len, const std::vector<uint8_t>::const_iterator& iter);
 };
 
+/**
+ * @brief The joint limits and default speeds in RobotConfig message
+ *
+ */
+class JointLimitsInfo : public RobotConfPackage {
+   private:
+    // The limits follow the sub-header of the message
+    static constexpr int LIMITS_OFFSET = sizeof(uint32_t) + sizeof(uint8_t);
+
+   public:
+    ELITE_EXPORT JointLimitsInfo() = default;
+    ELITE_EXPORT ~JointLimitsInfo() = default;
+
+    // Joint position limits, rad
+    vector6d_t joint_min_{};
+    vector6d_t joint_max_{};
+    // Joint velocity limits, rad/s
+    vector6d_t max_velocity_{};
+    // Joint acceleration limits, rad/s^2
+    vector6d_t max_acceleration_{};
+    // Defaults of movej, rad/s and rad/s^2
+    double default_velocity_ = 0;
+    double default_acceleration_ = 0;
+    // Defaults of movel, m/s and m/s^2
+    double default_tool_velocity_ = 0;
+    double default_tool_acceleration_ = 0;
+    double eq_radius_ = 0;
+
+    /**
+     * @brief Parser message from robot. Internal use.
+     *
+     * @param len The len of sub-package
+     * @param iter Position of the sub-package in the entire package
+     */
+    ELITE_EXPORT void parser(int len, const std::vector<uint8_t>::const_iterator& iter);
+};
+
 }  // namespace ELITE
 
 #endif
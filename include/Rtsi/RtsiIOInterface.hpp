@@ -13,7 +13,9 @@
 #include <Elite/VersionInfo.hpp>
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 
@@ -89,6 +91,15 @@ class RtsiIOInterface : protected RtsiClientInterface {
      */
     ELITE_EXPORT virtual VersionInfo getControllerVersion();
 
+    /**
+     * @brief Wait for the next output recipe package from the robot
+     *
+     * @param timeout_ms Timeout, millisecond
+     * @return true a new package was received
+     * @return false timeout or the sync thread is stopped
+     */
+    ELITE_EXPORT bool waitForUpdate(unsigned timeout_ms);
+
     /**
      * @brief Set the robot speed scaling
      *
@@ -502,6 +513,18 @@ class RtsiIOInterface : protected RtsiClientInterface {
 
     std::unique_ptr<std::thread> recv_thread_;
     std::atomic<bool> is_recv_thread_alive_;
+
+    // Counts the received output packages, waitForUpdate() waits on it
+    std::mutex update_mutex_;
+    std::condition_variable update_cv_;
+    uint64_t update_count_;
+
+    /**
+     * @brief Wake up the threads waiting for an update
+     *
+     * @param received A new package was received
+     */
+    void notifyUpdate(bool received);
     VersionInfo controller_version_;
 
     /**
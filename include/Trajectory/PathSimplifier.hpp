@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// PathSimplifier.hpp
+// Provides the PathSimplifier class, tolerance bounded decimation of dense paths and blend radii for
+// writeTrajectoryPoint().
+#ifndef __ELITE__PATH_SIMPLIFIER_HPP__
+#define __ELITE__PATH_SIMPLIFIER_HPP__
+
+#include <Elite/DataType.hpp>
+#include <Elite/EliteOptions.hpp>
+#include <Elite/KinematicsBase.hpp>
+#include <Elite/QuaternionPose.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ELITE {
+
+/**
+ * @brief Options of PathSimplifier
+ *
+ */
+struct PathSimplifierOptions {
+    // Largest deviation of a joint from the simplified joint path, in rad
+    double joint_tolerance = 0.001;
+    // Largest deviation of the TCP position from the simplified path, in meters. It bounds Cartesian paths, and joint
+    // paths when the simplifier has a kinematics solver.
+    double position_tolerance = 0.0005;
+    // Largest deviation of the TCP orientation from the simplified Cartesian path, in radians
+    double orientation_tolerance = 0.005;
+    // Share of each tolerance kept for the blends, in [0, 1). The decimation uses the rest. Not used by a joint path
+    // without a kinematics solver, which gets no blends.
+    double blend_share = 0.5;
+    // Largest blend radius, in meters
+    double max_blend_radius = 0.05;
+};
+
+/**
+ * @brief A point of the simplified path
+ *
+ */
+struct SimplifiedWaypoint {
+    // The joint or Cartesian positions
+    vector6d_t positions{};
+    // Index of the point in the input path
+    size_t index = 0;
+    // The blend radius for writeTrajectoryPoint(), in meters. 0 for the first and the last points.
+    double blend_radius = 0;
+};
+
+/**
+ * @brief Counters of the last PathSimplifier::simplify()
+ *
+ */
+struct PathSimplifierStats {
+    size_t input_points = 0;
+    size_t output_points = 0;
+    // Largest deviations of an input point from the simplified path
+    double max_joint_deviation = 0;
+    double max_position_deviation = 0;
+    double max_orientation_deviation = 0;
+
+    /**
+     * @brief Removed points over input points, 0 before the first call
+     *
+     */
+    double reduction() const {
+        return input_points ? 1.0 - static_cast<double>(output_points) / static_cast<double>(input_points) : 0.0;
+    }
+};
+
+/**
+ * @brief Simplification of a dense path before writeTrajectoryPoint().
+ * @verbatim
+ *  The trajectory thread of the external control script runs one movej or movel per point, so a dense path runs as
+ *  thousands of short motions. simplify() removes the points the path does not need (Douglas-Peucker): a point is kept
+ *  when an input point between its neighbors deviates from the straight motion between them by more than the
+ *  tolerances. A joint path is checked against joint_tolerance, and against position_tolerance on the TCP positions
+ *  when the simplifier has a kinematics solver. A Cartesian path [x, y, z, roll, pitch, yaw] is checked against
+ *  position_tolerance and orientation_tolerance.
+ *  Then each inner point gets the largest blend radius that keeps the TCP position, and the orientation of a Cartesian
+ *  path or the joints of a joint path, within the tolerances of the input path. The deviation of a blend is estimated
+ *  on the corner of the two segments of the point, and a radius is at most half of the shorter segment so that the
+ *  blends do not overlap. A joint path without a kinematics solver gets no blends.
+ * @endverbatim
+ *
+ */
+class PathSimplifier {
+   public:
+    /**
+     * @brief Construct the simplifier
+     *
+     * @param options The options
+     * @param kinematics The kinematics solver with its MDH set, for the TCP positions of joint paths. Optional.
+     */
+    ELITE_EXPORT explicit PathSimplifier(const PathSimplifierOptions& options = PathSimplifierOptions(),
+                                         KinematicsBaseSharedPtr kinematics = nullptr);
+
+    /**
+     * @brief Simplify a path
+     *
+     * @param points The joint or Cartesian positions of the path
+     * @param cartesian True if the points are Cartesian, false if they are joint positions
+     * @param waypoints The kept points with their blend radii
+     * @return true simplified
+     * @return false fewer than 2 points, non-finite values, tolerances not greater than 0 or a failed FK
+     */
+    ELITE_EXPORT bool simplify(const std::vector<vector6d_t>& points, bool cartesian, std::vector<SimplifiedWaypoint>& waypoints);
+
+    ELITE_EXPORT const PathSimplifierStats& getStats() const { return stats_; }
+
+   private:
+    PathSimplifierOptions options_;
+    KinematicsBaseSharedPtr kinematics_;
+    PathSimplifierStats stats_;
+
+    // The largest deviations of the input points from a segment of the simplified path
+    struct SegmentDeviation {
+        double joint = 0;
+        double position = 0;
+        double orientation = 0;
+    };
+
+    // TCP poses and orientations of the input points, the kept flags and the deviations of the segment starting at
+    // each kept point
+    std::vector<vector6d_t> tcp_;
+    std::vector<QuaternionPose> orientations_;
+    std::vector<char> keep_;
+    std::vector<SegmentDeviation> segment_deviations_;
+    std::vector<std::pair<size_t, size_t>> stack_;
+
+    // The deviations of point i from the motion between points first and last
+    bool deviation(const std::vector<vector6d_t>& points, bool cartesian, size_t first, size_t last, size_t i, double& joint,
+                   double& position, double& orientation) const;
+
+    double blendRadius(const std::vector<vector6d_t>& points, bool cartesian, size_t previous, size_t current,
+                       size_t next) const;
+};
+
+}  // namespace ELITE
+
+#endif  // __ELITE__PATH_SIMPLIFIER_HPP__
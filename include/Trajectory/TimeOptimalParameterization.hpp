@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// TimeOptimalParameterization.hpp
+// Provides the TimeOptimalParameterization class, the fastest timing of a joint path under joint velocity and
+// acceleration limits.
+#ifndef __ELITE__TIME_OPTIMAL_PARAMETERIZATION_HPP__
+#define __ELITE__TIME_OPTIMAL_PARAMETERIZATION_HPP__
+
+#include <Elite/DataType.hpp>
+#include <Elite/EliteOptions.hpp>
+#include <Elite/RobotConfPackage.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace ELITE {
+
+/**
+ * @brief Options of TimeOptimalParameterization
+ *
+ */
+struct TimeOptimalOptions {
+    // Joint velocity limits, rad/s
+    vector6d_t max_velocity{};
+    // Joint acceleration limits, rad/s^2
+    vector6d_t max_acceleration{};
+    // Fractions of the limits the path is timed with, in (0, 1]
+    double velocity_scale = 1.0;
+    double acceleration_scale = 1.0;
+    // Largest step of the grid the limits are enforced on, in rad of path length. The grid has at least the
+    // waypoints, a dense path is not refined.
+    double grid_step = 0.02;
+
+    TimeOptimalOptions() = default;
+
+    /**
+     * @brief The limits of the robot, read from the primary port
+     *
+     * @param limits The joint limits of the RobotConfig message
+     */
+    explicit TimeOptimalOptions(const JointLimitsInfo& limits)
+        : max_velocity(limits.max_velocity_), max_acceleration(limits.max_acceleration_) {}
+};
+
+/**
+ * @brief Time-optimal parameterization of a joint path (TOPP-RA).
+ * @verbatim
+ *  The waypoints are joined by a cubic spline over the joint path length. The path is timed on a grid of path
+ *  positions: a backward pass computes at each grid point the largest path speed from which the robot can still stop
+ *  at the end within the limits, then a forward pass accelerates as much as these sets allow. The path starts and ends
+ *  at rest. The limits are enforced at the grid points, the acceleration is constant in between.
+ *  A compute() is O(waypoints) and allocates only when the path is longer than the previous one, so it can run for
+ *  every new motion, e.g. per pick. The result is sampled at the servoj period for writeServoj(), or at a longer
+ *  period for writeTrajectoryPoint() with the period as the time of each point.
+ * @endverbatim
+ *
+ */
+class TimeOptimalParameterization {
+   public:
+    /**
+     * @brief Construct the parameterization
+     *
+     * @param options The options
+     */
+    ELITE_EXPORT explicit TimeOptimalParameterization(const TimeOptimalOptions& options = TimeOptimalOptions());
+
+    ELITE_EXPORT void setOptions(const TimeOptimalOptions& options) { options_ = options; }
+
+    ELITE_EXPORT const TimeOptimalOptions& getOptions() const { return options_; }
+
+    /**
+     * @brief Time a joint path
+     *
+     * @param waypoints The joint positions of the path, consecutive duplicates are skipped
+     * @return true timed
+     * @return false fewer than 2 distinct waypoints, non-finite values or limits not greater than 0
+     */
+    ELITE_EXPORT bool compute(const std::vector<vector6d_t>& waypoints);
+
+    /**
+     * @brief Time of the path, 0 before a successful compute()
+     *
+     */
+    ELITE_EXPORT double getDuration() const { return times_.empty() ? 0.0 : times_.back(); }
+
+    /**
+     * @brief Time at which the path reaches each of the waypoints given to compute(), from the start of the path
+     *
+     */
+    ELITE_EXPORT const std::vector<double>& getWaypointTimes() const { return waypoint_times_; }
+
+    /**
+     * @brief The state of the path at a time
+     *
+     * @param time Time from the start of the path, clamped to [0, getDuration()]
+     * @param position The joint positions
+     * @param velocity The joint velocities
+     * @return true sampled
+     * @return false no path was computed
+     */
+    ELITE_EXPORT bool sample(double time, vector6d_t& position, vector6d_t& velocity) const;
+
+    /**
+     * @brief Sample the path at a fixed period, e.g. the servoj_time of EliteDriverConfig
+     *
+     * @param period The period, in seconds
+     * @param positions The joint positions at 0, period, 2 * period... and at getDuration() for the last one
+     * @return true sampled
+     * @return false no path was computed or period is not greater than 0
+     */
+    ELITE_EXPORT bool sampleUniform(double period, std::vector<vector6d_t>& positions) const;
+
+   private:
+    TimeOptimalOptions options_;
+
+    // The cubic spline: knot positions on the path, the distinct waypoints and their second derivatives, the knot of
+    // each waypoint and the grid point of each knot
+    std::vector<double> knots_;
+    std::vector<vector6d_t> points_;
+    std::vector<vector6d_t> second_derivatives_;
+    std::vector<size_t> waypoint_knots_;
+    std::vector<size_t> knot_grid_;
+
+    // The grid: path position, spline segment, largest controllable squared path speed, squared path speed and time
+    std::vector<double> grid_;
+    std::vector<size_t> grid_segments_;
+    std::vector<double> controllable_;
+    std::vector<double> speeds_;
+    std::vector<double> times_;
+
+    std::vector<double> waypoint_times_;
+
+    // Scratch of the spline solve
+    std::vector<double> scratch_;
+
+    bool buildSpline(const std::vector<vector6d_t>& waypoints);
+
+    void buildGrid();
+
+    void evaluate(size_t segment, double s, vector6d_t* position, vector6d_t* first, vector6d_t* second) const;
+
+    // The path position and speed at a time, from the grid interval containing it
+    void locate(double time, size_t& interval, double& s, double& speed) const;
+};
+
+}  // namespace ELITE
+
+#endif  // __ELITE__TIME_OPTIMAL_PARAMETERIZATION_HPP__
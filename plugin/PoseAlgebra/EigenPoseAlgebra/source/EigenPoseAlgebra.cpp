@@ -29,32 +29,32 @@ ELITE::PoseMatrix toPoseMatrix(const Eigen::Matrix4d& matrix) {
     return pose;
 }
 
-bool validateRotation(const Eigen::Matrix3d& rotation, ELITE::PoseAlgebraResult& result, const std::string& name) {
+bool validateRotation(const Eigen::Matrix3d& rotation, ELITE::PoseAlgebraResult& result, const char* name) {
     const Eigen::Matrix3d should_be_identity = rotation.transpose() * rotation;
     const double orthonormal_error = (should_be_identity - Eigen::Matrix3d::Identity()).cwiseAbs().maxCoeff();
     if (orthonormal_error > ELITE::PoseAlgebraBase::ZERO_TOLERANCE) {
         ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::INVALID_ROTATION_MATRIX,
-                                         name + " contains a non-orthonormal rotation matrix");
+                                         name, ELITE::PoseAlgebraBase::NON_ORTHONORMAL_DETAIL);
         return false;
     }
 
     const double determinant = rotation.determinant();
     if (std::fabs(determinant) < ELITE::PoseAlgebraBase::ZERO_TOLERANCE) {
         ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::SINGULAR_MATRIX,
-                                         name + " rotation matrix is singular and cannot be inverted");
+                                         name, ELITE::PoseAlgebraBase::SINGULAR_DETAIL);
         return false;
     }
 
     if (std::fabs(determinant - 1.0) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE) {
         ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::INVALID_ROTATION_MATRIX,
-                                         name + " rotation determinant is not close to +1");
+                                         name, ELITE::PoseAlgebraBase::DETERMINANT_DETAIL);
         return false;
     }
 
     return true;
 }
 
-bool validatePoseMatrix(const ELITE::PoseMatrix& pose, ELITE::PoseAlgebraResult& result, const std::string& name) {
+bool validatePoseMatrix(const ELITE::PoseMatrix& pose, ELITE::PoseAlgebraResult& result, const char* name) {
     if (!ELITE::PoseAlgebraBase::validateMatrixFinite(pose, result, name)) {
         return false;
     }
@@ -62,16 +62,18 @@ bool validatePoseMatrix(const ELITE::PoseMatrix& pose, ELITE::PoseAlgebraResult&
     const Eigen::Matrix4d matrix = toEigenMatrix(pose);
     if (std::fabs(matrix(3, 0)) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE || std::fabs(matrix(3, 1)) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE ||
         std::fabs(matrix(3, 2)) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE || std::fabs(matrix(3, 3) - 1.0) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE) {
-        ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::INVALID_INPUT, name + " is not a valid homogeneous pose matrix");
+        ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::INVALID_INPUT, name,
+                                         ELITE::PoseAlgebraBase::NOT_HOMOGENEOUS_DETAIL);
         return false;
     }
 
     return validateRotation(matrix.block<3, 3>(0, 0), result, name);
 }
 
+// The input and the matrix are validated when checked is set
 bool vectorToIsometry(const ELITE::vector6d_t& pose_vector, Eigen::Isometry3d& pose_iso, ELITE::PoseAlgebraResult& result,
-                      const std::string& name) {
-    if (!ELITE::PoseAlgebraBase::validateVectorFinite(pose_vector, result, name)) {
+                      const char* name, bool checked) {
+    if (checked && !ELITE::PoseAlgebraBase::validateVectorFinite(pose_vector, result, name)) {
         return false;
     }
 
@@ -83,22 +85,22 @@ bool vectorToIsometry(const ELITE::vector6d_t& pose_vector, Eigen::Isometry3d& p
     pose_iso.linear() = (rot_z * rot_y * rot_x).toRotationMatrix();
     pose_iso.translation() = Eigen::Vector3d(pose_vector[0], pose_vector[1], pose_vector[2]);
 
-    if (!std::isfinite(pose_iso.matrix().sum())) {
+    if (checked && !std::isfinite(pose_iso.matrix().sum())) {
         ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::NUMERICAL_ERROR,
-                                         name + " produced non-finite values when converting to matrix");
+                                         name, " produced non-finite values when converting to matrix");
         return false;
     }
 
     return true;
 }
 
-ELITE::vector6d_t matrixToVectorUnchecked(const Eigen::Matrix4d& matrix) {
+ELITE::vector6d_t affineToVectorUnchecked(const Eigen::Matrix<double, 3, 4>& affine) {
     ELITE::vector6d_t pose_vector{};
-    pose_vector[0] = matrix(0, 3);
-    pose_vector[1] = matrix(1, 3);
-    pose_vector[2] = matrix(2, 3);
+    pose_vector[0] = affine(0, 3);
+    pose_vector[1] = affine(1, 3);
+    pose_vector[2] = affine(2, 3);
 
-    const Eigen::Vector3d zyx = matrix.block<3, 3>(0, 0).eulerAngles(2, 1, 0);
+    const Eigen::Vector3d zyx = affine.block<3, 3>(0, 0).eulerAngles(2, 1, 0);
     pose_vector[3] = zyx[2];
     pose_vector[4] = zyx[1];
     pose_vector[5] = zyx[0];
@@ -106,6 +108,10 @@ ELITE::vector6d_t matrixToVectorUnchecked(const Eigen::Matrix4d& matrix) {
     return pose_vector;
 }
 
+ELITE::vector6d_t matrixToVectorUnchecked(const Eigen::Matrix4d& matrix) {
+    return affineToVectorUnchecked(matrix.topRows<3>());
+}
+
 bool computeDistance(const Eigen::Isometry3d& pose_a, const Eigen::Isometry3d& pose_b, ELITE::PoseDistance& out_distance) {
     out_distance.linear_distance = (pose_a.translation() - pose_b.translation()).norm();
 
@@ -117,12 +123,190 @@ bool computeDistance(const Eigen::Isometry3d& pose_a, const Eigen::Isometry3d& p
     return std::isfinite(out_distance.linear_distance) && std::isfinite(out_distance.angular_distance);
 }
 
+// Elements of a block of the batch kernels
+constexpr Eigen::Index BATCH_BLOCK = 8;
+
+// A block of poses, the columns 4 * l to 4 * l + 3 are [R | t] of the element l. As a 3 x 4n matrix the composition of
+// the whole block with a pose is one product.
+using AffineBlock = Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::ColMajor, 3, 4 * BATCH_BLOCK>;
+using RowMatrix4d = Eigen::Matrix<double, 4, 4, Eigen::RowMajor>;
+using BlockArray = Eigen::Array<double, 1, Eigen::Dynamic, Eigen::RowMajor, 1, BATCH_BLOCK>;
+
+void loadBlock(const ELITE::vector6d_t* pose_vectors, Eigen::Index count, AffineBlock& block) {
+    // vector6d_t is a contiguous array of 6 doubles, so the poses are the columns of a 6 x count matrix
+    const Eigen::Map<const Eigen::Matrix<double, 6, Eigen::Dynamic>> poses(pose_vectors[0].data(), 6, count);
+    const BlockArray cr = poses.row(3).array().cos();
+    const BlockArray sr = poses.row(3).array().sin();
+    const BlockArray cp = poses.row(4).array().cos();
+    const BlockArray sp = poses.row(4).array().sin();
+    const BlockArray cy = poses.row(5).array().cos();
+    const BlockArray sy = poses.row(5).array().sin();
+
+    // R = Rz(yaw) * Ry(pitch) * Rx(roll), the rotation of vectorToIsometry()
+    block.resize(3, 4 * count);
+    Eigen::Map<Eigen::Matrix<double, 12, Eigen::Dynamic>> columns(block.data(), 12, count);
+    columns.row(0) = cy * cp;
+    columns.row(1) = sy * cp;
+    columns.row(2) = -sp;
+    columns.row(3) = cy * sp * sr - sy * cr;
+    columns.row(4) = sy * sp * sr + cy * cr;
+    columns.row(5) = cp * sr;
+    columns.row(6) = cy * sp * cr + sy * sr;
+    columns.row(7) = sy * sp * cr - cy * sr;
+    columns.row(8) = cp * cr;
+    columns.bottomRows<3>() = poses.topRows<3>();
+}
+
+void loadBlock(const ELITE::PoseMatrix* pose_matrices, Eigen::Index count, AffineBlock& block) {
+    block.resize(3, 4 * count);
+    for (Eigen::Index l = 0; l < count; ++l) {
+        block.middleCols<4>(4 * l) = Eigen::Map<const RowMatrix4d>(pose_matrices[l].data[0].data()).topRows<3>();
+    }
+}
+
+void storeBlock(const AffineBlock& block, Eigen::Index count, ELITE::PoseMatrix* pose_matrices) {
+    for (Eigen::Index l = 0; l < count; ++l) {
+        Eigen::Map<RowMatrix4d> matrix(pose_matrices[l].data[0].data());
+        matrix.topRows<3>() = block.middleCols<4>(4 * l);
+        matrix.row(3) << 0.0, 0.0, 0.0, 1.0;
+    }
+}
+
+void storeBlock(const AffineBlock& block, Eigen::Index count, ELITE::vector6d_t* pose_vectors) {
+    for (Eigen::Index l = 0; l < count; ++l) {
+        pose_vectors[l] = affineToVectorUnchecked(block.middleCols<4>(4 * l));
+    }
+}
+
+// out = left * in, for all the elements of the block
+void composeBlock(const Eigen::Isometry3d& left, const AffineBlock& in, Eigen::Index count, AffineBlock& out) {
+    out.noalias() = left.linear() * in;
+    for (Eigen::Index l = 0; l < count; ++l) {
+        out.col(4 * l + 3) += left.translation();
+    }
+}
+
+// The index of the first element with a non-finite value, count if there is none
+Eigen::Index firstNonFiniteElement(const AffineBlock& block, Eigen::Index count) {
+    if (block.allFinite()) {
+        return count;
+    }
+    for (Eigen::Index l = 0; l < count; ++l) {
+        if (!block.middleCols<4>(4 * l).allFinite()) {
+            return l;
+        }
+    }
+    return count;
+}
+
+bool setBatchNumericalError(ELITE::PoseAlgebraResult& result, size_t index) {
+    ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::NUMERICAL_ERROR, "output pose contains non-finite values");
+    return ELITE::PoseAlgebraBase::setBatchError(result, index);
+}
+
+Eigen::Isometry3d toIsometryUnchecked(const ELITE::PoseMatrix& pose) {
+    Eigen::Isometry3d pose_iso = Eigen::Isometry3d::Identity();
+    pose_iso.matrix() = Eigen::Map<const RowMatrix4d>(pose.data[0].data());
+    return pose_iso;
+}
+
+// out_poses[i] = left * in_poses[i], left is already validated. The outputs are checked to be finite when checked is set.
+template <typename InPose, typename OutPose>
+bool composeBatch(const Eigen::Isometry3d& left, const InPose* in_poses, OutPose* out_poses, size_t n, bool checked,
+                  ELITE::PoseAlgebraResult& result) {
+    AffineBlock in;
+    AffineBlock out;
+    for (size_t begin = 0; begin < n; begin += BATCH_BLOCK) {
+        const Eigen::Index count = static_cast<Eigen::Index>(std::min<size_t>(BATCH_BLOCK, n - begin));
+        loadBlock(in_poses + begin, count, in);
+        composeBlock(left, in, count, out);
+        const Eigen::Index bad = checked ? firstNonFiniteElement(out, count) : count;
+        if (bad != count) {
+            return setBatchNumericalError(result, begin + static_cast<size_t>(bad));
+        }
+        storeBlock(out, count, out_poses + begin);
+    }
+    ELITE::PoseAlgebraBase::setSuccess(result);
+    return true;
+}
+
+// out_poses[i] = in_poses[i] in the other representation. The outputs are checked to be finite when checked is set.
+template <typename InPose, typename OutPose>
+bool convertBatch(const InPose* in_poses, OutPose* out_poses, size_t n, bool checked, ELITE::PoseAlgebraResult& result) {
+    AffineBlock block;
+    for (size_t begin = 0; begin < n; begin += BATCH_BLOCK) {
+        const Eigen::Index count = static_cast<Eigen::Index>(std::min<size_t>(BATCH_BLOCK, n - begin));
+        loadBlock(in_poses + begin, count, block);
+        const Eigen::Index bad = checked ? firstNonFiniteElement(block, count) : count;
+        if (bad != count) {
+            return setBatchNumericalError(result, begin + static_cast<size_t>(bad));
+        }
+        storeBlock(block, count, out_poses + begin);
+    }
+    ELITE::PoseAlgebraBase::setSuccess(result);
+    return true;
+}
+
+// out_points[i] = pose * points[i], pose is already validated. The outputs are checked to be finite when checked is set.
+bool transformPointsBlocks(const Eigen::Isometry3d& pose, const ELITE::vector3d_t* points, ELITE::vector3d_t* out_points,
+                           size_t n, bool checked, ELITE::PoseAlgebraResult& result) {
+    Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::ColMajor, 3, BATCH_BLOCK> block;
+    for (size_t begin = 0; begin < n; begin += BATCH_BLOCK) {
+        const Eigen::Index count = static_cast<Eigen::Index>(std::min<size_t>(BATCH_BLOCK, n - begin));
+        // vector3d_t is a contiguous array of 3 doubles, so the points are the columns of a 3 x count matrix. The block
+        // is computed before it is stored, so out_points may be points.
+        block.noalias() = pose.linear() * Eigen::Map<const Eigen::Matrix3Xd>(points[begin].data(), 3, count);
+        block.colwise() += pose.translation();
+        for (Eigen::Index l = 0; checked && l < count; ++l) {
+            if (!block.col(l).allFinite()) {
+                ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::NUMERICAL_ERROR,
+                                                 "output point contains non-finite values");
+                return ELITE::PoseAlgebraBase::setBatchError(result, begin + static_cast<size_t>(l));
+            }
+        }
+        Eigen::Map<Eigen::Matrix3Xd>(out_points[begin].data(), 3, count) = block;
+    }
+    ELITE::PoseAlgebraBase::setSuccess(result);
+    return true;
+}
+
+// The kernels of getKernelTable(), the batch operations without validation
+void composeMatricesKernel(const ELITE::PoseMatrix& left_pose, const ELITE::PoseMatrix* in_poses, ELITE::PoseMatrix* out_poses,
+                           size_t n) {
+    ELITE::PoseAlgebraResult result;
+    composeBatch(toIsometryUnchecked(left_pose), in_poses, out_poses, n, false, result);
+}
+
+void composeVectorsKernel(const ELITE::vector6d_t& left_pose, const ELITE::vector6d_t* in_poses, ELITE::vector6d_t* out_poses,
+                          size_t n) {
+    ELITE::PoseAlgebraResult result;
+    Eigen::Isometry3d left_iso = Eigen::Isometry3d::Identity();
+    vectorToIsometry(left_pose, left_iso, result, "left pose", false);
+    composeBatch(left_iso, in_poses, out_poses, n, false, result);
+}
+
+void vectorToMatrixKernel(const ELITE::vector6d_t* pose_vectors, ELITE::PoseMatrix* pose_matrices, size_t n) {
+    ELITE::PoseAlgebraResult result;
+    convertBatch(pose_vectors, pose_matrices, n, false, result);
+}
+
+void matrixToVectorKernel(const ELITE::PoseMatrix* pose_matrices, ELITE::vector6d_t* pose_vectors, size_t n) {
+    ELITE::PoseAlgebraResult result;
+    convertBatch(pose_matrices, pose_vectors, n, false, result);
+}
+
+void transformPointsKernel(const ELITE::PoseMatrix& pose, const ELITE::vector3d_t* points, ELITE::vector3d_t* out_points,
+                           size_t n) {
+    ELITE::PoseAlgebraResult result;
+    transformPointsBlocks(toIsometryUnchecked(pose), points, out_points, n, false, result);
+}
+
 }  // namespace
 
 namespace ELITE {
 
 bool EigenPoseAlgebra::inverse(const PoseMatrix& pose, PoseMatrix& inverse_pose, PoseAlgebraResult& result) const {
-    if (!validatePoseMatrix(pose, result, "pose")) {
+    if (isChecked() && !validatePoseMatrix(pose, result, "pose")) {
         return false;
     }
 
@@ -134,7 +318,7 @@ bool EigenPoseAlgebra::inverse(const PoseMatrix& pose, PoseMatrix& inverse_pose,
     const Eigen::Isometry3d inverse_iso = pose_iso.inverse();
     inverse_pose = toPoseMatrix(inverse_iso.matrix());
 
-    if (!validatePoseMatrix(inverse_pose, result, "inverse pose")) {
+    if (isChecked() && !validatePoseMatrix(inverse_pose, result, "inverse pose")) {
         return false;
     }
 
@@ -144,12 +328,12 @@ bool EigenPoseAlgebra::inverse(const PoseMatrix& pose, PoseMatrix& inverse_pose,
 
 bool EigenPoseAlgebra::inverse(const vector6d_t& pose, vector6d_t& inverse_pose, PoseAlgebraResult& result) const {
     Eigen::Isometry3d pose_iso = Eigen::Isometry3d::Identity();
-    if (!vectorToIsometry(pose, pose_iso, result, "pose")) {
+    if (!vectorToIsometry(pose, pose_iso, result, "pose", isChecked())) {
         return false;
     }
 
     inverse_pose = matrixToVectorUnchecked(pose_iso.inverse().matrix());
-    if (!PoseAlgebraBase::validateVectorFinite(inverse_pose, result, "inverse pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(inverse_pose, result, "inverse pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "inverse pose vector contains non-finite values");
         return false;
     }
@@ -160,17 +344,17 @@ bool EigenPoseAlgebra::inverse(const vector6d_t& pose, vector6d_t& inverse_pose,
 
 bool EigenPoseAlgebra::multiply(const PoseMatrix& left_pose, const PoseMatrix& right_pose, PoseMatrix& out_pose,
                                 PoseAlgebraResult& result) const {
-    if (!validatePoseMatrix(left_pose, result, "left pose")) {
+    if (isChecked() && !validatePoseMatrix(left_pose, result, "left pose")) {
         return false;
     }
-    if (!validatePoseMatrix(right_pose, result, "right pose")) {
+    if (isChecked() && !validatePoseMatrix(right_pose, result, "right pose")) {
         return false;
     }
 
     const Eigen::Matrix4d out_matrix = toEigenMatrix(left_pose) * toEigenMatrix(right_pose);
     out_pose = toPoseMatrix(out_matrix);
 
-    if (!validatePoseMatrix(out_pose, result, "output pose")) {
+    if (isChecked() && !validatePoseMatrix(out_pose, result, "output pose")) {
         return false;
     }
 
@@ -182,15 +366,15 @@ bool EigenPoseAlgebra::multiply(const vector6d_t& left_pose, const vector6d_t& r
                                 PoseAlgebraResult& result) const {
     Eigen::Isometry3d left_iso = Eigen::Isometry3d::Identity();
     Eigen::Isometry3d right_iso = Eigen::Isometry3d::Identity();
-    if (!vectorToIsometry(left_pose, left_iso, result, "left pose")) {
+    if (!vectorToIsometry(left_pose, left_iso, result, "left pose", isChecked())) {
         return false;
     }
-    if (!vectorToIsometry(right_pose, right_iso, result, "right pose")) {
+    if (!vectorToIsometry(right_pose, right_iso, result, "right pose", isChecked())) {
         return false;
     }
 
     out_pose = matrixToVectorUnchecked((left_iso * right_iso).matrix());
-    if (!PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose vector contains non-finite values");
         return false;
     }
@@ -201,17 +385,17 @@ bool EigenPoseAlgebra::multiply(const vector6d_t& left_pose, const vector6d_t& r
 
 bool EigenPoseAlgebra::add(const PoseMatrix& left_pose, const PoseMatrix& right_pose, PoseMatrix& out_pose,
                            PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateMatrixFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateMatrixFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(right_pose, result, "right pose")) {
         return false;
     }
 
     const Eigen::Matrix4d out_matrix = toEigenMatrix(left_pose) + toEigenMatrix(right_pose);
     out_pose = toPoseMatrix(out_matrix);
 
-    if (!PoseAlgebraBase::validateMatrixFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose matrix contains non-finite values");
         return false;
     }
@@ -222,10 +406,10 @@ bool EigenPoseAlgebra::add(const PoseMatrix& left_pose, const PoseMatrix& right_
 
 bool EigenPoseAlgebra::add(const vector6d_t& left_pose, const vector6d_t& right_pose, vector6d_t& out_pose,
                            PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
         return false;
     }
 
@@ -233,7 +417,7 @@ bool EigenPoseAlgebra::add(const vector6d_t& left_pose, const vector6d_t& right_
         out_pose[i] = left_pose[i] + right_pose[i];
     }
 
-    if (!PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose vector contains non-finite values");
         return false;
     }
@@ -244,17 +428,17 @@ bool EigenPoseAlgebra::add(const vector6d_t& left_pose, const vector6d_t& right_
 
 bool EigenPoseAlgebra::subtract(const PoseMatrix& left_pose, const PoseMatrix& right_pose, PoseMatrix& out_pose,
                                 PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateMatrixFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateMatrixFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(right_pose, result, "right pose")) {
         return false;
     }
 
     const Eigen::Matrix4d out_matrix = toEigenMatrix(left_pose) - toEigenMatrix(right_pose);
     out_pose = toPoseMatrix(out_matrix);
 
-    if (!PoseAlgebraBase::validateMatrixFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose matrix contains non-finite values");
         return false;
     }
@@ -265,10 +449,10 @@ bool EigenPoseAlgebra::subtract(const PoseMatrix& left_pose, const PoseMatrix& r
 
 bool EigenPoseAlgebra::subtract(const vector6d_t& left_pose, const vector6d_t& right_pose, vector6d_t& out_pose,
                                 PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
         return false;
     }
 
@@ -276,7 +460,7 @@ bool EigenPoseAlgebra::subtract(const vector6d_t& left_pose, const vector6d_t& r
         out_pose[i] = left_pose[i] - right_pose[i];
     }
 
-    if (!PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose vector contains non-finite values");
         return false;
     }
@@ -288,12 +472,12 @@ bool EigenPoseAlgebra::subtract(const vector6d_t& left_pose, const vector6d_t& r
 bool EigenPoseAlgebra::vectorToMatrix(const vector6d_t& pose_vector, PoseMatrix& pose_matrix,
                                       PoseAlgebraResult& result) const {
     Eigen::Isometry3d pose_iso = Eigen::Isometry3d::Identity();
-    if (!vectorToIsometry(pose_vector, pose_iso, result, "pose vector")) {
+    if (!vectorToIsometry(pose_vector, pose_iso, result, "pose vector", isChecked())) {
         return false;
     }
 
     pose_matrix = toPoseMatrix(pose_iso.matrix());
-    if (!validatePoseMatrix(pose_matrix, result, "pose matrix")) {
+    if (isChecked() && !validatePoseMatrix(pose_matrix, result, "pose matrix")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "failed to construct a valid pose matrix from pose vector");
         return false;
     }
@@ -304,12 +488,12 @@ bool EigenPoseAlgebra::vectorToMatrix(const vector6d_t& pose_vector, PoseMatrix&
 
 bool EigenPoseAlgebra::matrixToVector(const PoseMatrix& pose_matrix, vector6d_t& pose_vector,
                                       PoseAlgebraResult& result) const {
-    if (!validatePoseMatrix(pose_matrix, result, "pose matrix")) {
+    if (isChecked() && !validatePoseMatrix(pose_matrix, result, "pose matrix")) {
         return false;
     }
 
     pose_vector = matrixToVectorUnchecked(toEigenMatrix(pose_matrix));
-    if (!PoseAlgebraBase::validateVectorFinite(pose_vector, result, "pose vector")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(pose_vector, result, "pose vector")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "failed to extract a valid pose vector from pose matrix");
         return false;
     }
@@ -320,10 +504,10 @@ bool EigenPoseAlgebra::matrixToVector(const PoseMatrix& pose_matrix, vector6d_t&
 
 bool EigenPoseAlgebra::distance(const PoseMatrix& pose_a, const PoseMatrix& pose_b, PoseDistance& out_distance,
                                 PoseAlgebraResult& result) const {
-    if (!validatePoseMatrix(pose_a, result, "pose_a")) {
+    if (isChecked() && !validatePoseMatrix(pose_a, result, "pose_a")) {
         return false;
     }
-    if (!validatePoseMatrix(pose_b, result, "pose_b")) {
+    if (isChecked() && !validatePoseMatrix(pose_b, result, "pose_b")) {
         return false;
     }
 
@@ -349,10 +533,10 @@ bool EigenPoseAlgebra::distance(const vector6d_t& pose_a, const vector6d_t& pose
     Eigen::Isometry3d pose_a_iso = Eigen::Isometry3d::Identity();
     Eigen::Isometry3d pose_b_iso = Eigen::Isometry3d::Identity();
 
-    if (!vectorToIsometry(pose_a, pose_a_iso, result, "pose_a")) {
+    if (!vectorToIsometry(pose_a, pose_a_iso, result, "pose_a", isChecked())) {
         return false;
     }
-    if (!vectorToIsometry(pose_b, pose_b_iso, result, "pose_b")) {
+    if (!vectorToIsometry(pose_b, pose_b_iso, result, "pose_b", isChecked())) {
         return false;
     }
 
@@ -418,6 +602,85 @@ bool EigenPoseAlgebra::localToWorld(const vector6d_t& world_ref_pose, const vect
     return matrixToVector(world_pose_matrix, world_pose, result);
 }
 
+bool EigenPoseAlgebra::multiplyBatch(const PoseMatrix& left_pose, const PoseMatrix* right_poses, PoseMatrix* out_poses, size_t n,
+                                     PoseAlgebraResult& result) const {
+    if (isChecked() && !validatePoseMatrix(left_pose, result, "left pose")) {
+        return false;
+    }
+    return composeBatch(toIsometryUnchecked(left_pose), right_poses, out_poses, n, isChecked(), result);
+}
+
+bool EigenPoseAlgebra::multiplyBatch(const vector6d_t& left_pose, const vector6d_t* right_poses, vector6d_t* out_poses, size_t n,
+                                     PoseAlgebraResult& result) const {
+    Eigen::Isometry3d left_iso = Eigen::Isometry3d::Identity();
+    if (!vectorToIsometry(left_pose, left_iso, result, "left pose", isChecked())) {
+        return false;
+    }
+    return composeBatch(left_iso, right_poses, out_poses, n, isChecked(), result);
+}
+
+bool EigenPoseAlgebra::worldToLocalBatch(const PoseMatrix& world_ref_pose, const PoseMatrix* world_poses, PoseMatrix* local_poses,
+                                         size_t n, PoseAlgebraResult& result) const {
+    if (isChecked() && !validatePoseMatrix(world_ref_pose, result, "world reference pose")) {
+        return false;
+    }
+    return composeBatch(toIsometryUnchecked(world_ref_pose).inverse(), world_poses, local_poses, n, isChecked(), result);
+}
+
+bool EigenPoseAlgebra::worldToLocalBatch(const vector6d_t& world_ref_pose, const vector6d_t* world_poses, vector6d_t* local_poses,
+                                         size_t n, PoseAlgebraResult& result) const {
+    Eigen::Isometry3d world_ref_iso = Eigen::Isometry3d::Identity();
+    if (!vectorToIsometry(world_ref_pose, world_ref_iso, result, "world reference pose", isChecked())) {
+        return false;
+    }
+    return composeBatch(world_ref_iso.inverse(), world_poses, local_poses, n, isChecked(), result);
+}
+
+bool EigenPoseAlgebra::localToWorldBatch(const PoseMatrix& world_ref_pose, const PoseMatrix* local_poses, PoseMatrix* world_poses,
+                                         size_t n, PoseAlgebraResult& result) const {
+    if (isChecked() && !validatePoseMatrix(world_ref_pose, result, "world reference pose")) {
+        return false;
+    }
+    return composeBatch(toIsometryUnchecked(world_ref_pose), local_poses, world_poses, n, isChecked(), result);
+}
+
+bool EigenPoseAlgebra::localToWorldBatch(const vector6d_t& world_ref_pose, const vector6d_t* local_poses, vector6d_t* world_poses,
+                                         size_t n, PoseAlgebraResult& result) const {
+    Eigen::Isometry3d world_ref_iso = Eigen::Isometry3d::Identity();
+    if (!vectorToIsometry(world_ref_pose, world_ref_iso, result, "world reference pose", isChecked())) {
+        return false;
+    }
+    return composeBatch(world_ref_iso, local_poses, world_poses, n, isChecked(), result);
+}
+
+bool EigenPoseAlgebra::vectorToMatrixBatch(const vector6d_t* pose_vectors, PoseMatrix* pose_matrices, size_t n,
+                                           PoseAlgebraResult& result) const {
+    return convertBatch(pose_vectors, pose_matrices, n, isChecked(), result);
+}
+
+bool EigenPoseAlgebra::matrixToVectorBatch(const PoseMatrix* pose_matrices, vector6d_t* pose_vectors, size_t n,
+                                           PoseAlgebraResult& result) const {
+    return convertBatch(pose_matrices, pose_vectors, n, isChecked(), result);
+}
+
+bool EigenPoseAlgebra::transformPointsBatch(const PoseMatrix& pose, const vector3d_t* points, vector3d_t* out_points, size_t n,
+                                            PoseAlgebraResult& result) const {
+    if (isChecked() && !validatePoseMatrix(pose, result, "pose")) {
+        return false;
+    }
+    return transformPointsBlocks(toIsometryUnchecked(pose), points, out_points, n, isChecked(), result);
+}
+
+PoseAlgebraKernels EigenPoseAlgebra::getKernelTable() const {
+    PoseAlgebraKernels kernels;
+    kernels.compose_matrices = composeMatricesKernel;
+    kernels.compose_vectors = composeVectorsKernel;
+    kernels.vector_to_matrix = vectorToMatrixKernel;
+    kernels.matrix_to_vector = matrixToVectorKernel;
+    kernels.transform_points = transformPointsKernel;
+    return kernels;
+}
+
 }  // namespace ELITE
 
 #include <Elite/ClassRegisterMacro.hpp>
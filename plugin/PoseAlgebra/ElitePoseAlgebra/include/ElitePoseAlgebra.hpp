@@ -56,6 +56,39 @@ class ElitePoseAlgebra : public PoseAlgebraBase {
 
       ELITE_EXPORT bool localToWorld(const vector6d_t& world_ref_pose, const vector6d_t& local_pose,
                               vector6d_t& world_pose, PoseAlgebraResult& result) const override;
+
+    // The batch operations validate the shared pose once and run structure of arrays kernels over blocks of elements.
+    // The elements are only checked for non-finite outputs, they are not checked to be valid homogeneous poses. With
+    // PoseAlgebraValidation::UNCHECKED neither the shared pose nor the outputs are checked.
+
+    ELITE_EXPORT bool multiplyBatch(const PoseMatrix& left_pose, const PoseMatrix* right_poses, PoseMatrix* out_poses, size_t n,
+                                    PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT bool multiplyBatch(const vector6d_t& left_pose, const vector6d_t* right_poses, vector6d_t* out_poses, size_t n,
+                                    PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT bool worldToLocalBatch(const PoseMatrix& world_ref_pose, const PoseMatrix* world_poses,
+                                        PoseMatrix* local_poses, size_t n, PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT bool worldToLocalBatch(const vector6d_t& world_ref_pose, const vector6d_t* world_poses,
+                                        vector6d_t* local_poses, size_t n, PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT bool localToWorldBatch(const PoseMatrix& world_ref_pose, const PoseMatrix* local_poses,
+                                        PoseMatrix* world_poses, size_t n, PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT bool localToWorldBatch(const vector6d_t& world_ref_pose, const vector6d_t* local_poses,
+                                        vector6d_t* world_poses, size_t n, PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT bool vectorToMatrixBatch(const vector6d_t* pose_vectors, PoseMatrix* pose_matrices, size_t n,
+                                          PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT bool matrixToVectorBatch(const PoseMatrix* pose_matrices, vector6d_t* pose_vectors, size_t n,
+                                          PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT bool transformPointsBatch(const PoseMatrix& pose, const vector3d_t* points, vector3d_t* out_points, size_t n,
+                                           PoseAlgebraResult& result) const override;
+
+    ELITE_EXPORT PoseAlgebraKernels getKernelTable() const override;
 };
 
 }  // namespace ELITE
@@ -5,14 +5,15 @@
 
 namespace {
 
-bool validatePoseMatrix(const ELITE::PoseMatrix& pose, ELITE::PoseAlgebraResult& result, const std::string& name) {
+bool validatePoseMatrix(const ELITE::PoseMatrix& pose, ELITE::PoseAlgebraResult& result, const char* name) {
     if (!ELITE::PoseAlgebraBase::validateMatrixFinite(pose, result, name)) {
         return false;
     }
 
     if (std::fabs(pose.data[3][0]) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE || std::fabs(pose.data[3][1]) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE ||
         std::fabs(pose.data[3][2]) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE || std::fabs(pose.data[3][3] - 1.0) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE) {
-        ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::INVALID_INPUT, name + " is not a valid homogeneous pose matrix");
+        ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::INVALID_INPUT, name,
+                                         ELITE::PoseAlgebraBase::NOT_HOMOGENEOUS_DETAIL);
         return false;
     }
 
@@ -26,7 +27,7 @@ bool validatePoseMatrix(const ELITE::PoseMatrix& pose, ELITE::PoseAlgebraResult&
             const double expected = (i == j) ? 1.0 : 0.0;
             if (std::fabs(dot - expected) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE) {
                 ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::INVALID_ROTATION_MATRIX,
-                                                 name + " contains a non-orthonormal rotation matrix");
+                                                 name, ELITE::PoseAlgebraBase::NON_ORTHONORMAL_DETAIL);
                 return false;
             }
         }
@@ -35,13 +36,13 @@ bool validatePoseMatrix(const ELITE::PoseMatrix& pose, ELITE::PoseAlgebraResult&
     const double det = ELITE::PoseAlgebraBase::determinant3x3(pose);
     if (std::fabs(det) < ELITE::PoseAlgebraBase::ZERO_TOLERANCE) {
         ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::SINGULAR_MATRIX,
-                                         name + " rotation matrix is singular and cannot be inverted");
+                                         name, ELITE::PoseAlgebraBase::SINGULAR_DETAIL);
         return false;
     }
 
     if (std::fabs(det - 1.0) > ELITE::PoseAlgebraBase::ZERO_TOLERANCE) {
         ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::INVALID_ROTATION_MATRIX,
-                                         name + " rotation determinant is not close to +1");
+                                         name, ELITE::PoseAlgebraBase::DETERMINANT_DETAIL);
         return false;
     }
 
@@ -85,21 +86,8 @@ ELITE::PoseMatrix toPoseMatrixUnchecked(const ELITE::vector6d_t& pose_vector) {
     return pose_matrix;
 }
 
-ELITE::vector6d_t toPoseVectorUnchecked(const ELITE::PoseMatrix& pose_matrix) {
-    ELITE::vector6d_t pose_vector{};
-
-    pose_vector[0] = pose_matrix.data[0][3];
-    pose_vector[1] = pose_matrix.data[1][3];
-    pose_vector[2] = pose_matrix.data[2][3];
-
-    const double nx = pose_matrix.data[0][0];
-    const double ny = pose_matrix.data[1][0];
-    const double nz = pose_matrix.data[2][0];
-    const double ox = pose_matrix.data[0][1];
-    const double oy = pose_matrix.data[1][1];
-    const double oz = pose_matrix.data[2][1];
-    const double az = pose_matrix.data[2][2];
-
+void rpyFromRotation(double nx, double ny, double nz, double ox, double oy, double oz, double az,
+                     ELITE::vector6d_t& pose_vector) {
     const double pitch = std::atan2(-nz, std::sqrt(nx * nx + ny * ny));
     const double cp = std::cos(pitch);
 
@@ -117,6 +105,17 @@ ELITE::vector6d_t toPoseVectorUnchecked(const ELITE::PoseMatrix& pose_matrix) {
     pose_vector[3] = roll;
     pose_vector[4] = pitch;
     pose_vector[5] = yaw;
+}
+
+ELITE::vector6d_t toPoseVectorUnchecked(const ELITE::PoseMatrix& pose_matrix) {
+    ELITE::vector6d_t pose_vector{};
+
+    pose_vector[0] = pose_matrix.data[0][3];
+    pose_vector[1] = pose_matrix.data[1][3];
+    pose_vector[2] = pose_matrix.data[2][3];
+
+    rpyFromRotation(pose_matrix.data[0][0], pose_matrix.data[1][0], pose_matrix.data[2][0], pose_matrix.data[0][1],
+                    pose_matrix.data[1][1], pose_matrix.data[2][1], pose_matrix.data[2][2], pose_vector);
 
     return pose_vector;
 }
@@ -186,17 +185,227 @@ bool computeDistanceUnchecked(const ELITE::PoseMatrix& pose_a, const ELITE::Pose
     return std::isfinite(out_distance.linear_distance) && std::isfinite(out_distance.angular_distance);
 }
 
+// Elements of a block of the batch kernels
+constexpr size_t BATCH_BLOCK = 8;
+
+// A block of poses as a structure of arrays: r[row * 3 + col][lane] and t[row][lane], so the lane loops vectorize
+struct PoseBlock {
+    double r[9][BATCH_BLOCK];
+    double t[3][BATCH_BLOCK];
+};
+
+void loadBlock(const ELITE::vector6d_t* pose_vectors, size_t count, PoseBlock& block) {
+    double cr[BATCH_BLOCK], sr[BATCH_BLOCK], cp[BATCH_BLOCK], sp[BATCH_BLOCK], cy[BATCH_BLOCK], sy[BATCH_BLOCK];
+    for (size_t l = 0; l < count; ++l) {
+        const ELITE::vector6d_t& v = pose_vectors[l];
+        cr[l] = std::cos(v[3]);
+        sr[l] = std::sin(v[3]);
+        cp[l] = std::cos(v[4]);
+        sp[l] = std::sin(v[4]);
+        cy[l] = std::cos(v[5]);
+        sy[l] = std::sin(v[5]);
+        block.t[0][l] = v[0];
+        block.t[1][l] = v[1];
+        block.t[2][l] = v[2];
+    }
+    for (size_t l = 0; l < count; ++l) {
+        block.r[0][l] = cy[l] * cp[l];
+        block.r[1][l] = cy[l] * sp[l] * sr[l] - sy[l] * cr[l];
+        block.r[2][l] = cy[l] * sp[l] * cr[l] + sy[l] * sr[l];
+        block.r[3][l] = sy[l] * cp[l];
+        block.r[4][l] = sy[l] * sp[l] * sr[l] + cy[l] * cr[l];
+        block.r[5][l] = sy[l] * sp[l] * cr[l] - cy[l] * sr[l];
+        block.r[6][l] = -sp[l];
+        block.r[7][l] = cp[l] * sr[l];
+        block.r[8][l] = cp[l] * cr[l];
+    }
+}
+
+void loadBlock(const ELITE::PoseMatrix* pose_matrices, size_t count, PoseBlock& block) {
+    for (size_t l = 0; l < count; ++l) {
+        const ELITE::PoseMatrix& m = pose_matrices[l];
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                block.r[i * 3 + j][l] = m.data[i][j];
+            }
+            block.t[i][l] = m.data[i][3];
+        }
+    }
+}
+
+// out = left * in, for the lanes of the block
+void composeBlock(const ELITE::PoseMatrix& left, const PoseBlock& in, size_t count, PoseBlock& out) {
+    for (size_t i = 0; i < 3; ++i) {
+        const double l0 = left.data[i][0];
+        const double l1 = left.data[i][1];
+        const double l2 = left.data[i][2];
+        const double l3 = left.data[i][3];
+        for (size_t j = 0; j < 3; ++j) {
+            for (size_t l = 0; l < count; ++l) {
+                out.r[i * 3 + j][l] = l0 * in.r[j][l] + l1 * in.r[3 + j][l] + l2 * in.r[6 + j][l];
+            }
+        }
+        for (size_t l = 0; l < count; ++l) {
+            out.t[i][l] = l0 * in.t[0][l] + l1 * in.t[1][l] + l2 * in.t[2][l] + l3;
+        }
+    }
+}
+
+// The index of the first lane with a non-finite value, count if there is none
+size_t firstNonFiniteLane(const PoseBlock& block, size_t count) {
+    for (size_t l = 0; l < count; ++l) {
+        double sum = block.t[0][l] + block.t[1][l] + block.t[2][l];
+        for (size_t k = 0; k < 9; ++k) {
+            sum += block.r[k][l];
+        }
+        // A NaN or an infinity in any term makes the sum non-finite
+        if (!std::isfinite(sum)) {
+            return l;
+        }
+    }
+    return count;
+}
+
+void storeBlock(const PoseBlock& block, size_t count, ELITE::PoseMatrix* pose_matrices) {
+    for (size_t l = 0; l < count; ++l) {
+        ELITE::PoseMatrix& m = pose_matrices[l];
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                m.data[i][j] = block.r[i * 3 + j][l];
+            }
+            m.data[i][3] = block.t[i][l];
+        }
+        m.data[3][0] = 0.0;
+        m.data[3][1] = 0.0;
+        m.data[3][2] = 0.0;
+        m.data[3][3] = 1.0;
+    }
+}
+
+void storeBlock(const PoseBlock& block, size_t count, ELITE::vector6d_t* pose_vectors) {
+    for (size_t l = 0; l < count; ++l) {
+        ELITE::vector6d_t& v = pose_vectors[l];
+        v[0] = block.t[0][l];
+        v[1] = block.t[1][l];
+        v[2] = block.t[2][l];
+        rpyFromRotation(block.r[0][l], block.r[3][l], block.r[6][l], block.r[1][l], block.r[4][l], block.r[7][l],
+                        block.r[8][l], v);
+    }
+}
+
+bool setBatchNumericalError(ELITE::PoseAlgebraResult& result, size_t index) {
+    ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::NUMERICAL_ERROR, "output pose contains non-finite values");
+    return ELITE::PoseAlgebraBase::setBatchError(result, index);
+}
+
+// out_poses[i] = left * in_poses[i], left is already validated. The outputs are checked to be finite when checked is set.
+template <typename InPose, typename OutPose>
+bool composeBatch(const ELITE::PoseMatrix& left, const InPose* in_poses, OutPose* out_poses, size_t n, bool checked,
+                  ELITE::PoseAlgebraResult& result) {
+    PoseBlock in;
+    PoseBlock out;
+    for (size_t begin = 0; begin < n; begin += BATCH_BLOCK) {
+        const size_t count = std::min(BATCH_BLOCK, n - begin);
+        loadBlock(in_poses + begin, count, in);
+        composeBlock(left, in, count, out);
+        const size_t bad = checked ? firstNonFiniteLane(out, count) : count;
+        if (bad != count) {
+            return setBatchNumericalError(result, begin + bad);
+        }
+        storeBlock(out, count, out_poses + begin);
+    }
+    ELITE::PoseAlgebraBase::setSuccess(result);
+    return true;
+}
+
+// out_poses[i] = in_poses[i] in the other representation. The outputs are checked to be finite when checked is set.
+template <typename InPose, typename OutPose>
+bool convertBatch(const InPose* in_poses, OutPose* out_poses, size_t n, bool checked, ELITE::PoseAlgebraResult& result) {
+    PoseBlock block;
+    for (size_t begin = 0; begin < n; begin += BATCH_BLOCK) {
+        const size_t count = std::min(BATCH_BLOCK, n - begin);
+        loadBlock(in_poses + begin, count, block);
+        const size_t bad = checked ? firstNonFiniteLane(block, count) : count;
+        if (bad != count) {
+            return setBatchNumericalError(result, begin + bad);
+        }
+        storeBlock(block, count, out_poses + begin);
+    }
+    ELITE::PoseAlgebraBase::setSuccess(result);
+    return true;
+}
+
+// out_points[i] = R * points[i] + t, pose is already validated. The outputs are checked to be finite when checked is set.
+bool transformPointsBlocks(const ELITE::PoseMatrix& pose, const ELITE::vector3d_t* points, ELITE::vector3d_t* out_points,
+                           size_t n, bool checked, ELITE::PoseAlgebraResult& result) {
+    double p[3][BATCH_BLOCK];
+    double q[3][BATCH_BLOCK];
+    for (size_t begin = 0; begin < n; begin += BATCH_BLOCK) {
+        const size_t count = std::min(BATCH_BLOCK, n - begin);
+        // The block is loaded before it is stored, so out_points may be points
+        for (size_t l = 0; l < count; ++l) {
+            p[0][l] = points[begin + l][0];
+            p[1][l] = points[begin + l][1];
+            p[2][l] = points[begin + l][2];
+        }
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t l = 0; l < count; ++l) {
+                q[i][l] = pose.data[i][0] * p[0][l] + pose.data[i][1] * p[1][l] + pose.data[i][2] * p[2][l] + pose.data[i][3];
+            }
+        }
+        for (size_t l = 0; l < count; ++l) {
+            if (checked && !std::isfinite(q[0][l] + q[1][l] + q[2][l])) {
+                ELITE::PoseAlgebraBase::setError(result, ELITE::PoseAlgebraError::NUMERICAL_ERROR,
+                                                 "output point contains non-finite values");
+                return ELITE::PoseAlgebraBase::setBatchError(result, begin + l);
+            }
+            out_points[begin + l] = {q[0][l], q[1][l], q[2][l]};
+        }
+    }
+    ELITE::PoseAlgebraBase::setSuccess(result);
+    return true;
+}
+
+// The kernels of getKernelTable(), the batch operations without validation
+void composeMatricesKernel(const ELITE::PoseMatrix& left_pose, const ELITE::PoseMatrix* in_poses, ELITE::PoseMatrix* out_poses,
+                           size_t n) {
+    ELITE::PoseAlgebraResult result;
+    composeBatch(left_pose, in_poses, out_poses, n, false, result);
+}
+
+void composeVectorsKernel(const ELITE::vector6d_t& left_pose, const ELITE::vector6d_t* in_poses, ELITE::vector6d_t* out_poses,
+                          size_t n) {
+    ELITE::PoseAlgebraResult result;
+    composeBatch(toPoseMatrixUnchecked(left_pose), in_poses, out_poses, n, false, result);
+}
+
+void vectorToMatrixKernel(const ELITE::vector6d_t* pose_vectors, ELITE::PoseMatrix* pose_matrices, size_t n) {
+    ELITE::PoseAlgebraResult result;
+    convertBatch(pose_vectors, pose_matrices, n, false, result);
+}
+
+void matrixToVectorKernel(const ELITE::PoseMatrix* pose_matrices, ELITE::vector6d_t* pose_vectors, size_t n) {
+    ELITE::PoseAlgebraResult result;
+    convertBatch(pose_matrices, pose_vectors, n, false, result);
+}
+
+void transformPointsKernel(const ELITE::PoseMatrix& pose, const ELITE::vector3d_t* points, ELITE::vector3d_t* out_points,
+                           size_t n) {
+    ELITE::PoseAlgebraResult result;
+    transformPointsBlocks(pose, points, out_points, n, false, result);
+}
+
 }  // namespace
 
 namespace ELITE {
 
 bool ElitePoseAlgebra::inverse(const PoseMatrix& pose, PoseMatrix& inverse_pose, PoseAlgebraResult& result) const {
-    if (!validatePoseMatrix(pose, result, "pose")) {
+    if (isChecked() && !validatePoseMatrix(pose, result, "pose")) {
         return false;
     }
 
     inverse_pose = inverseMatrixUnchecked(pose);
-    if (!validatePoseMatrix(inverse_pose, result, "inverse pose")) {
+    if (isChecked() && !validatePoseMatrix(inverse_pose, result, "inverse pose")) {
         return false;
     }
 
@@ -205,7 +414,7 @@ bool ElitePoseAlgebra::inverse(const PoseMatrix& pose, PoseMatrix& inverse_pose,
 }
 
 bool ElitePoseAlgebra::inverse(const vector6d_t& pose, vector6d_t& inverse_pose, PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateVectorFinite(pose, result, "pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(pose, result, "pose")) {
         return false;
     }
 
@@ -213,7 +422,7 @@ bool ElitePoseAlgebra::inverse(const vector6d_t& pose, vector6d_t& inverse_pose,
     const PoseMatrix inverse_pose_matrix = inverseMatrixUnchecked(pose_matrix);
     inverse_pose = toPoseVectorUnchecked(inverse_pose_matrix);
 
-    if (!PoseAlgebraBase::validateVectorFinite(inverse_pose, result, "inverse pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(inverse_pose, result, "inverse pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "inverse pose vector contains non-finite values");
         return false;
     }
@@ -224,15 +433,15 @@ bool ElitePoseAlgebra::inverse(const vector6d_t& pose, vector6d_t& inverse_pose,
 
 bool ElitePoseAlgebra::multiply(const PoseMatrix& left_pose, const PoseMatrix& right_pose, PoseMatrix& out_pose,
                              PoseAlgebraResult& result) const {
-    if (!validatePoseMatrix(left_pose, result, "left pose")) {
+    if (isChecked() && !validatePoseMatrix(left_pose, result, "left pose")) {
         return false;
     }
-    if (!validatePoseMatrix(right_pose, result, "right pose")) {
+    if (isChecked() && !validatePoseMatrix(right_pose, result, "right pose")) {
         return false;
     }
 
     out_pose = multiplyMatrixUnchecked(left_pose, right_pose);
-    if (!validatePoseMatrix(out_pose, result, "output pose")) {
+    if (isChecked() && !validatePoseMatrix(out_pose, result, "output pose")) {
         return false;
     }
 
@@ -242,10 +451,10 @@ bool ElitePoseAlgebra::multiply(const PoseMatrix& left_pose, const PoseMatrix& r
 
 bool ElitePoseAlgebra::multiply(const vector6d_t& left_pose, const vector6d_t& right_pose, vector6d_t& out_pose,
                              PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
         return false;
     }
 
@@ -254,7 +463,7 @@ bool ElitePoseAlgebra::multiply(const vector6d_t& left_pose, const vector6d_t& r
     const PoseMatrix out_pose_matrix = multiplyMatrixUnchecked(left_pose_matrix, right_pose_matrix);
     out_pose = toPoseVectorUnchecked(out_pose_matrix);
 
-    if (!PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose vector contains non-finite values");
         return false;
     }
@@ -265,10 +474,10 @@ bool ElitePoseAlgebra::multiply(const vector6d_t& left_pose, const vector6d_t& r
 
 bool ElitePoseAlgebra::add(const PoseMatrix& left_pose, const PoseMatrix& right_pose, PoseMatrix& out_pose,
                         PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateMatrixFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateMatrixFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(right_pose, result, "right pose")) {
         return false;
     }
 
@@ -278,7 +487,7 @@ bool ElitePoseAlgebra::add(const PoseMatrix& left_pose, const PoseMatrix& right_
         }
     }
 
-    if (!PoseAlgebraBase::validateMatrixFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose matrix contains non-finite values");
         return false;
     }
@@ -289,10 +498,10 @@ bool ElitePoseAlgebra::add(const PoseMatrix& left_pose, const PoseMatrix& right_
 
 bool ElitePoseAlgebra::add(const vector6d_t& left_pose, const vector6d_t& right_pose, vector6d_t& out_pose,
                         PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
         return false;
     }
 
@@ -300,7 +509,7 @@ bool ElitePoseAlgebra::add(const vector6d_t& left_pose, const vector6d_t& right_
         out_pose[i] = left_pose[i] + right_pose[i];
     }
 
-    if (!PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose vector contains non-finite values");
         return false;
     }
@@ -311,10 +520,10 @@ bool ElitePoseAlgebra::add(const vector6d_t& left_pose, const vector6d_t& right_
 
 bool ElitePoseAlgebra::subtract(const PoseMatrix& left_pose, const PoseMatrix& right_pose, PoseMatrix& out_pose,
                              PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateMatrixFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateMatrixFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(right_pose, result, "right pose")) {
         return false;
     }
 
@@ -324,7 +533,7 @@ bool ElitePoseAlgebra::subtract(const PoseMatrix& left_pose, const PoseMatrix& r
         }
     }
 
-    if (!PoseAlgebraBase::validateMatrixFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateMatrixFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose matrix contains non-finite values");
         return false;
     }
@@ -335,10 +544,10 @@ bool ElitePoseAlgebra::subtract(const PoseMatrix& left_pose, const PoseMatrix& r
 
 bool ElitePoseAlgebra::subtract(const vector6d_t& left_pose, const vector6d_t& right_pose, vector6d_t& out_pose,
                              PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(right_pose, result, "right pose")) {
         return false;
     }
 
@@ -346,7 +555,7 @@ bool ElitePoseAlgebra::subtract(const vector6d_t& left_pose, const vector6d_t& r
         out_pose[i] = left_pose[i] - right_pose[i];
     }
 
-    if (!PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(out_pose, result, "output pose")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "output pose vector contains non-finite values");
         return false;
     }
@@ -356,13 +565,13 @@ bool ElitePoseAlgebra::subtract(const vector6d_t& left_pose, const vector6d_t& r
 }
 
 bool ElitePoseAlgebra::vectorToMatrix(const vector6d_t& pose_vector, PoseMatrix& pose_matrix, PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateVectorFinite(pose_vector, result, "pose vector")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(pose_vector, result, "pose vector")) {
         return false;
     }
 
     pose_matrix = toPoseMatrixUnchecked(pose_vector);
 
-    if (!validatePoseMatrix(pose_matrix, result, "pose matrix")) {
+    if (isChecked() && !validatePoseMatrix(pose_matrix, result, "pose matrix")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "failed to construct a valid pose matrix from pose vector");
         return false;
     }
@@ -372,12 +581,12 @@ bool ElitePoseAlgebra::vectorToMatrix(const vector6d_t& pose_vector, PoseMatrix&
 }
 
 bool ElitePoseAlgebra::matrixToVector(const PoseMatrix& pose_matrix, vector6d_t& pose_vector, PoseAlgebraResult& result) const {
-    if (!validatePoseMatrix(pose_matrix, result, "pose matrix")) {
+    if (isChecked() && !validatePoseMatrix(pose_matrix, result, "pose matrix")) {
         return false;
     }
 
     pose_vector = toPoseVectorUnchecked(pose_matrix);
-    if (!PoseAlgebraBase::validateVectorFinite(pose_vector, result, "pose vector")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(pose_vector, result, "pose vector")) {
         PoseAlgebraBase::setError(result, PoseAlgebraError::NUMERICAL_ERROR, "failed to extract a valid pose vector from pose matrix");
         return false;
     }
@@ -388,10 +597,10 @@ bool ElitePoseAlgebra::matrixToVector(const PoseMatrix& pose_matrix, vector6d_t&
 
 bool ElitePoseAlgebra::distance(const PoseMatrix& pose_a, const PoseMatrix& pose_b, PoseDistance& out_distance,
                              PoseAlgebraResult& result) const {
-    if (!validatePoseMatrix(pose_a, result, "pose_a")) {
+    if (isChecked() && !validatePoseMatrix(pose_a, result, "pose_a")) {
         return false;
     }
-    if (!validatePoseMatrix(pose_b, result, "pose_b")) {
+    if (isChecked() && !validatePoseMatrix(pose_b, result, "pose_b")) {
         return false;
     }
 
@@ -406,10 +615,10 @@ bool ElitePoseAlgebra::distance(const PoseMatrix& pose_a, const PoseMatrix& pose
 
 bool ElitePoseAlgebra::distance(const vector6d_t& pose_a, const vector6d_t& pose_b, PoseDistance& out_distance,
                              PoseAlgebraResult& result) const {
-    if (!PoseAlgebraBase::validateVectorFinite(pose_a, result, "pose_a")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(pose_a, result, "pose_a")) {
         return false;
     }
-    if (!PoseAlgebraBase::validateVectorFinite(pose_b, result, "pose_b")) {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(pose_b, result, "pose_b")) {
         return false;
     }
 
@@ -478,6 +687,83 @@ bool ElitePoseAlgebra::localToWorld(const vector6d_t& world_ref_pose, const vect
     return matrixToVector(world_pose_matrix, world_pose, result);
 }
 
+bool ElitePoseAlgebra::multiplyBatch(const PoseMatrix& left_pose, const PoseMatrix* right_poses, PoseMatrix* out_poses, size_t n,
+                                     PoseAlgebraResult& result) const {
+    if (isChecked() && !validatePoseMatrix(left_pose, result, "left pose")) {
+        return false;
+    }
+    return composeBatch(left_pose, right_poses, out_poses, n, isChecked(), result);
+}
+
+bool ElitePoseAlgebra::multiplyBatch(const vector6d_t& left_pose, const vector6d_t* right_poses, vector6d_t* out_poses, size_t n,
+                                     PoseAlgebraResult& result) const {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(left_pose, result, "left pose")) {
+        return false;
+    }
+    return composeBatch(toPoseMatrixUnchecked(left_pose), right_poses, out_poses, n, isChecked(), result);
+}
+
+bool ElitePoseAlgebra::worldToLocalBatch(const PoseMatrix& world_ref_pose, const PoseMatrix* world_poses, PoseMatrix* local_poses,
+                                         size_t n, PoseAlgebraResult& result) const {
+    if (isChecked() && !validatePoseMatrix(world_ref_pose, result, "world reference pose")) {
+        return false;
+    }
+    return composeBatch(inverseMatrixUnchecked(world_ref_pose), world_poses, local_poses, n, isChecked(), result);
+}
+
+bool ElitePoseAlgebra::worldToLocalBatch(const vector6d_t& world_ref_pose, const vector6d_t* world_poses, vector6d_t* local_poses,
+                                         size_t n, PoseAlgebraResult& result) const {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(world_ref_pose, result, "world reference pose")) {
+        return false;
+    }
+    return composeBatch(inverseMatrixUnchecked(toPoseMatrixUnchecked(world_ref_pose)), world_poses, local_poses, n,
+                        isChecked(), result);
+}
+
+bool ElitePoseAlgebra::localToWorldBatch(const PoseMatrix& world_ref_pose, const PoseMatrix* local_poses, PoseMatrix* world_poses,
+                                         size_t n, PoseAlgebraResult& result) const {
+    if (isChecked() && !validatePoseMatrix(world_ref_pose, result, "world reference pose")) {
+        return false;
+    }
+    return composeBatch(world_ref_pose, local_poses, world_poses, n, isChecked(), result);
+}
+
+bool ElitePoseAlgebra::localToWorldBatch(const vector6d_t& world_ref_pose, const vector6d_t* local_poses, vector6d_t* world_poses,
+                                         size_t n, PoseAlgebraResult& result) const {
+    if (isChecked() && !PoseAlgebraBase::validateVectorFinite(world_ref_pose, result, "world reference pose")) {
+        return false;
+    }
+    return composeBatch(toPoseMatrixUnchecked(world_ref_pose), local_poses, world_poses, n, isChecked(), result);
+}
+
+bool ElitePoseAlgebra::vectorToMatrixBatch(const vector6d_t* pose_vectors, PoseMatrix* pose_matrices, size_t n,
+                                           PoseAlgebraResult& result) const {
+    return convertBatch(pose_vectors, pose_matrices, n, isChecked(), result);
+}
+
+bool ElitePoseAlgebra::matrixToVectorBatch(const PoseMatrix* pose_matrices, vector6d_t* pose_vectors, size_t n,
+                                           PoseAlgebraResult& result) const {
+    return convertBatch(pose_matrices, pose_vectors, n, isChecked(), result);
+}
+
+bool ElitePoseAlgebra::transformPointsBatch(const PoseMatrix& pose, const vector3d_t* points, vector3d_t* out_points, size_t n,
+                                            PoseAlgebraResult& result) const {
+    if (isChecked() && !validatePoseMatrix(pose, result, "pose")) {
+        return false;
+    }
+    return transformPointsBlocks(pose, points, out_points, n, isChecked(), result);
+}
+
+PoseAlgebraKernels ElitePoseAlgebra::getKernelTable() const {
+    PoseAlgebraKernels kernels;
+    kernels.compose_matrices = composeMatricesKernel;
+    kernels.compose_vectors = composeVectorsKernel;
+    kernels.vector_to_matrix = vectorToMatrixKernel;
+    kernels.matrix_to_vector = matrixToVectorKernel;
+    kernels.transform_points = transformPointsKernel;
+    return kernels;
+}
+
 }  // namespace ELITE
 
 #include <Elite/ClassRegisterMacro.hpp>
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// AnalyticKinematicsPlugin.hpp
+// Closed-form kinematics plugin for the 6-axis arms with three parallel middle axes
+#ifndef __ELITE__ANALYTIC_KINEMATICS_PLUGIN_HPP__
+#define __ELITE__ANALYTIC_KINEMATICS_PLUGIN_HPP__
+
+#include <memory>
+
+// Elite
+#include <Elite/KinematicsBase.hpp>
+#include <Elite/MdhKinematics.hpp>
+#include <Elite/DataType.hpp>
+#include <Elite/EliteOptions.hpp>
+
+namespace ELITE {
+
+/**
+ * @brief Closed-form kinematics of the Elite CS arms.
+ * @verbatim
+ *  The MDH geometry must have the base and the shoulder axes perpendicular (alpha[1] = +-pi/2), the shoulder, elbow
+ *  and wrist 1 axes parallel (alpha[2] = alpha[3] = 0), no base and wrist link lengths (a[0] = a[4] = a[5] = 0) and
+ *  twisted wrist 2 and wrist 3 axes. The IK then gives the up to 8 solutions (shoulder, wrist and elbow branches)
+ *  without iterations, sorted by the distance to the seed.
+ *  The model is immutable and replaced atomically by setMDH(), so the queries do not lock.
+ * @endverbatim
+ *
+ */
+class AnalyticKinematicsPlugin : public KinematicsBase {
+   public:
+    // The geometry of the chain used by the IK
+    struct Model;
+
+    // Solutions of a pose: 2 shoulder, 2 wrist and 2 elbow branches
+    static constexpr size_t MAX_SOLUTIONS = 8;
+
+   private:
+    std::shared_ptr<const Model> model_;
+
+    std::shared_ptr<const Model> loadModel() const;
+
+    // Write the solutions, sorted by the distance to near, and return their number
+    size_t solveAll(const Model& model, const vector6d_t& pose, const vector6d_t& near, vector6d_t* solutions) const;
+
+    size_t solve(const vector6d_t& pose, const vector6d_t& near, vector6d_t* solutions, KinematicsResult& result) const;
+
+   public:
+    /**
+     * @brief Set robot MDH parameter. Logs an error if the geometry has no closed-form IK, the FK still works then.
+     *
+     * @param alpha MDH alpha parameter
+     * @param a MDH a parameter
+     * @param d MDH d parameter
+     */
+    ELITE_EXPORT virtual void setMDH(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d);
+
+    /**
+     * @brief Given a set of joint angles and a set of links, compute their pose
+     *
+     * @param joint_angles The state for which FK is being computed
+     * @param poses The resultant set of poses.
+     * @return True if a valid solution was found, false otherwise
+     */
+    ELITE_EXPORT virtual bool getPositionFK(const vector6d_t& joint_angles, vector6d_t& poses) const;
+
+    /**
+     * @brief Compute the poses of many joint configurations with the native MDH kernel
+     *
+     * @param q The joint angles of the configurations
+     * @param poses The resultant poses, poses[i] is the pose of q[i]
+     * @param n The number of configurations
+     * @return True if the poses were computed, false if setMDH() was not called
+     */
+    ELITE_EXPORT virtual bool getPositionFKBatch(const vector6d_t* q, vector6d_t* poses, size_t n) const;
+
+    /**
+     * @brief Compute the geometric Jacobian in the base frame with the closed form of the MDH chain
+     *
+     * @param joint_angles The joint angles
+     * @param jacobian The resultant Jacobian, rows [vx, vy, vz, wx, wy, wz] of the flange, a column per joint
+     * @return True if the Jacobian was computed, false if setMDH() was not called
+     */
+    ELITE_EXPORT virtual bool getJacobian(const vector6d_t& joint_angles, matrix6d_t& jacobian) const;
+
+    /**
+     * @brief Given a desired pose of the end-effector, compute the joint angles to reach it
+     *
+     * Returns the solution closest to the seed state.
+     * @param pose the desired pose of the link
+     * @param near an initial guess solution for the inverse kinematics
+     * @param solution the solution vector
+     * @param result A struct that reports the results of the query
+     * @return True if a valid set of solutions was found, false otherwise.
+     */
+    ELITE_EXPORT virtual bool getPositionIK(const vector6d_t& pose, const vector6d_t& near, vector6d_t& solution,
+                                            KinematicsResult& result) const;
+
+    /**
+     * @brief Compute all the joint solutions of a pose
+     *
+     * @param pose The desired pose of the link
+     * @param near The seed. Each joint of a solution is the equivalent angle (+-2*pi) closest to it, within [-2*pi, 2*pi],
+     * and the solutions are sorted by their euclidean distance to it.
+     * @param solutions Up to 8 solutions
+     * @param result A struct that reports the results of the query
+     * @return True if a valid set of solutions was found, false otherwise.
+     */
+    ELITE_EXPORT virtual bool getPositionIK(const vector6d_t& pose, const vector6d_t& near, std::vector<vector6d_t>& solutions,
+                                            KinematicsResult& result) const;
+
+    AnalyticKinematicsPlugin();
+    ~AnalyticKinematicsPlugin();
+};
+
+}  // namespace ELITE
+
+#endif  // __ELITE__ANALYTIC_KINEMATICS_PLUGIN_HPP__
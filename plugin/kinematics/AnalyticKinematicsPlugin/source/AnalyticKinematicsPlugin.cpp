@@ -0,0 +1,308 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+
+#include "AnalyticKinematicsPlugin.hpp"
+#include <Elite/Log.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace ELITE {
+
+// Tolerance of the geometry checks and of the cos/sin domains
+static constexpr double GEOMETRY_TOLERANCE = 1e-6;
+// A solution whose FK differs more from the target is dropped
+static constexpr double SOLUTION_TOLERANCE = 1e-6;
+// Below it the wrist is singular (q5 = 0 or pi), q6 then keeps the seed
+static constexpr double SINGULAR_TOLERANCE = 1e-9;
+
+static const double PI = 3.14159265358979323846;
+
+namespace {
+
+// Rigid transform, row-major rotation
+struct Frame {
+    double r[9];
+    double p[3];
+};
+
+Frame multiply(const Frame& l, const Frame& rt) {
+    Frame out;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            out.r[i * 3 + j] = l.r[i * 3] * rt.r[j] + l.r[i * 3 + 1] * rt.r[3 + j] + l.r[i * 3 + 2] * rt.r[6 + j];
+        }
+        out.p[i] = l.r[i * 3] * rt.p[0] + l.r[i * 3 + 1] * rt.p[1] + l.r[i * 3 + 2] * rt.p[2] + l.p[i];
+    }
+    return out;
+}
+
+Frame inverse(const Frame& f) {
+    Frame out;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            out.r[i * 3 + j] = f.r[j * 3 + i];
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        out.p[i] = -(out.r[i * 3] * f.p[0] + out.r[i * 3 + 1] * f.p[1] + out.r[i * 3 + 2] * f.p[2]);
+    }
+    return out;
+}
+
+// RotX(alpha) * Trans(a, 0, d) * RotZ(q), one joint of the chain
+Frame mdhFrame(double alpha, double a, double d, double q) {
+    const double ca = std::cos(alpha), sa = std::sin(alpha);
+    const double c = std::cos(q), s = std::sin(q);
+    return Frame{{c, -s, 0, ca * s, ca * c, -sa, sa * s, sa * c, ca}, {a, -sa * d, ca * d}};
+}
+
+// The same convention as KDL::Rotation::RPY()
+Frame poseToFrame(const vector6d_t& pose) {
+    const double cr = std::cos(pose[3]), sr = std::sin(pose[3]);
+    const double cp = std::cos(pose[4]), sp = std::sin(pose[4]);
+    const double cy = std::cos(pose[5]), sy = std::sin(pose[5]);
+    return Frame{{cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr, sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr,
+                  -sp, cp * sr, cp * cr},
+                 {pose[0], pose[1], pose[2]}};
+}
+
+double clampUnit(double v) { return std::max(-1.0, std::min(1.0, v)); }
+
+// The equivalent angle closest to the seed, within [-2*pi, 2*pi]
+double nearestAngle(double angle, double seed) {
+    angle += 2 * PI * std::round((seed - angle) / (2 * PI));
+    if (angle > 2 * PI) {
+        angle -= 2 * PI;
+    } else if (angle < -2 * PI) {
+        angle += 2 * PI;
+    }
+    return angle;
+}
+
+double squaredDistance(const vector6d_t& l, const vector6d_t& r) {
+    double sum = 0;
+    for (size_t i = 0; i < 6; i++) {
+        sum += (l[i] - r[i]) * (l[i] - r[i]);
+    }
+    return sum;
+}
+
+}  // namespace
+
+struct AnalyticKinematicsPlugin::Model {
+    MdhKinematics fk;
+    vector6d_t alpha;
+    vector6d_t a;
+    vector6d_t d;
+    bool ik_supported = false;
+    // Wrist center: p5 * z2 = offset, with z2 = sin(alpha[1]) * (sin(q1), -cos(q1), 0)
+    double shoulder_offset = 0;
+    // z6 * z2 = wrist_cos + wrist_scale * cos(q5)
+    double wrist_cos = 0;
+    double wrist_scale = 0;
+    // (RotX(alpha[1]) * Trans(a[1], 0, d[1]))^-1, reduces the middle joints to a planar 3R chain
+    Frame shoulder_inverse;
+};
+
+AnalyticKinematicsPlugin::AnalyticKinematicsPlugin() {}
+
+AnalyticKinematicsPlugin::~AnalyticKinematicsPlugin() {}
+
+std::shared_ptr<const AnalyticKinematicsPlugin::Model> AnalyticKinematicsPlugin::loadModel() const {
+    return std::atomic_load(&model_);
+}
+
+void AnalyticKinematicsPlugin::setMDH(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d) {
+    auto model = std::make_shared<Model>();
+    model->fk = MdhKinematics(alpha, a, d);
+    model->alpha = alpha;
+    model->a = a;
+    model->d = d;
+
+    auto is_zero = [](double v) { return std::fabs(v) < GEOMETRY_TOLERANCE; };
+    const double wrist_sin = std::sin(alpha[4]) * std::sin(alpha[5]);
+    model->ik_supported = is_zero(alpha[0]) && is_zero(a[0]) && is_zero(std::cos(alpha[1])) && is_zero(alpha[2]) &&
+                          is_zero(alpha[3]) && is_zero(a[4]) && is_zero(a[5]) && !is_zero(a[2]) && !is_zero(a[3]) &&
+                          !is_zero(wrist_sin);
+    if (model->ik_supported) {
+        model->shoulder_offset = (d[1] + d[2] + d[3] + d[4] * std::cos(alpha[4])) / std::sin(alpha[1]);
+        model->wrist_cos = std::cos(alpha[4]) * std::cos(alpha[5]);
+        model->wrist_scale = -wrist_sin;
+        model->shoulder_inverse = inverse(mdhFrame(alpha[1], a[1], d[1], 0));
+    } else {
+        ELITE_LOG_ERROR("The MDH parameters have no closed-form IK, only the FK is available\n");
+    }
+
+    std::atomic_store(&model_, std::shared_ptr<const Model>(model));
+}
+
+bool AnalyticKinematicsPlugin::getPositionFK(const vector6d_t& joint_angles, vector6d_t& poses) const {
+    auto model = loadModel();
+    if (!model) {
+        ELITE_LOG_ERROR("Please set Kinematics config first by setMDH()\n");
+        return false;
+    }
+    model->fk.forward(joint_angles, poses);
+    return true;
+}
+
+bool AnalyticKinematicsPlugin::getPositionFKBatch(const vector6d_t* q, vector6d_t* poses, size_t n) const {
+    auto model = loadModel();
+    if (!model) {
+        ELITE_LOG_ERROR("Please set Kinematics config first by setMDH()\n");
+        return false;
+    }
+    model->fk.forwardBatch(q, poses, n, 0);
+    return true;
+}
+
+bool AnalyticKinematicsPlugin::getJacobian(const vector6d_t& joint_angles, matrix6d_t& jacobian) const {
+    auto model = loadModel();
+    if (!model) {
+        ELITE_LOG_ERROR("Please set Kinematics config first by setMDH()\n");
+        return false;
+    }
+    model->fk.jacobian(joint_angles, jacobian);
+    return true;
+}
+
+size_t AnalyticKinematicsPlugin::solveAll(const Model& model, const vector6d_t& pose, const vector6d_t& near,
+                                          vector6d_t* solutions) const {
+    const vector6d_t& alpha = model.alpha;
+    const vector6d_t& a = model.a;
+    const vector6d_t& d = model.d;
+    const Frame target = poseToFrame(pose);
+    const double z6[3] = {target.r[2], target.r[5], target.r[8]};
+
+    // Base: the wrist center is at the shoulder offset from the plane of the arm
+    const double px = target.p[0] - d[5] * z6[0];
+    const double py = target.p[1] - d[5] * z6[1];
+    const double rho = std::hypot(px, py);
+    if (rho < GEOMETRY_TOLERANCE || std::fabs(model.shoulder_offset) > rho + GEOMETRY_TOLERANCE) {
+        return 0;
+    }
+    const double phi = std::atan2(py, px);
+    const double shoulder = std::asin(clampUnit(model.shoulder_offset / rho));
+    const double q1_branches[2] = {phi + shoulder, phi + PI - shoulder};
+
+    size_t count = 0;
+    for (double q1 : q1_branches) {
+        const double s1 = std::sin(q1), c1 = std::cos(q1);
+        const double sa1 = std::sin(alpha[1]);
+        const double z2[3] = {sa1 * s1, -sa1 * c1, 0};
+
+        // Wrist 2: the angle between the tool axis and the parallel axes
+        const double z6_z2 = z6[0] * z2[0] + z6[1] * z2[1];
+        const double c5 = (z6_z2 - model.wrist_cos) / model.wrist_scale;
+        if (std::fabs(c5) > 1 + GEOMETRY_TOLERANCE) {
+            continue;
+        }
+        const double q5_abs = std::acos(clampUnit(c5));
+        const double q5_branches[2] = {q5_abs, -q5_abs};
+
+        // The parallel axis in the tool frame
+        const double v[3] = {target.r[0] * z2[0] + target.r[3] * z2[1], target.r[1] * z2[0] + target.r[4] * z2[1],
+                             target.r[2] * z2[0] + target.r[5] * z2[1]};
+        for (double q5 : q5_branches) {
+            // Wrist 3: rotates the parallel axis, seen from the tool, to RotX(-alpha[5])*RotZ(-q5)*RotX(-alpha[4])*z
+            const double sa4 = std::sin(alpha[4]), ca4 = std::cos(alpha[4]);
+            const double sa5 = std::sin(alpha[5]), ca5 = std::cos(alpha[5]);
+            const double wx = sa4 * std::sin(q5);
+            const double wy = sa4 * std::cos(q5) * ca5 + ca4 * sa5;
+            double q6;
+            if (std::hypot(v[0], v[1]) < SINGULAR_TOLERANCE || std::hypot(wx, wy) < SINGULAR_TOLERANCE) {
+                q6 = near[5];
+            } else {
+                q6 = std::atan2(wy, wx) - std::atan2(v[1], v[0]);
+            }
+
+            // The middle joints are a planar 3R chain
+            const Frame wrist = multiply(mdhFrame(alpha[4], a[4], d[4], q5), mdhFrame(alpha[5], a[5], d[5], q6));
+            const Frame frame4 = multiply(target, inverse(wrist));
+            const Frame planar =
+                multiply(model.shoulder_inverse, multiply(inverse(mdhFrame(alpha[0], a[0], d[0], q1)), frame4));
+            const double x = planar.p[0];
+            const double y = planar.p[1];
+            const double c3 = (x * x + y * y - a[2] * a[2] - a[3] * a[3]) / (2 * a[2] * a[3]);
+            if (std::fabs(c3) > 1 + GEOMETRY_TOLERANCE) {
+                continue;
+            }
+            const double q3_abs = std::acos(clampUnit(c3));
+            const double q234 = std::atan2(planar.r[3], planar.r[0]);
+            for (double q3 : {q3_abs, -q3_abs}) {
+                const double q2 = std::atan2(y, x) - std::atan2(a[3] * std::sin(q3), a[2] + a[3] * std::cos(q3));
+                vector6d_t q = {q1, q2, q3, q234 - q2 - q3, q5, q6};
+                for (size_t i = 0; i < 6; i++) {
+                    q[i] = nearestAngle(q[i], near[i]);
+                }
+
+                // Drop the branches lost in the clamping of a singular pose
+                double r[9], p[3];
+                model.fk.forward(q, r, p);
+                double error = 0;
+                for (int i = 0; i < 9; i++) {
+                    error = std::max(error, std::fabs(r[i] - target.r[i]));
+                }
+                for (int i = 0; i < 3; i++) {
+                    error = std::max(error, std::fabs(p[i] - target.p[i]));
+                }
+                if (error > SOLUTION_TOLERANCE) {
+                    continue;
+                }
+                bool duplicate = std::any_of(solutions, solutions + count, [&q](const vector6d_t& other) {
+                    return squaredDistance(q, other) < SOLUTION_TOLERANCE * SOLUTION_TOLERANCE;
+                });
+                if (!duplicate) {
+                    solutions[count++] = q;
+                }
+            }
+        }
+    }
+
+    std::sort(solutions, solutions + count, [&near](const vector6d_t& l, const vector6d_t& r) {
+        return squaredDistance(l, near) < squaredDistance(r, near);
+    });
+    return count;
+}
+
+bool AnalyticKinematicsPlugin::getPositionIK(const vector6d_t& pose, const vector6d_t& near, vector6d_t& solution,
+                                             KinematicsResult& result) const {
+    vector6d_t solutions[MAX_SOLUTIONS];
+    if (!solve(pose, near, solutions, result)) {
+        return false;
+    }
+    solution = solutions[0];
+    return true;
+}
+
+bool AnalyticKinematicsPlugin::getPositionIK(const vector6d_t& pose, const vector6d_t& near, std::vector<vector6d_t>& solutions,
+                                             KinematicsResult& result) const {
+    vector6d_t found[MAX_SOLUTIONS];
+    size_t count = solve(pose, near, found, result);
+    solutions.assign(found, found + count);
+    return count > 0;
+}
+
+size_t AnalyticKinematicsPlugin::solve(const vector6d_t& pose, const vector6d_t& near, vector6d_t* solutions,
+                                       KinematicsResult& result) const {
+    auto model = loadModel();
+    if (!model) {
+        ELITE_LOG_ERROR("Please set Kinematics config first by setMDH()\n");
+        result.kinematic_error = KinematicError::SOLVER_NOT_ACTIVE;
+        return 0;
+    }
+    if (!model->ik_supported) {
+        result.kinematic_error = KinematicError::SOLVER_NOT_ACTIVE;
+        return 0;
+    }
+    size_t count = solveAll(*model, pose, near, solutions);
+    result.kinematic_error = count > 0 ? KinematicError::OK : KinematicError::NO_SOLUTION;
+    return count;
+}
+
+}  // namespace ELITE
+
+#include <Elite/ClassRegisterMacro.hpp>
+ELITE_CLASS_LOADER_REGISTER_CLASS(ELITE::AnalyticKinematicsPlugin, ELITE::KinematicsBase);
@@ -6,7 +6,9 @@
 #ifndef __ELITE__KDL_KINEMATICS_PLUGIN_HPP__
 #define __ELITE__KDL_KINEMATICS_PLUGIN_HPP__
 
+#include <memory>
 #include <mutex>
+#include <vector>
 
 // KDL
 #include <kdl/chain.hpp>
@@ -15,30 +17,72 @@
 
 // Elite
 #include <Elite/KinematicsBase.hpp>
+#include <Elite/MdhKinematics.hpp>
 #include <Elite/ClassLoader.hpp>
 #include <Elite/DataType.hpp>
 #include <Elite/EliteOptions.hpp>
 
 namespace ELITE {
 
+/**
+ * @brief Kinematics solver based on KDL.
+ * @verbatim
+ *  The chain of setMDH() is immutable and published atomically, a query takes a reference to the current chain and
+ *  never waits for setMDH(). The KDL solvers keep scratch state, so every query leases a set of solvers from a pool of
+ *  the chain: the threads solve in parallel, and a set is only created when more threads than ever before solve at once.
+ * @endverbatim
+ *
+ */
 class KdlKinematicsPlugin : public KinematicsBase
 {
+public:
+    // The KDL solvers and joint arrays used by one query at a time
+    struct Scratch {
+        KDL::ChainFkSolverPos_recursive fk_solver;
+        KDL::ChainIkSolverPos_LMA ik_solver;
+        KDL::JntArray joints;
+        KDL::JntArray seed;
+        KDL::JntArray result;
+
+        explicit Scratch(const KDL::Chain& chain);
+    };
+
+    // The chain of a set of MDH parameters, and the pool of its solvers
+    struct Model {
+        KDL::Chain chain;
+        // Native FK of the chain, for the batch queries and the Jacobian
+        MdhKinematics mdh;
+
+        std::mutex pool_mutex;
+        std::vector<std::unique_ptr<Scratch>> pool;
+
+        Model(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d);
+    };
+
 private:
-    vector6d_t dh_alpha_;
-    vector6d_t dh_a_;
-    vector6d_t dh_d_;
+    std::shared_ptr<Model> model_;
+
+    // Returns the scratch to the pool of its model when destroyed
+    class ScratchLease {
+       private:
+        std::shared_ptr<Model> model_;
+        std::unique_ptr<Scratch> scratch_;
 
-    mutable std::mutex mutex_;
+       public:
+        explicit ScratchLease(std::shared_ptr<Model> model);
+        ~ScratchLease();
+        Scratch& operator*() const { return *scratch_; }
+        Scratch* operator->() const { return scratch_.get(); }
+    };
 
-    std::unique_ptr<KDL::ChainIkSolverPos_LMA> ik_solver_;
-    std::unique_ptr<KDL::ChainFkSolverPos_recursive> fk_solver_;
-    std::unique_ptr<KDL::Chain> robot_chain_;
+    std::shared_ptr<Model> loadModel() const;
 
-    KDL::JntArray convertToKDLJoints(const ELITE::vector6d_t &joints) const;
+    static void convertToKDLJoints(const ELITE::vector6d_t& joints, KDL::JntArray& kdl_joints);
 public:
     /**
-     * @brief Set robot MDH parameter
-     * 
+     * @brief Set robot MDH parameter. The new chain is used by the queries started after the call, the running queries
+     * finish with the previous one.
+     *
      * @param alpha MDH alpha parameter
      * @param a MDH a parameter
      * @param d MDH d parameter
@@ -47,16 +91,36 @@ public:
 
     /**
      * @brief Given a set of joint angles and a set of links, compute their pose
-     * 
+     *
      * @param joint_angles The state for which FK is being computed
      * @param poses The resultant set of poses.
      * @return True if a valid solution was found, false otherwise
      */
     ELITE_EXPORT virtual bool getPositionFK(const vector6d_t& joint_angles, vector6d_t& poses) const;
 
+    /**
+     * @brief Compute the poses of many joint configurations with the native MDH kernel. Large batches are split across
+     * the hardware threads.
+     *
+     * @param q The joint angles of the configurations
+     * @param poses The resultant poses, poses[i] is the pose of q[i]
+     * @param n The number of configurations
+     * @return True if the poses were computed, false if setMDH() was not called
+     */
+    ELITE_EXPORT virtual bool getPositionFKBatch(const vector6d_t* q, vector6d_t* poses, size_t n) const;
+
+    /**
+     * @brief Compute the geometric Jacobian in the base frame with the closed form of the MDH chain
+     *
+     * @param joint_angles The joint angles
+     * @param jacobian The resultant Jacobian, rows [vx, vy, vz, wx, wy, wz] of the flange, a column per joint
+     * @return True if the Jacobian was computed, false if setMDH() was not called
+     */
+    ELITE_EXPORT virtual bool getJacobian(const vector6d_t& joint_angles, matrix6d_t& jacobian) const;
+
     /**
      * @brief Given a desired pose of the end-effector, compute the joint angles to reach it
-     * 
+     *
      * In contrast to the searchPositionIK methods, this one is expected to return the solution
      * closest to the seed state. Randomly re-seeding is explicitly not allowed.
      * @param pose the desired pose of the link
@@ -69,7 +133,7 @@ public:
 
     /**
      * @brief Get the Position I K object
-     * 
+     *
      * @param pose The desired pose of each tip link
      * @param near an initial guess solution for the inverse kinematics
      * @param solutions A vector of valid joint vectors. This return has two variant behaviors:
@@ -87,4 +151,4 @@ public:
 
 } // namespace ELITE
 
-#endif  // __ELITE__KDL_KINEMATICS_PLUGIN_HPP__
\ No newline at end of file
+#endif  // __ELITE__KDL_KINEMATICS_PLUGIN_HPP__
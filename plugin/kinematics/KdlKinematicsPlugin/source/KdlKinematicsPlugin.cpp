@@ -4,51 +4,65 @@
 #include "KdlKinematicsPlugin.hpp"
 #include <Elite/Log.hpp>
 
+#include <atomic>
+
 // The robot dimension
 #define AXIS_COUNT (6)
 
 namespace ELITE {
 
-KdlKinematicsPlugin::KdlKinematicsPlugin() {}
-
-KdlKinematicsPlugin::~KdlKinematicsPlugin() {}
+KdlKinematicsPlugin::Scratch::Scratch(const KDL::Chain& chain)
+    : fk_solver(chain), ik_solver(chain, 1e-10, 10000), joints(AXIS_COUNT), seed(AXIS_COUNT), result(AXIS_COUNT) {}
 
-void KdlKinematicsPlugin::setMDH(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d) {
-    std::lock_guard<std::mutex> lock(mutex_);
+KdlKinematicsPlugin::Model::Model(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d) : mdh(alpha, a, d) {
+    for (int i = 0; i < AXIS_COUNT; i++) {
+        KDL::Frame rot = KDL::Frame(KDL::Rotation(KDL::Vector(1, 0, 0), KDL::Vector(0, std::cos(alpha[i]), std::sin(alpha[i])),
+                                                  KDL::Vector(0, -std::sin(alpha[i]), std::cos(alpha[i]))));
+        KDL::Frame trans = KDL::Frame(KDL::Vector(a[i], 0, d[i]));
+        chain.addSegment(KDL::Segment("Link" + std::to_string(i), KDL::Joint(KDL::Joint::None), rot * trans));
+        chain.addSegment(KDL::Segment("Link" + std::to_string(i), KDL::Joint(KDL::Joint::RotZ)));
+    }
+}
 
-    dh_alpha_ = alpha;
-    dh_a_ = a;
-    dh_d_ = d;
+KdlKinematicsPlugin::ScratchLease::ScratchLease(std::shared_ptr<Model> model) : model_(std::move(model)) {
+    {
+        std::lock_guard<std::mutex> lock(model_->pool_mutex);
+        if (!model_->pool.empty()) {
+            scratch_ = std::move(model_->pool.back());
+            model_->pool.pop_back();
+        }
+    }
+    if (!scratch_) {
+        scratch_.reset(new Scratch(model_->chain));
+    }
+}
 
-    ik_solver_.reset();
-    fk_solver_.reset();
-    robot_chain_.reset();
+KdlKinematicsPlugin::ScratchLease::~ScratchLease() {
+    std::lock_guard<std::mutex> lock(model_->pool_mutex);
+    model_->pool.push_back(std::move(scratch_));
+}
 
-    robot_chain_ = std::make_unique<KDL::Chain>();
+KdlKinematicsPlugin::KdlKinematicsPlugin() {}
 
-    for (int i = 0; i < AXIS_COUNT; i++) {
-        KDL::Frame rot =
-            KDL::Frame(KDL::Rotation(KDL::Vector(1, 0, 0), KDL::Vector(0, std::cos(dh_alpha_[i]), std::sin(dh_alpha_[i])),
-                                     KDL::Vector(0, -std::sin(dh_alpha_[i]), std::cos(dh_alpha_[i]))));
-        KDL::Frame trans = KDL::Frame(KDL::Vector(dh_a_[i], 0, dh_d_[i]));
-        robot_chain_->addSegment(KDL::Segment("Link" + std::to_string(i), KDL::Joint(KDL::Joint::None), rot * trans));
-        robot_chain_->addSegment(KDL::Segment("Link" + std::to_string(i), KDL::Joint(KDL::Joint::RotZ)));
-    }
+KdlKinematicsPlugin::~KdlKinematicsPlugin() {}
 
-    ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_LMA>(*robot_chain_, 1e-10, 10000);
+std::shared_ptr<KdlKinematicsPlugin::Model> KdlKinematicsPlugin::loadModel() const { return std::atomic_load(&model_); }
 
-    fk_solver_ = std::make_unique<KDL::ChainFkSolverPos_recursive>(*robot_chain_);
+void KdlKinematicsPlugin::setMDH(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d) {
+    // The running queries keep the previous model until they return its scratch
+    std::atomic_store(&model_, std::make_shared<Model>(alpha, a, d));
 }
 
 bool KdlKinematicsPlugin::getPositionFK(const vector6d_t& joint_angles, vector6d_t& poses) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!fk_solver_) {
+    auto model = loadModel();
+    if (!model) {
         ELITE_LOG_ERROR("Please set Kinematics config first by setMDH()\n");
         return false;
     }
-    KDL::JntArray kdl_joints = convertToKDLJoints(joint_angles);
+    ScratchLease scratch(model);
+    convertToKDLJoints(joint_angles, scratch->joints);
     KDL::Frame result_frame;
-    int ret = fk_solver_->JntToCart(kdl_joints, result_frame);
+    int ret = scratch->fk_solver.JntToCart(scratch->joints, result_frame);
     if (ret < 0) {
         ELITE_LOG_ERROR("KDL FK solver failed, error code: %d\n", ret);
         return false;
@@ -63,17 +77,38 @@ bool KdlKinematicsPlugin::getPositionFK(const vector6d_t& joint_angles, vector6d
     return true;
 }
 
+bool KdlKinematicsPlugin::getPositionFKBatch(const vector6d_t* q, vector6d_t* poses, size_t n) const {
+    auto model = loadModel();
+    if (!model) {
+        ELITE_LOG_ERROR("Please set Kinematics config first by setMDH()\n");
+        return false;
+    }
+    model->mdh.forwardBatch(q, poses, n, 0);
+    return true;
+}
+
+bool KdlKinematicsPlugin::getJacobian(const vector6d_t& joint_angles, matrix6d_t& jacobian) const {
+    auto model = loadModel();
+    if (!model) {
+        ELITE_LOG_ERROR("Please set Kinematics config first by setMDH()\n");
+        return false;
+    }
+    model->mdh.jacobian(joint_angles, jacobian);
+    return true;
+}
+
 bool KdlKinematicsPlugin::getPositionIK(const vector6d_t& pose, const vector6d_t& near, vector6d_t& solution,
                                         KinematicsResult& result) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!ik_solver_) {
+    auto model = loadModel();
+    if (!model) {
         ELITE_LOG_ERROR("Please set Kinematics config first by setMDH()\n");
         result.kinematic_error = KinematicError::SOLVER_NOT_ACTIVE;
         return false;
     }
+    ScratchLease scratch(model);
 
     // near → KDL JntArray (seed)
-    KDL::JntArray kdl_joints_near = convertToKDLJoints(near);
+    convertToKDLJoints(near, scratch->seed);
 
     // pose(xyz + RPY) → KDL::Frame
     const double x = pose[0];
@@ -87,8 +122,7 @@ bool KdlKinematicsPlugin::getPositionIK(const vector6d_t& pose, const vector6d_t
     KDL::Vector pos(x, y, z);
     KDL::Frame frame(rot, pos);
 
-    KDL::JntArray ret_joints(AXIS_COUNT);
-    int ret = ik_solver_->CartToJnt(kdl_joints_near, frame, ret_joints);
+    int ret = scratch->ik_solver.CartToJnt(scratch->seed, frame, scratch->result);
 
     if (ret != KDL::SolverI::E_NOERROR) {
         ELITE_LOG_WARN("KDL IK solver failed, error code: %d\n", ret);
@@ -97,7 +131,7 @@ bool KdlKinematicsPlugin::getPositionIK(const vector6d_t& pose, const vector6d_t
     }
 
     for (size_t i = 0; i < AXIS_COUNT; ++i) {
-        solution[i] = ret_joints(i);
+        solution[i] = scratch->result(i);
     }
 
     result.kinematic_error = KinematicError::OK;
@@ -110,12 +144,10 @@ bool KdlKinematicsPlugin::getPositionIK(const vector6d_t& pose, const vector6d_t
     return getPositionIK(pose, near, solutions[0], result);
 }
 
-KDL::JntArray KdlKinematicsPlugin::convertToKDLJoints(const ELITE::vector6d_t& joints) const {
-    KDL::JntArray kdl_joints(AXIS_COUNT);
+void KdlKinematicsPlugin::convertToKDLJoints(const ELITE::vector6d_t& joints, KDL::JntArray& kdl_joints) {
     for (int i = 0; i < AXIS_COUNT; i++) {
-        kdl_joints(i) = (i < static_cast<int>(joints.size())) ? joints[i] : 0.0;
+        kdl_joints(i) = joints[i];
     }
-    return kdl_joints;
 }
 }  // namespace ELITE
 
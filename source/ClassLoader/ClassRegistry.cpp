@@ -17,24 +17,21 @@ ClassRegistry& ClassRegistry::instance() {
 ClassRegistry::ClassRegistry() {}
 
 bool ClassRegistry::registerClass(const std::string& derived, const std::string& base, Factory factory) {
-    return factories_.emplace(makeClassKey(derived, base), factory).second;
+    return factories_[derived].emplace(base, factory).second;
 }
 
 ClassRegistry::Factory ClassRegistry::getFactory(const std::string& derived, const std::string& base) const {
-    auto it = factories_.find(makeClassKey(derived, base));
-    if (it == factories_.end()) {
+    auto derived_it = factories_.find(derived);
+    if (derived_it == factories_.end()) {
+        return nullptr;
+    }
+    auto it = derived_it->second.find(base);
+    if (it == derived_it->second.end()) {
         return nullptr;
     }
     return it->second;
 }
 
-// Compose a unique key from derived and base class names.
-// Uses a control character as a separator to minimize collision risk.
-std::string ClassRegistry::makeClassKey(const std::string& derived, const std::string& base) const {
-    static const char separator = '\x1F';  // Unit Separator
-    return derived + separator + base;
-}
-
 }  // namespace INTERNAL
 
 }  // namespace ELITE
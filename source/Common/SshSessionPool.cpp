@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "Common/SshSessionPool.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "Elite/Log.hpp"
+
+namespace ELITE {
+
+namespace SSH_UTILS {
+
+namespace {
+
+// Holds the session while the command runs, so the pool does not close it.
+class LeasedChannel : public SshChannel {
+   private:
+    std::unique_ptr<SshChannel> channel_;
+    std::shared_ptr<SshConnection> connection_;
+
+   public:
+    LeasedChannel(std::unique_ptr<SshChannel> channel, std::shared_ptr<SshConnection> connection)
+        : channel_(std::move(channel)), connection_(std::move(connection)) {}
+
+    ~LeasedChannel() {
+        // The channel is closed before the session is released
+        channel_.reset();
+    }
+
+    int read(char* buffer, int size, int timeout_ms) override { return channel_->read(buffer, size, timeout_ms); }
+
+    bool write(const char* buffer, int size) override { return channel_->write(buffer, size); }
+
+    void closeInput() override { channel_->closeInput(); }
+
+    int wait() override { return channel_->wait(); }
+};
+
+}  // namespace
+
+// The connection given to the users of the pool. Each command takes the current session of the host from the pool.
+class SshSessionPool::PooledConnection : public SshConnection {
+   private:
+    SshSessionPool* pool_;
+    std::string host_;
+    std::string user_;
+    std::string password_;
+
+   public:
+    PooledConnection(SshSessionPool* pool, const std::string& host, const std::string& user, const std::string& password)
+        : pool_(pool), host_(host), user_(user), password_(password) {}
+
+    std::unique_ptr<SshChannel> exec(const std::string& cmd) override {
+        // A session that was lost since it was pooled is logged in again once.
+        for (int attempt = 0; attempt < 2; attempt++) {
+            auto connection = pool_->session(host_, user_, password_);
+            if (!connection) {
+                return nullptr;
+            }
+            auto channel = connection->exec(cmd);
+            if (channel) {
+                return std::unique_ptr<SshChannel>(new LeasedChannel(std::move(channel), std::move(connection)));
+            }
+            ELITE_LOG_INFO("SSH session to %s@%s lost, log in again", user_.c_str(), host_.c_str());
+            pool_->invalidate(user_ + "@" + host_, connection);
+        }
+        return nullptr;
+    }
+
+    bool keepAlive() override {
+        auto connection = pool_->session(host_, user_, password_);
+        return connection && connection->keepAlive();
+    }
+};
+
+SshSessionPool& SshSessionPool::instance() {
+    static SshSessionPool s_pool;
+    return s_pool;
+}
+
+SshSessionPool::SshSessionPool(Connector connector, std::chrono::milliseconds idle_timeout,
+                               std::chrono::milliseconds keep_alive_interval)
+    : connector_(connector ? std::move(connector) : Connector(connect)),
+      idle_timeout_(idle_timeout),
+      keep_alive_interval_(keep_alive_interval) {}
+
+SshSessionPool::~SshSessionPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    maintain_cv_.notify_all();
+    if (maintain_thread_.joinable()) {
+        maintain_thread_.join();
+    }
+    entries_.clear();
+}
+
+std::shared_ptr<SshConnection> SshSessionPool::acquire(const std::string& host, const std::string& user,
+                                                       const std::string& password) {
+    if (!session(host, user, password)) {
+        return nullptr;
+    }
+    return std::make_shared<PooledConnection>(this, host, user, password);
+}
+
+std::shared_ptr<SshConnection> SshSessionPool::session(const std::string& host, const std::string& user,
+                                                       const std::string& password) {
+    const std::string key = user + "@" + host;
+    auto find = [&]() -> std::shared_ptr<SshConnection> {
+        auto it = entries_.find(key);
+        if (it == entries_.end() || it->second.password != password) {
+            return nullptr;
+        }
+        it->second.last_used = std::chrono::steady_clock::now();
+        return it->second.connection;
+    };
+    std::shared_ptr<std::mutex> connect_mutex;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto connection = find();
+        if (connection) {
+            return connection;
+        }
+        auto& key_mutex = connect_mutexes_[key];
+        if (!key_mutex) {
+            key_mutex = std::make_shared<std::mutex>();
+        }
+        connect_mutex = key_mutex;
+    }
+
+    // One login per host at a time, the logins to different hosts run in parallel.
+    std::lock_guard<std::mutex> connect_lock(*connect_mutex);
+    Connector connector;
+    {
+        // Another thread may have logged in meanwhile
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto connection = find();
+        if (connection) {
+            return connection;
+        }
+        connector = connector_;
+    }
+    auto connection = connector(host, user, password);
+    if (!connection) {
+        return nullptr;
+    }
+    std::shared_ptr<SshConnection> replaced;
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_[key];
+    replaced = std::move(entry.connection);
+    entry.password = password;
+    entry.connection = connection;
+    entry.last_used = std::chrono::steady_clock::now();
+    if (!maintain_running_ && !stopping_) {
+        // The previous thread has set maintain_running_ under the lock, it only has to return.
+        if (maintain_thread_.joinable()) {
+            maintain_thread_.join();
+        }
+        maintain_running_ = true;
+        maintain_thread_ = std::thread(&SshSessionPool::maintainLoop, this);
+    }
+    return connection;
+}
+
+void SshSessionPool::invalidate(const std::string& key, const std::shared_ptr<SshConnection>& connection) {
+    std::shared_ptr<SshConnection> lost;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end() && it->second.connection == connection) {
+        lost = std::move(it->second.connection);
+        entries_.erase(it);
+    }
+}
+
+void SshSessionPool::setConnector(Connector connector) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    connector_ = connector ? std::move(connector) : Connector(connect);
+}
+
+void SshSessionPool::clear() {
+    std::vector<std::shared_ptr<SshConnection>> closing;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.connection.use_count() == 1) {
+            closing.push_back(std::move(it->second.connection));
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+size_t SshSessionPool::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void SshSessionPool::maintainLoop() {
+    using namespace std::chrono;
+    const milliseconds tick = std::min(idle_timeout_, keep_alive_interval_);
+    auto last_keep_alive = steady_clock::now();
+    std::vector<std::shared_ptr<SshConnection>> closing;
+    std::vector<std::shared_ptr<SshConnection>> checking;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_ && !entries_.empty()) {
+        maintain_cv_.wait_for(lock, tick);
+        if (stopping_) {
+            break;
+        }
+        auto now = steady_clock::now();
+        bool keep_alive = now - last_keep_alive >= keep_alive_interval_;
+        if (keep_alive) {
+            last_keep_alive = now;
+        }
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            // A session with a running command is in use, and has traffic anyway.
+            if (it->second.connection.use_count() > 1) {
+                ++it;
+            } else if (now - it->second.last_used >= idle_timeout_) {
+                closing.push_back(std::move(it->second.connection));
+                it = entries_.erase(it);
+            } else {
+                if (keep_alive) {
+                    checking.push_back(it->second.connection);
+                }
+                ++it;
+            }
+        }
+
+        // Closing and keep-alives talk to the server, without the lock.
+        lock.unlock();
+        closing.clear();
+        std::vector<std::shared_ptr<SshConnection>> lost;
+        for (auto& connection : checking) {
+            if (!connection->keepAlive()) {
+                lost.push_back(connection);
+            }
+        }
+        lock.lock();
+        for (auto& connection : lost) {
+            for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+                if (it->second.connection == connection) {
+                    ELITE_LOG_INFO("SSH session to %s lost", it->first.c_str());
+                    closing.push_back(std::move(it->second.connection));
+                    entries_.erase(it);
+                    break;
+                }
+            }
+        }
+        checking.clear();
+        lost.clear();
+        if (!closing.empty()) {
+            lock.unlock();
+            closing.clear();
+            lock.lock();
+        }
+    }
+    maintain_running_ = false;
+}
+
+}  // namespace SSH_UTILS
+
+}  // namespace ELITE
@@ -0,0 +1,816 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#ifdef ELITE_USE_LIB_SSH
+#include <libssh/libssh.h>
+#endif
+
+#include "Common/SshTransfer.hpp"
+#include "Elite/Log.hpp"
+
+namespace ELITE {
+
+namespace SSH_UTILS {
+
+namespace {
+
+// Minimal SHA-256 (FIPS 180-4), only used to verify the transferred files.
+class Sha256 {
+   private:
+    uint32_t state_[8];
+    uint8_t block_[64];
+    size_t block_size_ = 0;
+    uint64_t length_ = 0;
+
+    static uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    void transform(const uint8_t* data) {
+        static const uint32_t K[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+        uint32_t w[64];
+        for (int i = 0; i < 16; i++) {
+            w[i] = (static_cast<uint32_t>(data[i * 4]) << 24) | (static_cast<uint32_t>(data[i * 4 + 1]) << 16) |
+                   (static_cast<uint32_t>(data[i * 4 + 2]) << 8) | static_cast<uint32_t>(data[i * 4 + 3]);
+        }
+        for (int i = 16; i < 64; i++) {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+        uint32_t e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+        for (int i = 0; i < 64; i++) {
+            uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+            uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state_[0] += a;
+        state_[1] += b;
+        state_[2] += c;
+        state_[3] += d;
+        state_[4] += e;
+        state_[5] += f;
+        state_[6] += g;
+        state_[7] += h;
+    }
+
+   public:
+    Sha256() {
+        static const uint32_t INIT[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                         0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+        std::memcpy(state_, INIT, sizeof(state_));
+    }
+
+    void update(const uint8_t* data, size_t size) {
+        length_ += size;
+        while (size > 0) {
+            size_t n = std::min(size, sizeof(block_) - block_size_);
+            std::memcpy(block_ + block_size_, data, n);
+            block_size_ += n;
+            data += n;
+            size -= n;
+            if (block_size_ == sizeof(block_)) {
+                transform(block_);
+                block_size_ = 0;
+            }
+        }
+    }
+
+    std::string hexDigest() {
+        uint64_t bits = length_ * 8;
+        uint8_t pad = 0x80;
+        update(&pad, 1);
+        pad = 0;
+        while (block_size_ != 56) {
+            update(&pad, 1);
+        }
+        uint8_t length[8];
+        for (int i = 0; i < 8; i++) {
+            length[i] = static_cast<uint8_t>(bits >> (56 - i * 8));
+        }
+        update(length, 8);
+        static const char HEX[] = "0123456789abcdef";
+        std::string digest;
+        for (uint32_t word : state_) {
+            for (int shift = 28; shift >= 0; shift -= 4) {
+                digest += HEX[(word >> shift) & 0xF];
+            }
+        }
+        return digest;
+    }
+};
+
+bool localSize(const std::string& path, uint64_t& size) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    size = static_cast<uint64_t>(file.tellg());
+    return true;
+}
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+
+class ProcessChannel : public SshChannel {
+   private:
+    pid_t pid_;
+    int input_fd_;
+    int output_fd_;
+    bool exited_ = false;
+    int status_ = -1;
+
+    void reap(int options) {
+        int status = 0;
+        pid_t r;
+        do {
+            r = waitpid(pid_, &status, options);
+        } while (r < 0 && errno == EINTR);
+        if (r == pid_) {
+            exited_ = true;
+            status_ = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+        } else if (r < 0) {
+            exited_ = true;
+        }
+    }
+
+   public:
+    ProcessChannel(pid_t pid, int input_fd, int output_fd) : pid_(pid), input_fd_(input_fd), output_fd_(output_fd) {}
+
+    ~ProcessChannel() {
+        closeInput();
+        if (output_fd_ >= 0) {
+            ::close(output_fd_);
+        }
+        // With both ends closed a command exits by itself, a hung one is killed.
+        for (int i = 0; i < 100 && !exited_; i++) {
+            reap(WNOHANG);
+            if (!exited_) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+        if (!exited_) {
+            ::kill(pid_, SIGKILL);
+            reap(0);
+        }
+    }
+
+    int read(char* buffer, int size, int timeout_ms) override {
+        if (timeout_ms > 0) {
+            pollfd pfd = {output_fd_, POLLIN, 0};
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+            int r;
+            do {
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+                r = ::poll(&pfd, 1, static_cast<int>(std::max<long long>(left.count(), 0)));
+            } while (r < 0 && errno == EINTR);
+            if (r <= 0) {
+                return -1;
+            }
+        }
+        ssize_t n;
+        do {
+            n = ::read(output_fd_, buffer, size);
+        } while (n < 0 && errno == EINTR);
+        return n < 0 ? -1 : static_cast<int>(n);
+    }
+
+    bool write(const char* buffer, int size) override {
+        while (size > 0) {
+            // The input is a socket, so a command that exited is an error, not a SIGPIPE.
+            ssize_t n = ::send(input_fd_, buffer, size, MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            buffer += n;
+            size -= static_cast<int>(n);
+        }
+        return true;
+    }
+
+    void closeInput() override {
+        if (input_fd_ >= 0) {
+            ::close(input_fd_);
+            input_fd_ = -1;
+        }
+    }
+
+    int wait() override {
+        closeInput();
+        if (!exited_) {
+            reap(0);
+        }
+        return status_;
+    }
+};
+
+// The commands run with `ssh` on an OpenSSH master connection, which is logged in once with `sshpass`.
+class OpenSshConnection : public SshConnection {
+   private:
+    std::string target_;
+    std::string control_path_;
+
+   public:
+    OpenSshConnection(const std::string& target, const std::string& control_path)
+        : target_(target), control_path_(control_path) {}
+
+    ~OpenSshConnection() {
+        auto channel = spawnProcess({"ssh", "-o", "ControlPath=" + control_path_, "-O", "exit", target_});
+        if (channel) {
+            channel->wait();
+        }
+    }
+
+    std::unique_ptr<SshChannel> exec(const std::string& cmd) override {
+        // The master removes its socket when it exits
+        if (::access(control_path_.c_str(), F_OK) != 0) {
+            return nullptr;
+        }
+        return spawnProcess({"ssh", "-o", "ControlPath=" + control_path_, "-o", "ControlMaster=no", "-o", "BatchMode=yes", "-o",
+                             "StrictHostKeyChecking=no", target_, cmd});
+    }
+
+    bool keepAlive() override {
+        // The master sends the keep-alive messages itself ("ServerAliveInterval"), this checks that it is still running.
+        auto channel = spawnProcess({"ssh", "-o", "ControlPath=" + control_path_, "-O", "check", target_});
+        return channel && channel->wait() == 0;
+    }
+};
+
+#endif
+
+#ifdef ELITE_USE_LIB_SSH
+
+// A libssh session is not thread safe, the channels of a connection take turns with this lock.
+struct LibsshSession {
+    ssh_session session;
+    std::mutex mutex;
+
+    explicit LibsshSession(ssh_session s) : session(s) {}
+
+    ~LibsshSession() {
+        ssh_disconnect(session);
+        ssh_free(session);
+    }
+};
+
+class LibsshChannel : public SshChannel {
+   private:
+    // Keeps the session open while the channel is used
+    std::shared_ptr<LibsshSession> session_;
+    ssh_channel channel_;
+    bool input_closed_ = false;
+
+   public:
+    LibsshChannel(std::shared_ptr<LibsshSession> session, ssh_channel channel)
+        : session_(std::move(session)), channel_(channel) {}
+
+    ~LibsshChannel() {
+        std::lock_guard<std::mutex> lock(session_->mutex);
+        ssh_channel_close(channel_);
+        ssh_channel_free(channel_);
+    }
+
+    int read(char* buffer, int size, int timeout_ms) override {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        // Wait in short slices, so the other channels of the session are not blocked.
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(session_->mutex);
+                int n = ssh_channel_read_timeout(channel_, buffer, size, 0, 20);
+                if (n == SSH_ERROR) {
+                    return -1;
+                }
+                if (n > 0 || ssh_channel_is_eof(channel_) || !ssh_channel_is_open(channel_)) {
+                    return n;
+                }
+            }
+            if (timeout_ms > 0 && std::chrono::steady_clock::now() >= deadline) {
+                return -1;
+            }
+        }
+    }
+
+    bool write(const char* buffer, int size) override {
+        while (size > 0) {
+            std::lock_guard<std::mutex> lock(session_->mutex);
+            int n = ssh_channel_write(channel_, buffer, size);
+            if (n == SSH_ERROR) {
+                return false;
+            }
+            buffer += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    void closeInput() override {
+        if (!input_closed_) {
+            std::lock_guard<std::mutex> lock(session_->mutex);
+            ssh_channel_send_eof(channel_);
+            input_closed_ = true;
+        }
+    }
+
+    int wait() override {
+        closeInput();
+        char buffer[256];
+        while (read(buffer, sizeof(buffer), 0) > 0) {
+        }
+        std::lock_guard<std::mutex> lock(session_->mutex);
+        return ssh_channel_get_exit_status(channel_);
+    }
+};
+
+class LibsshConnection : public SshConnection {
+   private:
+    std::shared_ptr<LibsshSession> session_;
+
+   public:
+    explicit LibsshConnection(ssh_session session) : session_(std::make_shared<LibsshSession>(session)) {}
+
+    std::unique_ptr<SshChannel> exec(const std::string& cmd) override {
+        std::lock_guard<std::mutex> lock(session_->mutex);
+        ssh_session session = session_->session;
+        ssh_channel channel = ssh_channel_new(session);
+        if (!channel) {
+            ELITE_LOG_ERROR("Failed to create SSH channel");
+            return nullptr;
+        }
+        if (ssh_channel_open_session(channel) != SSH_OK) {
+            ELITE_LOG_ERROR("Failed to open SSH channel: %s", ssh_get_error(session));
+            ssh_channel_free(channel);
+            return nullptr;
+        }
+        if (ssh_channel_request_exec(channel, cmd.c_str()) != SSH_OK) {
+            ELITE_LOG_ERROR("Failed to execute command: %s", ssh_get_error(session));
+            ssh_channel_close(channel);
+            ssh_channel_free(channel);
+            return nullptr;
+        }
+        return std::unique_ptr<SshChannel>(new LibsshChannel(session_, channel));
+    }
+
+    bool keepAlive() override {
+        std::lock_guard<std::mutex> lock(session_->mutex);
+        return ssh_is_connected(session_->session) && ssh_send_ignore(session_->session, "keepalive") == SSH_OK;
+    }
+};
+
+#endif
+
+}  // namespace
+
+std::shared_ptr<SshConnection> connect(const std::string& host, const std::string& user, const std::string& password) {
+#ifdef ELITE_USE_LIB_SSH
+    ssh_session session = ssh_new();
+    if (!session) {
+        ELITE_LOG_ERROR("Failed to create SSH session");
+        return nullptr;
+    }
+
+    ssh_options_set(session, SSH_OPTIONS_HOST, host.c_str());
+    ssh_options_set(session, SSH_OPTIONS_USER, user.c_str());
+
+    if (ssh_connect(session) != SSH_OK) {
+        ELITE_LOG_ERROR("SSH connection failed: %s", ssh_get_error(session));
+        ssh_free(session);
+        return nullptr;
+    }
+
+    if (ssh_userauth_password(session, nullptr, password.c_str()) != SSH_AUTH_SUCCESS) {
+        ELITE_LOG_ERROR("SSH authentication failed: %s", ssh_get_error(session));
+        ssh_disconnect(session);
+        ssh_free(session);
+        return nullptr;
+    }
+    return std::make_shared<LibsshConnection>(session);
+#elif defined(__linux) || defined(linux) || defined(__linux__)
+    static std::atomic<int> s_connection_count{0};
+    std::string target = user + "@" + host;
+    std::string control_path =
+        "/tmp/elite-ssh-" + std::to_string(getpid()) + "-" + std::to_string(s_connection_count.fetch_add(1));
+    // "-f -N": log in, then keep the master connection in the background.
+    auto channel = spawnProcess({"sshpass", "-p", password, "ssh", "-o", "StrictHostKeyChecking=no", "-o", "ControlMaster=yes",
+                                 "-o", "ControlPath=" + control_path, "-o", "ControlPersist=yes", "-o", "ServerAliveInterval=15",
+                                 "-f", "-N", target});
+    if (!channel) {
+        return nullptr;
+    }
+    int status = channel->wait();
+    if (status != 0) {
+        ELITE_LOG_ERROR("SSH connection to %s failed, exited with status: %d", target.c_str(), status);
+        return nullptr;
+    }
+    return std::make_shared<OpenSshConnection>(target, control_path);
+#else
+    (void)host;
+    (void)user;
+    (void)password;
+    ELITE_LOG_ERROR("SSH is not available, the SDK is built without libssh");
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<SshChannel> spawnProcess(const std::vector<std::string>& argv) {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+    int input[2];
+    int output[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, input) == -1) {
+        char buf[256] = {0};
+        ELITE_LOG_ERROR("Execute \"%s\" fail: %s", argv[0].c_str(), strerror_r(errno, buf, sizeof(buf)));
+        return nullptr;
+    }
+    if (pipe2(output, O_CLOEXEC) == -1) {
+        char buf[256] = {0};
+        ELITE_LOG_ERROR("Execute \"%s\" fail: %s", argv[0].c_str(), strerror_r(errno, buf, sizeof(buf)));
+        ::close(input[0]);
+        ::close(input[1]);
+        return nullptr;
+    }
+    std::vector<char*> args;
+    for (auto& arg : argv) {
+        args.push_back(const_cast<char*>(arg.c_str()));
+    }
+    args.push_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid == -1) {
+        char buf[256] = {0};
+        ELITE_LOG_ERROR("Execute \"%s\" fail: %s", argv[0].c_str(), strerror_r(errno, buf, sizeof(buf)));
+        ::close(input[0]);
+        ::close(input[1]);
+        ::close(output[0]);
+        ::close(output[1]);
+        return nullptr;
+    }
+    if (pid == 0) {  // child process
+        dup2(input[1], STDIN_FILENO);
+        dup2(output[1], STDOUT_FILENO);
+        execvp(args[0], args.data());
+        _exit(127);
+    }
+    ::close(input[1]);
+    ::close(output[1]);
+    return std::unique_ptr<SshChannel>(new ProcessChannel(pid, input[0], output[0]));
+#else
+    (void)argv;
+    return nullptr;
+#endif
+}
+
+std::string shellQuote(const std::string& text) {
+    std::string quoted = "'";
+    for (char c : text) {
+        if (c == '\'') {
+            quoted += "'\\''";
+        } else {
+            quoted += c;
+        }
+    }
+    quoted += "'";
+    return quoted;
+}
+
+std::string sha256File(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return "";
+    }
+    Sha256 sha;
+    std::vector<char> buffer(64 * 1024);
+    while (file) {
+        file.read(buffer.data(), buffer.size());
+        sha.update(reinterpret_cast<const uint8_t*>(buffer.data()), static_cast<size_t>(file.gcount()));
+    }
+    return sha.hexDigest();
+}
+
+std::string sha256Data(const char* data, size_t size) {
+    Sha256 sha;
+    sha.update(reinterpret_cast<const uint8_t*>(data), size);
+    return sha.hexDigest();
+}
+
+SshTransfer::SshTransfer(std::shared_ptr<SshConnection> connection, const TransferOptions& options)
+    : connection_(std::move(connection)), options_(options) {
+    options_.chunk_size = std::max<size_t>(options_.chunk_size, 4096);
+    options_.retries = std::max(options_.retries, 0);
+}
+
+std::string SshTransfer::execute(const std::string& cmd, int* status) {
+    if (status) {
+        *status = -1;
+    }
+    auto channel = connection_->exec(cmd);
+    if (!channel) {
+        return "";
+    }
+    std::string result;
+    char buffer[4096];
+    int n;
+    while ((n = channel->read(buffer, sizeof(buffer), options_.read_timeout_ms)) > 0) {
+        result.append(buffer, n);
+    }
+    if (n < 0) {
+        // The command is not waited, it stops when the channel is closed.
+        ELITE_LOG_ERROR("Execute command \"%s\" fail: no output for %d ms", cmd.c_str(), options_.read_timeout_ms);
+        return result;
+    }
+    int exit_status = channel->wait();
+    ELITE_LOG_DEBUG("Execute command \"%s\" exited with status: %d", cmd.c_str(), exit_status);
+    if (status) {
+        *status = exit_status;
+    }
+    return result;
+}
+
+bool SshTransfer::remoteSize(const std::string& path, uint64_t& size) {
+    int status;
+    std::string out = execute("stat -c %s " + shellQuote(path) + " 2>/dev/null", &status);
+    if (status != 0) {
+        return false;
+    }
+    try {
+        size = std::stoull(out);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+SshTransfer::VerifyResult SshTransfer::remoteVerify(const std::string& remote_path, uint64_t size, const std::string& sha256) {
+    // Only the transferred bytes, a log file may grow while it is downloaded.
+    int status;
+    std::string out = execute("head -c " + std::to_string(size) + " " + shellQuote(remote_path) + " | sha256sum", &status);
+    if (status != 0 || out.size() < 64) {
+        if (options_.allow_unverified) {
+            ELITE_LOG_WARN("Can't get the SHA-256 of \"%s\", the transfer is not verified", remote_path.c_str());
+            return VerifyResult::MATCH;
+        }
+        ELITE_LOG_ERROR("Can't get the SHA-256 of \"%s\", the transfer can't be verified", remote_path.c_str());
+        return VerifyResult::UNAVAILABLE;
+    }
+    return out.compare(0, 64, sha256) == 0 ? VerifyResult::MATCH : VerifyResult::MISMATCH;
+}
+
+bool SshTransfer::download(const std::string& remote_path, const std::string& local_path, TransferProgress progress) {
+    uint64_t total = 0;
+    if (!remoteSize(remote_path, total)) {
+        ELITE_LOG_ERROR("Download \"%s\" fail: can't get the file size", remote_path.c_str());
+        if (progress) {
+            progress(0, 0, "can't get the remote file size");
+        }
+        return false;
+    }
+    ELITE_LOG_INFO("Downloading: %s (%llu bytes)", remote_path.c_str(), static_cast<unsigned long long>(total));
+
+    const std::string part_path = local_path + ".part";
+    std::vector<char> buffer(options_.chunk_size);
+    uint64_t offset = 0;
+    for (int attempt = 0; attempt <= options_.retries; attempt++) {
+        if (!localSize(part_path, offset) || offset > total) {
+            std::remove(part_path.c_str());
+            offset = 0;
+        }
+        std::FILE* fp = std::fopen(part_path.c_str(), "ab");
+        if (!fp) {
+            ELITE_LOG_ERROR("Failed to open local file: %s", part_path.c_str());
+            if (progress) {
+                progress(total, offset, "failed to open local file");
+            }
+            return false;
+        }
+        if (offset > 0) {
+            ELITE_LOG_INFO("Resume download of %s from %llu bytes", remote_path.c_str(), static_cast<unsigned long long>(offset));
+        }
+        auto channel = offset < total ? connection_->exec("tail -c +" + std::to_string(offset + 1) + " " + shellQuote(remote_path))
+                                      : nullptr;
+        bool write_fail = false;
+        while (channel && offset < total) {
+            int n = channel->read(buffer.data(), static_cast<int>(std::min<uint64_t>(buffer.size(), total - offset)),
+                                  options_.read_timeout_ms);
+            if (n <= 0) {
+                break;
+            }
+            if (options_.limiter) {
+                options_.limiter->consume(n);
+            }
+            if (std::fwrite(buffer.data(), 1, n, fp) != static_cast<size_t>(n)) {
+                write_fail = true;
+                break;
+            }
+            offset += n;
+            if (progress) {
+                progress(total, offset, nullptr);
+            }
+        }
+        std::fclose(fp);
+        // The remote command is not waited, it stops when the channel is closed.
+        channel.reset();
+        if (write_fail) {
+            ELITE_LOG_ERROR("Failed to write local file: %s", part_path.c_str());
+            if (progress) {
+                progress(total, offset, "failed to write local file");
+            }
+            return false;
+        }
+        if (offset < total) {
+            ELITE_LOG_WARN("Download of %s interrupted at %llu/%llu bytes", remote_path.c_str(),
+                           static_cast<unsigned long long>(offset), static_cast<unsigned long long>(total));
+            continue;
+        }
+        VerifyResult verified = options_.verify ? remoteVerify(remote_path, offset, sha256File(part_path)) : VerifyResult::MATCH;
+        if (verified == VerifyResult::UNAVAILABLE) {
+            if (progress) {
+                progress(total, offset, "can't get the SHA-256 of the remote file");
+            }
+            return false;
+        }
+        if (verified == VerifyResult::MISMATCH) {
+            ELITE_LOG_WARN("Downloaded %s does not match the SHA-256 of the remote file, download again", remote_path.c_str());
+            std::remove(part_path.c_str());
+            continue;
+        }
+        std::remove(local_path.c_str());
+        if (std::rename(part_path.c_str(), local_path.c_str()) != 0) {
+            ELITE_LOG_ERROR("Failed to rename %s to %s", part_path.c_str(), local_path.c_str());
+            if (progress) {
+                progress(total, offset, "failed to rename local file");
+            }
+            return false;
+        }
+        ELITE_LOG_INFO("Download complete!");
+        return true;
+    }
+    ELITE_LOG_ERROR("Download %s fail after %d attempts", remote_path.c_str(), options_.retries + 1);
+    if (progress) {
+        progress(total, offset, "download interrupted");
+    }
+    return false;
+}
+
+bool SshTransfer::upload(const std::string& local_path, const std::string& remote_path, TransferProgress progress) {
+    uint64_t total = 0;
+    std::ifstream local_file(local_path, std::ios::binary);
+    if (!local_file || !localSize(local_path, total)) {
+        ELITE_LOG_ERROR("Failed to open local file: %s", local_path.c_str());
+        if (progress) {
+            progress(0, 0, "failed to open local file");
+        }
+        return false;
+    }
+    auto read = [&](uint64_t offset, char* buffer, size_t size) -> size_t {
+        local_file.clear();
+        local_file.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+        local_file.read(buffer, size);
+        return static_cast<size_t>(local_file.gcount());
+    };
+    return uploadFrom(read, total, options_.verify ? sha256File(local_path) : "", local_path, remote_path, progress);
+}
+
+bool SshTransfer::upload(const char* data, size_t size, const std::string& sha256, const std::string& remote_path,
+                         TransferProgress progress) {
+    auto read = [&](uint64_t offset, char* buffer, size_t n) -> size_t {
+        n = static_cast<size_t>(std::min<uint64_t>(n, size - offset));
+        std::memcpy(buffer, data + offset, n);
+        return n;
+    };
+    std::string digest = sha256;
+    if (options_.verify && digest.empty()) {
+        digest = sha256Data(data, size);
+    }
+    return uploadFrom(read, size, digest, "memory data", remote_path, progress);
+}
+
+bool SshTransfer::uploadFrom(const std::function<size_t(uint64_t offset, char* buffer, size_t size)>& read, uint64_t total,
+                             const std::string& sha256, const std::string& name, const std::string& remote_path,
+                             TransferProgress progress) {
+    ELITE_LOG_INFO("Uploading: %s (%llu bytes)", name.c_str(), static_cast<unsigned long long>(total));
+
+    const std::string part_path = remote_path + ".part";
+    const std::string quoted_part = shellQuote(part_path);
+    std::vector<char> buffer(options_.chunk_size);
+    uint64_t offset = 0;
+    for (int attempt = 0; attempt <= options_.retries; attempt++) {
+        if (!remoteSize(part_path, offset) || offset > total) {
+            offset = 0;
+        }
+        if (offset > 0) {
+            ELITE_LOG_INFO("Resume upload of %s from %llu bytes", name.c_str(), static_cast<unsigned long long>(offset));
+        }
+        bool sent = true;
+        if (offset < total || offset == 0) {
+            auto channel = connection_->exec((offset == 0 ? "cat > " : "cat >> ") + quoted_part);
+            while (channel && offset < total) {
+                size_t n = read(offset, buffer.data(), buffer.size());
+                if (n == 0) {
+                    break;
+                }
+                if (options_.limiter) {
+                    options_.limiter->consume(n);
+                }
+                if (!channel->write(buffer.data(), static_cast<int>(n))) {
+                    break;
+                }
+                offset += n;
+                if (progress) {
+                    progress(total, offset, nullptr);
+                }
+            }
+            sent = channel && offset == total && channel->wait() == 0;
+        }
+        if (!sent) {
+            ELITE_LOG_WARN("Upload of %s interrupted at %llu/%llu bytes", name.c_str(), static_cast<unsigned long long>(offset),
+                           static_cast<unsigned long long>(total));
+            continue;
+        }
+        VerifyResult verified = options_.verify ? remoteVerify(part_path, total, sha256) : VerifyResult::MATCH;
+        if (verified == VerifyResult::UNAVAILABLE) {
+            if (progress) {
+                progress(total, offset, "can't get the SHA-256 of the remote file");
+            }
+            return false;
+        }
+        if (verified == VerifyResult::MISMATCH) {
+            ELITE_LOG_WARN("Uploaded %s does not match the SHA-256 of the local data, upload again", name.c_str());
+            execute("rm -f " + quoted_part);
+            continue;
+        }
+        int status;
+        execute("mv -f " + quoted_part + " " + shellQuote(remote_path), &status);
+        if (status != 0) {
+            ELITE_LOG_ERROR("Failed to rename %s to %s", part_path.c_str(), remote_path.c_str());
+            if (progress) {
+                progress(total, offset, "failed to rename remote file");
+            }
+            return false;
+        }
+        ELITE_LOG_INFO("Upload complete!");
+        return true;
+    }
+    ELITE_LOG_ERROR("Upload %s fail after %d attempts", name.c_str(), options_.retries + 1);
+    if (progress) {
+        progress(total, offset, "upload interrupted");
+    }
+    return false;
+}
+
+BandwidthLimiter::BandwidthLimiter(uint64_t bytes_per_second)
+    : bytes_per_second_(bytes_per_second), next_(std::chrono::steady_clock::now()) {}
+
+void BandwidthLimiter::consume(uint64_t bytes) {
+    using namespace std::chrono;
+    if (bytes_per_second_ == 0) {
+        return;
+    }
+    steady_clock::time_point start;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Unused time of the last 100 ms can be caught up as a burst
+        auto now = steady_clock::now();
+        start = std::max(next_, now - milliseconds(100));
+        next_ = start + duration_cast<steady_clock::duration>(duration<double>(static_cast<double>(bytes) / bytes_per_second_));
+    }
+    std::this_thread::sleep_until(start);
+}
+
+}  // namespace SSH_UTILS
+
+}  // namespace ELITE
@@ -10,10 +10,21 @@ namespace ELITE {
 
 ScriptCommandInterface::ScriptCommandInterface(int port, std::shared_ptr<TcpServer::StaticResource> resource)
     : ReversePort(port, 4, resource) {
+    server_->setReceiveCallback([this](const uint8_t data[], int nb) {
+        if (nb != sizeof(int32_t)) {
+            return;
+        }
+        int32_t value = ::ntohl(*((const int32_t*)data));
+        {
+            std::lock_guard<std::mutex> lock(serial_result_mutex_);
+            serial_results_.push_back(value);
+        }
+        serial_result_cv_.notify_all();
+    });
     server_->startListen();
 }
 
-ScriptCommandInterface::~ScriptCommandInterface() {}
+ScriptCommandInterface::~ScriptCommandInterface() { server_->unsetReceiveCallback(); }
 
 bool ScriptCommandInterface::zeroFTSensor() {
     int32_t buffer[SCRIPT_COMMAND_DATA_SIZE] = {0};
@@ -70,4 +81,88 @@ bool ScriptCommandInterface::endForceMode() {
     return write(buffer, sizeof(buffer)) > 0;
 }
 
-}  // namespace ELITE
\ No newline at end of file
+bool ScriptCommandInterface::waitSerialResult(SerialResult expected, std::chrono::steady_clock::time_point deadline,
+                                              int32_t& value) {
+    std::unique_lock<std::mutex> lock(serial_result_mutex_);
+    while (serial_result_cv_.wait_until(lock, deadline, [this]() { return serial_results_.size() >= 2; })) {
+        int32_t type = serial_results_[0];
+        value = serial_results_[1];
+        serial_results_.erase(serial_results_.begin(), serial_results_.begin() + 2);
+        if (type == static_cast<int32_t>(expected)) {
+            return true;
+        }
+        ELITE_LOG_WARN("Unexpected serial command acknowledgement %d", type);
+    }
+    return false;
+}
+
+bool ScriptCommandInterface::serialCommand(Cmd cmd, const SerialConfig* config, int tcp_port, SerialResult expected,
+                                           int accept_timeout_ms, int timeout_ms, int32_t& value) {
+    std::lock_guard<std::mutex> command_lock(serial_command_mutex_);
+    {
+        // Acknowledgements of commands that timed out
+        std::lock_guard<std::mutex> lock(serial_result_mutex_);
+        serial_results_.clear();
+    }
+    int32_t buffer[SCRIPT_COMMAND_DATA_SIZE] = {0};
+    buffer[0] = htonl(static_cast<int32_t>(cmd));
+    if (config) {
+        buffer[1] = htonl(static_cast<int32_t>(config->baud_rate));
+        buffer[2] = htonl(static_cast<int32_t>(config->parity));
+        buffer[3] = htonl(static_cast<int32_t>(config->stop_bits));
+        buffer[4] = htonl(tcp_port);
+    }
+    if (write(buffer, sizeof(buffer)) <= 0) {
+        return false;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(accept_timeout_ms);
+    int32_t accepted = -1;
+    bool is_accepted = false;
+    while (!is_accepted && waitSerialResult(SerialResult::ACCEPTED, deadline, accepted)) {
+        // The accepted command is echoed
+        is_accepted = accepted == static_cast<int32_t>(cmd);
+    }
+    if (!is_accepted) {
+        ELITE_LOG_WARN("Serial command %d is not accepted by the script", static_cast<int>(cmd));
+        return false;
+    }
+    deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    if (!waitSerialResult(expected, deadline, value)) {
+        ELITE_LOG_ERROR("Wait serial command %d acknowledgement timeout", static_cast<int>(cmd));
+        return false;
+    }
+    return true;
+}
+
+int ScriptCommandInterface::startToolRs485(const SerialConfig& config, int tcp_port, int accept_timeout_ms, int timeout_ms) {
+    int32_t pid = -1;
+    if (!serialCommand(Cmd::START_TOOL_RS485, &config, tcp_port, SerialResult::START, accept_timeout_ms, timeout_ms,
+                       pid)) {
+        return -1;
+    }
+    return pid > 0 ? pid : -1;
+}
+
+bool ScriptCommandInterface::endToolRs485(int accept_timeout_ms, int timeout_ms) {
+    int32_t status = -1;
+    return serialCommand(Cmd::END_TOOL_RS485, nullptr, 0, SerialResult::END, accept_timeout_ms, timeout_ms, status) &&
+           status == 0;
+}
+
+int ScriptCommandInterface::startBoardRs485(const SerialConfig& config, int tcp_port, int accept_timeout_ms, int timeout_ms) {
+    int32_t pid = -1;
+    if (!serialCommand(Cmd::START_BOARD_RS485, &config, tcp_port, SerialResult::START, accept_timeout_ms, timeout_ms,
+                       pid)) {
+        return -1;
+    }
+    return pid > 0 ? pid : -1;
+}
+
+bool ScriptCommandInterface::endBoardRs485(int accept_timeout_ms, int timeout_ms) {
+    int32_t status = -1;
+    return serialCommand(Cmd::END_BOARD_RS485, nullptr, 0, SerialResult::END, accept_timeout_ms, timeout_ms, status) &&
+           status == 0;
+}
+
+}  // namespace ELITE
@@ -1,9 +1,11 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025, Elite Robots.
 #include "DashboardClient.hpp"
+#include "DashboardResponseMatcher.hpp"
+#include "DashboardStateSource.hpp"
 #include <boost/asio.hpp>
+#include <deque>
 #include <iostream>
-#include <regex>
 #include <thread>
 #include "DataType.hpp"
 #include "Log.hpp"
@@ -13,14 +15,116 @@ using namespace std::chrono_literals;
 
 class DashboardClient::Impl {
    public:
+    // A reply that has not been read yet
+    struct PendingReply {
+        std::shared_ptr<std::promise<std::string>> promise;
+        // Multi-line replies are followed by the reply of a fence command, which ends them
+        bool fenced = false;
+    };
+
+    // Guards the socket and keeps the order of sent commands and pending replies the same
     std::mutex socket_mutex_;
+    // Only one thread reads the responses at a time
+    std::mutex read_mutex_;
     boost::asio::io_context io_context_;
-    std::unique_ptr<boost::asio::ip::tcp::socket> socket_ptr_;
+    // Shared with a running read, which keeps the socket alive until it returns
+    std::shared_ptr<boost::asio::ip::tcp::socket> socket_ptr_;
+    // A read is running on socket_ptr_, guarded by socket_mutex_
+    bool reading_ = false;
     std::unique_ptr<boost::asio::ip::tcp::resolver> resolver_ptr_;
+    // Keeps the bytes received after a '\n', which belong to the next response
+    boost::asio::streambuf read_buffer_;
+
+    // Replies of the commands have been sent, in the order of sending
+    std::mutex pending_mutex_;
+    std::deque<PendingReply> pending_;
+
+    // Waits after the commands use it when set, otherwise poll the dashboard
+    std::mutex state_source_mutex_;
+    std::shared_ptr<DashboardStateSource> state_source_;
 
     void disconnect();
+    void failPending(std::exception_ptr ex);
+    // Queue the reply of cmd and write cmd, with the fence command after it if its reply has several lines
+    void queueCommand(const std::string& cmd, std::shared_ptr<std::promise<std::string>> reply, std::string& out);
+};
+
+namespace {
+
+// Commands whose reply has several lines. There is no end marker in the reply, so the echo command is sent after
+// them and the reply ends at the line of echo.
+const char* const MULTI_LINE_COMMANDS[] = {"status", "help", "usage"};
+const std::string FENCE_COMMAND = "echo\n";
+const std::string FENCE_REPLY = "Hello ELITE ROBOTS.\r\n";
+
+bool isMultiLineCommand(const std::string& cmd) {
+    size_t end = cmd.find_first_of(" \r\n");
+    size_t length = (end == std::string::npos) ? cmd.size() : end;
+    for (const char* name : MULTI_LINE_COMMANDS) {
+        if (cmd.compare(0, length, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The expected responses, built once. Literal and prefix matchers avoid constructing a std::regex per call.
+struct ResponseMatchers {
+    const DashboardResponseMatcher brake_release = DashboardResponseMatcher::regex("Brake (Releasing.*|is released).*");
+    const DashboardResponseMatcher close_safety_dialog = DashboardResponseMatcher::regex("closing .* dialog\r\n");
+    const DashboardResponseMatcher echo = DashboardResponseMatcher::literal("Hello ELITE ROBOTS.\r\n");
+    const DashboardResponseMatcher log = DashboardResponseMatcher::literal("Log has been added.\r\n");
+    const DashboardResponseMatcher popup =
+        DashboardResponseMatcher::regex("Closing popup\r\n|Showing popup with text:.*\\s*");
+    const DashboardResponseMatcher power_on = DashboardResponseMatcher::literal("Powering on\r\n");
+    const DashboardResponseMatcher power_off = DashboardResponseMatcher::literal("Powering off\r\n");
+    const DashboardResponseMatcher speed_fraction = DashboardResponseMatcher::linePrefix("Target Speed Fraction:");
+    const DashboardResponseMatcher robot_mode = DashboardResponseMatcher::linePrefix("robotMode:");
+    const DashboardResponseMatcher robot_mode_running = DashboardResponseMatcher::literal("robotMode: RUNNING\r\n");
+    const DashboardResponseMatcher robot_mode_powered = DashboardResponseMatcher::regex("robotMode: (RUNNING|IDLE)\r\n");
+    const DashboardResponseMatcher robot_mode_power_off = DashboardResponseMatcher::literal("robotMode: POWER_OFF\r\n");
+    const DashboardResponseMatcher safety_status = DashboardResponseMatcher::linePrefix("Safety status:");
+    const DashboardResponseMatcher safety_restart = DashboardResponseMatcher::linePrefix("Restarting safety board");
+    const DashboardResponseMatcher safety_mode_normal = DashboardResponseMatcher::literal("Safety mode: NORMAL\r\n");
+    const DashboardResponseMatcher running_status = DashboardResponseMatcher::linePrefix("RunningStatus:");
+    const DashboardResponseMatcher unlock_protective_stop =
+        DashboardResponseMatcher::literal("Protective stop unlocking...\r\n");
+    const DashboardResponseMatcher loading_configuration = DashboardResponseMatcher::linePrefix("Loading Configuration :");
+    const DashboardResponseMatcher configuration_path = DashboardResponseMatcher::linePrefix("configuration: Relative path:");
+    const DashboardResponseMatcher loaded_task = DashboardResponseMatcher::linePrefix("Loaded task: ");
+    const DashboardResponseMatcher task_is = DashboardResponseMatcher::linePrefix("Task is ");
+    const DashboardResponseMatcher task_running = DashboardResponseMatcher::literal("Task is running\r\n");
+    const DashboardResponseMatcher task_paused = DashboardResponseMatcher::literal("Task is paused\r\n");
+    const DashboardResponseMatcher task_stopped = DashboardResponseMatcher::literal("Task is stopped\r\n");
 };
 
+const ResponseMatchers& matchers() {
+    static const ResponseMatchers table;
+    return table;
+}
+
+// Match the response with the expected matcher, throw if not match
+std::string matchResponse(const std::string& cmd, const std::string& response, const DashboardResponseMatcher& expected) {
+    std::string matched;
+    if (!expected.search(response, &matched)) {
+        throw EliteException(
+            EliteException::Code::DASHBOARD_NOT_EXPECT_RECIVE,
+            "Dashboard command \"" + cmd + "\" response expected: " + expected.pattern() + ". But received: " + response);
+    }
+    return matched;
+}
+
+int parseSpeedScaling(const std::string& cmd, const std::string& response) {
+    int value = 0;
+    if (!DASHBOARD_RESPONSE::parseIntValue(response, value)) {
+        throw EliteException(EliteException::Code::DASHBOARD_NOT_EXPECT_RECIVE,
+                             "Dashboard command \"" + cmd + "\" response has no speed scaling: " + response);
+    }
+    return value;
+}
+
+}  // namespace
+
 DashboardClient::DashboardClient() { impl_ = std::make_unique<Impl>(); }
 
 DashboardClient::~DashboardClient() {}
@@ -29,7 +133,9 @@ bool DashboardClient::connect(const std::string& ip, int port) {
     bool ret_val = false;
     try {
         std::lock_guard<std::mutex> lock(impl_->socket_mutex_);
-        impl_->socket_ptr_.reset(new boost::asio::ip::tcp::socket(impl_->io_context_));
+        // Fail the replies of the previous connection and stop a read still waiting on it
+        impl_->disconnect();
+        impl_->socket_ptr_ = std::make_shared<boost::asio::ip::tcp::socket>(impl_->io_context_);
         impl_->resolver_ptr_.reset(new boost::asio::ip::tcp::resolver(impl_->io_context_));
         impl_->socket_ptr_->open(boost::asio::ip::tcp::v4());
         boost::asio::ip::tcp::no_delay no_delay_option(true);
@@ -66,7 +172,11 @@ bool DashboardClient::connect(const std::string& ip, int port) {
         ELITE_LOG_ERROR("Dashboard connect to robot fail: %s", error.what());
         throw EliteException(EliteException::Code::SOCKET_CONNECT_FAIL, error.what());
     }
-    asyncReadLine();
+    {
+        std::lock_guard<std::mutex> lock(impl_->read_mutex_);
+        impl_->read_buffer_.consume(impl_->read_buffer_.size());
+        asyncReadLine();
+    }
     return ret_val;
 }
 
@@ -75,23 +185,68 @@ void DashboardClient::disconnect() {
     impl_->disconnect();
 }
 
-void DashboardClient::Impl::disconnect() { socket_ptr_.reset(); }
+void DashboardClient::Impl::disconnect() {
+    failPending(std::make_exception_ptr(EliteException(EliteException::Code::SOCKET_FAIL, "Dashboard disconnected")));
+    if (!socket_ptr_) {
+        return;
+    }
+    if (reading_) {
+        // The reading thread runs the io_context, close there so the read returns. The reader holds the socket until
+        // it returns and closes it itself if this hasn't run by then.
+        std::weak_ptr<boost::asio::ip::tcp::socket> weak_socket = socket_ptr_;
+        boost::asio::post(io_context_, [weak_socket]() {
+            if (auto socket = weak_socket.lock()) {
+                boost::system::error_code ignore_ec;
+                socket->close(ignore_ec);
+            }
+        });
+    } else {
+        boost::system::error_code ignore_ec;
+        socket_ptr_->close(ignore_ec);
+    }
+    socket_ptr_.reset();
+}
+
+void DashboardClient::Impl::failPending(std::exception_ptr ex) {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    for (auto& reply : pending_) {
+        reply.promise->set_exception(ex);
+    }
+    pending_.clear();
+}
+
+void DashboardClient::Impl::queueCommand(const std::string& cmd, std::shared_ptr<std::promise<std::string>> reply,
+                                         std::string& out) {
+    PendingReply pending;
+    pending.promise = std::move(reply);
+    pending.fenced = isMultiLineCommand(cmd);
+    out += cmd;
+    if (cmd.empty() || cmd.back() != '\n') {
+        out += '\n';
+    }
+    if (pending.fenced) {
+        out += FENCE_COMMAND;
+    }
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    pending_.push_back(std::move(pending));
+}
 
 bool DashboardClient::brakeRelease() {
-    std::string response = sendAndRequest("brakeRelease\n", "Brake (Releasing.*|is released).*");
+    std::string response = sendAndRequest("brakeRelease\n", matchers().brake_release);
     if (response.empty()) {
         return false;
     }
-    return waitForReply("robotMode\n", "robotMode: RUNNING\r\n");
+    return waitForState([](const DashboardStatus& state) { return state.robot_mode == RobotMode::RUNNING; }, "robotMode\n",
+                        matchers().robot_mode_running);
 }
 
 bool DashboardClient::closeSafetyDialog() {
-    std::string response = sendAndRequest("closeSafetyDialog\n", "closing .* dialog\r\n");
+    std::string response = sendAndRequest("closeSafetyDialog\n", matchers().close_safety_dialog);
     return !response.empty();
 }
 
 bool DashboardClient::echo() {
-    std::string response = sendAndRequest("echo\n", "Hello ELITE ROBOTS.\r\n");
+    std::string response = sendAndRequest("echo\n", matchers().echo);
     return !response.empty();
 }
 
@@ -115,7 +270,7 @@ bool DashboardClient::log(const std::string& message) {
     }
 
     std::string send_string = "log -a " + message_cpy + "\n";
-    std::string response = sendAndRequest(send_string, "Log has been added.\r\n");
+    std::string response = sendAndRequest(send_string, matchers().log);
     return !response.empty();
 }
 
@@ -128,18 +283,18 @@ bool DashboardClient::popup(const std::string& arg, const std::string& message)
     } else {
         throw EliteException(EliteException::Code::ILLEGAL_PARAM, "dashboard popup command");
     }
-    std::string response = sendAndRequest(send_string, "Closing popup\r\n|Showing popup with text:.*\\s*");
+    std::string response = sendAndRequest(send_string, matchers().popup);
     return !response.empty();
 }
 
 void DashboardClient::quit() {
     sendAndRequest("quit\n");
-    impl_->disconnect();
+    disconnect();
 }
 
 void DashboardClient::reboot() {
     sendAndRequest("reboot\n");
-    impl_->disconnect();
+    disconnect();
 }
 
 std::string DashboardClient::robot() { return sendAndRequest("robot -t\n"); }
@@ -157,119 +312,59 @@ std::string DashboardClient::robotID() {
 }
 
 bool DashboardClient::powerOn() {
-    std::string response = sendAndRequest("robotControl -on\n", "Powering on\r\n");
-    return waitForReply("robotMode\n", "robotMode: (RUNNING|IDLE)\r\n");
+    std::string response = sendAndRequest("robotControl -on\n", matchers().power_on);
+    return waitForState(
+        [](const DashboardStatus& state) {
+            return state.robot_mode == RobotMode::RUNNING || state.robot_mode == RobotMode::IDLE;
+        },
+        "robotMode\n", matchers().robot_mode_powered);
 }
 
 bool DashboardClient::powerOff() {
-    std::string response = sendAndRequest("robotControl -off\n", "Powering off\r\n");
+    std::string response = sendAndRequest("robotControl -off\n", matchers().power_off);
+    auto powered_off = [](const DashboardStatus& state) { return state.robot_mode == RobotMode::POWER_OFF; };
+    if (stateSource()) {
+        return waitForState(powered_off, "robotMode\n", matchers().robot_mode_power_off);
+    }
     // Beacuse of robot after power off need time to
     // complete some operation (robot still return "POWER_OFF" by "robotMode" command), delay there
     std::this_thread::sleep_for(500ms);
-    return waitForReply("robotMode\n", "robotMode: POWER_OFF\r\n");
+    return waitForReply("robotMode\n", matchers().robot_mode_power_off);
 }
 
 void DashboardClient::shutdown() {
     sendAndRequest("shutdown\n");
-    impl_->disconnect();
+    disconnect();
 }
 
 int DashboardClient::speedScaling() {
-    std::string request = sendAndRequest("status\n", "Target Speed Fraction:.*");
-    std::size_t pos = request.find(": ");
-    request = request.substr(pos + 2);
-    return std::stoi(request);
+    std::string request = sendAndRequest("status\n", matchers().speed_fraction);
+    return parseSpeedScaling("status\n", request);
 }
 
 RobotMode DashboardClient::robotMode() {
-    std::string request = sendAndRequest("robotMode\n", "robotMode:.*");
-    std::size_t pos = request.find(": ");
-    std::string mode = request.substr(pos + 2);
-    if (mode == "NO_CONTROLLER") {
-        return RobotMode::NO_CONTROLLER;
-    } else if (mode == "DISCONNECTED") {
-        return RobotMode::DISCONNECTED;
-    } else if (mode == "CONFIRM_SAFETY") {
-        return RobotMode::CONFIRM_SAFETY;
-    } else if (mode == "BOOTING") {
-        return RobotMode::BOOTING;
-    } else if (mode == "POWER_OFF") {
-        return RobotMode::POWER_OFF;
-    } else if (mode == "POWER_ON") {
-        return RobotMode::POWER_ON;
-    } else if (mode == "IDLE") {
-        return RobotMode::IDLE;
-    } else if (mode == "BACK_DRIVE") {
-        return RobotMode::BACKDRIVE;
-    } else if (mode == "RUNNING") {
-        return RobotMode::RUNNING;
-    } else if (mode == "UPDATING") {
-        return RobotMode::UPDATING_FIRMWARE;
-    } else if (mode == "WAITING_CALIBRATION") {
-        return RobotMode::WAITING_CALIBRATION;
-    } else {
-        return RobotMode::UNKNOWN;
-    }
+    std::string request = sendAndRequest("robotMode\n", matchers().robot_mode);
+    return DASHBOARD_RESPONSE::parseRobotMode(request);
 }
 
 SafetyMode DashboardClient::safetyMode() {
-    std::string request = sendAndRequest("safety -s\n", "Safety status:.*");
-    std::size_t pos = request.find(": ");
-    std::string status = request.substr(pos + 2);
-    if (status == "NORMAL") {
-        return SafetyMode::NORMAL;
-    } else if (status == "REDUCED") {
-        return SafetyMode::REDUCED;
-    } else if (status == "PROTECTIVE_STOP") {
-        return SafetyMode::PROTECTIVE_STOP;
-    } else if (status == "RECOVERY") {
-        return SafetyMode::RECOVERY;
-    } else if (status == "SAFEGUARD_STOP") {
-        return SafetyMode::SAFEGUARD_STOP;
-    } else if (status == "SYSTEM_EMERGENCY_STOP") {
-        return SafetyMode::SYSTEM_EMERGENCY_STOP;
-    } else if (status == "ROBOT_EMERGENCY_STOP") {
-        return SafetyMode::ROBOT_EMERGENCY_STOP;
-    } else if (status == "VIOLATION") {
-        return SafetyMode::VIOLATION;
-    } else if (status == "FAULT") {
-        return SafetyMode::FAULT;
-    } else if (status == "VALIDATE_JOINT_ID") {
-        return SafetyMode::VALIDATE_JOINT_ID;
-    } else if (status == "UNDEFINED_SAFETY_MODE") {
-        return SafetyMode::UNDEFINED_SAFETY_MODE;
-    } else if (status == "AUTOMATIC_MODE_SAFEGUARD_STOP") {
-        return SafetyMode::AUTOMATIC_MODE_SAFEGUARD_STOP;
-    } else if (status == "SYSTEM_THREE_POSITION_ENABLING_STOP") {
-        return SafetyMode::SYSTEM_THREE_POSITION_ENABLING_STOP;
-    } else if (status == "TP_THREE_POSITION_ENABLING_STOP") {
-        return SafetyMode::TP_THREE_POSITION_ENABLING_STOP;
-    } else {
-        return SafetyMode::UNKNOWN;
-    }
+    std::string request = sendAndRequest("safety -s\n", matchers().safety_status);
+    return DASHBOARD_RESPONSE::parseSafetyMode(request);
 }
 
 bool DashboardClient::safetySystemRestart() {
-    sendAndRequest("safety -r\n", "Restarting safety board.*");
-    return waitForReply("safety -m\n", "Safety mode: NORMAL\r\n");
+    sendAndRequest("safety -r\n", matchers().safety_restart);
+    return waitForState([](const DashboardStatus& state) { return state.safety_mode == SafetyMode::NORMAL; }, "safety -m\n",
+                        matchers().safety_mode_normal);
 }
 
 TaskStatus DashboardClient::runningStatus() {
-    std::string request = sendAndRequest("status\n", "RunningStatus:.*");
-    std::size_t pos = request.find(": ");
-    std::string status = request.substr(pos + 2);
-    if (status.find("STOP") != std::string::npos) {
-        return TaskStatus::STOPPED;
-    } else if (status.find("RUNNING") != std::string::npos) {
-        return TaskStatus::PLAYING;
-    } else if (status.find("PAUSE") != std::string::npos) {
-        return TaskStatus::PAUSED;
-    }
-    return TaskStatus::STOPPED;
+    std::string request = sendAndRequest("status\n", matchers().running_status);
+    return DASHBOARD_RESPONSE::parseRunningStatus(request);
 }
 
 bool DashboardClient::unlockProtectiveStop() {
-    std::string response = sendAndRequest("unlockProtectiveStop\n", "Protective stop unlocking...\r\n");
+    std::string response = sendAndRequest("unlockProtectiveStop\n", matchers().unlock_protective_stop);
     return !response.empty();
 }
 
@@ -282,15 +377,15 @@ std::string DashboardClient::version() {
 
 bool DashboardClient::loadConfiguration(const std::string& path) {
     std::string send_command = "configuration -p " + path + "\n";
-    std::string response = sendAndRequest(send_command, "Loading Configuration :.*");
+    std::string response = sendAndRequest(send_command, matchers().loading_configuration);
     if (response.empty()) {
         return false;
     }
-    return waitForReply("configuration\n", "configuration: Relative path:" + path + "\r\n");
+    return waitForReply("configuration\n", DashboardResponseMatcher::literal("configuration: Relative path:" + path + "\r\n"));
 }
 
 std::string DashboardClient::configurationPath() {
-    std::string request = sendAndRequest("configuration\n", "configuration: Relative path:.*");
+    std::string request = sendAndRequest("configuration\n", matchers().configuration_path);
     std::size_t pos = request.find("Relative path:");
     return request.substr(pos + (sizeof("Relative path:") - 1));
 }
@@ -309,7 +404,8 @@ bool DashboardClient::playProgram() {
     if (request != "Starting task\r\n") {
         return false;
     }
-    return waitForReply("task -s\n", "Task is running\r\n");
+    return waitForState([](const DashboardStatus& state) { return state.task_status == TaskStatus::PLAYING; }, "task -s\n",
+                        matchers().task_running);
 }
 
 bool DashboardClient::pauseProgram() {
@@ -317,12 +413,21 @@ bool DashboardClient::pauseProgram() {
     if (request != "Pausing task\r\n") {
         return false;
     }
-    return waitForReply("task -s\n", "Task is paused\r\n");
+    return waitForState([](const DashboardStatus& state) { return state.task_status == TaskStatus::PAUSED; }, "task -s\n",
+                        matchers().task_paused);
 }
 
 bool DashboardClient::setSpeedScaling(int scaling) {
     std::string send_command = "speed -v " + std::to_string(scaling) + "\n";
     sendAndRequest(send_command);
+    auto source = stateSource();
+    if (source) {
+        auto result = source->waitUntil([&](const DashboardStatus& state) { return state.speed_scaling == scaling; },
+                                        std::chrono::milliseconds(500));
+        if (result != DashboardStateSource::WaitResult::UNAVAILABLE) {
+            return result == DashboardStateSource::WaitResult::MATCHED;
+        }
+    }
     // Give some time for the command to take effect
     std::this_thread::sleep_for(200ms);
     return (speedScaling() == scaling);
@@ -333,7 +438,8 @@ bool DashboardClient::stopProgram() {
     if (response != "Stopping task\r\n") {
         return false;
     }
-    return waitForReply("task -s\n", "Task is stopped\r\n");
+    return waitForState([](const DashboardStatus& state) { return state.task_status == TaskStatus::STOPPED; }, "task -s\n",
+                        matchers().task_stopped);
 }
 
 std::string DashboardClient::getTaskPath() {
@@ -350,25 +456,17 @@ std::string DashboardClient::getTaskPath() {
 
 bool DashboardClient::loadTask(const std::string& path) {
     std::string send_command = "task -p " + path + "\n";
-    sendAndRequest(send_command, "Loaded task: .*");
-    return waitForReply("task\n", "Relative path:" + path + "\r\n");
+    sendAndRequest(send_command, matchers().loaded_task);
+    return waitForReply("task\n", DashboardResponseMatcher::literal("Relative path:" + path + "\r\n"));
 }
 
 TaskStatus DashboardClient::getTaskStatus() {
-    std::string status_str = sendAndRequest("task -s\n", "Task is .*");
-    if (status_str.find("stopped") != std::string::npos) {
-        return TaskStatus::STOPPED;
-    } else if (status_str.find("paused") != std::string::npos) {
-        return TaskStatus::PAUSED;
-    } else if (status_str.find("running") != std::string::npos) {
-        return TaskStatus::PLAYING;
-    } else {
-        return TaskStatus::STOPPED;
-    }
+    std::string status_str = sendAndRequest("task -s\n", matchers().task_is);
+    return DASHBOARD_RESPONSE::parseTaskStatus(status_str);
 }
 
 bool DashboardClient::taskIsRunning() {
-    std::string request = sendAndRequest("task -r\n", "Task is .*");
+    std::string request = sendAndRequest("task -r\n", matchers().task_is);
     if (request.find("not running") != std::string::npos) {
         return false;
     } else if (request.find("is running") != std::string::npos) {
@@ -378,7 +476,7 @@ bool DashboardClient::taskIsRunning() {
 }
 
 bool DashboardClient::isTaskSaved() {
-    std::string response = sendAndRequest("task -ss\n", "Task is .*");
+    std::string response = sendAndRequest("task -ss\n", matchers().task_is);
     if (response == "Task is saved") {
         return true;
     } else {
@@ -388,18 +486,129 @@ bool DashboardClient::isTaskSaved() {
 
 std::string DashboardClient::sendAndReceive(const std::string& cmd) {
     if (cmd.back() != '\n') {
-        sendCommand(cmd + "\n");
+        return sendAsync(cmd + "\n").get();
     } else {
-        sendCommand(cmd);
+        return sendAsync(cmd).get();
+    }
+}
+
+std::future<std::string> DashboardClient::sendAsync(const std::string& cmd) {
+    auto reply = std::make_shared<std::promise<std::string>>();
+    std::shared_future<std::string> reply_future = reply->get_future().share();
+    {
+        std::lock_guard<std::mutex> lock(impl_->socket_mutex_);
+        if (!impl_->socket_ptr_) {
+            reply->set_exception(
+                std::make_exception_ptr(EliteException(EliteException::Code::SOCKET_FAIL, "Dashboard not connect to robot")));
+        } else {
+            // Queue the reply first, so a reader which already has the response can find it
+            std::string out;
+            impl_->queueCommand(cmd, reply, out);
+            try {
+                sendCommand(out);
+            } catch (...) {
+                impl_->failPending(std::current_exception());
+            }
+        }
+    }
+    return std::async(std::launch::deferred, [this, reply_future]() {
+        readReplies(reply_future);
+        return reply_future.get();
+    });
+}
+
+std::vector<std::string> DashboardClient::sendAndReceiveBatch(const std::vector<std::string>& cmds) {
+    std::string batch;
+    std::vector<std::shared_future<std::string>> futures;
+    {
+        std::lock_guard<std::mutex> lock(impl_->socket_mutex_);
+        if (!impl_->socket_ptr_) {
+            throw EliteException(EliteException::Code::SOCKET_FAIL, "Dashboard not connect to robot");
+        }
+        for (auto& cmd : cmds) {
+            auto reply = std::make_shared<std::promise<std::string>>();
+            futures.push_back(reply->get_future().share());
+            impl_->queueCommand(cmd, reply, batch);
+        }
+        try {
+            sendCommand(batch);
+        } catch (...) {
+            impl_->failPending(std::current_exception());
+        }
+    }
+    std::vector<std::string> responses;
+    responses.reserve(futures.size());
+    for (auto& f : futures) {
+        readReplies(f);
+        responses.push_back(f.get());
+    }
+    return responses;
+}
+
+DashboardStatus DashboardClient::getStatus() {
+    static const std::vector<std::string> STATUS_COMMANDS = {"robotMode\n", "safety -s\n", "task -s\n", "status\n"};
+    std::vector<std::string> responses = sendAndReceiveBatch(STATUS_COMMANDS);
+    DashboardStatus status;
+    status.robot_mode =
+        DASHBOARD_RESPONSE::parseRobotMode(matchResponse(STATUS_COMMANDS[0], responses[0], matchers().robot_mode));
+    status.safety_mode =
+        DASHBOARD_RESPONSE::parseSafetyMode(matchResponse(STATUS_COMMANDS[1], responses[1], matchers().safety_status));
+    status.task_status = DASHBOARD_RESPONSE::parseTaskStatus(matchResponse(STATUS_COMMANDS[2], responses[2], matchers().task_is));
+    status.speed_scaling =
+        parseSpeedScaling(STATUS_COMMANDS[3], matchResponse(STATUS_COMMANDS[3], responses[3], matchers().speed_fraction));
+    return status;
+}
+
+void DashboardClient::readReplies(const std::shared_future<std::string>& reply) {
+    std::lock_guard<std::mutex> lock(impl_->read_mutex_);
+    // Responses arrive in the order of the commands, so read until this reply is fulfilled.
+    while (reply.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        Impl::PendingReply front;
+        {
+            std::lock_guard<std::mutex> pending_lock(impl_->pending_mutex_);
+            if (impl_->pending_.empty()) {
+                return;
+            }
+            front = impl_->pending_.front();
+            impl_->pending_.pop_front();
+        }
+        try {
+            std::string response;
+            if (front.fenced) {
+                // Every line up to the reply of the fence command
+                for (std::string line = asyncReadLine(); line != FENCE_REPLY; line = asyncReadLine()) {
+                    response += line;
+                }
+            } else {
+                response = asyncReadLine();
+            }
+            front.promise->set_value(response);
+        } catch (...) {
+            // The order of the stream is lost, fail all the replies are waiting
+            front.promise->set_exception(std::current_exception());
+            impl_->failPending(std::current_exception());
+        }
     }
-    return asyncReadLine();
 }
 
 std::string DashboardClient::asyncReadLine(unsigned timeout_ms) {
+    // Hold a reference for the whole read, disconnect() may release the socket meanwhile
+    std::shared_ptr<boost::asio::ip::tcp::socket> socket;
+    {
+        std::lock_guard<std::mutex> lock(impl_->socket_mutex_);
+        socket = impl_->socket_ptr_;
+        if (!socket) {
+            throw EliteException(EliteException::Code::SOCKET_FAIL, "Dashboard not connect to robot");
+        }
+        impl_->reading_ = true;
+    }
     boost::system::error_code ec = boost::asio::error::would_block;
-    boost::asio::streambuf stream_buffer;
-    boost::asio::async_read_until(*impl_->socket_ptr_, stream_buffer, '\n',
-                                  [&](const boost::system::error_code& error, std::size_t nb) { ec = error; });
+    std::size_t line_size = 0;
+    boost::asio::async_read_until(*socket, impl_->read_buffer_, '\n',
+                                  [&](const boost::system::error_code& error, std::size_t nb) {
+                                      ec = error;
+                                      line_size = nb;
+                                  });
 
     do {
         impl_->io_context_.run_for(std::chrono::milliseconds(timeout_ms));
@@ -409,52 +618,63 @@ std::string DashboardClient::asyncReadLine(unsigned timeout_ms) {
             impl_->io_context_.restart();
         }
     } while (ec == boost::asio::error::would_block);
+    {
+        std::lock_guard<std::mutex> lock(impl_->socket_mutex_);
+        impl_->reading_ = false;
+        if (impl_->socket_ptr_ != socket) {
+            // Released during the read, the close posted by disconnect() may not have run
+            boost::system::error_code ignore_ec;
+            socket->close(ignore_ec);
+            if (!ec) {
+                ec = boost::asio::error::operation_aborted;
+            }
+        }
+    }
     if (ec) {
         throw EliteException(EliteException::Code::SOCKET_FAIL, ec.message());
     }
-    std::string line(boost::asio::buffers_begin(stream_buffer.data()), boost::asio::buffers_end(stream_buffer.data()));
+    // Only take one line, the rest of the buffer belongs to the next response
+    auto begin = boost::asio::buffers_begin(impl_->read_buffer_.data());
+    std::string line(begin, begin + line_size);
+    impl_->read_buffer_.consume(line_size);
     return line;
 }
 
 void DashboardClient::sendCommand(const std::string& cmd) {
     boost::system::error_code ec;
-    impl_->socket_ptr_->send(boost::asio::buffer(cmd), 0, ec);
+    boost::asio::write(*impl_->socket_ptr_, boost::asio::buffer(cmd), ec);
     if (ec) {
         throw EliteException(EliteException::Code::SOCKET_FAIL, ec.message());
     }
 }
 
-std::string DashboardClient::sendAndRequest(const std::string& cmd, const std::string& expected) {
-    std::lock_guard<std::mutex> lock(impl_->socket_mutex_);
-    if (!impl_->socket_ptr_) {
-        ELITE_LOG_ERROR("Dashboard not connect to robot");
-        return "";
-    }
-    sendCommand(cmd);
-    std::string response = asyncReadLine();
-    if (!expected.empty()) {
-        std::smatch match;
-        bool ret = std::regex_search(response, match, std::regex(expected));
-        if (!ret) {
-            throw EliteException(
-                EliteException::Code::DASHBOARD_NOT_EXPECT_RECIVE,
-                "Dashboard command \"" + cmd + "\" response expected: " + expected + ". But received: " + response);
-            return std::string();
+std::string DashboardClient::sendAndRequest(const std::string& cmd) {
+    {
+        std::lock_guard<std::mutex> lock(impl_->socket_mutex_);
+        if (!impl_->socket_ptr_) {
+            ELITE_LOG_ERROR("Dashboard not connect to robot");
+            return "";
         }
-        return match[0];
-    } else {
+    }
+    return sendAsync(cmd).get();
+}
+
+std::string DashboardClient::sendAndRequest(const std::string& cmd, const DashboardResponseMatcher& expected) {
+    std::string response = sendAndRequest(cmd);
+    if (response.empty()) {
         return response;
     }
+    return matchResponse(cmd, response, expected);
 }
 
-bool DashboardClient::waitForReply(const std::string& cmd, const std::string& expected,
+bool DashboardClient::waitForReply(const std::string& cmd, const DashboardResponseMatcher& expected,
                                    const std::chrono::duration<double> timeout) {
     const std::chrono::duration<double> wait_period = 100ms;
     std::chrono::duration<double> time_done(0);
     std::string response;
     while (time_done < timeout) {
         response = sendAndRequest(cmd);
-        if (std::regex_match(response, std::regex(expected))) {
+        if (expected.matchAll(response)) {
             return true;
         }
         // wait 100ms before trying again
@@ -462,4 +682,27 @@ bool DashboardClient::waitForReply(const std::string& cmd, const std::string& ex
         time_done += wait_period;
     }
     return false;
-}
\ No newline at end of file
+}
+
+void DashboardClient::setStateSource(std::shared_ptr<DashboardStateSource> source) {
+    std::lock_guard<std::mutex> lock(impl_->state_source_mutex_);
+    impl_->state_source_ = std::move(source);
+}
+
+std::shared_ptr<DashboardStateSource> DashboardClient::stateSource() {
+    std::lock_guard<std::mutex> lock(impl_->state_source_mutex_);
+    return impl_->state_source_;
+}
+
+bool DashboardClient::waitForState(const std::function<bool(const DashboardStatus&)>& predicate, const std::string& cmd,
+                                   const DashboardResponseMatcher& expected, const std::chrono::duration<double> timeout) {
+    auto source = stateSource();
+    if (source) {
+        auto result = source->waitUntil(predicate, std::chrono::duration_cast<std::chrono::milliseconds>(timeout));
+        if (result != DashboardStateSource::WaitResult::UNAVAILABLE) {
+            return result == DashboardStateSource::WaitResult::MATCHED;
+        }
+        ELITE_LOG_DEBUG("Dashboard state source unavailable, poll \"%s\" instead", cmd.substr(0, cmd.size() - 1).c_str());
+    }
+    return waitForReply(cmd, expected, timeout);
+}
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "DashboardResponseMatcher.hpp"
+
+#include <cstring>
+
+namespace ELITE {
+
+namespace {
+
+// The regex '.' stops at these characters
+inline bool isLineTerminator(char c) { return c == '\n' || c == '\r'; }
+
+size_t lineEnd(const std::string& s, size_t pos) {
+    while (pos < s.size() && !isLineTerminator(s[pos])) {
+        pos++;
+    }
+    return pos;
+}
+
+// Position of the value after ": " and the end of its line
+bool valueRange(const std::string& response, size_t& begin, size_t& end) {
+    size_t pos = response.find(": ");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    begin = pos + 2;
+    end = lineEnd(response, begin);
+    return true;
+}
+
+template <typename T>
+struct NamedValue {
+    const char* name;
+    size_t length;
+    T value;
+};
+
+#define ELITE_NAMED_VALUE(name, value) \
+    { name, sizeof(name) - 1, value }
+
+template <typename T, size_t N>
+T lookup(const std::string& response, const NamedValue<T> (&table)[N], T unknown) {
+    size_t begin, end;
+    if (!valueRange(response, begin, end)) {
+        return unknown;
+    }
+    const size_t length = end - begin;
+    const char* value = response.data() + begin;
+    for (auto& item : table) {
+        if (item.length == length && memcmp(item.name, value, length) == 0) {
+            return item.value;
+        }
+    }
+    return unknown;
+}
+
+const NamedValue<RobotMode> ROBOT_MODE_TABLE[] = {
+    ELITE_NAMED_VALUE("NO_CONTROLLER", RobotMode::NO_CONTROLLER),
+    ELITE_NAMED_VALUE("DISCONNECTED", RobotMode::DISCONNECTED),
+    ELITE_NAMED_VALUE("CONFIRM_SAFETY", RobotMode::CONFIRM_SAFETY),
+    ELITE_NAMED_VALUE("BOOTING", RobotMode::BOOTING),
+    ELITE_NAMED_VALUE("POWER_OFF", RobotMode::POWER_OFF),
+    ELITE_NAMED_VALUE("POWER_ON", RobotMode::POWER_ON),
+    ELITE_NAMED_VALUE("IDLE", RobotMode::IDLE),
+    ELITE_NAMED_VALUE("BACK_DRIVE", RobotMode::BACKDRIVE),
+    ELITE_NAMED_VALUE("RUNNING", RobotMode::RUNNING),
+    ELITE_NAMED_VALUE("UPDATING", RobotMode::UPDATING_FIRMWARE),
+    ELITE_NAMED_VALUE("WAITING_CALIBRATION", RobotMode::WAITING_CALIBRATION),
+};
+
+const NamedValue<SafetyMode> SAFETY_MODE_TABLE[] = {
+    ELITE_NAMED_VALUE("NORMAL", SafetyMode::NORMAL),
+    ELITE_NAMED_VALUE("REDUCED", SafetyMode::REDUCED),
+    ELITE_NAMED_VALUE("PROTECTIVE_STOP", SafetyMode::PROTECTIVE_STOP),
+    ELITE_NAMED_VALUE("RECOVERY", SafetyMode::RECOVERY),
+    ELITE_NAMED_VALUE("SAFEGUARD_STOP", SafetyMode::SAFEGUARD_STOP),
+    ELITE_NAMED_VALUE("SYSTEM_EMERGENCY_STOP", SafetyMode::SYSTEM_EMERGENCY_STOP),
+    ELITE_NAMED_VALUE("ROBOT_EMERGENCY_STOP", SafetyMode::ROBOT_EMERGENCY_STOP),
+    ELITE_NAMED_VALUE("VIOLATION", SafetyMode::VIOLATION),
+    ELITE_NAMED_VALUE("FAULT", SafetyMode::FAULT),
+    ELITE_NAMED_VALUE("VALIDATE_JOINT_ID", SafetyMode::VALIDATE_JOINT_ID),
+    ELITE_NAMED_VALUE("UNDEFINED_SAFETY_MODE", SafetyMode::UNDEFINED_SAFETY_MODE),
+    ELITE_NAMED_VALUE("AUTOMATIC_MODE_SAFEGUARD_STOP", SafetyMode::AUTOMATIC_MODE_SAFEGUARD_STOP),
+    ELITE_NAMED_VALUE("SYSTEM_THREE_POSITION_ENABLING_STOP", SafetyMode::SYSTEM_THREE_POSITION_ENABLING_STOP),
+    ELITE_NAMED_VALUE("TP_THREE_POSITION_ENABLING_STOP", SafetyMode::TP_THREE_POSITION_ENABLING_STOP),
+};
+
+#undef ELITE_NAMED_VALUE
+
+}  // namespace
+
+DashboardResponseMatcher::DashboardResponseMatcher(Kind kind, const std::string& pattern) : kind_(kind), pattern_(pattern) {
+    if (kind_ == Kind::REGEX) {
+        regex_ = std::make_shared<const std::regex>(pattern_);
+    }
+}
+
+DashboardResponseMatcher DashboardResponseMatcher::literal(const std::string& text) {
+    return DashboardResponseMatcher(Kind::LITERAL, text);
+}
+
+DashboardResponseMatcher DashboardResponseMatcher::linePrefix(const std::string& text) {
+    return DashboardResponseMatcher(Kind::LINE_PREFIX, text);
+}
+
+DashboardResponseMatcher DashboardResponseMatcher::regex(const std::string& pattern) {
+    return DashboardResponseMatcher(Kind::REGEX, pattern);
+}
+
+bool DashboardResponseMatcher::search(const std::string& response, std::string* matched) const {
+    switch (kind_) {
+        case Kind::LITERAL: {
+            size_t pos = response.find(pattern_);
+            if (pos == std::string::npos) {
+                return false;
+            }
+            if (matched) {
+                *matched = pattern_;
+            }
+            return true;
+        }
+        case Kind::LINE_PREFIX: {
+            size_t pos = response.find(pattern_);
+            if (pos == std::string::npos) {
+                return false;
+            }
+            if (matched) {
+                matched->assign(response, pos, lineEnd(response, pos + pattern_.size()) - pos);
+            }
+            return true;
+        }
+        case Kind::REGEX:
+        default: {
+            std::smatch match;
+            if (!std::regex_search(response, match, *regex_)) {
+                return false;
+            }
+            if (matched) {
+                *matched = match[0];
+            }
+            return true;
+        }
+    }
+}
+
+bool DashboardResponseMatcher::matchAll(const std::string& response) const {
+    switch (kind_) {
+        case Kind::LITERAL:
+            return response == pattern_;
+        case Kind::LINE_PREFIX:
+            return response.compare(0, pattern_.size(), pattern_) == 0 &&
+                   lineEnd(response, pattern_.size()) == response.size();
+        case Kind::REGEX:
+        default:
+            return std::regex_match(response, *regex_);
+    }
+}
+
+namespace DASHBOARD_RESPONSE {
+
+RobotMode parseRobotMode(const std::string& response) { return lookup(response, ROBOT_MODE_TABLE, RobotMode::UNKNOWN); }
+
+SafetyMode parseSafetyMode(const std::string& response) { return lookup(response, SAFETY_MODE_TABLE, SafetyMode::UNKNOWN); }
+
+TaskStatus parseTaskStatus(const std::string& response) {
+    if (response.find("stopped") != std::string::npos) {
+        return TaskStatus::STOPPED;
+    } else if (response.find("paused") != std::string::npos) {
+        return TaskStatus::PAUSED;
+    } else if (response.find("running") != std::string::npos) {
+        return TaskStatus::PLAYING;
+    } else {
+        return TaskStatus::STOPPED;
+    }
+}
+
+TaskStatus parseRunningStatus(const std::string& response) {
+    size_t begin, end;
+    if (!valueRange(response, begin, end)) {
+        return TaskStatus::STOPPED;
+    }
+    auto contains = [&](const char* text) {
+        size_t pos = response.find(text, begin);
+        return pos != std::string::npos && pos + strlen(text) <= end;
+    };
+    if (contains("STOP")) {
+        return TaskStatus::STOPPED;
+    } else if (contains("RUNNING")) {
+        return TaskStatus::PLAYING;
+    } else if (contains("PAUSE")) {
+        return TaskStatus::PAUSED;
+    }
+    return TaskStatus::STOPPED;
+}
+
+bool parseIntValue(const std::string& response, int& value) {
+    size_t begin, end;
+    if (!valueRange(response, begin, end)) {
+        return false;
+    }
+    // Skip the leading spaces, as std::stoi() does
+    while (begin < end && (response[begin] == ' ' || response[begin] == '\t')) {
+        begin++;
+    }
+    bool negative = false;
+    if (begin < end && (response[begin] == '-' || response[begin] == '+')) {
+        negative = response[begin] == '-';
+        begin++;
+    }
+    if (begin >= end || response[begin] < '0' || response[begin] > '9') {
+        return false;
+    }
+    long long result = 0;
+    for (; begin < end && response[begin] >= '0' && response[begin] <= '9'; begin++) {
+        result = result * 10 + (response[begin] - '0');
+        if (result > 0x7FFFFFFFLL) {
+            return false;
+        }
+    }
+    value = static_cast<int>(negative ? -result : result);
+    return true;
+}
+
+}  // namespace DASHBOARD_RESPONSE
+
+}  // namespace ELITE
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "DashboardStateSource.hpp"
+
+#include <cmath>
+
+using namespace ELITE;
+using namespace std::chrono;
+
+RtsiDashboardStateSource::RtsiDashboardStateSource(std::shared_ptr<RtsiIOInterface> rtsi) : rtsi_(std::move(rtsi)) {}
+
+bool RtsiDashboardStateSource::readState(DashboardStatus& state) {
+    int32_t robot_mode = 0;
+    int32_t safety_status = 0;
+    uint32_t runtime_state = 0;
+    double speed_fraction = 0;
+    if (!rtsi_->getRecipeValue("robot_mode", robot_mode) || !rtsi_->getRecipeValue("safety_status", safety_status) ||
+        !rtsi_->getRecipeValue("runtime_state", runtime_state) ||
+        !rtsi_->getRecipeValue("target_speed_fraction", speed_fraction)) {
+        return false;
+    }
+    state.robot_mode = static_cast<RobotMode>(robot_mode);
+    state.safety_mode = static_cast<SafetyMode>(safety_status);
+    state.task_status = static_cast<TaskStatus>(runtime_state);
+    // The dashboard reports the speed fraction in percent
+    state.speed_scaling = static_cast<int>(std::lround(speed_fraction * 100));
+    return true;
+}
+
+DashboardStateSource::WaitResult RtsiDashboardStateSource::waitUntil(
+    const std::function<bool(const DashboardStatus&)>& predicate, milliseconds timeout) {
+    if (!rtsi_) {
+        return WaitResult::UNAVAILABLE;
+    }
+    auto deadline = steady_clock::now() + timeout;
+    while (true) {
+        DashboardStatus state;
+        if (!rtsi_->isConnected() || !readState(state)) {
+            return WaitResult::UNAVAILABLE;
+        }
+        if (predicate(state)) {
+            return WaitResult::MATCHED;
+        }
+        auto now = steady_clock::now();
+        if (now >= deadline) {
+            return WaitResult::TIMEOUT;
+        }
+        rtsi_->waitForUpdate(static_cast<unsigned>(duration_cast<milliseconds>(deadline - now).count()) + 1);
+    }
+}
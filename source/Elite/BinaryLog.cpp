@@ -0,0 +1,470 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "BinaryLog.hpp"
+#include "EliteException.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ELITE {
+
+namespace {
+
+constexpr char BINARY_LOG_MAGIC[8] = {'E', 'L', 'I', 'T', 'E', 'L', 'O', 'G'};
+constexpr uint16_t BINARY_LOG_VERSION = 1;
+constexpr size_t BINARY_LOG_HEADER_SIZE = 16;
+constexpr size_t BINARY_LOG_MIN_FILE_SIZE = 4096;
+constexpr size_t MAX_SITE_FILE_SIZE = 1024;
+// The largest encoding of a 64-bit varint
+constexpr size_t MAX_VARINT_SIZE = 10;
+
+enum RecordType : uint8_t {
+    // The unused part of a mapped file is zero
+    RECORD_END = 0,
+    RECORD_SITE = 1,
+    RECORD_MESSAGE = 2,
+};
+
+inline size_t putVarint(uint8_t* out, uint64_t value) {
+    size_t n = 0;
+    while (value >= 0x80) {
+        out[n++] = static_cast<uint8_t>(value) | 0x80;
+        value >>= 7;
+    }
+    out[n++] = static_cast<uint8_t>(value);
+    return n;
+}
+
+// The time may go backwards, the delta is zigzag encoded
+inline uint64_t zigzag(int64_t value) { return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); }
+
+inline int64_t unzigzag(uint64_t value) { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1); }
+
+inline bool fileExists(const std::string& path) {
+    std::FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) {
+        return false;
+    }
+    std::fclose(fp);
+    return true;
+}
+
+// A file created with a fixed size and mapped for writing
+class MappedFile {
+   private:
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+
+   public:
+    MappedFile() = default;
+    ~MappedFile() { close(0); }
+
+    bool open(const std::string& path, size_t size) {
+#if defined(_WIN32)
+        file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        ULARGE_INTEGER length;
+        length.QuadPart = size;
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, length.HighPart, length.LowPart, nullptr);
+        if (mapping_) {
+            data_ = static_cast<uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_WRITE, 0, 0, size));
+        }
+#else
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            return false;
+        }
+        if (::ftruncate(fd_, static_cast<off_t>(size)) == 0) {
+            void* addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+            data_ = (addr == MAP_FAILED) ? nullptr : static_cast<uint8_t*>(addr);
+        }
+#endif
+        if (!data_) {
+            close(0);
+            return false;
+        }
+        size_ = size;
+        return true;
+    }
+
+    // Unmap and cut the file to the used size
+    void close(size_t used) {
+#if defined(_WIN32)
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            LARGE_INTEGER length;
+            length.QuadPart = used;
+            SetFilePointerEx(file_, length, nullptr, FILE_BEGIN);
+            SetEndOfFile(file_);
+            CloseHandle(file_);
+        }
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        if (data_) {
+            ::munmap(data_, size_);
+        }
+        if (fd_ >= 0) {
+            if (::ftruncate(fd_, static_cast<off_t>(used)) != 0) {
+                // Keep the zero padding, the reader stops at it
+            }
+            ::close(fd_);
+        }
+        fd_ = -1;
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    void sync() {
+        if (!data_) {
+            return;
+        }
+#if defined(_WIN32)
+        FlushViewOfFile(data_, 0);
+#else
+        ::msync(data_, size_, MS_ASYNC);
+#endif
+    }
+
+    uint8_t* data() { return data_; }
+
+    size_t size() const { return size_; }
+
+    bool isOpen() const { return data_ != nullptr; }
+};
+
+}  // namespace
+
+class BinaryLogHandler::Impl {
+   public:
+    struct Site {
+        std::string file;
+        uint32_t id;
+    };
+
+    struct SiteKeyHash {
+        size_t operator()(const std::pair<const char*, int>& key) const {
+            return std::hash<const void*>()(key.first) ^ (static_cast<size_t>(key.second) * 0x9E3779B97F4A7C15ULL);
+        }
+    };
+
+    std::mutex mutex;
+    std::string path_prefix;
+    size_t file_size;
+    size_t max_files;
+    // ".YYYYmmdd-HHMMSS" of the handler creation, the files of different runs never collide
+    std::string start_time;
+    uint64_t next_index = 0;
+    std::deque<std::string> files;
+    MappedFile mapped;
+    size_t used = 0;
+    int64_t last_time_us = 0;
+    uint64_t lost = 0;
+    // The sites written to the current file
+    std::unordered_map<std::pair<const char*, int>, Site, SiteKeyHash> sites;
+    uint32_t next_site_id = 0;
+    std::unordered_map<std::thread::id, uint32_t> threads;
+    std::vector<uint8_t> scratch;
+
+    bool openNext() {
+        mapped.close(used);
+        used = 0;
+        sites.clear();
+        next_site_id = 0;
+        last_time_us = 0;
+
+        // Never overwrite a file, a handler may have been created in the same second
+        std::string path;
+        do {
+            char suffix[32];
+            std::snprintf(suffix, sizeof(suffix), ".%04llu.elog", static_cast<unsigned long long>(next_index++));
+            path = path_prefix + start_time + suffix;
+        } while (fileExists(path));
+        if (!mapped.open(path, file_size)) {
+            return false;
+        }
+        uint8_t* header = mapped.data();
+        memcpy(header, BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC));
+        header[8] = static_cast<uint8_t>(BINARY_LOG_VERSION & 0xFF);
+        header[9] = static_cast<uint8_t>(BINARY_LOG_VERSION >> 8);
+        used = BINARY_LOG_HEADER_SIZE;
+
+        files.push_back(path);
+        while (max_files > 0 && files.size() > max_files) {
+            std::remove(files.front().c_str());
+            files.pop_front();
+        }
+        return true;
+    }
+
+    // Append a record, open the next file when the current one is full
+    bool append(const uint8_t* record, size_t size, bool& reopened) {
+        reopened = false;
+        if (mapped.isOpen() && used + size <= mapped.size()) {
+            memcpy(mapped.data() + used, record, size);
+            used += size;
+            return true;
+        }
+        if (!openNext()) {
+            return false;
+        }
+        reopened = true;
+        return true;
+    }
+
+    uint32_t threadId() {
+        auto result = threads.emplace(std::this_thread::get_id(), static_cast<uint32_t>(threads.size()));
+        return result.first->second;
+    }
+
+    void write(const char* file, int line, LogLevel level, const char* message) {
+        if (!file) {
+            file = "";
+        }
+        if (!message) {
+            message = "";
+        }
+        int64_t now_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        uint32_t thread = threadId();
+        size_t file_length = strlen(file);
+        if (file_length > MAX_SITE_FILE_SIZE) {
+            file_length = MAX_SITE_FILE_SIZE;
+        }
+        // Leave room for the site record in an empty file
+        size_t max_message = file_size - BINARY_LOG_HEADER_SIZE - file_length - 6 * MAX_VARINT_SIZE - 2;
+        size_t message_length = strlen(message);
+        if (message_length > max_message) {
+            message_length = max_message;
+        }
+
+        // Retried once in a new file, the sites and the time base start again there
+        for (int attempt = 0; attempt < 2; attempt++) {
+            if (!mapped.isOpen() && !openNext()) {
+                lost++;
+                return;
+            }
+            auto key = std::make_pair(file, line);
+            auto iter = sites.find(key);
+            if (iter == sites.end() || iter->second.file.compare(0, std::string::npos, file, file_length) != 0) {
+                uint32_t id = next_site_id;
+                scratch.resize(1 + 3 * MAX_VARINT_SIZE + file_length);
+                size_t n = 0;
+                scratch[n++] = RECORD_SITE;
+                n += putVarint(&scratch[n], id);
+                n += putVarint(&scratch[n], static_cast<uint32_t>(line));
+                n += putVarint(&scratch[n], file_length);
+                memcpy(&scratch[n], file, file_length);
+                n += file_length;
+                bool reopened;
+                if (!append(scratch.data(), n, reopened)) {
+                    lost++;
+                    return;
+                }
+                if (reopened) {
+                    continue;
+                }
+                next_site_id++;
+                sites[key] = Site{std::string(file, file_length), id};
+                iter = sites.find(key);
+            }
+
+            scratch.resize(2 + 4 * MAX_VARINT_SIZE + message_length);
+            size_t n = 0;
+            scratch[n++] = RECORD_MESSAGE;
+            n += putVarint(&scratch[n], zigzag(now_us - last_time_us));
+            scratch[n++] = static_cast<uint8_t>(level);
+            n += putVarint(&scratch[n], iter->second.id);
+            n += putVarint(&scratch[n], thread);
+            n += putVarint(&scratch[n], message_length);
+            memcpy(&scratch[n], message, message_length);
+            n += message_length;
+            bool reopened;
+            if (!append(scratch.data(), n, reopened)) {
+                lost++;
+                return;
+            }
+            if (reopened) {
+                continue;
+            }
+            last_time_us = now_us;
+            return;
+        }
+        lost++;
+    }
+};
+
+BinaryLogHandler::BinaryLogHandler(const std::string& path_prefix, size_t file_size, size_t max_files)
+    : impl_(new Impl()) {
+    impl_->path_prefix = path_prefix;
+    impl_->file_size = file_size < BINARY_LOG_MIN_FILE_SIZE ? BINARY_LOG_MIN_FILE_SIZE : file_size;
+    impl_->max_files = max_files;
+    std::time_t t = std::time(nullptr);
+    std::tm tm;
+#if defined(_WIN32)
+    localtime_s(&tm, &t);
+#else
+    localtime_r(&t, &tm);
+#endif
+    char start_time[32];
+    std::strftime(start_time, sizeof(start_time), ".%Y%m%d-%H%M%S", &tm);
+    impl_->start_time = start_time;
+    if (!impl_->openNext()) {
+        throw EliteException(EliteException::Code::FILE_OPEN_FAIL, path_prefix);
+    }
+}
+
+BinaryLogHandler::~BinaryLogHandler() {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->mapped.close(impl_->used);
+}
+
+void BinaryLogHandler::log(const char* file, int line, LogLevel loglevel, const char* log) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->write(file, line, loglevel, log);
+}
+
+void BinaryLogHandler::flush() {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->mapped.sync();
+}
+
+std::string BinaryLogHandler::currentFile() {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    if (!impl_->mapped.isOpen() || impl_->files.empty()) {
+        return std::string();
+    }
+    return impl_->files.back();
+}
+
+uint64_t BinaryLogHandler::lostCount() {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->lost;
+}
+
+class BinaryLogReader::Impl {
+   public:
+    std::vector<uint8_t> data;
+    size_t pos = BINARY_LOG_HEADER_SIZE;
+    int64_t time_us = 0;
+    bool broken = false;
+    std::vector<std::pair<std::string, int>> sites;
+
+    bool getVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= data.size()) {
+                return false;
+            }
+            uint8_t byte = data[pos++];
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool getString(std::string& out) {
+        uint64_t length;
+        if (!getVarint(length) || length > data.size() - pos) {
+            return false;
+        }
+        out.assign(reinterpret_cast<const char*>(&data[pos]), static_cast<size_t>(length));
+        pos += static_cast<size_t>(length);
+        return true;
+    }
+};
+
+BinaryLogReader::BinaryLogReader(const std::string& path) : impl_(new Impl()) {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        throw EliteException(EliteException::Code::FILE_OPEN_FAIL, path);
+    }
+    impl_->data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    if (impl_->data.size() < BINARY_LOG_HEADER_SIZE ||
+        memcmp(impl_->data.data(), BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC)) != 0 ||
+        (impl_->data[8] | (impl_->data[9] << 8)) != BINARY_LOG_VERSION) {
+        throw EliteException(EliteException::Code::FILE_OPEN_FAIL, path + " is not a binary log file");
+    }
+}
+
+BinaryLogReader::~BinaryLogReader() = default;
+
+bool BinaryLogReader::next(BinaryLogEntry& entry) {
+    Impl& r = *impl_;
+    while (!r.broken && r.pos < r.data.size()) {
+        uint8_t type = r.data[r.pos++];
+        if (type == RECORD_END) {
+            return false;
+        } else if (type == RECORD_SITE) {
+            uint64_t id, line;
+            std::string file;
+            if (!r.getVarint(id) || !r.getVarint(line) || !r.getString(file) || id != r.sites.size()) {
+                r.broken = true;
+                return false;
+            }
+            r.sites.emplace_back(std::move(file), static_cast<int>(line));
+        } else if (type == RECORD_MESSAGE) {
+            uint64_t delta, site, thread;
+            if (!r.getVarint(delta) || r.pos >= r.data.size()) {
+                r.broken = true;
+                return false;
+            }
+            uint8_t level = r.data[r.pos++];
+            if (level > static_cast<uint8_t>(LogLevel::ELI_NONE) || !r.getVarint(site) || site >= r.sites.size() ||
+                !r.getVarint(thread) || !r.getString(entry.message)) {
+                r.broken = true;
+                return false;
+            }
+            r.time_us += unzigzag(delta);
+            entry.time = std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(r.time_us)));
+            entry.level = static_cast<LogLevel>(level);
+            entry.file = r.sites[site].first;
+            entry.line = r.sites[site].second;
+            entry.thread = static_cast<uint32_t>(thread);
+            return true;
+        } else {
+            r.broken = true;
+            return false;
+        }
+    }
+    return false;
+}
+
+bool BinaryLogReader::isBroken() { return impl_->broken; }
+
+}  // namespace ELITE
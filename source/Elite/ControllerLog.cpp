@@ -2,7 +2,7 @@
 // Copyright (c) 2025, Elite Robots.
 #include "Elite/ControllerLog.hpp"
 #include "Elite/Log.hpp"
-#include "Common/SshUtils.hpp"
+#include "Common/SshSessionPool.hpp"
 
 #include <cstdlib>
 #include <algorithm>
@@ -12,14 +12,29 @@ bool ControllerLog::downloadSystemLog(const std::string &robot_ip,
                                       const std::string &password,
                                       const std::string &path, 
                                       std::function<void (int f_z, int r_z, const char *err)> progress_cb) {
-    
+    // The query and the download run on the pooled session of the robot.
+    auto connection = SSH_UTILS::SshSessionPool::instance().acquire(robot_ip, "root", password);
+    if (!connection) {
+        if (progress_cb) {
+            progress_cb(0, 0, "SSH connection failed");
+        }
+        return false;
+    }
+    SSH_UTILS::SshTransfer transfer(connection);
+
     std::string command = "bash -lc 'printenv RT_ROBOT_DATA_PATH'";
-    std::string remote_path = SSH_UTILS::executeCommand(robot_ip, "root", password, command);
+    std::string remote_path = transfer.execute(command);
     // Erase '\n'
     remote_path.erase(std::remove(remote_path.begin(), remote_path.end(), '\n'), remote_path.end());
     remote_path += "log/log_history.csv";
     ELITE_LOG_DEBUG("Remote path: %s", remote_path.c_str());
-    return SSH_UTILS::downloadFile(robot_ip, "root", password, remote_path, path, progress_cb);
+    SSH_UTILS::TransferProgress progress;
+    if (progress_cb) {
+        progress = [&](uint64_t total, uint64_t done, const char *err) {
+            progress_cb(static_cast<int>(total), static_cast<int>(done), err);
+        };
+    }
+    return transfer.download(remote_path, path, progress);
 }
 
-} // namespace ELITE
\ No newline at end of file
+} // namespace ELITE
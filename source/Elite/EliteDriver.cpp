@@ -40,6 +40,12 @@ static const std::string SERVOJ_DECELERATE_TIME_REPLACE = "{{SERVOJ_DECELERATE_T
 static const std::string SERVOJ_HOLD_VELOCITY_THRESHOLD_REPLACE = "{{SERVOJ_HOLD_VELOCITY_THRESHOLD_REPLACE}}";
 static const std::string SERVOJ_HOLD_STABLE_TIME_REPLACE = "{{SERVOJ_HOLD_STABLE_TIME_REPLACE}}";
 
+// Time to wait for the script to accept the RS485 script commands, a script without them falls back to SSH after it
+static constexpr int SCRIPT_RS485_ACCEPT_TIMEOUT_MS = 200;
+// Time to wait for the acknowledgement of an accepted RS485 script command, the script gives socat 2 s to listen
+static constexpr int SCRIPT_RS485_TIMEOUT_MS = 3000;
+static constexpr int SERIAL_CONNECT_TIMEOUT_MS = 1000;
+
 class EliteDriver::Impl {
    public:
     Impl() = delete;
@@ -59,6 +65,7 @@ class EliteDriver::Impl {
     std::string readScriptFile(const std::string& file);
     void scriptParamWrite(std::string& file_string, const EliteDriverConfig& config);
     int getSocatPid(const std::string& ssh_password, int port);
+    SerialCommunicationSharedPtr connectSerial(int tcp_port, int socat_pid);
     std::string robot_script_;
     std::string robot_ip_;
     std::string local_ip_;
@@ -180,6 +187,7 @@ void EliteDriver::init(const EliteDriverConfig& config) {
     // First, need to connect to the robot primary port before attempting to obtain the local IP address
     ELITE_LOG_DEBUG("Connecting to robot primary port %s ...", config.robot_ip.c_str());
     impl_->primary_port_ = std::make_unique<PrimaryPortInterface>();
+    impl_->primary_port_->setReconnectPolicy(config.primary_reconnect_policy);
     if (!impl_->primary_port_->connect(impl_->robot_ip_, PrimaryPortInterface::PRIMARY_PORT)) {
         ELITE_LOG_FATAL("Connect robot primary port fail.");
         throw EliteException(EliteException::Code::SOCKET_CONNECT_FAIL, "Connect robot primary port fail.");
@@ -390,12 +398,29 @@ int EliteDriver::Impl::getSocatPid(const std::string& ssh_password, int port) {
     }
 }
 
+// Socat was acknowledged to listen by the script, so the connection needs no retry
+SerialCommunicationSharedPtr EliteDriver::Impl::connectSerial(int tcp_port, int socat_pid) {
+    auto com = std::make_shared<SerialCommunicationImpl>(tcp_port, robot_ip_, socat_pid);
+    if (!com->connect(SERIAL_CONNECT_TIMEOUT_MS)) {
+        ELITE_LOG_WARN("Connect to socat port %d fail, connect() can be called again", tcp_port);
+    }
+    return com;
+}
+
 SerialCommunicationSharedPtr EliteDriver::startToolRs485(const SerialConfig& config, const std::string& ssh_password,
                                                          int tcp_port) {
     if (!impl_->primary_port_) {
         ELITE_LOG_ERROR("Not connect to robot primary port");
         return nullptr;
     }
+    if (impl_->script_command_server_->isRobotConnect()) {
+        int socat_pid = impl_->script_command_server_->startToolRs485(config, tcp_port, SCRIPT_RS485_ACCEPT_TIMEOUT_MS,
+                                                                      SCRIPT_RS485_TIMEOUT_MS);
+        if (socat_pid > 0) {
+            return impl_->connectSerial(tcp_port, socat_pid);
+        }
+        ELITE_LOG_WARN("Start tool RS485 by the external control script fail, start it by SSH");
+    }
     int socat_pid = impl_->getSocatPid(ssh_password, tcp_port);
     if (socat_pid > 0) {
         return std::make_shared<SerialCommunicationImpl>(tcp_port, impl_->robot_ip_, socat_pid);
@@ -433,6 +458,10 @@ bool EliteDriver::endToolRs485(SerialCommunicationSharedPtr com, const std::stri
     if (!com) {
         return false;
     }
+    if (impl_->script_command_server_->isRobotConnect() &&
+        impl_->script_command_server_->endToolRs485(SCRIPT_RS485_ACCEPT_TIMEOUT_MS, SCRIPT_RS485_TIMEOUT_MS)) {
+        return true;
+    }
     if (com->getSocatPid() < 0) {
         return false;
     }
@@ -446,6 +475,14 @@ SerialCommunicationSharedPtr EliteDriver::startBoardRs485(const SerialConfig& co
         ELITE_LOG_ERROR("Not connect to robot primary port");
         return nullptr;
     }
+    if (impl_->script_command_server_->isRobotConnect()) {
+        int socat_pid = impl_->script_command_server_->startBoardRs485(config, tcp_port, SCRIPT_RS485_ACCEPT_TIMEOUT_MS,
+                                                                       SCRIPT_RS485_TIMEOUT_MS);
+        if (socat_pid > 0) {
+            return impl_->connectSerial(tcp_port, socat_pid);
+        }
+        ELITE_LOG_WARN("Start board RS485 by the external control script fail, start it by SSH");
+    }
     int socat_pid = impl_->getSocatPid(ssh_password, tcp_port);
     if (socat_pid > 0) {
         return std::make_shared<SerialCommunicationImpl>(tcp_port, impl_->robot_ip_, socat_pid);
@@ -482,6 +519,10 @@ bool EliteDriver::endBoardRs485(SerialCommunicationSharedPtr com, const std::str
     if (!com) {
         return false;
     }
+    if (impl_->script_command_server_->isRobotConnect() &&
+        impl_->script_command_server_->endBoardRs485(SCRIPT_RS485_ACCEPT_TIMEOUT_MS, SCRIPT_RS485_TIMEOUT_MS)) {
+        return true;
+    }
     if (com->getSocatPid() < 0) {
         return false;
     }
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "Elite/FleetOrchestrator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include "Common/SshSessionPool.hpp"
+#include "Elite/Log.hpp"
+
+namespace ELITE {
+
+using namespace std::chrono;
+using namespace SSH_UTILS;
+
+// The same steps as UPGRADE::upgradeControlSoftware() and ControllerLog::downloadSystemLog()
+static const char* UPGRADE_REMOTE_FILE = "/tmp/CS_UPDATE.eup";
+static const char* UPGRADE_CHMOD_CMD = "chmod +x /tmp/CS_UPDATE.eup";
+static const char* UPGRADE_RUN_CMD = "bash -lc '/tmp/CS_UPDATE.eup --app'";
+static const char* LOG_PATH_CMD = "bash -lc 'printenv RT_ROBOT_DATA_PATH'";
+static const char* LOG_FILE = "log/log_history.csv";
+
+std::string FleetSummary::toString() const {
+    char line[256];
+    std::snprintf(line, sizeof(line), "%zu succeeded, %zu failed, %llu bytes, %.1f s\n", succeeded, failed,
+                  static_cast<unsigned long long>(bytes), elapsed.count() / 1000.0);
+    std::string text = line;
+    for (auto& host : hosts) {
+        if (host.success) {
+            std::snprintf(line, sizeof(line), "  %-16s OK      %llu bytes, %.1f s\n", host.ip.c_str(),
+                          static_cast<unsigned long long>(host.bytes), host.duration.count() / 1000.0);
+            text += line;
+        } else {
+            std::snprintf(line, sizeof(line), "  %-16s FAILED  ", host.ip.c_str());
+            text += line;
+            text += host.error + "\n";
+        }
+    }
+    return text;
+}
+
+class FleetOrchestrator::Impl {
+   public:
+    FleetOptions options_;
+    std::shared_ptr<BandwidthLimiter> limiter_;
+    std::mutex progress_mutex_;
+    FleetProgressCallback progress_;
+
+    explicit Impl(const FleetOptions& options) : options_(options) {
+        if (options_.max_bytes_per_second > 0) {
+            limiter_ = std::make_shared<BandwidthLimiter>(options_.max_bytes_per_second);
+        }
+    }
+
+    void report(const std::string& ip, FleetStage stage, uint64_t total, uint64_t done, const char* err) {
+        std::lock_guard<std::mutex> lock(progress_mutex_);
+        if (progress_) {
+            progress_(ip, stage, total, done, err);
+        }
+    }
+
+    // Log in and get the transfer of a robot, the error is set on failure
+    std::unique_ptr<SshTransfer> connect(FleetHostResult& result, const std::string& password) {
+        report(result.ip, FleetStage::CONNECT, 0, 0, nullptr);
+        auto connection = SshSessionPool::instance().acquire(result.ip, "root", password);
+        if (!connection) {
+            result.error = "SSH connection failed";
+            return nullptr;
+        }
+        TransferOptions transfer_options;
+        transfer_options.limiter = limiter_;
+        return std::unique_ptr<SshTransfer>(new SshTransfer(connection, transfer_options));
+    }
+
+    // Progress of a transfer, the last error is kept
+    TransferProgress transferProgress(FleetHostResult& result, FleetStage stage, std::string& error) {
+        return [this, &result, stage, &error](uint64_t total, uint64_t done, const char* err) {
+            result.bytes = done;
+            if (err) {
+                error = err;
+            } else {
+                report(result.ip, stage, total, done, nullptr);
+            }
+        };
+    }
+
+    FleetSummary run(const std::vector<std::string>& ips, const std::function<void(FleetHostResult&)>& task) {
+        auto start = steady_clock::now();
+        FleetSummary summary;
+        summary.hosts.resize(ips.size());
+        std::atomic<size_t> next{0};
+        auto worker = [&]() {
+            size_t index;
+            while ((index = next.fetch_add(1)) < ips.size()) {
+                FleetHostResult& result = summary.hosts[index];
+                result.ip = ips[index];
+                auto host_start = steady_clock::now();
+                task(result);
+                result.duration = duration_cast<milliseconds>(steady_clock::now() - host_start);
+                if (result.success) {
+                    report(result.ip, FleetStage::DONE, 0, 0, nullptr);
+                } else {
+                    ELITE_LOG_ERROR("Robot %s fail: %s", result.ip.c_str(), result.error.c_str());
+                    report(result.ip, FleetStage::FAILED, 0, 0, result.error.c_str());
+                }
+            }
+        };
+        size_t worker_count = std::min(std::max<size_t>(options_.max_workers, 1), ips.size());
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < worker_count; i++) {
+            workers.emplace_back(worker);
+        }
+        for (auto& t : workers) {
+            t.join();
+        }
+
+        for (auto& host : summary.hosts) {
+            if (host.success) {
+                summary.succeeded++;
+            } else {
+                summary.failed++;
+            }
+            summary.bytes += host.bytes;
+        }
+        summary.elapsed = duration_cast<milliseconds>(steady_clock::now() - start);
+        return summary;
+    }
+};
+
+FleetOrchestrator::FleetOrchestrator(const FleetOptions& options) : impl_(new Impl(options)) {}
+
+FleetOrchestrator::~FleetOrchestrator() = default;
+
+void FleetOrchestrator::setProgressCallback(FleetProgressCallback cb) {
+    std::lock_guard<std::mutex> lock(impl_->progress_mutex_);
+    impl_->progress_ = std::move(cb);
+}
+
+FleetSummary FleetOrchestrator::upgradeControlSoftware(const std::vector<std::string>& ips, const std::string& file,
+                                                       const std::string& password) {
+    // Read once, shared by all the uploads
+    std::string data;
+    std::string sha256;
+    std::ifstream input(file, std::ios::binary | std::ios::ate);
+    bool loaded = static_cast<bool>(input);
+    if (loaded) {
+        data.resize(static_cast<size_t>(input.tellg()));
+        input.seekg(0, std::ios::beg);
+        loaded = static_cast<bool>(input.read(&data[0], data.size()));
+        sha256 = sha256Data(data.data(), data.size());
+    }
+    if (!loaded) {
+        ELITE_LOG_ERROR("Failed to read upgrade file: %s", file.c_str());
+    }
+
+    return impl_->run(ips, [&](FleetHostResult& result) {
+        if (!loaded) {
+            result.error = "failed to read upgrade file " + file;
+            return;
+        }
+        auto transfer = impl_->connect(result, password);
+        if (!transfer) {
+            return;
+        }
+        std::string error = "upload fail";
+        if (!transfer->upload(data.data(), data.size(), sha256, UPGRADE_REMOTE_FILE,
+                              impl_->transferProgress(result, FleetStage::UPLOAD, error))) {
+            result.error = error;
+            return;
+        }
+
+        impl_->report(result.ip, FleetStage::INSTALL, 0, 0, nullptr);
+        transfer->execute(UPGRADE_CHMOD_CMD);
+        int status;
+        std::string out = transfer->execute(UPGRADE_RUN_CMD, &status);
+        ELITE_LOG_DEBUG("Robot %s execute cmd: %s\n Output:%s", result.ip.c_str(), UPGRADE_RUN_CMD, out.c_str());
+        if (status < 0) {
+            result.error = "failed to run the upgrade package";
+            return;
+        }
+        result.success = true;
+    });
+}
+
+FleetSummary FleetOrchestrator::downloadSystemLogs(const std::vector<std::string>& ips, const std::string& directory,
+                                                   const std::string& password) {
+    return impl_->run(ips, [&](FleetHostResult& result) {
+        auto transfer = impl_->connect(result, password);
+        if (!transfer) {
+            return;
+        }
+        std::string remote_path = transfer->execute(LOG_PATH_CMD);
+        remote_path.erase(std::remove(remote_path.begin(), remote_path.end(), '\n'), remote_path.end());
+        remote_path += LOG_FILE;
+
+        std::string local_path = directory;
+        if (!local_path.empty() && local_path.back() != '/' && local_path.back() != '\\') {
+            local_path += '/';
+        }
+        local_path += result.ip + "_log_history.csv";
+        std::string error = "download fail";
+        if (!transfer->download(remote_path, local_path, impl_->transferProgress(result, FleetStage::DOWNLOAD, error))) {
+            result.error = error;
+            return;
+        }
+        result.success = true;
+    });
+}
+
+}  // namespace ELITE
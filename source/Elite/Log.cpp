@@ -20,31 +20,51 @@ void setLogLevel(LogLevel level) {
     getLogger().setLevel(level);
 }
 
-void log(const char* file, int line, LogLevel level, const char* fmt, ...) {
-    if (level >= getLogger().getLogLevel()) {
-        size_t buffer_size = 4096;
-        std::unique_ptr<char[]> buffer;
-        buffer.reset(new char[buffer_size]);
+LogLevel getLogLevel() {
+    return getLogger().getLogLevel();
+}
+
+void setAsyncLogging(bool enable, size_t queue_capacity) {
+    getLogger().setAsync(enable, queue_capacity);
+}
 
-        va_list args;
-        va_start(args, fmt);
-        va_list args_copy;
-        va_copy(args_copy, args);
+bool flushLog(std::chrono::milliseconds timeout) {
+    return getLogger().flush(timeout);
+}
 
-        size_t characters = 1 + std::vsnprintf(buffer.get(), buffer_size, fmt, args);
+uint64_t getDroppedLogCount() {
+    return getLogger().getDroppedCount();
+}
 
-        if (characters >= buffer_size) {
-            buffer_size = characters + 1;
-            buffer.reset(new char[buffer_size]);
-            std::vsnprintf(buffer.get(), buffer_size, fmt, args_copy);
-        }
+void setLogRateLimit(unsigned burst, std::chrono::milliseconds interval) {
+    getLogger().rateLimiter().configure(burst, interval);
+}
 
-        va_end(args);
-        va_end(args_copy);
+static void logSuppressed(const char* file, int line, LogLevel level, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    getLogger().vlog(file, line, level, fmt, args);
+    va_end(args);
+}
 
-        getLogger().log(file, line, level, buffer.get());
+void log(const char* file, int line, LogLevel level, const char* fmt, ...) {
+    Logger& logger = getLogger();
+    if (level < logger.getLogLevel()) {
+        return;
     }
+    // Dropped before formatting
+    uint32_t suppressed = 0;
+    if (!logger.rateLimiter().allow(file, line, suppressed)) {
+        return;
+    }
+    if (suppressed > 0) {
+        logSuppressed(file, line, level, "%u similar messages were suppressed", suppressed);
+    }
+    va_list args;
+    va_start(args, fmt);
+    logger.vlog(file, line, level, fmt, args);
+    va_end(args);
 }
 
 
-}
\ No newline at end of file
+}
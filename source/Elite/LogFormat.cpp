@@ -0,0 +1,436 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "LogFormat.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+namespace ELITE {
+
+namespace LOG_FORMAT {
+
+namespace {
+
+enum class Length { NONE, HH, H, L, LL, J, Z, T, LONG_DOUBLE };
+
+// One conversion specification of a format string
+struct Conversion {
+    // The '%'
+    const char* begin;
+    // End of the flags, the width and the precision
+    const char* length_begin;
+    // After the conversion character
+    const char* end;
+    Length length;
+    char type;
+    bool width_star;
+    bool precision_star;
+    // -1 when the precision is not given as digits
+    int precision;
+};
+
+constexpr size_t MAX_SPEC_SIZE = 32;
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+bool parseConversion(const char* p, Conversion& c) {
+    c.begin = p++;
+    c.length = Length::NONE;
+    c.width_star = false;
+    c.precision_star = false;
+    c.precision = -1;
+    if (*p == '%') {
+        c.type = '%';
+        c.length_begin = p;
+        c.end = p + 1;
+        return true;
+    }
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0' || *p == '\'') {
+        p++;
+    }
+    if (*p == '*') {
+        c.width_star = true;
+        p++;
+    } else {
+        while (isDigit(*p)) {
+            p++;
+        }
+    }
+    // Positional arguments
+    if (*p == '$') {
+        return false;
+    }
+    if (*p == '.') {
+        p++;
+        if (*p == '*') {
+            c.precision_star = true;
+            p++;
+        } else {
+            c.precision = 0;
+            while (isDigit(*p)) {
+                if (c.precision < 100000) {
+                    c.precision = c.precision * 10 + (*p - '0');
+                }
+                p++;
+            }
+        }
+    }
+    c.length_begin = p;
+    switch (*p) {
+        case 'h':
+            c.length = (p[1] == 'h') ? Length::HH : Length::H;
+            p += (p[1] == 'h') ? 2 : 1;
+            break;
+        case 'l':
+            c.length = (p[1] == 'l') ? Length::LL : Length::L;
+            p += (p[1] == 'l') ? 2 : 1;
+            break;
+        case 'j':
+            c.length = Length::J;
+            p++;
+            break;
+        case 'z':
+            c.length = Length::Z;
+            p++;
+            break;
+        case 't':
+            c.length = Length::T;
+            p++;
+            break;
+        case 'L':
+            c.length = Length::LONG_DOUBLE;
+            p++;
+            break;
+        default:
+            break;
+    }
+    c.type = *p;
+    c.end = p + 1;
+    if (c.length_begin - c.begin > static_cast<ptrdiff_t>(MAX_SPEC_SIZE) - 4) {
+        return false;
+    }
+    switch (c.type) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            return c.length != Length::LONG_DOUBLE;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            return c.length == Length::NONE || c.length == Length::L || c.length == Length::LONG_DOUBLE;
+        case 'c':
+        case 's':
+        case 'p':
+            // "%lc" and "%ls" are wide characters
+            return c.length == Length::NONE;
+        default:
+            // "%n", or not a conversion
+            return false;
+    }
+}
+
+class BufferWriter {
+   private:
+    char* pos_;
+    char* end_;
+    bool ok_;
+
+   public:
+    BufferWriter(char* buffer, size_t size) : pos_(buffer), end_(buffer + size), ok_(true) {}
+
+    void putBytes(const void* data, size_t size) {
+        if (!ok_ || static_cast<size_t>(end_ - pos_) < size) {
+            ok_ = false;
+            return;
+        }
+        memcpy(pos_, data, size);
+        pos_ += size;
+    }
+
+    template <typename T>
+    void put(T value) {
+        putBytes(&value, sizeof(T));
+    }
+
+    bool ok() const { return ok_; }
+};
+
+class BufferReader {
+   private:
+    const char* pos_;
+
+   public:
+    explicit BufferReader(const char* buffer) : pos_(buffer) {}
+
+    const char* bytes(size_t size) {
+        const char* data = pos_;
+        pos_ += size;
+        return data;
+    }
+
+    template <typename T>
+    T get() {
+        T value;
+        memcpy(&value, bytes(sizeof(T)), sizeof(T));
+        return value;
+    }
+};
+
+// Format one argument with a rebuilt specification, the '*' values go first
+template <typename T>
+void appendFormatted(std::string& out, const char* spec, const int* stars, int star_count, T value) {
+    auto print = [&](char* dst, size_t size) {
+        switch (star_count) {
+            case 0:
+                return std::snprintf(dst, size, spec, value);
+            case 1:
+                return std::snprintf(dst, size, spec, stars[0], value);
+            default:
+                return std::snprintf(dst, size, spec, stars[0], stars[1], value);
+        }
+    };
+    char local[128];
+    int characters = print(local, sizeof(local));
+    if (characters < 0) {
+        return;
+    }
+    if (characters < static_cast<int>(sizeof(local))) {
+        out.append(local, characters);
+    } else {
+        size_t old_size = out.size();
+        out.resize(old_size + characters + 1);
+        print(&out[old_size], characters + 1);
+        out.resize(old_size + characters);
+    }
+}
+
+}  // namespace
+
+bool encode(char* buffer, size_t size, const char* fmt, va_list args) {
+    BufferWriter writer(buffer, size);
+    size_t fmt_length = strlen(fmt);
+    if (fmt_length > UINT16_MAX) {
+        return false;
+    }
+    writer.put<uint16_t>(static_cast<uint16_t>(fmt_length));
+    writer.putBytes(fmt, fmt_length + 1);
+
+    for (const char* p = strchr(fmt, '%'); p && writer.ok(); p = strchr(p, '%')) {
+        Conversion c;
+        if (!parseConversion(p, c)) {
+            return false;
+        }
+        p = c.end;
+        if (c.type == '%') {
+            continue;
+        }
+        int precision = c.precision;
+        if (c.width_star) {
+            writer.put<int>(va_arg(args, int));
+        }
+        if (c.precision_star) {
+            precision = va_arg(args, int);
+            writer.put<int>(precision);
+        }
+        switch (c.type) {
+            case 'd':
+            case 'i': {
+                long long value;
+                switch (c.length) {
+                    case Length::HH:
+                        value = static_cast<signed char>(va_arg(args, int));
+                        break;
+                    case Length::H:
+                        value = static_cast<short>(va_arg(args, int));
+                        break;
+                    case Length::L:
+                        value = va_arg(args, long);
+                        break;
+                    case Length::LL:
+                        value = va_arg(args, long long);
+                        break;
+                    case Length::J:
+                        value = va_arg(args, intmax_t);
+                        break;
+                    case Length::Z:
+                        value = va_arg(args, std::make_signed<size_t>::type);
+                        break;
+                    case Length::T:
+                        value = va_arg(args, ptrdiff_t);
+                        break;
+                    default:
+                        value = va_arg(args, int);
+                        break;
+                }
+                writer.put<long long>(value);
+                break;
+            }
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X': {
+                unsigned long long value;
+                switch (c.length) {
+                    case Length::HH:
+                        value = static_cast<unsigned char>(va_arg(args, unsigned int));
+                        break;
+                    case Length::H:
+                        value = static_cast<unsigned short>(va_arg(args, unsigned int));
+                        break;
+                    case Length::L:
+                        value = va_arg(args, unsigned long);
+                        break;
+                    case Length::LL:
+                        value = va_arg(args, unsigned long long);
+                        break;
+                    case Length::J:
+                        value = va_arg(args, uintmax_t);
+                        break;
+                    case Length::Z:
+                        value = va_arg(args, size_t);
+                        break;
+                    case Length::T:
+                        value = va_arg(args, std::make_unsigned<ptrdiff_t>::type);
+                        break;
+                    default:
+                        value = va_arg(args, unsigned int);
+                        break;
+                }
+                writer.put<unsigned long long>(value);
+                break;
+            }
+            case 'c':
+                writer.put<int>(va_arg(args, int));
+                break;
+            case 'p':
+                writer.put<void*>(va_arg(args, void*));
+                break;
+            case 's': {
+                const char* text = va_arg(args, const char*);
+                if (!text) {
+                    text = "(null)";
+                }
+                // With a precision the string does not have to be terminated
+                size_t length = 0;
+                while ((precision < 0 || length < static_cast<size_t>(precision)) && text[length] != '\0') {
+                    length++;
+                }
+                if (length > UINT16_MAX) {
+                    return false;
+                }
+                writer.put<uint16_t>(static_cast<uint16_t>(length));
+                writer.putBytes(text, length);
+                writer.put<char>('\0');
+                break;
+            }
+            default:
+                if (c.length == Length::LONG_DOUBLE) {
+                    writer.put<long double>(va_arg(args, long double));
+                } else {
+                    writer.put<double>(va_arg(args, double));
+                }
+                break;
+        }
+    }
+    return writer.ok();
+}
+
+void format(const char* buffer, std::string& out) {
+    BufferReader reader(buffer);
+    uint16_t fmt_length = reader.get<uint16_t>();
+    const char* fmt = reader.bytes(fmt_length + 1);
+
+    out.clear();
+    const char* p = fmt;
+    for (const char* percent = strchr(p, '%'); percent; percent = strchr(p, '%')) {
+        out.append(p, percent - p);
+        Conversion c;
+        // encode() accepted the format
+        parseConversion(percent, c);
+        p = c.end;
+        if (c.type == '%') {
+            out += '%';
+            continue;
+        }
+        int stars[2];
+        int star_count = 0;
+        if (c.width_star) {
+            stars[star_count++] = reader.get<int>();
+        }
+        if (c.precision_star) {
+            stars[star_count++] = reader.get<int>();
+        }
+        // The flags, width and precision as written, the length of the stored type
+        char spec[MAX_SPEC_SIZE];
+        size_t spec_size = c.length_begin - c.begin;
+        memcpy(spec, c.begin, spec_size);
+        switch (c.type) {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                spec[spec_size++] = 'l';
+                spec[spec_size++] = 'l';
+                break;
+            case 'c':
+            case 's':
+            case 'p':
+                break;
+            default:
+                if (c.length == Length::LONG_DOUBLE) {
+                    spec[spec_size++] = 'L';
+                }
+                break;
+        }
+        spec[spec_size++] = c.type;
+        spec[spec_size] = '\0';
+
+        switch (c.type) {
+            case 'd':
+            case 'i':
+                appendFormatted(out, spec, stars, star_count, reader.get<long long>());
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                appendFormatted(out, spec, stars, star_count, reader.get<unsigned long long>());
+                break;
+            case 'c':
+                appendFormatted(out, spec, stars, star_count, reader.get<int>());
+                break;
+            case 'p':
+                appendFormatted(out, spec, stars, star_count, reader.get<void*>());
+                break;
+            case 's': {
+                uint16_t length = reader.get<uint16_t>();
+                appendFormatted(out, spec, stars, star_count, reader.bytes(length + 1));
+                break;
+            }
+            default:
+                if (c.length == Length::LONG_DOUBLE) {
+                    appendFormatted(out, spec, stars, star_count, reader.get<long double>());
+                } else {
+                    appendFormatted(out, spec, stars, star_count, reader.get<double>());
+                }
+                break;
+        }
+    }
+    out.append(p);
+}
+
+}  // namespace LOG_FORMAT
+
+}  // namespace ELITE
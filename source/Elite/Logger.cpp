@@ -1,12 +1,202 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025, Elite Robots.
 #include "Logger.hpp"
+#include "LogFormat.hpp"
 
-namespace ELITE{
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace ELITE {
+
+namespace {
+// Messages shorter than this are formatted without heap allocation
+constexpr size_t LOG_STACK_BUFFER_SIZE = 512;
+// The writer thread sleeps at most this long when a wake-up is missed
+constexpr auto LOG_WRITER_IDLE_WAIT = std::chrono::milliseconds(10);
+constexpr char LOG_TRUNCATED_MARK[] = "...";
+}  // namespace
+
+Logger::Logger()
+    : level_(LogLevel::ELI_INFO),
+      async_(false),
+      writer_running_(false),
+      writer_sleeping_(false),
+      committed_(0),
+      handled_(0),
+      dropped_(0),
+      reported_dropped_(0) {
+    default_handler_ = new DefaultLogHandler();
+    handler_.reset(default_handler_);
+}
+
+Logger::~Logger() { setAsync(false, 0); }
+
+void Logger::registerHandler(std::unique_ptr<LogHandler>& handler) {
+    std::lock_guard<std::mutex> lock(handler_mutex_);
+    handler_ = std::move(handler);
+    default_handler_ = nullptr;
+}
+
+void Logger::unregisterHandler() {
+    std::lock_guard<std::mutex> lock(handler_mutex_);
+    default_handler_ = new DefaultLogHandler();
+    handler_.reset(default_handler_);
+}
+
+void Logger::handle(std::chrono::system_clock::time_point time, const char* file, int line, LogLevel level, const char* log) {
+    std::lock_guard<std::mutex> lock(handler_mutex_);
+    if (!handler_) {
+        default_handler_ = new DefaultLogHandler();
+        handler_.reset(default_handler_);
+    }
+    if (default_handler_) {
+        default_handler_->log(time, file, line, level, log);
+    } else {
+        handler_->log(file, line, level, log);
+    }
+}
+
+void Logger::log(const char* file, int line, LogLevel level, const char* log) {
+    handle(std::chrono::system_clock::now(), file, line, level, log);
+}
+
+void Logger::vlog(const char* file, int line, LogLevel level, const char* fmt, va_list args) {
+    if (async_.load(std::memory_order_acquire)) {
+        AsyncLogQueue::Slot slot;
+        if (!queue_->reserve(slot)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        LogRecord& record = *slot.record;
+        record.time = std::chrono::system_clock::now();
+        record.file = file;
+        record.line = line;
+        record.level = level;
+        va_list args_copy;
+        va_copy(args_copy, args);
+        record.deferred = LOG_FORMAT::encode(record.message, LogRecord::MESSAGE_SIZE, fmt, args_copy);
+        va_end(args_copy);
+        if (!record.deferred) {
+            int characters = std::vsnprintf(record.message, LogRecord::MESSAGE_SIZE, fmt, args);
+            if (characters >= static_cast<int>(LogRecord::MESSAGE_SIZE)) {
+                memcpy(record.message + LogRecord::MESSAGE_SIZE - sizeof(LOG_TRUNCATED_MARK), LOG_TRUNCATED_MARK,
+                       sizeof(LOG_TRUNCATED_MARK));
+            }
+        }
+        queue_->commit(slot);
+        committed_.fetch_add(1, std::memory_order_release);
+        if (writer_sleeping_.load(std::memory_order_acquire)) {
+            writer_cv_.notify_one();
+        }
+        return;
+    }
+
+    char stack_buffer[LOG_STACK_BUFFER_SIZE];
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int characters = std::vsnprintf(stack_buffer, sizeof(stack_buffer), fmt, args);
+    if (characters < static_cast<int>(sizeof(stack_buffer))) {
+        log(file, line, level, stack_buffer);
+    } else {
+        std::unique_ptr<char[]> buffer(new char[characters + 1]);
+        std::vsnprintf(buffer.get(), characters + 1, fmt, args_copy);
+        log(file, line, level, buffer.get());
+    }
+    va_end(args_copy);
+}
+
+void Logger::setAsync(bool enable, size_t queue_capacity) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    if (enable) {
+        if (writer_thread_) {
+            return;
+        }
+        if (!queue_) {
+            queue_.reset(new AsyncLogQueue(queue_capacity));
+            // Write the queued messages before the process exits
+            std::atexit([]() { getLogger().setAsync(false, 0); });
+        }
+        writer_running_ = true;
+        writer_thread_.reset(new std::thread([this]() { writerLoop(); }));
+        async_.store(true, std::memory_order_release);
+    } else {
+        if (!writer_thread_) {
+            return;
+        }
+        async_.store(false, std::memory_order_release);
+        writer_running_ = false;
+        writer_cv_.notify_all();
+        writer_thread_->join();
+        writer_thread_.reset();
+    }
+}
+
+void Logger::writerLoop() {
+    while (true) {
+        bool handled_any = false;
+        while (queue_->consume([this](const LogRecord& record) {
+            if (record.deferred) {
+                LOG_FORMAT::format(record.message, deferred_message_);
+                handle(record.time, record.file, record.line, record.level, deferred_message_.c_str());
+            } else {
+                handle(record.time, record.file, record.line, record.level, record.message);
+            }
+        })) {
+            handled_.fetch_add(1, std::memory_order_release);
+            handled_any = true;
+        }
+        reportDropped();
+        if (!writer_running_) {
+            // Drain what was committed before the stop
+            if (handled_.load() >= committed_.load()) {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+        if (!handled_any) {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            writer_sleeping_.store(true, std::memory_order_seq_cst);
+            // A producer that missed the flag is picked up after the idle wait
+            if (handled_.load() >= committed_.load() && writer_running_) {
+                writer_cv_.wait_for(lock, LOG_WRITER_IDLE_WAIT);
+            }
+            writer_sleeping_.store(false, std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::reportDropped() {
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped != reported_dropped_) {
+        char message[96];
+        std::snprintf(message, sizeof(message), "%llu log messages were dropped, the asynchronous log queue is full",
+                      static_cast<unsigned long long>(dropped - reported_dropped_));
+        reported_dropped_ = dropped;
+        handle(std::chrono::system_clock::now(), __REL_FILE__, __LINE__, LogLevel::ELI_WARN, message);
+    }
+}
+
+bool Logger::flush(std::chrono::milliseconds timeout) {
+    if (!isAsync()) {
+        return true;
+    }
+    uint64_t target = committed_.load(std::memory_order_acquire);
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (handled_.load(std::memory_order_acquire) < target) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        writer_cv_.notify_one();
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    return true;
+}
 
 Logger& getLogger() {
     static Logger* s_logger = new Logger();
     return *s_logger;
 }
 
-}
+}  // namespace ELITE
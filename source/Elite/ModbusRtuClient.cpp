@@ -0,0 +1,644 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "Elite/ModbusRtuClient.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "Elite/Log.hpp"
+
+namespace ELITE {
+
+using namespace std::chrono;
+
+// Exception code of the last failed request, per calling thread
+static thread_local uint8_t s_last_exception = 0;
+
+// Bits of a character on the line: start, 8 data, parity or second stop, stop
+static constexpr int MODBUS_CHAR_BITS = 11;
+// Largest RTU frame
+static constexpr size_t MODBUS_MAX_FRAME = 256;
+
+static std::array<uint16_t, 256> makeCrcTable() {
+    std::array<uint16_t, 256> table{};
+    for (uint16_t i = 0; i < 256; i++) {
+        uint16_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? static_cast<uint16_t>((crc >> 1) ^ 0xA001) : static_cast<uint16_t>(crc >> 1);
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+static bool isRead(ModbusFunction function) { return static_cast<uint8_t>(function) <= 0x04; }
+
+static bool isBitFunction(ModbusFunction function) {
+    return function == ModbusFunction::READ_COILS || function == ModbusFunction::READ_DISCRETE_INPUTS ||
+           function == ModbusFunction::WRITE_SINGLE_COIL || function == ModbusFunction::WRITE_MULTIPLE_COILS;
+}
+
+static ModbusTable tableOf(ModbusFunction function) {
+    switch (function) {
+        case ModbusFunction::READ_COILS:
+        case ModbusFunction::WRITE_SINGLE_COIL:
+        case ModbusFunction::WRITE_MULTIPLE_COILS:
+            return ModbusTable::COIL;
+        case ModbusFunction::READ_DISCRETE_INPUTS:
+            return ModbusTable::DISCRETE_INPUT;
+        case ModbusFunction::READ_INPUT_REGISTERS:
+            return ModbusTable::INPUT_REGISTER;
+        default:
+            return ModbusTable::HOLDING_REGISTER;
+    }
+}
+
+static ModbusFunction readFunctionOf(ModbusTable table) {
+    switch (table) {
+        case ModbusTable::COIL:
+            return ModbusFunction::READ_COILS;
+        case ModbusTable::DISCRETE_INPUT:
+            return ModbusFunction::READ_DISCRETE_INPUTS;
+        case ModbusTable::INPUT_REGISTER:
+            return ModbusFunction::READ_INPUT_REGISTERS;
+        default:
+            return ModbusFunction::READ_HOLDING_REGISTERS;
+    }
+}
+
+// The number of values of a request, 0 if it is out of the range of the function
+static uint16_t valueCount(const ModbusRequest& request) {
+    size_t count = isRead(request.function) ? request.count : request.values.size();
+    size_t max_count;
+    switch (request.function) {
+        case ModbusFunction::READ_COILS:
+        case ModbusFunction::READ_DISCRETE_INPUTS:
+            max_count = 2000;
+            break;
+        case ModbusFunction::READ_HOLDING_REGISTERS:
+        case ModbusFunction::READ_INPUT_REGISTERS:
+            max_count = 125;
+            break;
+        case ModbusFunction::WRITE_SINGLE_COIL:
+        case ModbusFunction::WRITE_SINGLE_REGISTER:
+            max_count = 1;
+            break;
+        case ModbusFunction::WRITE_MULTIPLE_COILS:
+            max_count = 1968;
+            break;
+        case ModbusFunction::WRITE_MULTIPLE_REGISTERS:
+            max_count = 123;
+            break;
+        default:
+            return 0;
+    }
+    // The values can't run past the last address
+    if (count == 0 || count > max_count || request.address + count > 0x10000) {
+        return 0;
+    }
+    return static_cast<uint16_t>(count);
+}
+
+static void putU16(std::vector<uint8_t>& frame, uint16_t value) {
+    frame.push_back(static_cast<uint8_t>(value >> 8));
+    frame.push_back(static_cast<uint8_t>(value & 0xFF));
+}
+
+static uint16_t getU16(const uint8_t* data) { return static_cast<uint16_t>((data[0] << 8) | data[1]); }
+
+// The frame of a request, with its CRC
+static std::vector<uint8_t> buildFrame(const ModbusRequest& request, uint16_t count) {
+    std::vector<uint8_t> frame;
+    frame.reserve(MODBUS_MAX_FRAME);
+    frame.push_back(request.slave);
+    frame.push_back(static_cast<uint8_t>(request.function));
+    putU16(frame, request.address);
+    switch (request.function) {
+        case ModbusFunction::WRITE_SINGLE_COIL:
+            putU16(frame, request.values[0] ? 0xFF00 : 0x0000);
+            break;
+        case ModbusFunction::WRITE_SINGLE_REGISTER:
+            putU16(frame, request.values[0]);
+            break;
+        case ModbusFunction::WRITE_MULTIPLE_COILS: {
+            putU16(frame, count);
+            uint8_t bytes = static_cast<uint8_t>((count + 7) / 8);
+            frame.push_back(bytes);
+            size_t start = frame.size();
+            frame.resize(start + bytes, 0);
+            for (uint16_t i = 0; i < count; i++) {
+                if (request.values[i]) {
+                    frame[start + i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+                }
+            }
+            break;
+        }
+        case ModbusFunction::WRITE_MULTIPLE_REGISTERS:
+            putU16(frame, count);
+            frame.push_back(static_cast<uint8_t>(count * 2));
+            for (uint16_t i = 0; i < count; i++) {
+                putU16(frame, request.values[i]);
+            }
+            break;
+        default:
+            putU16(frame, count);
+            break;
+    }
+    uint16_t crc = ModbusRtuClient::crc16(frame.data(), frame.size());
+    frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+    frame.push_back(static_cast<uint8_t>(crc >> 8));
+    return frame;
+}
+
+// The second word a write response echoes: the value of the single writes, the quantity of the multiple writes
+static uint16_t echoValue(const ModbusRequest& request, uint16_t count) {
+    switch (request.function) {
+        case ModbusFunction::WRITE_SINGLE_COIL:
+            return request.values[0] ? 0xFF00 : 0x0000;
+        case ModbusFunction::WRITE_SINGLE_REGISTER:
+            return request.values[0];
+        default:
+            return count;
+    }
+}
+
+// The size of the normal response of a request
+static size_t responseSize(const ModbusRequest& request, uint16_t count) {
+    switch (request.function) {
+        case ModbusFunction::READ_COILS:
+        case ModbusFunction::READ_DISCRETE_INPUTS:
+            return 5 + (count + 7) / 8;
+        case ModbusFunction::READ_HOLDING_REGISTERS:
+        case ModbusFunction::READ_INPUT_REGISTERS:
+            return 5 + count * 2;
+        default:
+            return 8;
+    }
+}
+
+class ModbusRtuClient::Impl {
+   public:
+    enum class ResponseStatus {
+        OK,
+        // The slave answered with an exception
+        EXCEPTION,
+        // Timeout or a broken frame, the request can be retried
+        BROKEN,
+        // The serial communication is disconnected
+        LOST
+    };
+
+    struct Poll {
+        int id;
+        uint8_t slave;
+        ModbusTable table;
+        uint16_t address;
+        uint16_t count;
+        milliseconds period;
+        steady_clock::time_point next;
+    };
+
+    SerialCommunicationSharedPtr serial_;
+    ModbusRtuOptions options_;
+    microseconds silent_interval_;
+    microseconds char_time_;
+
+    // Held while a group of requests is on the bus
+    std::mutex bus_mutex_;
+    steady_clock::time_point bus_idle_since_;
+
+    std::mutex image_mutex_;
+    std::map<uint32_t, uint16_t> image_;
+    std::mutex callback_mutex_;
+    ModbusChangeCallback callback_;
+
+    std::mutex poll_mutex_;
+    std::condition_variable poll_cv_;
+    std::vector<Poll> polls_;
+    int next_poll_id_ = 0;
+    bool polling_ = false;
+    std::thread poll_thread_;
+
+    Impl(SerialCommunicationSharedPtr serial, const ModbusRtuOptions& options) : serial_(std::move(serial)), options_(options) {
+        int baud = static_cast<int>(options_.baud_rate);
+        char_time_ = microseconds(MODBUS_CHAR_BITS * 1000000LL / baud);
+        // The Modbus serial line specification fixes 1.75 ms above 19200 baud
+        silent_interval_ = baud > 19200 ? microseconds(1750) : microseconds(MODBUS_CHAR_BITS * 3500000LL / baud);
+        options_.pipeline_depth = std::max(options_.pipeline_depth, 1);
+        options_.retries = std::max(options_.retries, 0);
+        options_.response_timeout_ms = std::max(options_.response_timeout_ms, 1);
+    }
+
+    static uint32_t imageKey(uint8_t slave, ModbusTable table, uint16_t address) {
+        return (static_cast<uint32_t>(slave) << 24) | (static_cast<uint32_t>(table) << 16) | address;
+    }
+
+    bool sendFrame(const std::vector<uint8_t>& frame) {
+        std::this_thread::sleep_until(bus_idle_since_ + silent_interval_);
+        if (serial_->write(frame.data(), frame.size()) != static_cast<int>(frame.size())) {
+            ELITE_LOG_ERROR("Modbus RTU write fail");
+            return false;
+        }
+        // The next frame follows this one on the line after the silent interval
+        bus_idle_since_ = steady_clock::now() + char_time_ * frame.size();
+        return true;
+    }
+
+    // Discard the received bytes. With wait, until the line is silent.
+    void discardStale(bool wait) {
+        uint8_t buffer[MODBUS_MAX_FRAME];
+        size_t discarded = 0;
+        do {
+            if (wait) {
+                std::this_thread::sleep_for(silent_interval_ + milliseconds(1));
+            }
+            size_t available = serial_->available();
+            if (available == 0) {
+                break;
+            }
+            while (available > 0) {
+                int n = serial_->readSome(buffer, std::min(available, sizeof(buffer)), 1);
+                if (n <= 0) {
+                    break;
+                }
+                available -= n;
+                discarded += n;
+            }
+        } while (wait);
+        if (discarded > 0) {
+            ELITE_LOG_DEBUG("Modbus RTU discard %zu stale bytes", discarded);
+        }
+    }
+
+    ResponseStatus readPart(uint8_t* data, size_t size, steady_clock::time_point deadline) {
+        auto left = duration_cast<milliseconds>(deadline - steady_clock::now()).count();
+        int n = serial_->readExact(data, size, static_cast<int>(std::max<long long>(left, 1)));
+        if (n < 0) {
+            return ResponseStatus::LOST;
+        }
+        return n == 0 ? ResponseStatus::BROKEN : ResponseStatus::OK;
+    }
+
+    ResponseStatus readResponse(ModbusRequest& request, uint16_t count) {
+        uint8_t frame[MODBUS_MAX_FRAME];
+        uint8_t function = static_cast<uint8_t>(request.function);
+        auto deadline = steady_clock::now() + milliseconds(options_.response_timeout_ms);
+        ResponseStatus status = readPart(frame, 2, deadline);
+        if (status != ResponseStatus::OK) {
+            if (status == ResponseStatus::BROKEN) {
+                ELITE_LOG_DEBUG("Modbus RTU slave %d function 0x%02X response timeout", request.slave, function);
+            }
+            return status;
+        }
+        bool exception = frame[1] == (function | 0x80);
+        if (frame[0] != request.slave || (frame[1] != function && !exception)) {
+            ELITE_LOG_DEBUG("Modbus RTU unexpected response head %02X %02X", frame[0], frame[1]);
+            return ResponseStatus::BROKEN;
+        }
+        size_t size = exception ? 5 : responseSize(request, count);
+        status = readPart(frame + 2, size - 2, deadline);
+        if (status != ResponseStatus::OK) {
+            return status;
+        }
+        bus_idle_since_ = steady_clock::now();
+        uint16_t crc = crc16(frame, size - 2);
+        if (frame[size - 2] != (crc & 0xFF) || frame[size - 1] != (crc >> 8)) {
+            ELITE_LOG_DEBUG("Modbus RTU slave %d response CRC error", request.slave);
+            return ResponseStatus::BROKEN;
+        }
+        if (exception) {
+            request.exception = frame[2];
+            ELITE_LOG_DEBUG("Modbus RTU slave %d function 0x%02X exception %d", request.slave, function, frame[2]);
+            return ResponseStatus::EXCEPTION;
+        }
+
+        if (isRead(request.function)) {
+            if (frame[2] != size - 5) {
+                return ResponseStatus::BROKEN;
+            }
+            request.result.resize(count);
+            for (uint16_t i = 0; i < count; i++) {
+                request.result[i] = isBitFunction(request.function) ? ((frame[3 + i / 8] >> (i % 8)) & 1) : getU16(frame + 3 + i * 2);
+            }
+        } else if (getU16(frame + 2) != request.address || getU16(frame + 4) != echoValue(request, count)) {
+            ELITE_LOG_DEBUG("Modbus RTU slave %d function 0x%02X response echo mismatch", request.slave, function);
+            return ResponseStatus::BROKEN;
+        }
+        request.success = true;
+        return ResponseStatus::OK;
+    }
+
+    bool transact(std::vector<ModbusRequest>& requests) {
+        std::vector<size_t> pending;
+        std::vector<uint16_t> counts(requests.size());
+        for (size_t i = 0; i < requests.size(); i++) {
+            auto& request = requests[i];
+            request.success = false;
+            request.exception = 0;
+            request.result.clear();
+            counts[i] = valueCount(request);
+            bool valid_slave = request.slave <= 247 && (request.slave != 0 || !isRead(request.function));
+            if (counts[i] == 0 || !valid_slave) {
+                ELITE_LOG_ERROR("Invalid Modbus request: slave %d function 0x%02X address %d count %zu", request.slave,
+                                static_cast<int>(request.function), request.address,
+                                isRead(request.function) ? request.count : request.values.size());
+                continue;
+            }
+            pending.push_back(i);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(bus_mutex_);
+            std::vector<int> attempts(requests.size(), 0);
+            std::deque<size_t> in_flight;
+            size_t next = 0;
+            bool lost = false;
+            while (!lost && (next < pending.size() || !in_flight.empty())) {
+                if (in_flight.empty()) {
+                    // Bytes nobody waits for, e.g. the late response of a timed out request
+                    discardStale(false);
+                }
+                while (next < pending.size() && static_cast<int>(in_flight.size()) < options_.pipeline_depth) {
+                    size_t index = pending[next++];
+                    if (!sendFrame(buildFrame(requests[index], counts[index]))) {
+                        lost = true;
+                        break;
+                    }
+                    if (requests[index].slave == 0) {
+                        // Broadcasts are not answered
+                        requests[index].success = true;
+                    } else {
+                        in_flight.push_back(index);
+                    }
+                }
+                if (lost || in_flight.empty()) {
+                    continue;
+                }
+
+                size_t index = in_flight.front();
+                in_flight.pop_front();
+                ResponseStatus status = readResponse(requests[index], counts[index]);
+                if (status == ResponseStatus::LOST) {
+                    lost = true;
+                } else if (status == ResponseStatus::BROKEN) {
+                    // The responses in flight can't be matched any more, send them again after this one
+                    discardStale(true);
+                    std::vector<size_t> resend;
+                    if (attempts[index]++ < options_.retries) {
+                        resend.push_back(index);
+                    }
+                    resend.insert(resend.end(), in_flight.begin(), in_flight.end());
+                    resend.insert(resend.end(), pending.begin() + next, pending.end());
+                    pending.swap(resend);
+                    next = 0;
+                    in_flight.clear();
+                }
+            }
+        }
+
+        bool all_success = true;
+        std::vector<std::pair<uint32_t, uint16_t>> changes;
+        {
+            std::lock_guard<std::mutex> lock(image_mutex_);
+            for (auto& request : requests) {
+                if (!request.success) {
+                    all_success = false;
+                    continue;
+                }
+                ModbusTable table = tableOf(request.function);
+                const auto& values = isRead(request.function) ? request.result : request.values;
+                for (size_t i = 0; i < values.size(); i++) {
+                    uint16_t value = (isBitFunction(request.function) && values[i]) ? 1 : values[i];
+                    // Broadcast writes are kept under slave 0
+                    uint32_t key = imageKey(request.slave, table, static_cast<uint16_t>(request.address + i));
+                    auto it = image_.find(key);
+                    if (it == image_.end() || it->second != value) {
+                        image_[key] = value;
+                        changes.emplace_back(key, value);
+                    }
+                }
+            }
+        }
+        if (!changes.empty()) {
+            std::lock_guard<std::mutex> lock(callback_mutex_);
+            if (callback_) {
+                for (auto& change : changes) {
+                    callback_(static_cast<uint8_t>(change.first >> 24), static_cast<ModbusTable>((change.first >> 16) & 0xFF),
+                              static_cast<uint16_t>(change.first & 0xFFFF), change.second);
+                }
+            }
+        }
+        return all_success;
+    }
+
+    bool single(ModbusRequest& request) {
+        std::vector<ModbusRequest> requests(1, std::move(request));
+        bool success = transact(requests);
+        request = std::move(requests[0]);
+        s_last_exception = request.exception;
+        return success;
+    }
+
+    void pollLoop() {
+        std::unique_lock<std::mutex> lock(poll_mutex_);
+        while (polling_) {
+            auto now = steady_clock::now();
+            auto wake = now + seconds(1);
+            std::vector<ModbusRequest> requests;
+            for (auto& poll : polls_) {
+                if (poll.next <= now) {
+                    ModbusRequest request;
+                    request.slave = poll.slave;
+                    request.function = readFunctionOf(poll.table);
+                    request.address = poll.address;
+                    request.count = poll.count;
+                    requests.push_back(std::move(request));
+                    poll.next += poll.period;
+                    if (poll.next <= now) {
+                        // Behind the schedule, skip the missed periods
+                        poll.next = now + poll.period;
+                    }
+                }
+                wake = std::min(wake, poll.next);
+            }
+            if (!requests.empty()) {
+                lock.unlock();
+                transact(requests);
+                lock.lock();
+                continue;
+            }
+            poll_cv_.wait_until(lock, wake);
+        }
+    }
+};
+
+ModbusRtuClient::ModbusRtuClient(SerialCommunicationSharedPtr serial, const ModbusRtuOptions& options)
+    : impl_(new Impl(std::move(serial), options)) {}
+
+ModbusRtuClient::~ModbusRtuClient() { stopPolling(); }
+
+uint16_t ModbusRtuClient::crc16(const uint8_t* data, size_t size) {
+    static const std::array<uint16_t, 256> table = makeCrcTable();
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc = static_cast<uint16_t>((crc >> 8) ^ table[(crc ^ data[i]) & 0xFF]);
+    }
+    return crc;
+}
+
+bool ModbusRtuClient::transact(std::vector<ModbusRequest>& requests) { return impl_->transact(requests); }
+
+bool ModbusRtuClient::readCoils(uint8_t slave, uint16_t address, uint16_t count, std::vector<bool>& values) {
+    ModbusRequest request;
+    request.slave = slave;
+    request.function = ModbusFunction::READ_COILS;
+    request.address = address;
+    request.count = count;
+    if (!impl_->single(request)) {
+        return false;
+    }
+    values.assign(request.result.begin(), request.result.end());
+    return true;
+}
+
+bool ModbusRtuClient::readDiscreteInputs(uint8_t slave, uint16_t address, uint16_t count, std::vector<bool>& values) {
+    ModbusRequest request;
+    request.slave = slave;
+    request.function = ModbusFunction::READ_DISCRETE_INPUTS;
+    request.address = address;
+    request.count = count;
+    if (!impl_->single(request)) {
+        return false;
+    }
+    values.assign(request.result.begin(), request.result.end());
+    return true;
+}
+
+bool ModbusRtuClient::readHoldingRegisters(uint8_t slave, uint16_t address, uint16_t count, std::vector<uint16_t>& values) {
+    ModbusRequest request;
+    request.slave = slave;
+    request.function = ModbusFunction::READ_HOLDING_REGISTERS;
+    request.address = address;
+    request.count = count;
+    if (!impl_->single(request)) {
+        return false;
+    }
+    values = std::move(request.result);
+    return true;
+}
+
+bool ModbusRtuClient::readInputRegisters(uint8_t slave, uint16_t address, uint16_t count, std::vector<uint16_t>& values) {
+    ModbusRequest request;
+    request.slave = slave;
+    request.function = ModbusFunction::READ_INPUT_REGISTERS;
+    request.address = address;
+    request.count = count;
+    if (!impl_->single(request)) {
+        return false;
+    }
+    values = std::move(request.result);
+    return true;
+}
+
+bool ModbusRtuClient::writeSingleCoil(uint8_t slave, uint16_t address, bool value) {
+    ModbusRequest request;
+    request.slave = slave;
+    request.function = ModbusFunction::WRITE_SINGLE_COIL;
+    request.address = address;
+    request.values.push_back(value ? 1 : 0);
+    return impl_->single(request);
+}
+
+bool ModbusRtuClient::writeSingleRegister(uint8_t slave, uint16_t address, uint16_t value) {
+    ModbusRequest request;
+    request.slave = slave;
+    request.function = ModbusFunction::WRITE_SINGLE_REGISTER;
+    request.address = address;
+    request.values.push_back(value);
+    return impl_->single(request);
+}
+
+bool ModbusRtuClient::writeMultipleCoils(uint8_t slave, uint16_t address, const std::vector<bool>& values) {
+    ModbusRequest request;
+    request.slave = slave;
+    request.function = ModbusFunction::WRITE_MULTIPLE_COILS;
+    request.address = address;
+    request.values.assign(values.begin(), values.end());
+    return impl_->single(request);
+}
+
+bool ModbusRtuClient::writeMultipleRegisters(uint8_t slave, uint16_t address, const std::vector<uint16_t>& values) {
+    ModbusRequest request;
+    request.slave = slave;
+    request.function = ModbusFunction::WRITE_MULTIPLE_REGISTERS;
+    request.address = address;
+    request.values = values;
+    return impl_->single(request);
+}
+
+uint8_t ModbusRtuClient::getLastException() const { return s_last_exception; }
+
+int ModbusRtuClient::addPoll(uint8_t slave, ModbusTable table, uint16_t address, uint16_t count, int period_ms) {
+    ModbusRequest request;
+    request.function = readFunctionOf(table);
+    request.address = address;
+    request.count = count;
+    if (slave == 0 || slave > 247 || valueCount(request) == 0 || period_ms <= 0) {
+        ELITE_LOG_ERROR("Invalid Modbus poll: slave %d count %d period %d ms", slave, count, period_ms);
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(impl_->poll_mutex_);
+    int id = impl_->next_poll_id_++;
+    impl_->polls_.push_back({id, slave, table, address, count, milliseconds(period_ms), steady_clock::now()});
+    impl_->poll_cv_.notify_all();
+    return id;
+}
+
+void ModbusRtuClient::removePoll(int id) {
+    std::lock_guard<std::mutex> lock(impl_->poll_mutex_);
+    auto& polls = impl_->polls_;
+    polls.erase(std::remove_if(polls.begin(), polls.end(), [id](const Impl::Poll& poll) { return poll.id == id; }), polls.end());
+}
+
+void ModbusRtuClient::startPolling() {
+    std::lock_guard<std::mutex> lock(impl_->poll_mutex_);
+    if (impl_->polling_) {
+        return;
+    }
+    impl_->polling_ = true;
+    impl_->poll_thread_ = std::thread([this]() { impl_->pollLoop(); });
+}
+
+void ModbusRtuClient::stopPolling() {
+    {
+        std::lock_guard<std::mutex> lock(impl_->poll_mutex_);
+        impl_->polling_ = false;
+        impl_->poll_cv_.notify_all();
+    }
+    if (impl_->poll_thread_.joinable()) {
+        impl_->poll_thread_.join();
+    }
+}
+
+bool ModbusRtuClient::getCachedValue(uint8_t slave, ModbusTable table, uint16_t address, uint16_t& value) {
+    std::lock_guard<std::mutex> lock(impl_->image_mutex_);
+    auto it = impl_->image_.find(Impl::imageKey(slave, table, address));
+    if (it == impl_->image_.end()) {
+        return false;
+    }
+    value = it->second;
+    return true;
+}
+
+void ModbusRtuClient::setChangeCallback(ModbusChangeCallback cb) {
+    std::lock_guard<std::mutex> lock(impl_->callback_mutex_);
+    impl_->callback_ = std::move(cb);
+}
+
+}  // namespace ELITE
@@ -4,7 +4,7 @@
 #include <cstdio>
 #include <string>
 
-#include "Common/SshUtils.hpp"
+#include "Common/SshSessionPool.hpp"
 #include "Elite/Log.hpp"
 #include "RemoteUpgrade.hpp"
 
@@ -17,24 +17,32 @@ namespace UPGRADE
 {
 
 bool upgradeControlSoftware(std::string ip, std::string file, std::string password) {
-	auto upload_error_cb = [&](int f_z, int r_z, const char* err) {
+	// The upload and the commands run on the pooled session of the robot.
+	auto connection = SshSessionPool::instance().acquire(ip, "root", password);
+	if (!connection) {
+		return false;
+	}
+	SshTransfer transfer(connection);
+
+	auto upload_error_cb = [&](uint64_t f_z, uint64_t r_z, const char* err) {
 		if (err) {
-			ELITE_LOG_ERROR("Upload update file fail %d/%d. Reason: %s ", r_z, f_z, err);
+			ELITE_LOG_ERROR("Upload update file fail %llu/%llu. Reason: %s ", static_cast<unsigned long long>(r_z),
+							static_cast<unsigned long long>(f_z), err);
 		}
 	};
-	// Upload update package
-	if (!uploadFile(ip, "root", password, "/tmp/CS_UPDATE.eup", file, upload_error_cb)) {
+	// Upload update package. An interrupted upload is continued, and the package is checked with its SHA-256.
+	if (!transfer.upload(file, "/tmp/CS_UPDATE.eup", upload_error_cb)) {
 		return false;
 	}
 
 	// Add executable permissions to the upgrade package.
 	std::string cmd = "chmod +x /tmp/CS_UPDATE.eup";
-	std::string cmd_out = executeCommand(ip, "root", password, cmd);
+	std::string cmd_out = transfer.execute(cmd);
 	ELITE_LOG_DEBUG("Execute cmd: %s\n Output:%s", cmd.c_str(), cmd_out.c_str());
 
 	// Execute the upgrade package in the bash environment.
 	cmd = "bash -lc '/tmp/CS_UPDATE.eup --app'";
-	cmd_out = executeCommand(ip, "root", password, cmd);
+	cmd_out = transfer.execute(cmd);
 	ELITE_LOG_DEBUG("Execute cmd: %s\n Output:%s", cmd.c_str(), cmd_out.c_str());
 	return true;
 }
@@ -3,17 +3,25 @@
 #include "SerialCommunicationImpl.hpp"
 #include "Log.hpp"
 
+#include <future>
+
 namespace ELITE {
 
+// Receive buffer size. When it is full the reading pauses, and TCP flow control holds the serial data back.
+static constexpr size_t SERIAL_BUFFER_SIZE = 64 * 1024;
+
 SerialCommunicationImpl::SerialCommunicationImpl(int tcp_port, const std::string& ip, int socat_pid)
-    : robot_ip_(ip), tcp_port_(tcp_port), socat_pid_(socat_pid), socket_(io_context_) {}
+    : robot_ip_(ip), tcp_port_(tcp_port), socat_pid_(socat_pid), socket_(io_context_), buffer_(SERIAL_BUFFER_SIZE) {}
 
-SerialCommunicationImpl::~SerialCommunicationImpl() {}
+SerialCommunicationImpl::~SerialCommunicationImpl() { disconnect(); }
 
 bool SerialCommunicationImpl::connect(int timeout_ms) {
+    if (isConnected()) {
+        return true;
+    }
     disconnect();
+    std::lock_guard<std::mutex> lock(socket_mutex_);
     try {
-        std::lock_guard<std::mutex> lock(socket_mutex_);
         socket_.open(boost::asio::ip::tcp::v4());
         boost::asio::ip::tcp::no_delay no_delay_option(true);
         socket_.set_option(no_delay_option);
@@ -26,18 +34,29 @@ bool SerialCommunicationImpl::connect(int timeout_ms) {
         boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address(robot_ip_), tcp_port_);
         auto ec_ptr = std::make_shared<boost::system::error_code>(boost::asio::error::would_block);
         socket_.async_connect(endpoint, [ec_ptr](const boost::system::error_code& error) { *ec_ptr = error; });
-        if (io_context_.stopped()) {
-            io_context_.restart();
-        }
+        io_context_.restart();
         io_context_.run_for(std::chrono::milliseconds(timeout_ms));
         if (*ec_ptr) {
             ELITE_LOG_ERROR("Serial connect to robot fail: %s", boost::system::system_error(*ec_ptr).what());
+            socketDisconnect();
             return false;
         }
     } catch (const boost::system::system_error& error) {
         ELITE_LOG_ERROR("Serial connect to robot fail: %s", error.what());
+        socketDisconnect();
         return false;
     }
+
+    {
+        std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+        buffer_.clear();
+        receiving_ = true;
+        read_paused_ = false;
+    }
+    io_context_.restart();
+    work_guard_.reset(new boost::asio::executor_work_guard<boost::asio::io_context::executor_type>(io_context_.get_executor()));
+    boost::asio::post(io_context_, [this]() { startRead(); });
+    io_thread_ = std::thread([this]() { io_context_.run(); });
     return true;
 }
 
@@ -47,6 +66,16 @@ void SerialCommunicationImpl::disconnect() {
 }
 
 void SerialCommunicationImpl::socketDisconnect() {
+    if (io_thread_.joinable()) {
+        // Close on the io thread, the pending read completes with an error
+        boost::asio::post(io_context_, [this]() {
+            boost::system::error_code ignore_ec;
+            socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignore_ec);
+            socket_.close(ignore_ec);
+        });
+        work_guard_.reset();
+        io_thread_.join();
+    }
     if (!io_context_.stopped()) {
         io_context_.stop();
     }
@@ -57,60 +86,159 @@ void SerialCommunicationImpl::socketDisconnect() {
         socket_.cancel(ignore_ec);
         socket_.close(ignore_ec);
     }
+    {
+        std::lock_guard<std::mutex> buffer_lock(buffer_mutex_);
+        receiving_ = false;
+    }
+    buffer_cv_.notify_all();
 }
 
-bool SerialCommunicationImpl::isConnected() {
-    std::lock_guard<std::mutex> lock(socket_mutex_);
-    if (socket_.is_open()) {
+void SerialCommunicationImpl::startRead() {
+    std::pair<uint8_t*, size_t> span;
+    {
+        std::lock_guard<std::mutex> lock(buffer_mutex_);
+        span = buffer_.writeSpan();
+        if (span.second == 0) {
+            read_paused_ = true;
+            return;
+        }
+    }
+    // Only this read writes into the span, the readers only touch the data before it.
+    socket_.async_read_some(boost::asio::buffer(span.first, span.second),
+                            [this](const boost::system::error_code& ec, std::size_t nb) {
+                                {
+                                    std::lock_guard<std::mutex> lock(buffer_mutex_);
+                                    buffer_.commit(nb);
+                                    if (ec) {
+                                        receiving_ = false;
+                                    }
+                                }
+                                buffer_cv_.notify_all();
+                                if (ec) {
+                                    if (ec != boost::asio::error::operation_aborted) {
+                                        ELITE_LOG_DEBUG("Serial socket receive fail: %s", ec.message().c_str());
+                                    }
+                                    return;
+                                }
+                                startRead();
+                            });
+}
+
+// Called with the buffer lock held, after data was consumed
+void SerialCommunicationImpl::resumeRead() {
+    if (read_paused_ && receiving_) {
+        read_paused_ = false;
+        boost::asio::post(io_context_, [this]() { startRead(); });
+    }
+}
+
+template <typename Pred>
+bool SerialCommunicationImpl::waitData(std::unique_lock<std::mutex>& lock, int timeout_ms, Pred pred) {
+    auto done = [&]() { return pred() || !receiving_; };
+    if (timeout_ms <= 0) {
+        buffer_cv_.wait(lock, done);
         return true;
     }
-    return false;
+    return buffer_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), done);
+}
+
+bool SerialCommunicationImpl::isConnected() {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    return receiving_;
 }
 
 int SerialCommunicationImpl::write(const uint8_t* data, size_t size) {
     std::lock_guard<std::mutex> lock(socket_mutex_);
-    if (!socket_.is_open()) {
+    if (!io_thread_.joinable()) {
         return -1;
     }
-    boost::system::error_code ec;
-    int ret = boost::asio::write(socket_, boost::asio::buffer(data, size), ec);
-
-    if (ec) {
-        ELITE_LOG_DEBUG("Serial socket send fail: %s", ec.message().c_str());
+    // The socket is used on the io thread only
+    std::promise<std::pair<boost::system::error_code, size_t>> result;
+    boost::asio::post(io_context_, [&]() {
+        boost::asio::async_write(socket_, boost::asio::buffer(data, size),
+                                 [&](const boost::system::error_code& ec, std::size_t nb) { result.set_value({ec, nb}); });
+    });
+    auto ret = result.get_future().get();
+    if (ret.first) {
+        ELITE_LOG_DEBUG("Serial socket send fail: %s", ret.first.message().c_str());
         return -1;
     }
-    return ret;
+    return static_cast<int>(ret.second);
 }
 
-int SerialCommunicationImpl::read(uint8_t* data, size_t size, int timeout_ms) {
-    std::lock_guard<std::mutex> lock(socket_mutex_);
-    if (!socket_.is_open()) {
+int SerialCommunicationImpl::read(uint8_t* data, size_t size, int timeout_ms) { return readExact(data, size, timeout_ms); }
+
+int SerialCommunicationImpl::readSome(uint8_t* data, size_t size, int timeout_ms) {
+    if (size == 0) {
+        return 0;
+    }
+    std::unique_lock<std::mutex> lock(buffer_mutex_);
+    waitData(lock, timeout_ms, [&]() { return buffer_.size() > 0; });
+    if (buffer_.size() > 0) {
+        int n = static_cast<int>(buffer_.read(data, size));
+        resumeRead();
+        return n;
+    }
+    return receiving_ ? 0 : -1;
+}
+
+int SerialCommunicationImpl::readUntil(uint8_t* data, size_t size, const std::string& delimiter, int timeout_ms) {
+    if (delimiter.empty()) {
         return -1;
     }
-    int read_len = 0;
-    boost::system::error_code error_code;
-    if (timeout_ms <= 0) {
-        read_len = boost::asio::read(socket_, boost::asio::buffer(data, size), error_code);
-        if (error_code && read_len <= 0) {
-            ELITE_LOG_ERROR("Serial socket receive fail: %s", error_code.message().c_str());
-            return -1;
+    const uint8_t* pattern = reinterpret_cast<const uint8_t*>(delimiter.data());
+    size_t found = ByteRingBuffer::npos;
+    // Bytes already searched, a new search starts where the delimiter may begin
+    size_t searched = 0;
+    std::unique_lock<std::mutex> lock(buffer_mutex_);
+    waitData(lock, timeout_ms, [&]() {
+        found = buffer_.find(pattern, delimiter.size(), searched);
+        if (found != ByteRingBuffer::npos) {
+            return true;
         }
-        return read_len;
-    } else {
-        if (io_context_.stopped()) {
-            io_context_.restart();
+        if (buffer_.size() >= delimiter.size()) {
+            searched = buffer_.size() - delimiter.size() + 1;
         }
-        boost::asio::async_read(socket_, boost::asio::buffer(data, size), [&](const boost::system::error_code& ec, std::size_t nb) {
-            error_code = ec;
-            read_len = nb;
-        });
-        io_context_.run_for(std::chrono::milliseconds(timeout_ms));
-        if (error_code && read_len <= 0) {
-            ELITE_LOG_ERROR("Serial socket receive fail: %s", error_code.message().c_str());
-            return -1;
-        }
-        return read_len;
+        // The delimiter can't fit in the data buffer any more, or can't be received
+        return searched + delimiter.size() > size || buffer_.space() == 0;
+    });
+    if (found != ByteRingBuffer::npos && found + delimiter.size() <= size) {
+        int n = static_cast<int>(buffer_.read(data, found + delimiter.size()));
+        resumeRead();
+        return n;
+    }
+    if (found == ByteRingBuffer::npos && buffer_.space() == 0) {
+        // Nothing more can be received, drop the bytes that can't start a delimiter so the stream resynchronises
+        ELITE_LOG_ERROR("Serial receive buffer is full without a delimiter, %zu bytes dropped", searched);
+        buffer_.consume(searched);
+        resumeRead();
+        return -2;
+    }
+    if (found != ByteRingBuffer::npos || searched + delimiter.size() > size) {
+        ELITE_LOG_DEBUG("Serial delimiter not found in %zu bytes", size);
+        return -1;
     }
+    return receiving_ ? 0 : -1;
+}
+
+int SerialCommunicationImpl::readExact(uint8_t* data, size_t size, int timeout_ms) {
+    if (size > buffer_.capacity()) {
+        ELITE_LOG_ERROR("Serial read size %zu is larger than the receive buffer", size);
+        return -1;
+    }
+    std::unique_lock<std::mutex> lock(buffer_mutex_);
+    waitData(lock, timeout_ms, [&]() { return buffer_.size() >= size; });
+    if (buffer_.size() >= size) {
+        int n = static_cast<int>(buffer_.read(data, size));
+        resumeRead();
+        return n;
+    }
+    return receiving_ ? 0 : -1;
+}
+
+size_t SerialCommunicationImpl::available() {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    return buffer_.size();
 }
 
 }  // namespace ELITE
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "KinematicsBase/ContinuousIkSolver.hpp"
+#include "KinematicsBase/MdhKinematics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ELITE {
+
+namespace {
+
+double maxDistance(const vector6d_t& l, const vector6d_t& r) {
+    double distance = 0;
+    for (size_t i = 0; i < 6; i++) {
+        distance = std::max(distance, std::fabs(l[i] - r[i]));
+    }
+    return distance;
+}
+
+// The rotation vector (axis * angle) of a row-major rotation matrix
+void rotationVector(const double m[9], double* w) {
+    const double cos_angle = std::max(-1.0, std::min(1.0, (m[0] + m[4] + m[8] - 1) / 2));
+    const double angle = std::acos(cos_angle);
+    const double sin_angle = std::sin(angle);
+    if (sin_angle > 1e-6 || angle < 1.0) {
+        // The skew-symmetric part is sin(angle) * axis
+        const double scale = angle < 1e-9 ? 0.5 : angle / (2 * sin_angle);
+        w[0] = (m[7] - m[5]) * scale;
+        w[1] = (m[2] - m[6]) * scale;
+        w[2] = (m[3] - m[1]) * scale;
+        return;
+    }
+    // Close to a half turn the axis is read from the diagonal, m = 2 * axis * axis^T - I
+    size_t k = 0;
+    for (size_t i = 1; i < 3; i++) {
+        if (m[i * 4] > m[k * 4]) {
+            k = i;
+        }
+    }
+    double axis[3];
+    axis[k] = std::sqrt(std::max(0.0, (m[k * 4] + 1) / 2));
+    for (size_t i = 0; i < 3; i++) {
+        if (i != k) {
+            axis[i] = m[i * 3 + k] / (2 * axis[k]);
+        }
+    }
+    for (size_t i = 0; i < 3; i++) {
+        w[i] = axis[i] * angle;
+    }
+}
+
+}  // namespace
+
+ContinuousIkSolver::ContinuousIkSolver(KinematicsBaseSharedPtr kinematics, const ContinuousIkOptions& options)
+    : kinematics_(std::move(kinematics)), options_(options) {
+    if (options_.cache_capacity > 0) {
+        cache_.reset(new IkSolutionCache(options_.cache_capacity, options_.cache_position_resolution,
+                                         options_.cache_orientation_resolution));
+    }
+}
+
+bool ContinuousIkSolver::refactor(const vector6d_t& joints) {
+    if (!kinematics_->getJacobian(joints, jacobian_) ||
+        !JacobianAlgebra::dampedFactor(jacobian_, options_.damping, factor_)) {
+        factored_ = false;
+        return false;
+    }
+    factored_joints_ = joints;
+    factored_ = true;
+    stats_.factorizations++;
+    return true;
+}
+
+bool ContinuousIkSolver::iterate(const vector6d_t& seed, const vector6d_t& pose, vector6d_t& joints, int& budget) {
+    double target[9];
+    MdhKinematics::rpyToRotation(pose[3], pose[4], pose[5], target);
+    joints = seed;
+    double previous_error = std::numeric_limits<double>::infinity();
+    while (true) {
+        vector6d_t current;
+        if (!kinematics_->getPositionFK(joints, current)) {
+            return false;
+        }
+        double r[9];
+        MdhKinematics::rpyToRotation(current[3], current[4], current[5], r);
+        // The twist from the current pose to the target: the position difference and the rotation of target * r^T
+        double m[9];
+        for (size_t row = 0; row < 3; row++) {
+            for (size_t col = 0; col < 3; col++) {
+                m[row * 3 + col] = target[row * 3] * r[col * 3] + target[row * 3 + 1] * r[col * 3 + 1] +
+                                   target[row * 3 + 2] * r[col * 3 + 2];
+            }
+        }
+        vector6d_t error;
+        for (size_t k = 0; k < 3; k++) {
+            error[k] = pose[k] - current[k];
+        }
+        rotationVector(m, &error[3]);
+        const double position_error = std::sqrt(error[0] * error[0] + error[1] * error[1] + error[2] * error[2]);
+        const double orientation_error = std::sqrt(error[3] * error[3] + error[4] * error[4] + error[5] * error[5]);
+        if (position_error <= options_.position_tolerance && orientation_error <= options_.orientation_tolerance) {
+            return true;
+        }
+        if (budget <= 0) {
+            return false;
+        }
+
+        // The kept factorization is refreshed when the joints moved away from it, or when it did not halve the error
+        const double total_error = position_error + orientation_error;
+        const bool slow = total_error > 0.5 * previous_error && factored_joints_ != joints;
+        if (!factored_ || slow || maxDistance(joints, factored_joints_) > options_.jacobian_refresh) {
+            if (!refactor(joints)) {
+                return false;
+            }
+        }
+        previous_error = total_error;
+
+        vector6d_t step;
+        JacobianAlgebra::dampedLeastSquares(jacobian_, factor_, error, step);
+        for (size_t k = 0; k < 6; k++) {
+            joints[k] += step[k];
+        }
+        budget--;
+        stats_.iterations++;
+    }
+}
+
+void ContinuousIkSolver::accept(const vector6d_t& pose, const vector6d_t& solution) {
+    before_previous_ = previous_;
+    previous_ = solution;
+    history_ = std::min(history_ + 1, 2);
+    if (cache_) {
+        cache_->insert(pose, solution);
+    }
+}
+
+bool ContinuousIkSolver::solve(const vector6d_t& pose, const vector6d_t& near, vector6d_t& solution,
+                               KinematicsResult& result) {
+    stats_.calls++;
+    vector6d_t joints;
+    vector6d_t seed;
+    // Shared by the attempts of the call, so a call never takes more than max_iterations steps
+    int budget = options_.max_iterations;
+    if (history_ > 0) {
+        // Constant joint velocity from the two previous solutions
+        seed = previous_;
+        if (history_ > 1) {
+            for (size_t i = 0; i < 6; i++) {
+                seed[i] += previous_[i] - before_previous_[i];
+            }
+        }
+        if (iterate(seed, pose, joints, budget) && maxDistance(joints, previous_) <= options_.max_joint_step) {
+            stats_.warm_solutions++;
+            accept(pose, joints);
+            solution = joints;
+            result.kinematic_error = KinematicError::OK;
+            return true;
+        }
+    } else {
+        seed = near;
+        vector6d_t cached;
+        if (cache_ && cache_->lookup(pose, cached)) {
+            stats_.cache_hits++;
+            if (iterate(cached, pose, joints, budget)) {
+                stats_.cache_solutions++;
+                accept(pose, joints);
+                solution = joints;
+                result.kinematic_error = KinematicError::OK;
+                return true;
+            }
+        } else if (cache_) {
+            stats_.cache_misses++;
+        }
+        // The steps left by a cached seed that did not converge
+        if (iterate(seed, pose, joints, budget) && maxDistance(joints, seed) <= options_.max_joint_step) {
+            stats_.cold_solutions++;
+            accept(pose, joints);
+            solution = joints;
+            result.kinematic_error = KinematicError::OK;
+            return true;
+        }
+    }
+
+    if (!options_.allow_fallback) {
+        stats_.failures++;
+        result.kinematic_error = KinematicError::NO_SOLUTION;
+        return false;
+    }
+    if (!kinematics_->getPositionIK(pose, seed, joints, result)) {
+        stats_.failures++;
+        return false;
+    }
+    stats_.fallbacks++;
+    accept(pose, joints);
+    solution = joints;
+    return true;
+}
+
+void ContinuousIkSolver::reset() {
+    history_ = 0;
+    factored_ = false;
+}
+
+void ContinuousIkSolver::reset(const vector6d_t& joints) {
+    previous_ = joints;
+    history_ = 1;
+    factored_ = false;
+}
+
+void ContinuousIkSolver::clearCache() {
+    if (cache_) {
+        cache_->clear();
+    }
+}
+
+}  // namespace ELITE
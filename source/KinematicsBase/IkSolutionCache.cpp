@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "KinematicsBase/IkSolutionCache.hpp"
+
+#include <cmath>
+
+namespace ELITE {
+
+namespace {
+
+uint64_t mix(uint64_t h, int64_t v) {
+    // splitmix64 of the combined value
+    uint64_t x = h ^ (static_cast<uint64_t>(v) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+}  // namespace
+
+IkSolutionCache::IkSolutionCache(size_t capacity, double position_resolution, double orientation_resolution)
+    : position_resolution_(position_resolution),
+      // A rotation by an angle changes the components of the unit quaternion by about half of it
+      quaternion_resolution_(orientation_resolution / 2) {
+    size_t slots = 1;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+    slots_.resize(slots);
+}
+
+uint64_t IkSolutionCache::cellKey(const vector6d_t& pose) const {
+    const double cr = std::cos(pose[3] / 2), sr = std::sin(pose[3] / 2);
+    const double cp = std::cos(pose[4] / 2), sp = std::sin(pose[4] / 2);
+    const double cy = std::cos(pose[5] / 2), sy = std::sin(pose[5] / 2);
+    double qw = cr * cp * cy + sr * sp * sy;
+    double qx = sr * cp * cy - cr * sp * sy;
+    double qy = cr * sp * cy + sr * cp * sy;
+    double qz = cr * cp * sy - sr * sp * cy;
+    // q and -q are the same rotation. The sign is fixed by the largest component, which is at least 1/2, so rounding
+    // can't flip it the way it flips qw close to 0 at half turns.
+    double q[4] = {qw, qx, qy, qz};
+    size_t largest = 0;
+    for (size_t i = 1; i < 4; i++) {
+        if (std::fabs(q[i]) > std::fabs(q[largest])) {
+            largest = i;
+        }
+    }
+    const double sign = q[largest] < 0 ? -1.0 : 1.0;
+    uint64_t key = 0;
+    for (size_t i = 0; i < 3; i++) {
+        key = mix(key, static_cast<int64_t>(std::floor(pose[i] / position_resolution_)));
+    }
+    // qw is part of the key too, its sign is not fixed any more. The bins are centered on 0, the components of the
+    // common axis aligned rotations, so rounding around 0 stays in one bin.
+    for (size_t i = 0; i < 4; i++) {
+        key = mix(key, static_cast<int64_t>(std::floor(sign * q[i] / quaternion_resolution_ + 0.5)));
+    }
+    return key;
+}
+
+bool IkSolutionCache::lookup(const vector6d_t& pose, vector6d_t& joints) {
+    const uint64_t key = cellKey(pose);
+    const Slot& slot = slots_[key & (slots_.size() - 1)];
+    if (slot.used && slot.key == key) {
+        joints = slot.joints;
+        hits_++;
+        return true;
+    }
+    misses_++;
+    return false;
+}
+
+void IkSolutionCache::insert(const vector6d_t& pose, const vector6d_t& joints) {
+    const uint64_t key = cellKey(pose);
+    Slot& slot = slots_[key & (slots_.size() - 1)];
+    if (!slot.used) {
+        slot.used = true;
+        size_++;
+    }
+    slot.key = key;
+    slot.joints = joints;
+}
+
+void IkSolutionCache::clear() {
+    for (auto& slot : slots_) {
+        slot = Slot();
+    }
+    size_ = 0;
+    hits_ = 0;
+    misses_ = 0;
+}
+
+}  // namespace ELITE
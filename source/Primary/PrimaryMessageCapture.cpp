@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "PrimaryMessageCapture.hpp"
+#include "Log.hpp"
+
+#include <cstring>
+
+namespace ELITE {
+
+namespace {
+constexpr char CAPTURE_MAGIC[8] = {'E', 'L', 'I', 'P', 'C', 'A', 'P', '1'};
+constexpr size_t RECORD_HEAD_LENGTH = sizeof(uint64_t) + sizeof(uint32_t);
+
+void putBigEndian(uint8_t* out, uint64_t value, int bytes) {
+    for (int i = bytes - 1; i >= 0; i--) {
+        out[i] = static_cast<uint8_t>(value & 0xFF);
+        value >>= 8;
+    }
+}
+
+uint64_t getBigEndian(const uint8_t* in, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; i++) {
+        value = (value << 8) | in[i];
+    }
+    return value;
+}
+}  // namespace
+
+bool PrimaryCaptureWriter::open(const std::string& path) {
+    close();
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        ELITE_LOG_ERROR("Open primary capture file \"%s\" fail", path.c_str());
+        return false;
+    }
+    file_.write(CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+    return file_.good();
+}
+
+bool PrimaryCaptureWriter::write(uint64_t timestamp_us, const uint8_t* head, size_t head_len, const uint8_t* body,
+                                 size_t body_len) {
+    if (!file_.is_open()) {
+        return false;
+    }
+    uint8_t record_head[RECORD_HEAD_LENGTH];
+    putBigEndian(record_head, timestamp_us, sizeof(uint64_t));
+    putBigEndian(record_head + sizeof(uint64_t), head_len + body_len, sizeof(uint32_t));
+    file_.write(reinterpret_cast<const char*>(record_head), RECORD_HEAD_LENGTH);
+    file_.write(reinterpret_cast<const char*>(head), head_len);
+    if (body && body_len > 0) {
+        file_.write(reinterpret_cast<const char*>(body), body_len);
+    }
+    return file_.good();
+}
+
+void PrimaryCaptureWriter::close() {
+    if (file_.is_open()) {
+        file_.flush();
+        file_.close();
+    }
+}
+
+bool PrimaryCaptureReader::open(const std::string& path) {
+    file_.open(path, std::ios::binary);
+    if (!file_.is_open()) {
+        ELITE_LOG_ERROR("Open primary capture file \"%s\" fail", path.c_str());
+        return false;
+    }
+    char magic[sizeof(CAPTURE_MAGIC)] = {0};
+    file_.read(magic, sizeof(magic));
+    if (!file_.good() || memcmp(magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)) != 0) {
+        ELITE_LOG_ERROR("\"%s\" is not a primary capture file", path.c_str());
+        file_.close();
+        return false;
+    }
+    return true;
+}
+
+bool PrimaryCaptureReader::next(PrimaryCaptureRecord& record) {
+    if (!file_.is_open()) {
+        return false;
+    }
+    uint8_t record_head[RECORD_HEAD_LENGTH];
+    file_.read(reinterpret_cast<char*>(record_head), RECORD_HEAD_LENGTH);
+    if (file_.gcount() != static_cast<std::streamsize>(RECORD_HEAD_LENGTH)) {
+        return false;
+    }
+    record.timestamp_us = getBigEndian(record_head, sizeof(uint64_t));
+    uint32_t length = static_cast<uint32_t>(getBigEndian(record_head + sizeof(uint64_t), sizeof(uint32_t)));
+    if (length > MAX_RECORD_LENGTH) {
+        ELITE_LOG_ERROR("Primary capture record length %u is too large", length);
+        return false;
+    }
+    record.data.resize(length);
+    file_.read(reinterpret_cast<char*>(record.data.data()), length);
+    return file_.gcount() == static_cast<std::streamsize>(length);
+}
+
+bool PrimaryCaptureReader::load(const std::string& path, std::vector<PrimaryCaptureRecord>& records) {
+    PrimaryCaptureReader reader;
+    if (!reader.open(path)) {
+        return false;
+    }
+    PrimaryCaptureRecord record;
+    while (reader.next(record)) {
+        records.push_back(std::move(record));
+    }
+    return true;
+}
+
+}  // namespace ELITE
@@ -5,33 +5,72 @@
 #include "Log.hpp"
 #include "Utils.hpp"
 
+#include <algorithm>
+
 using namespace std::chrono;
 
 namespace ELITE {
 using namespace std::chrono;
 
-PrimaryPort::PrimaryPort() { message_head_.resize(HEAD_LENGTH); }
+PrimaryPort::PrimaryPort() : socket_async_thread_alive_(false), backoff_(PrimaryReconnectPolicy()) {
+    message_head_.resize(HEAD_LENGTH);
+}
 
 PrimaryPort::~PrimaryPort() { disconnect(); }
 
 bool PrimaryPort::connect(const std::string& ip, int port) {
-    std::lock_guard<std::mutex> lock(socket_mutex_);
-    if (!socketConnect(ip, port)) {
-        return false;
+    bool connected = false;
+    std::function<void(PrimaryConnectionState)> connecting_cb;
+    std::function<void(PrimaryConnectionState)> result_cb;
+    {
+        std::lock_guard<std::mutex> lock(socket_mutex_);
+        connecting_cb = recordConnectionState(PrimaryConnectionState::CONNECTING);
+        {
+            std::lock_guard<std::mutex> health_lock(health_mutex_);
+            metrics_.connect_attempts++;
+        }
+        connected = socketConnect(ip, port);
+        if (!connected) {
+            {
+                std::lock_guard<std::mutex> health_lock(health_mutex_);
+                metrics_.connect_failures++;
+            }
+            result_cb = recordConnectionState(PrimaryConnectionState::DISCONNECTED);
+        } else {
+            {
+                std::lock_guard<std::mutex> health_lock(health_mutex_);
+                backoff_.reset();
+                metrics_.consecutive_failures = 0;
+            }
+            result_cb = recordConnectionState(PrimaryConnectionState::CONNECTED);
+            if (!socket_async_thread_) {
+                // Start async thread
+                socket_async_thread_alive_ = true;
+                socket_async_thread_.reset(
+                    new std::thread([&](std::string ip, int port) { socketAsyncLoop(ip, port); }, ip, port));
+            }
+        }
     }
-    if (!socket_async_thread_) {
-        // Start async thread
-        socket_async_thread_alive_ = true;
-        socket_async_thread_.reset(new std::thread([&](std::string ip, int port) { socketAsyncLoop(ip, port); }, ip, port));
+    // Call outside socket_mutex_, the callbacks may use the port
+    if (connecting_cb) {
+        connecting_cb(PrimaryConnectionState::CONNECTING);
     }
-    return true;
+    if (result_cb) {
+        result_cb(connected ? PrimaryConnectionState::CONNECTED : PrimaryConnectionState::DISCONNECTED);
+    }
+    return connected;
 }
 
 void PrimaryPort::disconnect() {
     // Close socket and set thread flag
     {
-        std::lock_guard<std::mutex> lock(socket_mutex_);
+        // Wake the background thread if it is waiting for the next reconnect attempt
+        std::lock_guard<std::mutex> health_lock(health_mutex_);
         socket_async_thread_alive_ = false;
+    }
+    backoff_cv_.notify_all();
+    {
+        std::lock_guard<std::mutex> lock(socket_mutex_);
         socketDisconnect();
         socket_ptr_.reset();
     }
@@ -39,6 +78,7 @@ void PrimaryPort::disconnect() {
         socket_async_thread_->join();
     }
     socket_async_thread_.reset();
+    setConnectionState(PrimaryConnectionState::DISCONNECTED);
 }
 
 bool PrimaryPort::sendScript(const std::string& script) {
@@ -67,35 +107,177 @@ bool PrimaryPort::getPackage(std::shared_ptr<PrimaryPackage> pkg, int timeout_ms
     return pkg->waitUpdate(timeout_ms);
 }
 
-bool PrimaryPort::parserMessage() {
+void PrimaryPort::subscribePackage(std::shared_ptr<PrimaryPackage> pkg) {
+    if (!pkg) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& pkgs = subscribed_msg_[pkg->getType()];
+    if (std::find(pkgs.begin(), pkgs.end(), pkg) == pkgs.end()) {
+        pkgs.push_back(pkg);
+    }
+}
+
+void PrimaryPort::unsubscribePackage(std::shared_ptr<PrimaryPackage> pkg) {
+    if (!pkg) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = subscribed_msg_.find(pkg->getType());
+    if (iter == subscribed_msg_.end()) {
+        return;
+    }
+    auto& pkgs = iter->second;
+    pkgs.erase(std::remove(pkgs.begin(), pkgs.end(), pkg), pkgs.end());
+    if (pkgs.empty()) {
+        subscribed_msg_.erase(iter);
+    }
+}
+
+void PrimaryPort::setReconnectPolicy(const PrimaryReconnectPolicy& policy) {
+    std::lock_guard<std::mutex> lock(health_mutex_);
+    backoff_.setPolicy(policy);
+}
+
+PrimaryReconnectPolicy PrimaryPort::getReconnectPolicy() {
+    std::lock_guard<std::mutex> lock(health_mutex_);
+    return backoff_.getPolicy();
+}
+
+PrimaryConnectionState PrimaryPort::getConnectionState() {
+    std::lock_guard<std::mutex> lock(health_mutex_);
+    return metrics_.state;
+}
+
+PrimaryConnectionMetrics PrimaryPort::getConnectionMetrics() {
+    std::lock_guard<std::mutex> lock(health_mutex_);
+    return metrics_;
+}
+
+void PrimaryPort::registerConnectionStateCallback(std::function<void(PrimaryConnectionState)> cb) {
+    std::lock_guard<std::mutex> lock(health_mutex_);
+    connection_state_cb_ = std::move(cb);
+}
+
+void PrimaryPort::setConnectionState(PrimaryConnectionState state) {
+    auto cb = recordConnectionState(state);
+    // Call outside the lock, so the callback can query the metrics
+    if (cb) {
+        cb(state);
+    }
+}
+
+std::function<void(PrimaryConnectionState)> PrimaryPort::recordConnectionState(PrimaryConnectionState state) {
+    std::lock_guard<std::mutex> lock(health_mutex_);
+    if (metrics_.state == state) {
+        return nullptr;
+    }
+    metrics_.state = state;
+    return connection_state_cb_;
+}
+
+bool PrimaryPort::parserMessage(bool& received) {
+    received = false;
     std::lock_guard<std::mutex> lock(socket_mutex_);
     if (!socket_ptr_ || !socket_ptr_->is_open()) {
         return false;
     }
     // Receive package head and parser it
     boost::system::error_code ec;
-    int head_len = boost::asio::read(*socket_ptr_, boost::asio::buffer(message_head_, HEAD_LENGTH), ec);
+    size_t head_len = boost::asio::read(*socket_ptr_, boost::asio::buffer(message_head_, HEAD_LENGTH), ec);
     if (ec) {
-        if (ec == boost::asio::error::would_block) {
+        if (ec != boost::asio::error::would_block) {
+            ELITE_LOG_ERROR("Primary port receive package head had expection: %s", boost::system::system_error(ec).what());
+            return false;
+        }
+        if (head_len == 0) {
             // Data not ready, non blocking mode returns normally
             return true;
-        } else {
-            ELITE_LOG_ERROR("Primary port receive package head had expection: %s", boost::system::system_error(ec).what());
+        }
+        // Only part of the head arrived. Wait for the rest, otherwise the stream loses sync.
+        if (!receiveWithTimeout(message_head_.data() + head_len, HEAD_LENGTH - head_len)) {
+            ELITE_LOG_ERROR("Primary port receive package head fail");
             return false;
         }
     }
+    received = true;
     uint32_t package_len = 0;
     EndianUtils::unpack(message_head_.begin(), package_len);
-    if (package_len <= HEAD_LENGTH) {
-        ELITE_LOG_ERROR("Primary port package len error: %d", package_len);
+    if (package_len <= HEAD_LENGTH || package_len > MAX_PACKAGE_LENGTH) {
+        // Keep the bad head in the capture, it is what reproduces the problem
+        captureMessage(false);
+        ELITE_LOG_ERROR("Primary port package len error: %u", package_len);
         return false;
     }
 
     return parserMessageBody(message_head_[4], package_len);
 }
 
+bool PrimaryPort::receiveWithTimeout(uint8_t* data, size_t len) {
+    boost::system::error_code ec;
+    size_t read_len = 0;
+    boost::asio::async_read(*socket_ptr_, boost::asio::buffer(data, len), [&](boost::system::error_code error, std::size_t n) {
+        ec = error;
+        read_len = n;
+    });
+    if (io_context_.stopped()) {
+        io_context_.restart();
+    }
+    io_context_.run_for(500ms);
+    // If the asynchronous operation completed successfully then the io_context
+    // would have been stopped due to running out of work. If it was not
+    // stopped, then the io_context::run_for call must have timed out.
+    if (!io_context_.stopped()) {
+        ELITE_LOG_ERROR("Primary port receive timeout");
+        io_context_.stop();
+        return false;
+    }
+    if (ec) {
+        ELITE_LOG_ERROR("Primary port receive had expection: %s", boost::system::system_error(ec).what());
+        return false;
+    }
+    if (read_len != len) {
+        ELITE_LOG_ERROR("Primary port receive data length not match. Receive:%zu, expect:%zu", read_len, len);
+        return false;
+    }
+    return true;
+}
+
+void PrimaryPort::captureMessage(bool with_body) {
+    std::lock_guard<std::mutex> lock(capture_mutex_);
+    if (!capture_) {
+        return;
+    }
+    uint64_t timestamp_us = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+    if (with_body) {
+        capture_->write(timestamp_us, message_head_.data(), HEAD_LENGTH, message_body_.data(), message_body_.size());
+    } else {
+        capture_->write(timestamp_us, message_head_.data(), HEAD_LENGTH);
+    }
+}
+
+bool PrimaryPort::startCapture(const std::string& path) {
+    auto writer = std::make_unique<PrimaryCaptureWriter>();
+    if (!writer->open(path)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(capture_mutex_);
+    capture_ = std::move(writer);
+    return true;
+}
+
+void PrimaryPort::stopCapture() {
+    std::lock_guard<std::mutex> lock(capture_mutex_);
+    capture_.reset();
+}
+
 RobotErrorSharedPtr PrimaryPort::parserRobotError(uint64_t timestamp, RobotError::Source source,
                                                   const std::vector<uint8_t>& msg_body, int offset) {
+    // code, sub code, level, data type and a 4 bytes data, except the string type whose data may be empty
+    if (msg_body.size() < offset + sizeof(int32_t) * 4) {
+        ELITE_LOG_ERROR("Primary port robot error package too short: %zu", msg_body.size());
+        return nullptr;
+    }
     int32_t code = 0;
     EndianUtils::unpack(msg_body.begin() + offset, code);
     offset += sizeof(int32_t);
@@ -112,6 +294,12 @@ RobotErrorSharedPtr PrimaryPort::parserRobotError(uint64_t timestamp, RobotError
     EndianUtils::unpack(msg_body.begin() + offset, data_type);
     offset += sizeof(uint32_t);
 
+    if (static_cast<RobotError::DataType>(data_type) != RobotError::DataType::STRING &&
+        msg_body.size() < offset + sizeof(uint32_t)) {
+        ELITE_LOG_ERROR("Primary port robot error package too short: %zu", msg_body.size());
+        return nullptr;
+    }
+
     switch ((RobotError::DataType)data_type) {
         case RobotError::DataType::NONE:
         case RobotError::DataType::UNSIGNED:
@@ -154,6 +342,10 @@ RobotErrorSharedPtr PrimaryPort::parserRobotError(uint64_t timestamp, RobotError
 
 RobotRuntimeExceptionSharedPtr PrimaryPort::paraserRuntimeException(uint64_t timestamp, const std::vector<uint8_t>& msg_body,
                                                                     int offset) {
+    if (msg_body.size() < offset + sizeof(int32_t) * 2) {
+        ELITE_LOG_ERROR("Primary port runtime exception package too short: %zu", msg_body.size());
+        return nullptr;
+    }
     int32_t line;
     EndianUtils::unpack(msg_body.begin() + offset, line);
     offset += sizeof(int32_t);
@@ -171,6 +363,11 @@ RobotRuntimeExceptionSharedPtr PrimaryPort::paraserRuntimeException(uint64_t tim
 }
 
 RobotExceptionSharedPtr PrimaryPort::parserException(const std::vector<uint8_t>& msg_body) {
+    // timestamp + source + type
+    if (msg_body.size() < sizeof(uint64_t) + 2) {
+        ELITE_LOG_ERROR("Primary port exception package too short: %zu", msg_body.size());
+        return nullptr;
+    }
     uint64_t timestamp;
     int offset = 0;
     EndianUtils::unpack<uint64_t>(msg_body.begin(), timestamp);
@@ -193,53 +390,17 @@ RobotExceptionSharedPtr PrimaryPort::parserException(const std::vector<uint8_t>&
 }
 
 bool PrimaryPort::parserMessageBody(int type, int package_len) {
-    boost::system::error_code ec;
-    int body_len = package_len - HEAD_LENGTH;
-    int read_len = 0;
-    message_body_.resize(body_len);
-
+    message_body_.resize(package_len - HEAD_LENGTH);
     // Receive package body
-    boost::asio::async_read(*socket_ptr_, boost::asio::buffer(message_body_, body_len),
-                            [&](boost::system::error_code error, std::size_t n) {
-                                ec = error;
-                                read_len = n;
-                            });
-    if (io_context_.stopped()) {
-        io_context_.restart();
-    }
-    io_context_.run_for(500ms);
-    if (ec) {
-        ELITE_LOG_ERROR("Primary port receive package body had expection: %s", boost::system::system_error(ec).what());
-        return false;
-    }
-    if (read_len != body_len) {
-        ELITE_LOG_ERROR("Primary port receive package body data length not match. Receive:%d, expect:%d", read_len, body_len);
+    if (!receiveWithTimeout(message_body_.data(), message_body_.size())) {
+        ELITE_LOG_ERROR("Primary port receive package body fail");
         return false;
     }
+    captureMessage(true);
 
-    // If the asynchronous operation completed successfully then the io_context
-    // would have been stopped due to running out of work. If it was not
-    // stopped, then the io_context::run_for call must have timed out.
-    if (!io_context_.stopped()) {
-        ELITE_LOG_ERROR("Primary port receive package body timeout");
-        io_context_.stop();
-        return false;
-    }
     // If RobotState message parser others don't do anything.
     if (type == ROBOT_STATE_MSG_TYPE) {
-        uint32_t sub_len = 0;
-        for (auto iter = message_body_.begin(); iter < message_body_.end(); iter += sub_len) {
-            EndianUtils::unpack(iter, sub_len);
-            int sub_type = *(iter + 4);
-
-            std::lock_guard<std::mutex> lock(mutex_);
-            auto psm = parser_sub_msg_.find(sub_type);
-            if (psm != parser_sub_msg_.end()) {
-                psm->second->parser(sub_len, iter);
-                psm->second->notifyUpated();
-                parser_sub_msg_.erase(sub_type);
-            }
-        }
+        parserRobotState();
     } else if (type == ROBOT_EXCEPTION_MSG_TYPE) {
         if (robot_exception_cb_) {
             RobotExceptionSharedPtr ex = parserException(message_body_);
@@ -251,28 +412,158 @@ bool PrimaryPort::parserMessageBody(int type, int package_len) {
     return true;
 }
 
-bool PrimaryPort::socketReconnect(const std::string& ip, int port, bool is_last_connect_success) {
-    // Disconnect and reconnect
-    std::lock_guard<std::mutex> lock(socket_mutex_);
-    socketDisconnect();
-    return socketConnect(ip, port, is_last_connect_success);
+void PrimaryPort::parserRobotState() {
+    size_t offset = 0;
+    while (offset + SUB_HEAD_LENGTH <= message_body_.size()) {
+        uint32_t sub_len = 0;
+        auto iter = message_body_.cbegin() + offset;
+        EndianUtils::unpack(iter, sub_len);
+        // A broken length would loop forever (0) or make the parsers read past the body
+        if (sub_len < SUB_HEAD_LENGTH || sub_len > message_body_.size() - offset) {
+            ELITE_LOG_ERROR("Primary port sub-package len error: %u, remain: %zu", sub_len, message_body_.size() - offset);
+            return;
+        }
+        int sub_type = *(iter + 4);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto psm = parser_sub_msg_.find(sub_type);
+        if (psm != parser_sub_msg_.end()) {
+            psm->second->parser(sub_len, iter);
+            psm->second->notifyUpated();
+            parser_sub_msg_.erase(psm);
+        }
+        auto subscribed = subscribed_msg_.find(sub_type);
+        if (subscribed != subscribed_msg_.end()) {
+            for (auto& pkg : subscribed->second) {
+                pkg->parser(sub_len, iter);
+                pkg->notifyUpated();
+            }
+        }
+        offset += sub_len;
+    }
+}
+
+void PrimaryPort::onConnectionLost() {
+    std::function<void(PrimaryConnectionState)> state_cb;
+    {
+        std::lock_guard<std::mutex> lock(health_mutex_);
+        metrics_.disconnections++;
+        metrics_.consecutive_failures = 0;
+        metrics_.state = PrimaryConnectionState::DISCONNECTED;
+        state_cb = connection_state_cb_;
+        connection_lost_time_ = steady_clock::now();
+        backoff_.reset();
+    }
+    if (state_cb) {
+        state_cb(PrimaryConnectionState::DISCONNECTED);
+    }
+
+    auto now = std::chrono::system_clock::now();
+    auto duration = now.time_since_epoch();
+    auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+    auto ex = std::make_shared<RobotException>(RobotException::Type::ROBOT_DISCONNECTED, timestamp);
+    if (robot_exception_cb_) {
+        robot_exception_cb_(ex);
+    }
+}
+
+bool PrimaryPort::waitBackoff(std::chrono::milliseconds delay) {
+    std::unique_lock<std::mutex> lock(health_mutex_);
+    backoff_cv_.wait_for(lock, delay, [this]() { return !socket_async_thread_alive_; });
+    return socket_async_thread_alive_;
+}
+
+bool PrimaryPort::socketReconnect(const std::string& ip, int port) {
+    {
+        std::lock_guard<std::mutex> lock(socket_mutex_);
+        socketDisconnect();
+        socket_ptr_.reset();
+    }
+
+    std::chrono::milliseconds delay;
+    bool is_first_attempt = false;
+    {
+        std::lock_guard<std::mutex> lock(health_mutex_);
+        is_first_attempt = (metrics_.consecutive_failures == 0);
+        delay = backoff_.nextDelay();
+        metrics_.current_backoff_ms = static_cast<int>(delay.count());
+    }
+    setConnectionState(PrimaryConnectionState::BACKOFF);
+    if (!waitBackoff(delay)) {
+        return false;
+    }
+
+    setConnectionState(PrimaryConnectionState::CONNECTING);
+    bool connected = false;
+    {
+        std::lock_guard<std::mutex> lock(socket_mutex_);
+        if (!socket_async_thread_alive_) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> health_lock(health_mutex_);
+            metrics_.connect_attempts++;
+        }
+        // Only the first failure after the connection was lost is logged, to avoid flooding the log.
+        connected = socketConnect(ip, port, is_first_attempt);
+    }
+
+    if (!connected) {
+        std::lock_guard<std::mutex> lock(health_mutex_);
+        metrics_.connect_failures++;
+        metrics_.consecutive_failures++;
+        return false;
+    }
+
+    uint32_t attempts = 0;
+    uint64_t downtime_ms = 0;
+    size_t subscriptions = 0;
+    std::function<void(PrimaryConnectionState)> state_cb;
+    {
+        // Metrics and state change together, so a reader never sees one without the other
+        std::lock_guard<std::mutex> lock(health_mutex_);
+        attempts = metrics_.consecutive_failures + 1;
+        downtime_ms = duration_cast<milliseconds>(steady_clock::now() - connection_lost_time_).count();
+        metrics_.reconnect_successes++;
+        metrics_.consecutive_failures = 0;
+        metrics_.last_downtime_ms = downtime_ms;
+        metrics_.state = PrimaryConnectionState::CONNECTED;
+        state_cb = connection_state_cb_;
+        backoff_.reset();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& sub : subscribed_msg_) {
+            subscriptions += sub.second.size();
+        }
+    }
+    ELITE_LOG_INFO("Primary port reconnected after %u attempts, downtime %llu ms, %zu subscriptions restored", attempts,
+                   static_cast<unsigned long long>(downtime_ms), subscriptions);
+    if (state_cb) {
+        state_cb(PrimaryConnectionState::CONNECTED);
+    }
+    return true;
 }
 
 void PrimaryPort::socketAsyncLoop(const std::string& ip, int port) {
-    bool is_last_connect_success = true;
     while (socket_async_thread_alive_) {
         try {
-            if (!parserMessage()) {
-                auto now = std::chrono::system_clock::now();
-                auto duration = now.time_since_epoch();
-                auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
-                auto ex = std::make_shared<RobotException>(RobotException::Type::ROBOT_DISCONNECTED, timestamp);
-                if (robot_exception_cb_ && is_last_connect_success) {
-                    robot_exception_cb_(ex);
+            bool received = false;
+            if (!parserMessage(received)) {
+                if (!socket_async_thread_alive_) {
+                    break;
+                }
+                if (getConnectionState() == PrimaryConnectionState::CONNECTED) {
+                    onConnectionLost();
                 }
-                is_last_connect_success = socketReconnect(ip, port, is_last_connect_success);
+                // The backoff wait inside paces the loop, no extra sleep.
+                socketReconnect(ip, port);
+                continue;
+            }
+            // Only idle when nothing was received, so bursts are drained at full speed
+            if (!received) {
+                std::this_thread::sleep_for(10ms);
             }
-            std::this_thread::sleep_for(10ms);
         } catch (const std::exception& e) {
             ELITE_LOG_ERROR("Primary port async loop throw exception:%s", e.what());
         }
@@ -296,7 +587,12 @@ bool PrimaryPort::socketConnect(const std::string& ip, int port, bool is_last_co
         if (io_context_.stopped()) {
             io_context_.restart();
         }
-        io_context_.run_for(500ms);
+        int connect_timeout_ms = 0;
+        {
+            std::lock_guard<std::mutex> health_lock(health_mutex_);
+            connect_timeout_ms = backoff_.getPolicy().connect_timeout_ms;
+        }
+        io_context_.run_for(milliseconds(connect_timeout_ms));
         if (connect_ec) {
             socket_ptr_.reset();
             if (is_last_connect_success) {
@@ -44,5 +44,41 @@ void PrimaryPortInterface::registerRobotExceptionCallback(std::function<void(Rob
     impl_->primary_.registerRobotExceptionCallback(cb);
 }
 
+bool PrimaryPortInterface::startCapture(const std::string& path) {
+    return impl_->primary_.startCapture(path);
+}
+
+void PrimaryPortInterface::stopCapture() {
+    impl_->primary_.stopCapture();
+}
+
+void PrimaryPortInterface::subscribePackage(std::shared_ptr<PrimaryPackage> pkg) {
+    impl_->primary_.subscribePackage(pkg);
+}
+
+void PrimaryPortInterface::unsubscribePackage(std::shared_ptr<PrimaryPackage> pkg) {
+    impl_->primary_.unsubscribePackage(pkg);
+}
+
+void PrimaryPortInterface::setReconnectPolicy(const PrimaryReconnectPolicy& policy) {
+    impl_->primary_.setReconnectPolicy(policy);
+}
+
+PrimaryReconnectPolicy PrimaryPortInterface::getReconnectPolicy() {
+    return impl_->primary_.getReconnectPolicy();
+}
+
+PrimaryConnectionState PrimaryPortInterface::getConnectionState() {
+    return impl_->primary_.getConnectionState();
+}
+
+PrimaryConnectionMetrics PrimaryPortInterface::getConnectionMetrics() {
+    return impl_->primary_.getConnectionMetrics();
+}
+
+void PrimaryPortInterface::registerConnectionStateCallback(std::function<void(PrimaryConnectionState)> cb) {
+    impl_->primary_.registerConnectionStateCallback(cb);
+}
+
 } // namespace ELITE
 
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "PrimaryReplayServer.hpp"
+#include "Log.hpp"
+
+#include <chrono>
+
+namespace ELITE {
+
+using namespace std::chrono;
+
+namespace {
+constexpr auto REPLAY_POLL_INTERVAL = milliseconds(2);
+}
+
+PrimaryReplayServer::PrimaryReplayServer(std::vector<PrimaryCaptureRecord> records)
+    : records_(std::move(records)), speed_(0), repeat_(1), running_(false), sent_messages_(0), sessions_(0) {}
+
+PrimaryReplayServer::~PrimaryReplayServer() { stop(); }
+
+int PrimaryReplayServer::start(int port) {
+    stop();
+    try {
+        acceptor_ = std::make_unique<boost::asio::ip::tcp::acceptor>(
+            io_context_, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), port), true);
+        // Non blocking, so the thread can notice stop()
+        acceptor_->non_blocking(true);
+    } catch (const boost::system::system_error& e) {
+        ELITE_LOG_ERROR("Primary replay server listen on port %d fail: %s", port, e.what());
+        acceptor_.reset();
+        return -1;
+    }
+    running_ = true;
+    thread_ = std::make_unique<std::thread>([this]() { serveLoop(); });
+    return getPort();
+}
+
+void PrimaryReplayServer::stop() {
+    running_ = false;
+    {
+        std::lock_guard<std::mutex> lock(client_mutex_);
+        if (client_) {
+            boost::system::error_code ignore_ec;
+            client_->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignore_ec);
+        }
+    }
+    if (thread_ && thread_->joinable()) {
+        thread_->join();
+    }
+    thread_.reset();
+    if (acceptor_) {
+        boost::system::error_code ignore_ec;
+        acceptor_->close(ignore_ec);
+        acceptor_.reset();
+    }
+}
+
+int PrimaryReplayServer::getPort() {
+    if (!acceptor_) {
+        return -1;
+    }
+    boost::system::error_code ec;
+    auto endpoint = acceptor_->local_endpoint(ec);
+    return ec ? -1 : endpoint.port();
+}
+
+void PrimaryReplayServer::serveLoop() {
+    while (running_) {
+        auto client = std::make_shared<boost::asio::ip::tcp::socket>(io_context_);
+        boost::system::error_code ec;
+        acceptor_->accept(*client, ec);
+        if (ec == boost::asio::error::would_block || ec == boost::asio::error::try_again) {
+            std::this_thread::sleep_for(REPLAY_POLL_INTERVAL);
+            continue;
+        } else if (ec) {
+            ELITE_LOG_ERROR("Primary replay server accept fail: %s", ec.message().c_str());
+            return;
+        }
+        // The accepted socket inherits the non blocking mode on some platforms
+        client->non_blocking(false, ec);
+        client->set_option(boost::asio::ip::tcp::no_delay(true), ec);
+        {
+            std::lock_guard<std::mutex> lock(client_mutex_);
+            client_ = client;
+        }
+        sessions_++;
+        replay(client);
+        {
+            std::lock_guard<std::mutex> lock(client_mutex_);
+            boost::system::error_code ignore_ec;
+            client_->close(ignore_ec);
+            client_.reset();
+        }
+    }
+}
+
+void PrimaryReplayServer::replay(std::shared_ptr<boost::asio::ip::tcp::socket> client) {
+    boost::system::error_code ec;
+    for (int round = 0; running_ && (repeat_ <= 0 || round < repeat_); round++) {
+        auto round_start = steady_clock::now();
+        for (size_t i = 0; running_ && i < records_.size(); i++) {
+            if (speed_ > 0 && i > 0) {
+                auto offset_us = static_cast<double>(records_[i].timestamp_us - records_[0].timestamp_us) / speed_;
+                std::this_thread::sleep_until(round_start + microseconds(static_cast<int64_t>(offset_us)));
+            }
+            boost::asio::write(*client, boost::asio::buffer(records_[i].data), ec);
+            if (ec) {
+                // Client left, or the client dropped the connection after a malformed message
+                return;
+            }
+            sent_messages_++;
+        }
+    }
+    // Keep the connection open until the client leaves, like the robot does
+    client->non_blocking(true, ec);
+    uint8_t byte;
+    while (running_) {
+        client->read_some(boost::asio::buffer(&byte, 1), ec);
+        if (ec && ec != boost::asio::error::would_block && ec != boost::asio::error::try_again) {
+            return;
+        }
+        std::this_thread::sleep_for(REPLAY_POLL_INTERVAL);
+    }
+}
+
+}  // namespace ELITE
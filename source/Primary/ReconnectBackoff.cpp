@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ReconnectBackoff.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ELITE {
+
+ReconnectBackoff::ReconnectBackoff(const PrimaryReconnectPolicy& policy, uint32_t seed) : attempts_(0), random_(seed) {
+    setPolicy(policy);
+}
+
+void ReconnectBackoff::setPolicy(const PrimaryReconnectPolicy& policy) {
+    policy_ = policy;
+    policy_.initial_delay_ms = std::max(policy_.initial_delay_ms, 0);
+    policy_.max_delay_ms = std::max(policy_.max_delay_ms, policy_.initial_delay_ms);
+    policy_.multiplier = std::max(policy_.multiplier, 1.0);
+    policy_.jitter = std::min(std::max(policy_.jitter, 0.0), 1.0);
+    policy_.connect_timeout_ms = std::max(policy_.connect_timeout_ms, 1);
+}
+
+std::chrono::milliseconds ReconnectBackoff::nextDelay() {
+    // Stop growing once the cap is reached, so the power can not overflow
+    double base = policy_.initial_delay_ms * std::pow(policy_.multiplier, std::min<uint32_t>(attempts_, 64));
+    base = std::min(base, static_cast<double>(policy_.max_delay_ms));
+    if (attempts_ < UINT32_MAX) {
+        attempts_++;
+    }
+
+    double delay = base;
+    if (policy_.jitter > 0) {
+        std::uniform_real_distribution<double> spread(1.0 - policy_.jitter, 1.0 + policy_.jitter);
+        delay = std::min(base * spread(random_), static_cast<double>(policy_.max_delay_ms));
+    }
+    return std::chrono::milliseconds(static_cast<int64_t>(delay));
+}
+
+}  // namespace ELITE
@@ -49,6 +49,10 @@ namespace ELITE
 
 
 void KinematicsInfo::parser(int len, const std::vector<uint8_t>::const_iterator& iter) {
+    // a, d and alpha of 6 joints
+    if (len < DH_PARAM_OFFSET + static_cast<int>(sizeof(double)) * 6 * 3) {
+        return;
+    }
     int offset = DH_PARAM_OFFSET;
     for (size_t i = 0; i < 6; i++) {
         EndianUtils::unpack(iter + offset, dh_a_[i]);
@@ -64,6 +68,31 @@ void KinematicsInfo::parser(int len, const std::vector<uint8_t>::const_iterator&
     }
 }
 
+void JointLimitsInfo::parser(int len, const std::vector<uint8_t>::const_iterator& iter) {
+    // Position, velocity and acceleration limits of 6 joints and 5 defaults
+    if (len < LIMITS_OFFSET + static_cast<int>(sizeof(double)) * (6 * 4 + 5)) {
+        return;
+    }
+    int offset = LIMITS_OFFSET;
+    for (size_t i = 0; i < 6; i++) {
+        EndianUtils::unpack(iter + offset, joint_min_[i]);
+        offset += sizeof(double);
+        EndianUtils::unpack(iter + offset, joint_max_[i]);
+        offset += sizeof(double);
+    }
+    for (size_t i = 0; i < 6; i++) {
+        EndianUtils::unpack(iter + offset, max_velocity_[i]);
+        offset += sizeof(double);
+        EndianUtils::unpack(iter + offset, max_acceleration_[i]);
+        offset += sizeof(double);
+    }
+    double* defaults[] = {&default_velocity_, &default_acceleration_, &default_tool_velocity_, &default_tool_acceleration_,
+                          &eq_radius_};
+    for (double* value : defaults) {
+        EndianUtils::unpack(iter + offset, *value);
+        offset += sizeof(double);
+    }
+}
 
 
 } // namespace ELITE
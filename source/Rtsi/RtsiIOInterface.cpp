@@ -18,14 +18,16 @@ RtsiIOInterface::RtsiIOInterface(const std::string& output_recipe_file, const st
     : output_recipe_string_(readRecipe(output_recipe_file)),
       input_recipe_string_(readRecipe(input_recipe_file)),
       target_frequency_(frequency),
-      input_new_cmd_(false) {}
+      input_new_cmd_(false),
+      update_count_(0) {}
 
 RtsiIOInterface::RtsiIOInterface(const std::vector<std::string>& output_recipe, const std::vector<std::string>& input_recipe,
                                  double frequency)
     : output_recipe_string_(output_recipe),
       input_recipe_string_(input_recipe),
       target_frequency_(frequency),
-      input_new_cmd_(false) {}
+      input_new_cmd_(false),
+      update_count_(0) {}
 
 RtsiIOInterface::~RtsiIOInterface() { disconnect(); }
 
@@ -99,9 +101,31 @@ void RtsiIOInterface::disconnect() {
         is_recv_thread_alive_ = false;
         recv_thread_->join();
     }
+    notifyUpdate(false);
     RtsiClientInterface::disconnect();
 }
 
+bool RtsiIOInterface::waitForUpdate(unsigned timeout_ms) {
+    std::unique_lock<std::mutex> lock(update_mutex_);
+    if (!is_recv_thread_alive_) {
+        return false;
+    }
+    uint64_t count = update_count_;
+    update_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                        [&]() { return update_count_ != count || !is_recv_thread_alive_; });
+    return update_count_ != count;
+}
+
+void RtsiIOInterface::notifyUpdate(bool received) {
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        if (received) {
+            update_count_++;
+        }
+    }
+    update_cv_.notify_all();
+}
+
 bool RtsiIOInterface::isConnected() { return is_recv_thread_alive_ && RtsiClientInterface::isConnected(); }
 
 bool RtsiIOInterface::isStarted() { return is_recv_thread_alive_ && RtsiClientInterface::isStarted(); }
@@ -649,7 +673,9 @@ void RtsiIOInterface::recvLoop() {
     while (is_recv_thread_alive_) {
         try {
             if (output_recipe_) {
-                receiveData(output_recipe_, false);
+                if (receiveData(output_recipe_, false)) {
+                    notifyUpdate(true);
+                }
             } else {
                 std::this_thread::sleep_for(std::chrono::milliseconds((uint64_t)period_ms));
             }
@@ -663,5 +689,6 @@ void RtsiIOInterface::recvLoop() {
         }
     }
     is_recv_thread_alive_ = false;
+    notifyUpdate(false);
     ELITE_LOG_INFO("RTSI IO interface sync thread dropped");
 }
@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "Trajectory/PathSimplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ELITE {
+
+namespace {
+
+// Shorter segments and smaller angles are treated as 0
+constexpr double LENGTH_EPSILON = 1e-9;
+
+bool isFinite(const vector6d_t& v) {
+    for (double x : v) {
+        if (!std::isfinite(x)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Parameter of the point of the segment a-b closest to p, on the first n coordinates
+double project(const vector6d_t& a, const vector6d_t& b, const vector6d_t& p, size_t n, double& length_squared) {
+    double dot = 0;
+    length_squared = 0;
+    for (size_t j = 0; j < n; j++) {
+        dot += (p[j] - a[j]) * (b[j] - a[j]);
+        length_squared += (b[j] - a[j]) * (b[j] - a[j]);
+    }
+    return length_squared > LENGTH_EPSILON * LENGTH_EPSILON ? std::min(1.0, std::max(0.0, dot / length_squared)) : 0.0;
+}
+
+double positionDistance(const vector6d_t& a, const vector6d_t& b) {
+    return std::sqrt((a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) + (a[2] - b[2]) * (a[2] - b[2]));
+}
+
+// Rotation angle between two orientations
+double angle(const QuaternionPose& a, const QuaternionPose& b) {
+    const QuaternionPose d = a.inverse() * b;
+    const double sin_half = std::sqrt(d.orientation[1] * d.orientation[1] + d.orientation[2] * d.orientation[2] +
+                                      d.orientation[3] * d.orientation[3]);
+    return 2 * std::atan2(sin_half, std::fabs(d.orientation[0]));
+}
+
+}  // namespace
+
+PathSimplifier::PathSimplifier(const PathSimplifierOptions& options, KinematicsBaseSharedPtr kinematics)
+    : options_(options), kinematics_(std::move(kinematics)) {}
+
+bool PathSimplifier::deviation(const std::vector<vector6d_t>& points, bool cartesian, size_t first, size_t last, size_t i,
+                               double& joint, double& position, double& orientation) const {
+    const vector6d_t& a = points[first];
+    const vector6d_t& b = points[last];
+    const vector6d_t& p = points[i];
+    double length_squared;
+    if (cartesian) {
+        // movel: the position moves on the segment and the orientation is interpolated on the shortest arc
+        double t = project(a, b, p, 3, length_squared);
+        if (length_squared <= LENGTH_EPSILON * LENGTH_EPSILON) {
+            // A rotation in place
+            const double total = angle(orientations_[first], orientations_[last]);
+            t = total > LENGTH_EPSILON ? std::min(1.0, angle(orientations_[first], orientations_[i]) / total) : 0.0;
+        }
+        vector6d_t on_segment;
+        for (size_t j = 0; j < 3; j++) {
+            on_segment[j] = a[j] + t * (b[j] - a[j]);
+        }
+        joint = 0;
+        position = positionDistance(p, on_segment);
+        orientation =
+            angle(orientations_[i], QuaternionPose::interpolate(orientations_[first], orientations_[last], t));
+        return true;
+    }
+
+    // movej: the joints move on the segment
+    const double t = project(a, b, p, 6, length_squared);
+    vector6d_t on_segment;
+    joint = 0;
+    for (size_t j = 0; j < 6; j++) {
+        on_segment[j] = a[j] + t * (b[j] - a[j]);
+        joint = std::max(joint, std::fabs(p[j] - on_segment[j]));
+    }
+    position = 0;
+    orientation = 0;
+    if (kinematics_) {
+        vector6d_t tcp;
+        if (!kinematics_->getPositionFK(on_segment, tcp)) {
+            return false;
+        }
+        position = positionDistance(tcp_[i], tcp);
+    }
+    return true;
+}
+
+double PathSimplifier::blendRadius(const std::vector<vector6d_t>& points, bool cartesian, size_t previous, size_t current,
+                                   size_t next) const {
+    const vector6d_t& p = tcp_[current];
+    const double previous_length = positionDistance(tcp_[previous], p);
+    const double next_length = positionDistance(tcp_[next], p);
+    if (previous_length < LENGTH_EPSILON || next_length < LENGTH_EPSILON) {
+        return 0;
+    }
+    // The blend leaves the segments within the radius of the corner. Its farthest point from the corner is about
+    // radius * cos(corner / 2) / 2 away, with corner the angle between the two segments (pi for a straight path).
+    double cos_corner = 0;
+    for (size_t j = 0; j < 3; j++) {
+        cos_corner += (tcp_[previous][j] - p[j]) * (tcp_[next][j] - p[j]);
+    }
+    cos_corner /= previous_length * next_length;
+    const double cos_half = std::sqrt(std::max(0.0, (1 + cos_corner) / 2));
+    const SegmentDeviation& before = segment_deviations_[previous];
+    const SegmentDeviation& after = segment_deviations_[current];
+    const double budget = options_.position_tolerance - std::max(before.position, after.position);
+    double radius = std::min(options_.max_blend_radius, 0.5 * std::min(previous_length, next_length));
+    if (cos_half > LENGTH_EPSILON) {
+        radius = std::min(radius, 2 * budget / cos_half);
+    }
+
+    // The blend moves the joints (or the orientation) from where it enters the first segment to where it leaves the
+    // second one, about radius / length of the way from the point on each segment. Its deviation from the point is at
+    // most the larger of the two moves.
+    if (cartesian) {
+        const double orientation_budget =
+            options_.orientation_tolerance - std::max(before.orientation, after.orientation);
+        const double previous_angle = angle(orientations_[previous], orientations_[current]);
+        const double next_angle = angle(orientations_[current], orientations_[next]);
+        if (previous_angle > LENGTH_EPSILON) {
+            radius = std::min(radius, orientation_budget * previous_length / previous_angle);
+        }
+        if (next_angle > LENGTH_EPSILON) {
+            radius = std::min(radius, orientation_budget * next_length / next_angle);
+        }
+    } else {
+        const double joint_budget = options_.joint_tolerance - std::max(before.joint, after.joint);
+        double previous_move = 0;
+        double next_move = 0;
+        for (size_t j = 0; j < 6; j++) {
+            previous_move = std::max(previous_move, std::fabs(points[current][j] - points[previous][j]));
+            next_move = std::max(next_move, std::fabs(points[next][j] - points[current][j]));
+        }
+        if (previous_move > LENGTH_EPSILON) {
+            radius = std::min(radius, joint_budget * previous_length / previous_move);
+        }
+        if (next_move > LENGTH_EPSILON) {
+            radius = std::min(radius, joint_budget * next_length / next_move);
+        }
+    }
+    return std::max(0.0, radius);
+}
+
+bool PathSimplifier::simplify(const std::vector<vector6d_t>& points, bool cartesian,
+                              std::vector<SimplifiedWaypoint>& waypoints) {
+    stats_ = PathSimplifierStats();
+    const size_t n = points.size();
+    if (n < 2 || !(options_.joint_tolerance > 0) || !(options_.position_tolerance > 0) ||
+        !(options_.orientation_tolerance > 0) || !(options_.blend_share >= 0 && options_.blend_share < 1) ||
+        !(options_.max_blend_radius >= 0)) {
+        return false;
+    }
+    for (const auto& point : points) {
+        if (!isFinite(point)) {
+            return false;
+        }
+    }
+
+    const bool has_tcp = cartesian || kinematics_;
+    if (cartesian) {
+        tcp_ = points;
+        orientations_.resize(n);
+        QuaternionPose::fromRpyBatch(points.data(), orientations_.data(), n);
+    } else if (kinematics_) {
+        tcp_.resize(n);
+        if (!kinematics_->getPositionFKBatch(points.data(), tcp_.data(), n)) {
+            return false;
+        }
+    }
+
+    // Douglas-Peucker with an explicit stack. When the points get blends, the decimation leaves blend_share of each
+    // tolerance to them.
+    const double decimation_share = has_tcp ? 1 - options_.blend_share : 1.0;
+    const double joint_tolerance = options_.joint_tolerance * decimation_share;
+    const double position_tolerance = options_.position_tolerance * decimation_share;
+    const double orientation_tolerance = options_.orientation_tolerance * decimation_share;
+    keep_.assign(n, 0);
+    keep_.front() = keep_.back() = 1;
+    segment_deviations_.assign(n, SegmentDeviation());
+    stack_.clear();
+    stack_.emplace_back(0, n - 1);
+    while (!stack_.empty()) {
+        const size_t first = stack_.back().first;
+        const size_t last = stack_.back().second;
+        stack_.pop_back();
+
+        size_t worst = first;
+        double worst_scaled = 0;
+        double max_joint = 0;
+        double max_position = 0;
+        double max_orientation = 0;
+        for (size_t i = first + 1; i < last; i++) {
+            double joint;
+            double position;
+            double orientation;
+            if (!deviation(points, cartesian, first, last, i, joint, position, orientation)) {
+                return false;
+            }
+            double scaled = has_tcp ? position / position_tolerance : 0.0;
+            scaled = std::max(scaled, cartesian ? orientation / orientation_tolerance : joint / joint_tolerance);
+            if (scaled > worst_scaled) {
+                worst_scaled = scaled;
+                worst = i;
+            }
+            max_joint = std::max(max_joint, joint);
+            max_position = std::max(max_position, position);
+            max_orientation = std::max(max_orientation, orientation);
+        }
+        if (worst_scaled > 1) {
+            keep_[worst] = 1;
+            stack_.emplace_back(first, worst);
+            stack_.emplace_back(worst, last);
+            continue;
+        }
+        segment_deviations_[first] = {max_joint, max_position, max_orientation};
+        stats_.max_joint_deviation = std::max(stats_.max_joint_deviation, max_joint);
+        stats_.max_position_deviation = std::max(stats_.max_position_deviation, max_position);
+        stats_.max_orientation_deviation = std::max(stats_.max_orientation_deviation, max_orientation);
+    }
+
+    waypoints.clear();
+    for (size_t i = 0; i < n; i++) {
+        if (keep_[i]) {
+            SimplifiedWaypoint waypoint;
+            waypoint.positions = points[i];
+            waypoint.index = i;
+            waypoints.push_back(waypoint);
+        }
+    }
+    if (has_tcp) {
+        for (size_t k = 1; k + 1 < waypoints.size(); k++) {
+            waypoints[k].blend_radius =
+                blendRadius(points, cartesian, waypoints[k - 1].index, waypoints[k].index, waypoints[k + 1].index);
+        }
+    }
+    stats_.input_points = n;
+    stats_.output_points = waypoints.size();
+    return true;
+}
+
+}  // namespace ELITE
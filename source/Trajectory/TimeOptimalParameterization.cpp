@@ -0,0 +1,308 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "Trajectory/TimeOptimalParameterization.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ELITE {
+
+namespace {
+
+// A path derivative below this does not bound the path speed or acceleration
+constexpr double DERIVATIVE_EPSILON = 1e-12;
+
+// Consecutive waypoints closer than this are one knot, in rad
+constexpr double DUPLICATE_DISTANCE = 1e-12;
+
+bool isFinite(const vector6d_t& v) {
+    for (double x : v) {
+        if (!std::isfinite(x)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool isPositive(const vector6d_t& v) {
+    for (double x : v) {
+        if (!(x > 0) || !std::isfinite(x)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double distance(const vector6d_t& l, const vector6d_t& r) {
+    double sum = 0;
+    for (size_t j = 0; j < 6; j++) {
+        sum += (l[j] - r[j]) * (l[j] - r[j]);
+    }
+    return std::sqrt(sum);
+}
+
+// The bounds of the path acceleration u at the squared path speed x, from |second * x + first * u| <= max_acceleration
+void accelerationBounds(const vector6d_t& first, const vector6d_t& second, const vector6d_t& max_acceleration, double x,
+                        double& u_min, double& u_max) {
+    for (size_t j = 0; j < 6; j++) {
+        if (std::fabs(first[j]) < DERIVATIVE_EPSILON) {
+            continue;
+        }
+        const double low = (-max_acceleration[j] - second[j] * x) / first[j];
+        const double high = (max_acceleration[j] - second[j] * x) / first[j];
+        u_min = std::max(u_min, std::min(low, high));
+        u_max = std::min(u_max, std::max(low, high));
+    }
+}
+
+}  // namespace
+
+TimeOptimalParameterization::TimeOptimalParameterization(const TimeOptimalOptions& options) : options_(options) {}
+
+bool TimeOptimalParameterization::buildSpline(const std::vector<vector6d_t>& waypoints) {
+    knots_.clear();
+    points_.clear();
+    waypoint_knots_.clear();
+    for (const auto& waypoint : waypoints) {
+        if (!isFinite(waypoint)) {
+            return false;
+        }
+        if (points_.empty()) {
+            knots_.push_back(0);
+            points_.push_back(waypoint);
+        } else {
+            const double length = distance(points_.back(), waypoint);
+            if (length > DUPLICATE_DISTANCE) {
+                knots_.push_back(knots_.back() + length);
+                points_.push_back(waypoint);
+            }
+        }
+        waypoint_knots_.push_back(points_.size() - 1);
+    }
+    const size_t n = points_.size();
+    if (n < 2) {
+        return false;
+    }
+
+    // Natural cubic spline: the second derivatives at the inner knots solve a tridiagonal system, the same for all the
+    // joints. Thomas algorithm, the eliminated upper diagonal is kept in scratch_ and the right-hand sides are reduced
+    // in place in second_derivatives_.
+    second_derivatives_.assign(n, vector6d_t{});
+    scratch_.assign(n, 0.0);
+    for (size_t i = 1; i + 1 < n; i++) {
+        const double h0 = knots_[i] - knots_[i - 1];
+        const double h1 = knots_[i + 1] - knots_[i];
+        const double pivot = 2 * (h0 + h1) - h0 * scratch_[i - 1];
+        scratch_[i] = h1 / pivot;
+        for (size_t j = 0; j < 6; j++) {
+            const double rhs = 6 * ((points_[i + 1][j] - points_[i][j]) / h1 - (points_[i][j] - points_[i - 1][j]) / h0);
+            second_derivatives_[i][j] = (rhs - h0 * second_derivatives_[i - 1][j]) / pivot;
+        }
+    }
+    for (size_t i = n - 2; i >= 1; i--) {
+        for (size_t j = 0; j < 6; j++) {
+            second_derivatives_[i][j] -= scratch_[i] * second_derivatives_[i + 1][j];
+        }
+    }
+    return true;
+}
+
+void TimeOptimalParameterization::buildGrid() {
+    grid_.clear();
+    grid_segments_.clear();
+    knot_grid_.clear();
+    const size_t segments = knots_.size() - 1;
+    for (size_t k = 0; k < segments; k++) {
+        const double h = knots_[k + 1] - knots_[k];
+        size_t pieces = static_cast<size_t>(std::ceil(h / options_.grid_step));
+        // A path of one segment gets an inner grid point, the speed is 0 at both ends
+        pieces = std::max<size_t>(pieces, segments == 1 ? 2 : 1);
+        knot_grid_.push_back(grid_.size());
+        for (size_t p = 0; p < pieces; p++) {
+            grid_.push_back(knots_[k] + h * p / pieces);
+            grid_segments_.push_back(k);
+        }
+    }
+    knot_grid_.push_back(grid_.size());
+    grid_.push_back(knots_.back());
+    grid_segments_.push_back(segments - 1);
+}
+
+void TimeOptimalParameterization::evaluate(size_t segment, double s, vector6d_t* position, vector6d_t* first,
+                                           vector6d_t* second) const {
+    const double h = knots_[segment + 1] - knots_[segment];
+    const double a = knots_[segment + 1] - s;
+    const double b = s - knots_[segment];
+    const vector6d_t& q0 = points_[segment];
+    const vector6d_t& q1 = points_[segment + 1];
+    const vector6d_t& m0 = second_derivatives_[segment];
+    const vector6d_t& m1 = second_derivatives_[segment + 1];
+    for (size_t j = 0; j < 6; j++) {
+        const double c0 = q0[j] / h - m0[j] * h / 6;
+        const double c1 = q1[j] / h - m1[j] * h / 6;
+        if (position) {
+            (*position)[j] = (m0[j] * a * a * a + m1[j] * b * b * b) / (6 * h) + c0 * a + c1 * b;
+        }
+        if (first) {
+            (*first)[j] = (m1[j] * b * b - m0[j] * a * a) / (2 * h) + c1 - c0;
+        }
+        if (second) {
+            (*second)[j] = (m0[j] * a + m1[j] * b) / h;
+        }
+    }
+}
+
+bool TimeOptimalParameterization::compute(const std::vector<vector6d_t>& waypoints) {
+    times_.clear();
+    waypoint_times_.clear();
+    if (!isPositive(options_.max_velocity) || !isPositive(options_.max_acceleration) || !(options_.velocity_scale > 0) ||
+        !(options_.acceleration_scale > 0) || !(options_.grid_step > 0)) {
+        return false;
+    }
+    if (!buildSpline(waypoints)) {
+        return false;
+    }
+    buildGrid();
+
+    vector6d_t max_velocity;
+    vector6d_t max_acceleration;
+    for (size_t j = 0; j < 6; j++) {
+        max_velocity[j] = options_.max_velocity[j] * options_.velocity_scale;
+        max_acceleration[j] = options_.max_acceleration[j] * options_.acceleration_scale;
+    }
+
+    // Backward pass. With x the squared path speed and u the path acceleration at a grid point, the joint velocity
+    // limits bound x, the joint acceleration limits are |second * x + first * u| <= max_acceleration, and the next
+    // grid point x + 2 * ds * u must be in its controllable set [0, controllable_[i + 1]]. Every constraint is
+    // alpha * x + beta * u <= gamma: u is eliminated pairwise (Fourier-Motzkin), which leaves the largest x.
+    const size_t last = grid_.size() - 1;
+    controllable_.assign(grid_.size(), 0.0);
+    double alpha[14];
+    double beta[14];
+    double gamma[14];
+    for (size_t i = last; i-- > 0;) {
+        vector6d_t first;
+        vector6d_t second;
+        evaluate(grid_segments_[i], grid_[i], nullptr, &first, &second);
+        const double ds = grid_[i + 1] - grid_[i];
+
+        double x_max = std::numeric_limits<double>::infinity();
+        size_t count = 0;
+        for (size_t j = 0; j < 6; j++) {
+            const double derivative = std::fabs(first[j]);
+            if (derivative < DERIVATIVE_EPSILON) {
+                // Only the curvature of the path: |second| * x <= max_acceleration
+                if (std::fabs(second[j]) > DERIVATIVE_EPSILON) {
+                    x_max = std::min(x_max, max_acceleration[j] / std::fabs(second[j]));
+                }
+                continue;
+            }
+            const double speed = max_velocity[j] / derivative;
+            x_max = std::min(x_max, speed * speed);
+            alpha[count] = second[j];
+            beta[count] = first[j];
+            gamma[count++] = max_acceleration[j];
+            alpha[count] = -second[j];
+            beta[count] = -first[j];
+            gamma[count++] = max_acceleration[j];
+        }
+        alpha[count] = 1;
+        beta[count] = 2 * ds;
+        gamma[count++] = controllable_[i + 1];
+        alpha[count] = -1;
+        beta[count] = -2 * ds;
+        gamma[count++] = 0;
+
+        for (size_t k = 0; k < count; k++) {
+            if (beta[k] <= 0) {
+                continue;
+            }
+            for (size_t l = 0; l < count; l++) {
+                if (beta[l] >= 0) {
+                    continue;
+                }
+                // u <= (gamma_k - alpha_k * x) / beta_k and u >= (gamma_l - alpha_l * x) / beta_l
+                const double c = alpha[k] / beta[k] - alpha[l] / beta[l];
+                const double d = gamma[k] / beta[k] - gamma[l] / beta[l];
+                if (c > 0) {
+                    x_max = std::min(x_max, d / c);
+                }
+            }
+        }
+        controllable_[i] = std::max(0.0, x_max);
+    }
+
+    // Forward pass, from rest: the largest path acceleration that keeps the next grid point controllable
+    speeds_.assign(grid_.size(), 0.0);
+    times_.assign(grid_.size(), 0.0);
+    for (size_t i = 0; i < last; i++) {
+        vector6d_t first;
+        vector6d_t second;
+        evaluate(grid_segments_[i], grid_[i], nullptr, &first, &second);
+        const double ds = grid_[i + 1] - grid_[i];
+        const double x = speeds_[i];
+        double u_min = -x / (2 * ds);
+        double u_max = (controllable_[i + 1] - x) / (2 * ds);
+        accelerationBounds(first, second, max_acceleration, x, u_min, u_max);
+        const double next = std::min(controllable_[i + 1], std::max(0.0, x + 2 * ds * std::max(u_min, u_max)));
+        speeds_[i + 1] = next;
+        // Constant path acceleration over the interval
+        const double mean_speed = std::sqrt(x) + std::sqrt(next);
+        times_[i + 1] = times_[i] + (mean_speed > 0 ? 2 * ds / mean_speed : 0.0);
+    }
+
+    waypoint_times_.resize(waypoint_knots_.size());
+    for (size_t w = 0; w < waypoint_knots_.size(); w++) {
+        waypoint_times_[w] = times_[knot_grid_[waypoint_knots_[w]]];
+    }
+    return true;
+}
+
+void TimeOptimalParameterization::locate(double time, size_t& interval, double& s, double& speed) const {
+    const double t = std::min(std::max(time, 0.0), times_.back());
+    interval = static_cast<size_t>(std::upper_bound(times_.begin(), times_.end(), t) - times_.begin());
+    interval = std::min(std::max<size_t>(interval, 1), times_.size() - 1) - 1;
+    const double ds = grid_[interval + 1] - grid_[interval];
+    const double start_speed = std::sqrt(speeds_[interval]);
+    const double u = (speeds_[interval + 1] - speeds_[interval]) / (2 * ds);
+    const double tau = t - times_[interval];
+    s = std::min(grid_[interval] + start_speed * tau + 0.5 * u * tau * tau, grid_[interval + 1]);
+    speed = std::max(0.0, start_speed + u * tau);
+}
+
+bool TimeOptimalParameterization::sample(double time, vector6d_t& position, vector6d_t& velocity) const {
+    if (times_.empty()) {
+        return false;
+    }
+    size_t interval;
+    double s;
+    double speed;
+    locate(time, interval, s, speed);
+    vector6d_t first;
+    evaluate(grid_segments_[interval], s, &position, &first, nullptr);
+    for (size_t j = 0; j < 6; j++) {
+        velocity[j] = first[j] * speed;
+    }
+    return true;
+}
+
+bool TimeOptimalParameterization::sampleUniform(double period, std::vector<vector6d_t>& positions) const {
+    if (times_.empty() || !(period > 0)) {
+        return false;
+    }
+    const double duration = getDuration();
+    // The last sample is the end of the path, one period or less after the previous one
+    const size_t count = static_cast<size_t>(std::ceil(duration / period - 1e-9)) + 1;
+    positions.resize(count);
+    for (size_t k = 0; k < count; k++) {
+        size_t interval;
+        double s;
+        double speed;
+        locate(std::min(k * period, duration), interval, s, speed);
+        evaluate(grid_segments_[interval], s, &positions[k], nullptr, nullptr);
+    }
+    return true;
+}
+
+}  // namespace ELITE
@@ -0,0 +1,235 @@
+#include <Elite/ClassLoader.hpp>
+#include <Elite/KinematicsBase.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ELITE;
+
+namespace {
+
+// MDH of a CS63 like arm
+const vector6d_t TEST_ALPHA = {0, M_PI / 2, 0, 0, M_PI / 2, -M_PI / 2};
+const vector6d_t TEST_A = {0, 0, -0.427, -0.357, 0, 0};
+const vector6d_t TEST_D = {0.1215, 0, 0, 0.1225, 0.1025, 0.094};
+
+std::string findPluginLibraryPath(const std::string& lib_name) {
+    const std::array<std::string, 5> candidates = {
+        "../build/plugin/kinematics/" + lib_name, "build/plugin/kinematics/" + lib_name, "plugin/kinematics/" + lib_name,
+        "../plugin/kinematics/" + lib_name,       "./" + lib_name,
+    };
+    for (const auto& candidate : candidates) {
+        if (std::filesystem::exists(candidate)) {
+            return candidate;
+        }
+    }
+    return "";
+}
+
+void expectPoseNear(const vector6d_t& expected, const vector6d_t& actual) {
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_NEAR(expected[i], actual[i], 1e-7);
+    }
+    // Compare the rotation matrices, the RPY angles of a rotation are not unique
+    auto rpy = [](const vector6d_t& p) {
+        double cr = std::cos(p[3]), sr = std::sin(p[3]);
+        double cp = std::cos(p[4]), sp = std::sin(p[4]);
+        double cy = std::cos(p[5]), sy = std::sin(p[5]);
+        return std::array<double, 9>{cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr, sy * cp, sy * sp * sr + cy * cr,
+                                     sy * sp * cr - cy * sr, -sp, cp * sr, cp * cr};
+    };
+    auto l = rpy(expected);
+    auto r = rpy(actual);
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_NEAR(l[i], r[i], 1e-7);
+    }
+}
+
+class AnalyticKinematicsPluginTest : public ::testing::Test {
+   protected:
+    std::unique_ptr<ClassLoader> loader_;
+    std::unique_ptr<KinematicsBase> solver_;
+
+    void SetUp() override {
+        const std::string path = findPluginLibraryPath("libelite_analytic_kinematics.so");
+        if (path.empty()) {
+            GTEST_SKIP() << "Analytic kinematics plugin library not found in expected build paths";
+        }
+        loader_.reset(new ClassLoader(path));
+        ASSERT_TRUE(loader_->loadLib());
+        solver_ = loader_->createUniqueInstance<KinematicsBase>("ELITE::AnalyticKinematicsPlugin");
+        ASSERT_NE(solver_, nullptr);
+        solver_->setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    }
+
+    void TearDown() override {
+        solver_.reset();
+        loader_.reset();
+    }
+};
+
+}  // namespace
+
+TEST_F(AnalyticKinematicsPluginTest, AllSolutionsReachThePose) {
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> dist(-M_PI, M_PI);
+    size_t total = 0;
+    for (int n = 0; n < 200; n++) {
+        vector6d_t q;
+        for (auto& v : q) {
+            v = dist(gen);
+        }
+        vector6d_t pose;
+        ASSERT_TRUE(solver_->getPositionFK(q, pose));
+
+        std::vector<vector6d_t> solutions;
+        KinematicsResult result;
+        ASSERT_TRUE(solver_->getPositionIK(pose, q, solutions, result));
+        EXPECT_EQ(result.kinematic_error, KinematicError::OK);
+        ASSERT_LE(solutions.size(), 8u);
+        total += solutions.size();
+
+        // The configuration itself is the closest solution
+        for (size_t i = 0; i < 6; i++) {
+            EXPECT_NEAR(solutions[0][i], q[i], 1e-6);
+        }
+        for (auto& solution : solutions) {
+            vector6d_t check;
+            solver_->getPositionFK(solution, check);
+            expectPoseNear(pose, check);
+        }
+    }
+    // Random configurations away from the singularities have all the branches
+    EXPECT_GT(total, 200u * 7);
+}
+
+TEST_F(AnalyticKinematicsPluginTest, SolutionsSortedByDistanceToSeed) {
+    vector6d_t q = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+    vector6d_t pose;
+    solver_->getPositionFK(q, pose);
+    vector6d_t seed = {0.5, -1.0, 1.0, -1.0, -1.0, 0.5};
+
+    std::vector<vector6d_t> solutions;
+    KinematicsResult result;
+    ASSERT_TRUE(solver_->getPositionIK(pose, seed, solutions, result));
+    EXPECT_EQ(solutions.size(), 8u);
+    auto distance = [&seed](const vector6d_t& s) {
+        double sum = 0;
+        for (size_t i = 0; i < 6; i++) {
+            sum += (s[i] - seed[i]) * (s[i] - seed[i]);
+        }
+        return sum;
+    };
+    for (size_t i = 1; i < solutions.size(); i++) {
+        EXPECT_LE(distance(solutions[i - 1]), distance(solutions[i]));
+    }
+
+    vector6d_t single;
+    ASSERT_TRUE(solver_->getPositionIK(pose, seed, single, result));
+    EXPECT_EQ(single, solutions[0]);
+}
+
+TEST_F(AnalyticKinematicsPluginTest, SeedSelectsTheEquivalentAngle) {
+    vector6d_t q = {0.3 - 2 * M_PI, -1.2, 1.4, -1.6, -1.3, -0.2 + 2 * M_PI};
+    vector6d_t pose;
+    solver_->getPositionFK(q, pose);
+
+    vector6d_t solution;
+    KinematicsResult result;
+    ASSERT_TRUE(solver_->getPositionIK(pose, q, solution, result));
+    for (size_t i = 0; i < 6; i++) {
+        EXPECT_NEAR(solution[i], q[i], 1e-6);
+    }
+}
+
+TEST_F(AnalyticKinematicsPluginTest, WristSingularityKeepsSeed) {
+    vector6d_t q = {0.3, -1.2, 1.4, -1.6, 0.0, 0.2};
+    vector6d_t pose;
+    solver_->getPositionFK(q, pose);
+
+    vector6d_t solution;
+    KinematicsResult result;
+    ASSERT_TRUE(solver_->getPositionIK(pose, q, solution, result));
+    vector6d_t check;
+    solver_->getPositionFK(solution, check);
+    expectPoseNear(pose, check);
+    EXPECT_NEAR(solution[5], q[5], 1e-6);
+}
+
+TEST_F(AnalyticKinematicsPluginTest, UnreachablePose) {
+    vector6d_t pose = {3.0, 0, 0, 0, 0, 0};
+    vector6d_t solution;
+    KinematicsResult result;
+    EXPECT_FALSE(solver_->getPositionIK(pose, vector6d_t{}, solution, result));
+    EXPECT_EQ(result.kinematic_error, KinematicError::NO_SOLUTION);
+}
+
+TEST_F(AnalyticKinematicsPluginTest, UnsupportedGeometry) {
+    vector6d_t alpha = TEST_ALPHA;
+    alpha[2] = 0.3;
+    solver_->setMDH(alpha, TEST_A, TEST_D);
+    vector6d_t pose;
+    ASSERT_TRUE(solver_->getPositionFK(vector6d_t{}, pose));
+    vector6d_t solution;
+    KinematicsResult result;
+    EXPECT_FALSE(solver_->getPositionIK(pose, vector6d_t{}, solution, result));
+    EXPECT_EQ(result.kinematic_error, KinematicError::SOLVER_NOT_ACTIVE);
+}
+
+TEST_F(AnalyticKinematicsPluginTest, JacobianMatchesNumericDefault) {
+    vector6d_t q = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+    matrix6d_t closed_form;
+    matrix6d_t numeric;
+    ASSERT_TRUE(solver_->getJacobian(q, closed_form));
+    ASSERT_TRUE(solver_->KinematicsBase::getJacobian(q, numeric));
+    for (size_t i = 0; i < 6; i++) {
+        for (size_t j = 0; j < 6; j++) {
+            EXPECT_NEAR(closed_form[i][j], numeric[i][j], 1e-6);
+        }
+    }
+}
+
+TEST_F(AnalyticKinematicsPluginTest, SetMDHDuringQueries) {
+    vector6d_t q = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+    vector6d_t pose;
+    solver_->getPositionFK(q, pose);
+    vector6d_t a = TEST_A;
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            while (!stop) {
+                vector6d_t solution;
+                KinematicsResult result;
+                if (!solver_->getPositionIK(pose, q, solution, result)) {
+                    failures++;
+                }
+            }
+        });
+    }
+    // Both models reach the pose, the queries see one or the other
+    for (int i = 0; i < 2000; i++) {
+        a[2] = (i % 2) ? TEST_A[2] : TEST_A[2] - 0.001;
+        solver_->setMDH(TEST_ALPHA, a, TEST_D);
+    }
+    stop = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(failures, 0);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
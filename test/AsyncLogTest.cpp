@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Elite/Log.hpp"
+#include "Elite/LogFormat.hpp"
+
+using namespace ELITE;
+using namespace std::chrono;
+
+struct LoggedMessage {
+    std::thread::id thread;
+    LogLevel level;
+    std::string text;
+};
+
+class CollectLogHandler : public LogHandler {
+   public:
+    // The handler waits while the gate is closed
+    CollectLogHandler(std::mutex& mutex, std::vector<LoggedMessage>& messages, std::atomic<bool>* gate = nullptr)
+        : mutex_(mutex), messages_(messages), gate_(gate) {}
+
+    void log(const char* file, int line, LogLevel loglevel, const char* log) override {
+        while (gate_ && !gate_->load()) {
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        messages_.push_back({std::this_thread::get_id(), loglevel, log});
+    }
+
+   private:
+    std::mutex& mutex_;
+    std::vector<LoggedMessage>& messages_;
+    std::atomic<bool>* gate_;
+};
+
+class AsyncLogTest : public ::testing::Test {
+   protected:
+    void TearDown() override {
+        setAsyncLogging(false);
+        unregisterLogHandler();
+        setLogLevel(LogLevel::ELI_INFO);
+    }
+
+    std::mutex mutex_;
+    std::vector<LoggedMessage> messages_;
+};
+
+TEST_F(AsyncLogTest, sync_mode_long_message) {
+    registerLogHandler(std::make_unique<CollectLogHandler>(mutex_, messages_));
+    std::string long_text(3000, 'x');
+    ELITE_LOG_INFO("%s", long_text.c_str());
+    ELITE_LOG_DEBUG("filtered");
+    ASSERT_EQ(messages_.size(), 1u);
+    EXPECT_EQ(messages_[0].text, long_text);
+    EXPECT_EQ(messages_[0].thread, std::this_thread::get_id());
+}
+
+TEST_F(AsyncLogTest, multi_producer_order) {
+    registerLogHandler(std::make_unique<CollectLogHandler>(mutex_, messages_));
+    setAsyncLogging(true, 4096);
+    uint64_t dropped_before = getDroppedLogCount();
+
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 500;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < THREADS; t++) {
+        producers.emplace_back([t]() {
+            for (int i = 0; i < PER_THREAD; i++) {
+                ELITE_LOG_INFO("%d %d", t, i);
+            }
+        });
+    }
+    for (auto& p : producers) {
+        p.join();
+    }
+    ASSERT_TRUE(flushLog(milliseconds(5000)));
+    EXPECT_EQ(getDroppedLogCount(), dropped_before);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(messages_.size(), static_cast<size_t>(THREADS * PER_THREAD));
+    // Messages of one thread keep their order, and the handler runs on the writer thread
+    std::map<int, int> next;
+    for (auto& m : messages_) {
+        EXPECT_NE(m.thread, std::this_thread::get_id());
+        int t = -1, i = -1;
+        ASSERT_EQ(sscanf(m.text.c_str(), "%d %d", &t, &i), 2);
+        EXPECT_EQ(i, next[t]);
+        next[t] = i + 1;
+    }
+}
+
+TEST_F(AsyncLogTest, truncate_and_drop) {
+    // The queue was created by the first test that enabled it, so fill it with a blocked handler
+    std::atomic<bool> gate{false};
+    registerLogHandler(std::make_unique<CollectLogHandler>(mutex_, messages_, &gate));
+    setAsyncLogging(true);
+    std::string long_text(2000, 'y');
+    ELITE_LOG_WARN("%s", long_text.c_str());
+
+    uint64_t dropped_before = getDroppedLogCount();
+    auto start = steady_clock::now();
+    for (int i = 0; i < 10000; i++) {
+        ELITE_LOG_INFO("flood %d", i);
+    }
+    // Logging never waits for the blocked handler
+    EXPECT_LT(steady_clock::now() - start, milliseconds(2000));
+    EXPECT_GT(getDroppedLogCount(), dropped_before);
+
+    // Disabling writes the queued messages
+    gate = true;
+    setAsyncLogging(false);
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_FALSE(messages_.empty());
+    EXPECT_LT(messages_[0].text.size(), long_text.size());
+    EXPECT_EQ(messages_[0].text.substr(messages_[0].text.size() - 3), "...");
+    bool drop_reported = false;
+    for (auto& m : messages_) {
+        if (m.level == LogLevel::ELI_WARN && m.text.find("dropped") != std::string::npos) {
+            drop_reported = true;
+        }
+    }
+    EXPECT_TRUE(drop_reported);
+}
+
+// Encode and format like the writer thread does
+static bool deferredFormat(std::string& out, const char* fmt, ...) {
+    char buffer[480];
+    va_list args;
+    va_start(args, fmt);
+    bool encoded = LOG_FORMAT::encode(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    if (encoded) {
+        LOG_FORMAT::format(buffer, out);
+    }
+    return encoded;
+}
+
+static std::string printfFormat(const char* fmt, ...) {
+    char buffer[1024];
+    va_list args;
+    va_start(args, fmt);
+    std::vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    return buffer;
+}
+
+#define EXPECT_SAME_FORMAT(...)                            \
+    do {                                                   \
+        std::string deferred;                              \
+        ASSERT_TRUE(deferredFormat(deferred, __VA_ARGS__)); \
+        EXPECT_EQ(deferred, printfFormat(__VA_ARGS__));    \
+    } while (0)
+
+TEST(LogFormatTest, same_as_printf) {
+    int value = 0;
+    EXPECT_SAME_FORMAT("no conversion 100%%");
+    EXPECT_SAME_FORMAT("%d %i %5d %-5d| %+d %05d", -12, 34, 56, 78, 9, -1);
+    EXPECT_SAME_FORMAT("%hhd %hhu %hd %hu", 300, 300, 70000, 70000);
+    EXPECT_SAME_FORMAT("%ld %lu %lld %llu", -1L, 2UL, -3LL, 18446744073709551615ULL);
+    EXPECT_SAME_FORMAT("%zu %zd %jd %td", static_cast<size_t>(42), static_cast<ptrdiff_t>(-42), static_cast<intmax_t>(7),
+                       static_cast<ptrdiff_t>(8));
+    EXPECT_SAME_FORMAT("%x %X %#x %o %08x", 255u, 255u, 255u, 8u, 0xbeefu);
+    EXPECT_SAME_FORMAT("%f %.3f %e %g %10.2f %a", 3.14159, 2.71828, 12345.678, 0.0001, -1.5, 1.0);
+    EXPECT_SAME_FORMAT("%Lf %lf", 1.25L, 2.5);
+    EXPECT_SAME_FORMAT("%c%c %5c", 'o', 'k', '!');
+    EXPECT_SAME_FORMAT("%p %p", static_cast<void*>(&value), static_cast<void*>(nullptr));
+    EXPECT_SAME_FORMAT("[%s] [%10s] [%-6s] [%.3s]", "abc", "right", "left", "truncated");
+    EXPECT_SAME_FORMAT("[%*d] [%-*d] [%.*f] [%*.*s]", 6, 1, 6, 2, 2, 3.14159, 8, 3, "string");
+    EXPECT_SAME_FORMAT("%s:%d joint %d, %.4f rad", "file.cpp", 120, 5, 0.7854);
+
+    // The precision bounds the bytes read from an unterminated string
+    const char unterminated[4] = {'a', 'b', 'c', 'd'};
+    EXPECT_SAME_FORMAT("%.4s|", unterminated);
+}
+
+TEST(LogFormatTest, fallback) {
+    std::string out;
+    int written = 0;
+    EXPECT_FALSE(deferredFormat(out, "%n", &written));
+    EXPECT_FALSE(deferredFormat(out, "%ls", L"wide"));
+    EXPECT_FALSE(deferredFormat(out, "%1$d", 1));
+    EXPECT_FALSE(deferredFormat(out, "%s", std::string(600, 'z').c_str()));
+}
+
+TEST_F(AsyncLogTest, deferred_messages) {
+    registerLogHandler(std::make_unique<CollectLogHandler>(mutex_, messages_));
+    setAsyncLogging(true);
+    {
+        std::string temporary = "robot";
+        ELITE_LOG_INFO("%s %d %.2f %s", temporary.c_str(), 6, 0.5, "joints");
+        temporary = "changed";
+    }
+    // Does not fit the record, formatted and truncated by the logging thread
+    std::string long_text(1000, 'w');
+    ELITE_LOG_INFO("%s", long_text.c_str());
+    ASSERT_TRUE(flushLog(milliseconds(5000)));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(messages_.size(), 2u);
+    EXPECT_EQ(messages_[0].text, "robot 6 0.50 joints");
+    EXPECT_EQ(messages_[1].text.size(), 479u);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Elite/BinaryLog.hpp"
+#include "Elite/Log.hpp"
+#include "EliteException.hpp"
+
+using namespace ELITE;
+using namespace std::chrono;
+
+static long fileSize(const std::string& path) {
+    std::FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) {
+        return -1;
+    }
+    std::fseek(fp, 0, SEEK_END);
+    long size = std::ftell(fp);
+    std::fclose(fp);
+    return size;
+}
+
+static std::vector<BinaryLogEntry> readAll(const std::string& path) {
+    std::vector<BinaryLogEntry> entries;
+    BinaryLogReader reader(path);
+    BinaryLogEntry entry;
+    while (reader.next(entry)) {
+        entries.push_back(entry);
+    }
+    EXPECT_FALSE(reader.isBroken());
+    return entries;
+}
+
+TEST(BinaryLogTest, write_and_read) {
+    std::string path;
+    auto before = system_clock::now();
+    {
+        BinaryLogHandler handler("binary_log_write_test");
+        path = handler.currentFile();
+        EXPECT_EQ(path.find("binary_log_write_test."), 0u);
+        EXPECT_EQ(path.substr(path.size() - 10), ".0000.elog");
+        handler.log("source/A.cpp", 10, LogLevel::ELI_INFO, "first");
+        handler.log("source/A.cpp", 10, LogLevel::ELI_INFO, "second");
+        std::thread other([&]() { handler.log("source/B.cpp", 20, LogLevel::ELI_ERROR, "from another thread"); });
+        other.join();
+        handler.log("source/A.cpp", 11, LogLevel::ELI_DEBUG, "");
+        handler.flush();
+
+        // Another handler created in the same second does not overwrite the file
+        BinaryLogHandler second("binary_log_write_test");
+        EXPECT_NE(second.currentFile(), path);
+        std::remove(second.currentFile().c_str());
+    }
+    auto after = system_clock::now();
+    // Cut to the used size, a site is written once
+    long size = fileSize(path);
+    EXPECT_GT(size, 16);
+    EXPECT_LT(size, 160);
+
+    auto entries = readAll(path);
+    ASSERT_EQ(entries.size(), 4u);
+    EXPECT_EQ(entries[0].message, "first");
+    EXPECT_EQ(entries[0].file, "source/A.cpp");
+    EXPECT_EQ(entries[0].line, 10);
+    EXPECT_EQ(entries[0].level, LogLevel::ELI_INFO);
+    EXPECT_EQ(entries[1].message, "second");
+    EXPECT_EQ(entries[2].file, "source/B.cpp");
+    EXPECT_EQ(entries[2].level, LogLevel::ELI_ERROR);
+    EXPECT_NE(entries[2].thread, entries[0].thread);
+    EXPECT_EQ(entries[1].thread, entries[0].thread);
+    EXPECT_EQ(entries[3].line, 11);
+    EXPECT_EQ(entries[3].message, "");
+    for (auto& e : entries) {
+        EXPECT_GE(e.time, time_point_cast<microseconds>(before));
+        EXPECT_LE(e.time, after);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(BinaryLogTest, rotation) {
+    std::vector<std::string> files;
+    {
+        BinaryLogHandler handler("binary_log_rotation_test", 4096, 3);
+        std::string text(100, 'r');
+        for (int i = 0; i < 400; i++) {
+            handler.log("source/Rotate.cpp", 1, LogLevel::ELI_INFO, (std::to_string(i) + text).c_str());
+            if (files.empty() || files.back() != handler.currentFile()) {
+                files.push_back(handler.currentFile());
+            }
+        }
+        EXPECT_EQ(handler.lostCount(), 0u);
+    }
+    // Only the 3 newest files are kept, each one is readable alone
+    ASSERT_GT(files.size(), 3u);
+    for (size_t i = 0; i + 3 < files.size(); i++) {
+        EXPECT_LT(fileSize(files[i]), 0);
+    }
+    int expected_next = -1;
+    for (size_t i = files.size() - 3; i < files.size(); i++) {
+        EXPECT_LE(fileSize(files[i]), 4096);
+        EXPECT_LT(files[i - 1], files[i]);
+        auto entries = readAll(files[i]);
+        ASSERT_FALSE(entries.empty());
+        for (auto& e : entries) {
+            EXPECT_EQ(e.file, "source/Rotate.cpp");
+            int index = std::stoi(e.message);
+            if (expected_next >= 0) {
+                EXPECT_EQ(index, expected_next);
+            }
+            expected_next = index + 1;
+        }
+        std::remove(files[i].c_str());
+    }
+    EXPECT_EQ(expected_next, 400);
+}
+
+TEST(BinaryLogTest, not_a_log_file) {
+    const std::string path = "binary_log_not_a_log.elog";
+    std::FILE* fp = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(fp, nullptr);
+    std::fputs("plain text, not a binary log", fp);
+    std::fclose(fp);
+    EXPECT_THROW(BinaryLogReader reader(path), EliteException);
+    std::remove(path.c_str());
+    EXPECT_THROW(BinaryLogReader reader("binary_log_missing.elog"), EliteException);
+}
+
+class CollectLogHandler : public LogHandler {
+   public:
+    explicit CollectLogHandler(std::vector<std::string>& messages) : messages_(messages) {}
+
+    void log(const char* file, int line, LogLevel loglevel, const char* log) override { messages_.push_back(log); }
+
+   private:
+    std::vector<std::string>& messages_;
+};
+
+// One log statement, as in a reconnect loop
+static void acceptClient(int port) { ELITE_LOG_INFO("TCP port %d accept client", port); }
+
+TEST(LogRateLimitTest, repeated_messages) {
+    std::vector<std::string> messages;
+    registerLogHandler(std::make_unique<CollectLogHandler>(messages));
+    setLogRateLimit(3, milliseconds(200));
+
+    for (int i = 0; i < 10; i++) {
+        acceptClient(50001);
+    }
+    // Another statement has its own budget
+    ELITE_LOG_INFO("other statement");
+    ASSERT_EQ(messages.size(), 4u);
+    EXPECT_EQ(messages[3], "other statement");
+
+    std::this_thread::sleep_for(milliseconds(250));
+    messages.clear();
+    for (int i = 0; i < 10; i++) {
+        acceptClient(50001);
+    }
+    ASSERT_EQ(messages.size(), 4u);
+    EXPECT_EQ(messages[0], "7 similar messages were suppressed");
+    EXPECT_EQ(messages[1], "TCP port 50001 accept client");
+
+    setLogRateLimit(0);
+    messages.clear();
+    for (int i = 0; i < 10; i++) {
+        acceptClient(50001);
+    }
+    EXPECT_EQ(messages.size(), 10u);
+    unregisterLogHandler();
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,228 @@
+#include <Elite/ClassLoader.hpp>
+#include <Elite/ContinuousIkSolver.hpp>
+#include <Elite/IkSolutionCache.hpp>
+#include <Elite/KinematicsBase.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+using namespace ELITE;
+
+namespace {
+
+// MDH of a CS63 like arm
+const vector6d_t TEST_ALPHA = {0, M_PI / 2, 0, 0, M_PI / 2, -M_PI / 2};
+const vector6d_t TEST_A = {0, 0, -0.427, -0.357, 0, 0};
+const vector6d_t TEST_D = {0.1215, 0, 0, 0.1225, 0.1025, 0.094};
+
+const vector6d_t START = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+const vector6d_t FAR = {-1.1, -1.8, 1.9, -0.9, -0.7, 1.6};
+
+std::string findPluginLibraryPath(const std::string& lib_name) {
+    const std::array<std::string, 5> candidates = {
+        "../build/plugin/kinematics/" + lib_name, "build/plugin/kinematics/" + lib_name, "plugin/kinematics/" + lib_name,
+        "../plugin/kinematics/" + lib_name,       "./" + lib_name,
+    };
+    for (const auto& candidate : candidates) {
+        if (std::filesystem::exists(candidate)) {
+            return candidate;
+        }
+    }
+    return "";
+}
+
+class ContinuousIkSolverTest : public ::testing::Test {
+   protected:
+    std::unique_ptr<ClassLoader> loader_;
+    KinematicsBaseSharedPtr kinematics_;
+
+    void SetUp() override {
+        const std::string path = findPluginLibraryPath("libelite_analytic_kinematics.so");
+        if (path.empty()) {
+            GTEST_SKIP() << "Analytic kinematics plugin library not found in expected build paths";
+        }
+        loader_.reset(new ClassLoader(path));
+        ASSERT_TRUE(loader_->loadLib());
+        kinematics_ = loader_->createUniqueInstance<KinematicsBase>("ELITE::AnalyticKinematicsPlugin");
+        ASSERT_NE(kinematics_, nullptr);
+        kinematics_->setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    }
+
+    void TearDown() override {
+        kinematics_.reset();
+        loader_.reset();
+    }
+
+    vector6d_t fk(const vector6d_t& q) {
+        vector6d_t pose;
+        kinematics_->getPositionFK(q, pose);
+        return pose;
+    }
+};
+
+}  // namespace
+
+TEST_F(ContinuousIkSolverTest, StreamsASmoothPath) {
+    ContinuousIkSolver solver(kinematics_);
+    const int steps = 500;
+    for (int n = 0; n < steps; n++) {
+        // 2 ms cycle of a joint motion
+        const double t = n * 0.002;
+        vector6d_t q = START;
+        for (size_t i = 0; i < 6; i++) {
+            q[i] += 0.4 * std::sin(2.0 * t + i);
+        }
+        vector6d_t solution;
+        KinematicsResult result;
+        ASSERT_TRUE(solver.solve(fk(q), START, solution, result));
+        EXPECT_EQ(result.kinematic_error, KinematicError::OK);
+        for (size_t i = 0; i < 6; i++) {
+            EXPECT_NEAR(solution[i], q[i], 1e-5);
+        }
+    }
+    const auto& stats = solver.getStats();
+    EXPECT_EQ(stats.calls, static_cast<uint64_t>(steps));
+    EXPECT_EQ(stats.fallbacks, 0u);
+    // The first call is a cold start from near
+    EXPECT_EQ(stats.cold_solutions, 1u);
+    EXPECT_EQ(stats.warm_solutions, static_cast<uint64_t>(steps - 1));
+    EXPECT_DOUBLE_EQ(stats.warmRate(), static_cast<double>(steps - 1) / steps);
+    // The prediction is close, so a call takes about one step and the factorization is mostly reused
+    EXPECT_LT(stats.iterations, 3u * steps);
+    EXPECT_LT(stats.factorizations, stats.iterations);
+}
+
+TEST_F(ContinuousIkSolverTest, IterationBudgetWithoutFallback) {
+    ContinuousIkOptions options;
+    options.max_iterations = 2;
+    // No fallback by default
+    ContinuousIkSolver solver(kinematics_, options);
+    solver.reset(START);
+
+    vector6d_t solution;
+    KinematicsResult result;
+    EXPECT_FALSE(solver.solve(fk(FAR), START, solution, result));
+    EXPECT_EQ(result.kinematic_error, KinematicError::NO_SOLUTION);
+    EXPECT_LE(solver.getStats().iterations, 2u);
+    EXPECT_EQ(solver.getStats().failures, 1u);
+}
+
+TEST_F(ContinuousIkSolverTest, ColdStartSharesTheIterationBudget) {
+    ContinuousIkOptions options;
+    options.max_iterations = 2;
+    options.allow_fallback = true;
+    // Coarse cells, so a pose away from the cached one hits
+    options.cache_position_resolution = 0.2;
+    options.cache_orientation_resolution = 1.0;
+    ContinuousIkSolver solver(kinematics_, options);
+    vector6d_t target = fk(FAR);
+    vector6d_t solution;
+    KinematicsResult result;
+    ASSERT_TRUE(solver.solve(target, START, solution, result));
+
+    // The cached seed does not converge in the budget, no steps are left for near
+    solver.reset();
+    solver.resetStats();
+    target[0] += 0.01;
+    target[3] += 0.3;
+    ASSERT_TRUE(solver.solve(target, START, solution, result));
+    EXPECT_EQ(solver.getStats().cache_hits, 1u);
+    EXPECT_EQ(solver.getStats().fallbacks, 1u);
+    EXPECT_LE(solver.getStats().iterations, 2u);
+}
+
+TEST_F(ContinuousIkSolverTest, FallsBackOnALargeMove) {
+    ContinuousIkOptions options;
+    options.allow_fallback = true;
+    ContinuousIkSolver solver(kinematics_, options);
+    solver.reset(START);
+    vector6d_t solution;
+    KinematicsResult result;
+    ASSERT_TRUE(solver.solve(fk(FAR), START, solution, result));
+    EXPECT_EQ(solver.getStats().fallbacks, 1u);
+    const vector6d_t pose = fk(FAR);
+    const vector6d_t check = fk(solution);
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_NEAR(pose[i], check[i], 1e-7);
+    }
+}
+
+TEST_F(ContinuousIkSolverTest, CacheSolvesARepeatedTarget) {
+    ContinuousIkOptions options;
+    options.allow_fallback = true;
+    ContinuousIkSolver solver(kinematics_, options);
+    const vector6d_t target = fk(FAR);
+    vector6d_t first;
+    KinematicsResult result;
+    ASSERT_TRUE(solver.solve(target, START, first, result));
+    EXPECT_EQ(solver.getStats().cache_misses, 1u);
+    EXPECT_EQ(solver.getStats().fallbacks, 1u);
+
+    // The next cycle starts cold again
+    solver.reset();
+    vector6d_t second;
+    ASSERT_TRUE(solver.solve(target, START, second, result));
+    EXPECT_EQ(solver.getStats().cache_hits, 1u);
+    EXPECT_EQ(solver.getStats().cache_solutions, 1u);
+    EXPECT_EQ(solver.getStats().fallbacks, 1u);
+    EXPECT_DOUBLE_EQ(solver.getStats().cacheHitRate(), 0.5);
+    for (size_t i = 0; i < 6; i++) {
+        EXPECT_NEAR(first[i], second[i], 1e-9);
+    }
+}
+
+TEST(IkSolutionCacheTest, VoxelAndOrientationGrid) {
+    IkSolutionCache cache(1000, 0.01, 0.05);
+    EXPECT_EQ(cache.capacity(), 1024u);
+
+    const vector6d_t pose = {0.4051, -0.1234, 0.3017, 0.3, -0.2, 1.1};
+    cache.insert(pose, START);
+    EXPECT_EQ(cache.size(), 1u);
+
+    vector6d_t joints;
+    ASSERT_TRUE(cache.lookup(pose, joints));
+    EXPECT_EQ(joints, START);
+
+    vector6d_t moved = pose;
+    moved[0] += 0.05;
+    EXPECT_FALSE(cache.lookup(moved, joints));
+    vector6d_t rotated = pose;
+    rotated[5] += 0.3;
+    EXPECT_FALSE(cache.lookup(rotated, joints));
+
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.misses(), 2u);
+    EXPECT_NEAR(cache.hitRate(), 1.0 / 3, 1e-12);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_FALSE(cache.lookup(pose, joints));
+}
+
+TEST(IkSolutionCacheTest, HalfTurnsShareTheirCell) {
+    IkSolutionCache cache(1000, 0.01, 0.05);
+    // Half turns have qw close to 0, roll of pi and -pi give q and -q up to rounding
+    const vector6d_t pose = {0.4051, -0.1234, 0.3017, M_PI, 0.0, 0.0};
+    cache.insert(pose, START);
+    vector6d_t joints;
+    vector6d_t other = pose;
+    other[3] = -M_PI;
+    EXPECT_TRUE(cache.lookup(other, joints));
+
+    const vector6d_t yaw = {0.4051, -0.1234, 0.3017, 0.0, 0.0, M_PI - 1e-12};
+    cache.insert(yaw, FAR);
+    other = yaw;
+    other[5] = -M_PI + 1e-12;
+    ASSERT_TRUE(cache.lookup(other, joints));
+    EXPECT_EQ(joints, FAR);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,339 @@
+#include <gtest/gtest.h>
+#include <boost/asio.hpp>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Dashboard/DashboardClient.hpp"
+#include "Dashboard/DashboardStateSource.hpp"
+
+using namespace ELITE;
+using namespace std::chrono;
+
+// A local stand-in of the dashboard server. It answers every received line from a table (an empty reply is not sent) and
+// counts how many socket reads it needed, so the test can see commands arriving together.
+class FakeDashboardServer {
+   public:
+    explicit FakeDashboardServer(std::map<std::string, std::string> replies)
+        : replies_(std::move(replies)),
+          acceptor_(io_context_, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)) {
+        thread_ = std::thread([this]() { serve(); });
+    }
+
+    ~FakeDashboardServer() { stop(); }
+
+    int port() { return acceptor_.local_endpoint().port(); }
+
+    void stop() {
+        boost::system::error_code ec;
+        acceptor_.close(ec);
+        if (client_) {
+            client_->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+        }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    int count(const std::string& line) {
+        std::lock_guard<std::mutex> lock(count_mutex_);
+        return counts_[line];
+    }
+
+    std::atomic<int> reads{0};
+    std::atomic<int> lines{0};
+
+   private:
+    void serve() {
+        boost::system::error_code ec;
+        client_ = std::make_unique<boost::asio::ip::tcp::socket>(io_context_);
+        acceptor_.accept(*client_, ec);
+        if (ec) {
+            return;
+        }
+        boost::asio::write(*client_, boost::asio::buffer(std::string("Connected: Elite Robot Dashboard Server\r\n")), ec);
+        std::string pending;
+        char buffer[1024];
+        while (true) {
+            size_t n = client_->read_some(boost::asio::buffer(buffer), ec);
+            if (ec) {
+                return;
+            }
+            reads++;
+            pending.append(buffer, n);
+            // Answer all the complete lines of this read in one write
+            std::string answer;
+            size_t pos;
+            while ((pos = pending.find('\n')) != std::string::npos) {
+                std::string line = pending.substr(0, pos);
+                pending.erase(0, pos + 1);
+                lines++;
+                {
+                    std::lock_guard<std::mutex> lock(count_mutex_);
+                    counts_[line]++;
+                }
+                auto iter = replies_.find(line);
+                answer += (iter != replies_.end() ? iter->second : "Unknown command\r\n");
+            }
+            if (!answer.empty()) {
+                boost::asio::write(*client_, boost::asio::buffer(answer), ec);
+            }
+        }
+    }
+
+    std::map<std::string, std::string> replies_;
+    std::mutex count_mutex_;
+    std::map<std::string, int> counts_;
+    boost::asio::io_context io_context_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    std::unique_ptr<boost::asio::ip::tcp::socket> client_;
+    std::thread thread_;
+};
+
+static bool waitLines(FakeDashboardServer& server, int lines) {
+    auto start = steady_clock::now();
+    while (server.lines < lines) {
+        if (steady_clock::now() - start > 1s) {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+
+static std::map<std::string, std::string> statusReplies() {
+    return {{"robotMode", "robotMode: RUNNING\r\n"},
+            {"safety -s", "Safety status: PROTECTIVE_STOP\r\n"},
+            {"task -s", "Task is paused\r\n"},
+            {"status", "Target Speed Fraction: 80\r\n"},
+            {"echo", "Hello ELITE ROBOTS.\r\n"},
+            {"version", "2.14.0\r\n"}};
+}
+
+TEST(DashboardClientPipelineTest, sync_commands) {
+    FakeDashboardServer server(statusReplies());
+    DashboardClient client;
+    ASSERT_TRUE(client.connect("127.0.0.1", server.port()));
+    EXPECT_TRUE(client.echo());
+    EXPECT_EQ(client.robotMode(), RobotMode::RUNNING);
+    EXPECT_EQ(client.safetyMode(), SafetyMode::PROTECTIVE_STOP);
+    EXPECT_EQ(client.getTaskStatus(), TaskStatus::PAUSED);
+    EXPECT_EQ(client.speedScaling(), 80);
+    EXPECT_EQ(client.sendAndReceive("version"), "2.14.0\r\n");
+    client.disconnect();
+}
+
+TEST(DashboardClientPipelineTest, async_fifo_order) {
+    FakeDashboardServer server(statusReplies());
+    DashboardClient client;
+    ASSERT_TRUE(client.connect("127.0.0.1", server.port()));
+    auto version = client.sendAsync("version\n");
+    auto echo = client.sendAsync("echo\n");
+    auto mode = client.sendAsync("robotMode\n");
+    // Getting the last one first must still match the responses in order
+    EXPECT_EQ(mode.get(), "robotMode: RUNNING\r\n");
+    EXPECT_EQ(echo.get(), "Hello ELITE ROBOTS.\r\n");
+    EXPECT_EQ(version.get(), "2.14.0\r\n");
+    // Sync commands after async ones use the same queue
+    EXPECT_EQ(client.robotMode(), RobotMode::RUNNING);
+    client.disconnect();
+}
+
+TEST(DashboardClientPipelineTest, batch_status) {
+    FakeDashboardServer server(statusReplies());
+    DashboardClient client;
+    ASSERT_TRUE(client.connect("127.0.0.1", server.port()));
+    auto responses = client.sendAndReceiveBatch({"echo", "version\n"});
+    ASSERT_EQ(responses.size(), 2u);
+    EXPECT_EQ(responses[0], "Hello ELITE ROBOTS.\r\n");
+    EXPECT_EQ(responses[1], "2.14.0\r\n");
+
+    int reads_before = server.reads;
+    DashboardStatus status = client.getStatus();
+    EXPECT_EQ(status.robot_mode, RobotMode::RUNNING);
+    EXPECT_EQ(status.safety_mode, SafetyMode::PROTECTIVE_STOP);
+    EXPECT_EQ(status.task_status, TaskStatus::PAUSED);
+    EXPECT_EQ(status.speed_scaling, 80);
+    // status has a multi-line reply, the echo fence after it is the seventh line
+    EXPECT_EQ(server.lines, 7);
+    // The four status commands are written at once, the loopback delivers them in one read
+    EXPECT_EQ(server.reads - reads_before, 1);
+    client.disconnect();
+}
+
+TEST(DashboardClientPipelineTest, multi_line_reply) {
+    auto replies = statusReplies();
+    replies["status"] = "RunningStatus: PAUSED\r\nTarget Speed Fraction: 60\r\nRobot Name: test\r\n";
+    FakeDashboardServer server(replies);
+    DashboardClient client;
+    ASSERT_TRUE(client.connect("127.0.0.1", server.port()));
+
+    // The whole reply belongs to its command, the commands after it get their own replies
+    auto status = client.sendAsync("status\n");
+    auto version = client.sendAsync("version\n");
+    auto mode = client.sendAsync("robotMode\n");
+    EXPECT_EQ(status.get(), replies["status"]);
+    EXPECT_EQ(version.get(), "2.14.0\r\n");
+    EXPECT_EQ(mode.get(), "robotMode: RUNNING\r\n");
+
+    // Both commands that parse the status reply find their line
+    EXPECT_EQ(client.runningStatus(), TaskStatus::PAUSED);
+    EXPECT_EQ(client.speedScaling(), 60);
+    EXPECT_EQ(client.robotMode(), RobotMode::RUNNING);
+
+    auto batch = client.sendAndReceiveBatch({"status", "task -s", "status", "echo"});
+    ASSERT_EQ(batch.size(), 4u);
+    EXPECT_EQ(batch[0], replies["status"]);
+    EXPECT_EQ(batch[1], "Task is paused\r\n");
+    EXPECT_EQ(batch[2], replies["status"]);
+    EXPECT_EQ(batch[3], "Hello ELITE ROBOTS.\r\n");
+    DashboardStatus robot_status = client.getStatus();
+    EXPECT_EQ(robot_status.speed_scaling, 60);
+    EXPECT_EQ(robot_status.task_status, TaskStatus::PAUSED);
+    client.disconnect();
+}
+
+TEST(DashboardClientPipelineTest, disconnect_during_read) {
+    // An empty reply is never sent, so the read of "hang" blocks until disconnect()
+    auto replies = statusReplies();
+    replies["hang"] = "";
+    FakeDashboardServer server(replies);
+    DashboardClient client;
+    ASSERT_TRUE(client.connect("127.0.0.1", server.port()));
+    auto blocked = client.sendAsync("hang\n");
+    std::thread disconnecter([&]() {
+        ASSERT_TRUE(waitLines(server, 1));
+        std::this_thread::sleep_for(50ms);
+        client.disconnect();
+    });
+    EXPECT_THROW(blocked.get(), EliteException);
+    disconnecter.join();
+    EXPECT_THROW(client.sendAsync("echo\n").get(), EliteException);
+}
+
+TEST(DashboardClientPipelineTest, pending_fail_on_disconnect) {
+    FakeDashboardServer server(statusReplies());
+    DashboardClient client;
+    ASSERT_TRUE(client.connect("127.0.0.1", server.port()));
+    EXPECT_TRUE(client.echo());
+    server.stop();
+    auto reply = client.sendAsync("echo\n");
+    EXPECT_THROW(reply.get(), EliteException);
+    client.disconnect();
+    auto not_connected = client.sendAsync("echo\n");
+    EXPECT_THROW(not_connected.get(), EliteException);
+    EXPECT_THROW(client.getStatus(), EliteException);
+}
+
+// A state source driven by the test
+class FakeStateSource : public DashboardStateSource {
+   public:
+    WaitResult waitUntil(const std::function<bool(const DashboardStatus&)>& predicate,
+                         std::chrono::milliseconds timeout) override {
+        waits++;
+        if (!available) {
+            return WaitResult::UNAVAILABLE;
+        }
+        auto deadline = steady_clock::now() + timeout;
+        while (steady_clock::now() < deadline) {
+            DashboardStatus state;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                state = status;
+            }
+            if (predicate(state)) {
+                return WaitResult::MATCHED;
+            }
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        return WaitResult::TIMEOUT;
+    }
+
+    void set(const DashboardStatus& s) {
+        std::lock_guard<std::mutex> lock(mutex);
+        status = s;
+    }
+
+    std::atomic<bool> available{true};
+    std::atomic<int> waits{0};
+    std::mutex mutex;
+    DashboardStatus status;
+};
+
+static std::map<std::string, std::string> controlReplies() {
+    auto replies = statusReplies();
+    replies["robotControl -on"] = "Powering on\r\n";
+    replies["play"] = "Starting task\r\n";
+    replies["speed -v 30"] = "Set speed fraction\r\n";
+    // The dashboard keeps reporting the old state, only the state source sees the change
+    replies["robotMode"] = "robotMode: POWER_OFF\r\n";
+    replies["task -s"] = "Task is stopped\r\n";
+    return replies;
+}
+
+TEST(DashboardClientStateSourceTest, wait_on_state_source) {
+    FakeDashboardServer server(controlReplies());
+    DashboardClient client;
+    auto source = std::make_shared<FakeStateSource>();
+    client.setStateSource(source);
+    ASSERT_TRUE(client.connect("127.0.0.1", server.port()));
+
+    std::thread robot([&]() {
+        std::this_thread::sleep_for(milliseconds(50));
+        DashboardStatus s;
+        s.robot_mode = RobotMode::IDLE;
+        source->set(s);
+    });
+    auto start = steady_clock::now();
+    EXPECT_TRUE(client.powerOn());
+    robot.join();
+    EXPECT_LT(steady_clock::now() - start, milliseconds(1000));
+
+    DashboardStatus s;
+    s.robot_mode = RobotMode::RUNNING;
+    s.task_status = TaskStatus::PLAYING;
+    s.speed_scaling = 30;
+    source->set(s);
+    EXPECT_TRUE(client.playProgram());
+    EXPECT_TRUE(client.setSpeedScaling(30));
+    // No polling of the dashboard
+    EXPECT_EQ(server.count("robotMode"), 0);
+    EXPECT_EQ(server.count("task -s"), 0);
+    EXPECT_EQ(server.count("status"), 0);
+    EXPECT_EQ(source->waits, 3);
+    client.disconnect();
+}
+
+TEST(DashboardClientStateSourceTest, fallback_to_polling) {
+    auto replies = controlReplies();
+    replies["robotMode"] = "robotMode: RUNNING\r\n";
+    FakeDashboardServer server(replies);
+    DashboardClient client;
+    auto source = std::make_shared<FakeStateSource>();
+    source->available = false;
+    client.setStateSource(source);
+    ASSERT_TRUE(client.connect("127.0.0.1", server.port()));
+    EXPECT_TRUE(client.powerOn());
+    EXPECT_EQ(source->waits, 1);
+    EXPECT_EQ(server.count("robotMode"), 1);
+
+    // An unconnected RTSI interface is unavailable
+    auto rtsi = std::make_shared<RtsiIOInterface>(std::vector<std::string>{"robot_mode"}, std::vector<std::string>{}, 250);
+    client.setStateSource(std::make_shared<RtsiDashboardStateSource>(rtsi));
+    EXPECT_TRUE(client.powerOn());
+    EXPECT_EQ(server.count("robotMode"), 2);
+
+    client.setStateSource(nullptr);
+    EXPECT_TRUE(client.powerOn());
+    EXPECT_EQ(server.count("robotMode"), 3);
+    client.disconnect();
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
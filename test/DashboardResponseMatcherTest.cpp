@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <regex>
+#include <string>
+#include <vector>
+#include "Dashboard/DashboardResponseMatcher.hpp"
+
+using namespace ELITE;
+using namespace ELITE::DASHBOARD_RESPONSE;
+
+// The matchers must behave like the regex they replace
+static void expectSameAsRegex(const DashboardResponseMatcher& matcher, const std::string& regex,
+                              const std::vector<std::string>& responses) {
+    std::regex re(regex);
+    for (auto& response : responses) {
+        SCOPED_TRACE(response);
+        std::smatch match;
+        bool regex_found = std::regex_search(response, match, re);
+        std::string matched;
+        EXPECT_EQ(matcher.search(response, &matched), regex_found);
+        if (regex_found) {
+            EXPECT_EQ(matched, match[0].str());
+        }
+        EXPECT_EQ(matcher.matchAll(response), std::regex_match(response, re));
+    }
+}
+
+TEST(DashboardResponseMatcherTest, literal) {
+    expectSameAsRegex(DashboardResponseMatcher::literal("Powering on\r\n"), "Powering on\r\n",
+                      {"Powering on\r\n", "Powering on", "Powering off\r\n", "xx Powering on\r\n", ""});
+    expectSameAsRegex(DashboardResponseMatcher::literal("Task is running\r\n"), "Task is running\r\n",
+                      {"Task is running\r\n", "Task is running\r\nTask", "Task is paused\r\n"});
+    // Regex special characters are plain text
+    auto path = DashboardResponseMatcher::literal("Relative path:a.task\r\n");
+    EXPECT_TRUE(path.matchAll("Relative path:a.task\r\n"));
+    EXPECT_FALSE(path.matchAll("Relative path:abtask\r\n"));
+}
+
+TEST(DashboardResponseMatcherTest, line_prefix) {
+    std::vector<std::string> responses = {"robotMode: RUNNING\r\n", "robotMode: RUNNING", "robotMode:\r\n",
+                                          "xx robotMode: IDLE\r\nrobotMode: RUNNING\r\n", "robot Mode: IDLE\r\n", ""};
+    expectSameAsRegex(DashboardResponseMatcher::linePrefix("robotMode:"), "robotMode:.*", responses);
+    expectSameAsRegex(DashboardResponseMatcher::linePrefix("Task is "), "Task is .*",
+                      {"Task is stopped\r\n", "Task is \n", "Task is", "task is stopped"});
+}
+
+TEST(DashboardResponseMatcherTest, regex) {
+    expectSameAsRegex(DashboardResponseMatcher::regex("robotMode: (RUNNING|IDLE)\r\n"), "robotMode: (RUNNING|IDLE)\r\n",
+                      {"robotMode: RUNNING\r\n", "robotMode: IDLE\r\n", "robotMode: POWER_OFF\r\n"});
+    EXPECT_EQ(DashboardResponseMatcher::regex("a.*").kind(), DashboardResponseMatcher::Kind::REGEX);
+    EXPECT_EQ(DashboardResponseMatcher::regex("a.*").pattern(), "a.*");
+}
+
+TEST(DashboardResponseMatcherTest, typed_parsers) {
+    EXPECT_EQ(parseRobotMode("robotMode: RUNNING"), RobotMode::RUNNING);
+    EXPECT_EQ(parseRobotMode("robotMode: BACK_DRIVE\r\n"), RobotMode::BACKDRIVE);
+    EXPECT_EQ(parseRobotMode("robotMode: RUNNING_X"), RobotMode::UNKNOWN);
+    EXPECT_EQ(parseRobotMode("robotMode RUNNING"), RobotMode::UNKNOWN);
+    EXPECT_EQ(parseSafetyMode("Safety status: TP_THREE_POSITION_ENABLING_STOP"), SafetyMode::TP_THREE_POSITION_ENABLING_STOP);
+    EXPECT_EQ(parseSafetyMode("Safety status: NORMAL\r\n"), SafetyMode::NORMAL);
+    EXPECT_EQ(parseTaskStatus("Task is paused"), TaskStatus::PAUSED);
+    EXPECT_EQ(parseTaskStatus("Task is running"), TaskStatus::PLAYING);
+    EXPECT_EQ(parseRunningStatus("RunningStatus: PAUSED"), TaskStatus::PAUSED);
+    EXPECT_EQ(parseRunningStatus("RunningStatus: RUNNING"), TaskStatus::PLAYING);
+    EXPECT_EQ(parseRunningStatus("RunningStatus: STOPPED"), TaskStatus::STOPPED);
+
+    int value = 0;
+    EXPECT_TRUE(parseIntValue("Target Speed Fraction: 80", value));
+    EXPECT_EQ(value, 80);
+    EXPECT_TRUE(parseIntValue("Target Speed Fraction: 100%\r\n", value));
+    EXPECT_EQ(value, 100);
+    EXPECT_TRUE(parseIntValue("Value: -5", value));
+    EXPECT_EQ(value, -5);
+    EXPECT_FALSE(parseIntValue("Target Speed Fraction: ", value));
+    EXPECT_FALSE(parseIntValue("Target Speed Fraction: x1", value));
+    EXPECT_FALSE(parseIntValue("Target Speed Fraction 80", value));
+    EXPECT_FALSE(parseIntValue("Value: 99999999999", value));
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
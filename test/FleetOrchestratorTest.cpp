@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Common/SshSessionPool.hpp"
+#include "Common/SshTransfer.hpp"
+#include "Elite/FleetOrchestrator.hpp"
+
+using namespace ELITE;
+using namespace ELITE::SSH_UTILS;
+using namespace std::chrono;
+
+static std::string s_cwd;
+
+// Stands in for a controller: the commands run in a local shell without the login profile, "/tmp" and the robot data path
+// are a directory of the robot.
+class FakeRobot : public SshConnection {
+   public:
+    explicit FakeRobot(const std::string& dir) : dir_(dir) {}
+
+    std::unique_ptr<SshChannel> exec(const std::string& cmd) override {
+        std::string local_cmd = cmd;
+        size_t pos = local_cmd.find("bash -lc ");
+        if (pos != std::string::npos) {
+            local_cmd.replace(pos, 9, "bash -c ");
+        }
+        // The robot directory may contain "/tmp/" itself, so its paths are left alone and the search continues after the
+        // inserted text
+        std::string mapped;
+        size_t begin = 0;
+        while ((pos = local_cmd.find("/tmp/", begin)) != std::string::npos) {
+            size_t own = local_cmd.find(dir_ + "/", begin);
+            if (own != std::string::npos && own <= pos) {
+                mapped.append(local_cmd, begin, own + dir_.size() + 1 - begin);
+                begin = own + dir_.size() + 1;
+                continue;
+            }
+            mapped.append(local_cmd, begin, pos - begin).append(dir_ + "/");
+            begin = pos + 5;
+        }
+        local_cmd = mapped + local_cmd.substr(begin);
+        return spawnProcess({"env", "RT_ROBOT_DATA_PATH=" + dir_ + "/", "/bin/sh", "-c", local_cmd});
+    }
+
+   private:
+    std::string dir_;
+};
+
+static std::string robotDir(const std::string& ip) { return s_cwd + "/fleet_test_" + ip; }
+
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+class FleetOrchestratorTest : public ::testing::Test {
+   protected:
+    std::vector<std::string> ips_ = {"10.0.0.1", "10.0.0.2", "10.0.0.3", "10.0.0.4"};
+
+    void SetUp() override {
+        for (auto& ip : ips_) {
+            std::system(("rm -rf " + robotDir(ip) + " && mkdir -p " + robotDir(ip) + "/log").c_str());
+        }
+        SshSessionPool::instance().clear();
+        SshSessionPool::instance().setConnector(
+            [](const std::string& host, const std::string& user, const std::string& password) -> std::shared_ptr<SshConnection> {
+                // 10.0.0.9 is not reachable
+                if (host == "10.0.0.9" || password != "elibot") {
+                    return nullptr;
+                }
+                return std::make_shared<FakeRobot>(robotDir(host));
+            });
+    }
+
+    void TearDown() override {
+        SshSessionPool::instance().clear();
+        SshSessionPool::instance().setConnector(nullptr);
+        for (auto& ip : ips_) {
+            std::system(("rm -rf " + robotDir(ip)).c_str());
+        }
+    }
+};
+
+TEST_F(FleetOrchestratorTest, upgrade) {
+    // The package records that it was run with "--app"
+    std::string package = "#!/bin/sh\necho \"$1\" > \"$(dirname \"$0\")/installed\"\n# " + std::string(100 * 1024, 'x') + "\n";
+    {
+        std::ofstream file("fleet_test_package.eup", std::ios::binary);
+        file << package;
+    }
+
+    FleetOptions options;
+    options.max_workers = 2;
+    options.max_bytes_per_second = 1024 * 1024;
+    FleetOrchestrator fleet(options);
+    std::mutex mutex;
+    std::map<std::string, std::vector<FleetStage>> stages;
+    std::map<std::string, uint64_t> uploaded;
+    fleet.setProgressCallback([&](const std::string& ip, FleetStage stage, uint64_t total, uint64_t done, const char* err) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stages[ip].empty() || stages[ip].back() != stage) {
+            stages[ip].push_back(stage);
+        }
+        if (stage == FleetStage::UPLOAD) {
+            EXPECT_EQ(total, package.size());
+            uploaded[ip] = done;
+        }
+    });
+
+    auto hosts = ips_;
+    hosts.push_back("10.0.0.9");
+    auto summary = fleet.upgradeControlSoftware(hosts, "fleet_test_package.eup", "elibot");
+    std::remove("fleet_test_package.eup");
+
+    EXPECT_EQ(summary.succeeded, 4u);
+    EXPECT_EQ(summary.failed, 1u);
+    EXPECT_EQ(summary.bytes, 4 * package.size());
+    // 4 uploads at 1 MiB/s in total
+    EXPECT_GE(summary.elapsed, milliseconds(250));
+    ASSERT_EQ(summary.hosts.size(), 5u);
+    for (size_t i = 0; i < ips_.size(); i++) {
+        auto& ip = ips_[i];
+        EXPECT_EQ(summary.hosts[i].ip, ip);
+        EXPECT_TRUE(summary.hosts[i].success);
+        EXPECT_EQ(readFile(robotDir(ip) + "/CS_UPDATE.eup"), package);
+        EXPECT_EQ(readFile(robotDir(ip) + "/installed"), "--app\n");
+        std::vector<FleetStage> expected = {FleetStage::CONNECT, FleetStage::UPLOAD, FleetStage::INSTALL, FleetStage::DONE};
+        EXPECT_EQ(stages[ip], expected);
+        EXPECT_EQ(uploaded[ip], package.size());
+    }
+    EXPECT_FALSE(summary.hosts[4].success);
+    EXPECT_EQ(summary.hosts[4].error, "SSH connection failed");
+    EXPECT_EQ(stages["10.0.0.9"].back(), FleetStage::FAILED);
+
+    std::string text = summary.toString();
+    EXPECT_EQ(text.find("4 succeeded, 1 failed"), 0u);
+    EXPECT_NE(text.find("10.0.0.9         FAILED  SSH connection failed"), std::string::npos);
+
+    // A missing file fails every robot
+    summary = fleet.upgradeControlSoftware(ips_, "fleet_test_missing.eup", "elibot");
+    EXPECT_EQ(summary.failed, 4u);
+}
+
+TEST_F(FleetOrchestratorTest, download_logs) {
+    for (auto& ip : ips_) {
+        std::ofstream file(robotDir(ip) + "/log/log_history.csv", std::ios::binary);
+        file << "time,level,message\n1,INFO," << ip << "\n";
+    }
+    std::system(("mkdir -p " + s_cwd + "/fleet_test_logs").c_str());
+
+    FleetOrchestrator fleet;
+    auto summary = fleet.downloadSystemLogs(ips_, "fleet_test_logs", "elibot");
+    EXPECT_EQ(summary.succeeded, 4u);
+    for (auto& ip : ips_) {
+        EXPECT_EQ(readFile("fleet_test_logs/" + ip + "_log_history.csv"), "time,level,message\n1,INFO," + ip + "\n");
+    }
+    // Each robot logged in once
+    EXPECT_EQ(SshSessionPool::instance().size(), 4u);
+
+    summary = fleet.downloadSystemLogs(ips_, "fleet_test_logs", "wrong");
+    EXPECT_EQ(summary.failed, 4u);
+    std::system(("rm -rf " + s_cwd + "/fleet_test_logs").c_str());
+}
+
+int main(int argc, char** argv) {
+    char* cwd = std::getenv("PWD");
+    s_cwd = cwd ? cwd : ".";
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,135 @@
+#include <Elite/ClassLoader.hpp>
+#include <Elite/KinematicsBase.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ELITE;
+
+namespace {
+
+// MDH of a CS63 like arm
+const vector6d_t TEST_ALPHA = {0, M_PI / 2, 0, 0, M_PI / 2, -M_PI / 2};
+const vector6d_t TEST_A = {0, 0, -0.427, -0.357, 0, 0};
+const vector6d_t TEST_D = {0.1215, 0, 0, 0.1225, 0.1025, 0.094};
+
+std::string findPluginLibraryPath(const std::string& lib_name) {
+    const std::array<std::string, 5> candidates = {
+        "../build/plugin/kinematics/" + lib_name, "build/plugin/kinematics/" + lib_name, "plugin/kinematics/" + lib_name,
+        "../plugin/kinematics/" + lib_name,       "./" + lib_name,
+    };
+    for (const auto& candidate : candidates) {
+        if (std::filesystem::exists(candidate)) {
+            return candidate;
+        }
+    }
+    return "";
+}
+
+bool poseNear(const vector6d_t& l, const vector6d_t& r, double tolerance) {
+    for (size_t i = 0; i < 6; i++) {
+        if (std::abs(l[i] - r[i]) > tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+class KdlKinematicsPluginTest : public ::testing::Test {
+   protected:
+    std::unique_ptr<ClassLoader> loader_;
+    std::unique_ptr<KinematicsBase> solver_;
+
+    void SetUp() override {
+        const std::string path = findPluginLibraryPath("libelite_kdl_kinematics.so");
+        if (path.empty()) {
+            GTEST_SKIP() << "KDL kinematics plugin library not found in expected build paths";
+        }
+        loader_.reset(new ClassLoader(path));
+        ASSERT_TRUE(loader_->loadLib());
+        solver_ = loader_->createUniqueInstance<KinematicsBase>("ELITE::KdlKinematicsPlugin");
+        ASSERT_NE(solver_, nullptr);
+        solver_->setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    }
+
+    void TearDown() override {
+        solver_.reset();
+        loader_.reset();
+    }
+};
+
+}  // namespace
+
+TEST_F(KdlKinematicsPluginTest, IkReachesThePose) {
+    vector6d_t q = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+    vector6d_t pose;
+    ASSERT_TRUE(solver_->getPositionFK(q, pose));
+
+    vector6d_t seed = q;
+    seed[0] += 0.05;
+    seed[4] -= 0.05;
+    vector6d_t solution;
+    KinematicsResult result;
+    ASSERT_TRUE(solver_->getPositionIK(pose, seed, solution, result));
+    vector6d_t check;
+    ASSERT_TRUE(solver_->getPositionFK(solution, check));
+    EXPECT_TRUE(poseNear(pose, check, 1e-5));
+}
+
+TEST_F(KdlKinematicsPluginTest, SetMDHDuringQueries) {
+    vector6d_t q = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+    vector6d_t a = TEST_A;
+    a[2] = TEST_A[2] - 0.001;
+    // The FK of both models, a query sees one or the other but never a mix
+    vector6d_t pose_a;
+    vector6d_t pose_b;
+    solver_->setMDH(TEST_ALPHA, a, TEST_D);
+    ASSERT_TRUE(solver_->getPositionFK(q, pose_b));
+    solver_->setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    ASSERT_TRUE(solver_->getPositionFK(q, pose_a));
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> fk_failures{0};
+    std::atomic<int> ik_failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t]() {
+            while (!stop) {
+                if (t % 2 == 0) {
+                    vector6d_t pose;
+                    if (!solver_->getPositionFK(q, pose) || !(poseNear(pose, pose_a, 1e-12) || poseNear(pose, pose_b, 1e-12))) {
+                        fk_failures++;
+                    }
+                } else {
+                    // Both models reach the pose from the seed
+                    vector6d_t solution;
+                    KinematicsResult result;
+                    if (!solver_->getPositionIK(pose_a, q, solution, result)) {
+                        ik_failures++;
+                    }
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 2000; i++) {
+        solver_->setMDH(TEST_ALPHA, (i % 2) ? TEST_A : a, TEST_D);
+    }
+    stop = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(fk_failures, 0);
+    EXPECT_EQ(ik_failures, 0);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,72 @@
+// Compile the log macros below WARN out in this file
+#define ELITE_LOG_COMPILE_LEVEL 2
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Elite/Log.hpp"
+
+using namespace ELITE;
+
+class CountLogHandler : public LogHandler {
+   public:
+    explicit CountLogHandler(std::vector<std::string>& messages) : messages_(messages) {}
+
+    void log(const char* file, int line, LogLevel loglevel, const char* log) override { messages_.push_back(log); }
+
+   private:
+    std::vector<std::string>& messages_;
+};
+
+static int s_evaluated = 0;
+
+static int evaluate() { return ++s_evaluated; }
+
+TEST(LogCompileLevelTest, compiled_out) {
+    std::vector<std::string> messages;
+    registerLogHandler(std::make_unique<CountLogHandler>(messages));
+    setLogLevel(LogLevel::ELI_DEBUG);
+
+    ELITE_LOG_DEBUG("debug %d", evaluate());
+    ELITE_LOG_INFO("info %d", evaluate());
+    EXPECT_EQ(s_evaluated, 0);
+    EXPECT_TRUE(messages.empty());
+
+    ELITE_LOG_WARN("warn %d", evaluate());
+    ELITE_LOG_ERROR("error %d", evaluate());
+    EXPECT_EQ(s_evaluated, 2);
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_EQ(messages[0], "warn 1");
+    EXPECT_EQ(messages[1], "error 2");
+
+    unregisterLogHandler();
+    setLogLevel(LogLevel::ELI_INFO);
+}
+
+TEST(LogCompileLevelTest, runtime_level_skips_arguments) {
+    std::vector<std::string> messages;
+    registerLogHandler(std::make_unique<CountLogHandler>(messages));
+    setLogLevel(LogLevel::ELI_ERROR);
+    EXPECT_EQ(getLogLevel(), LogLevel::ELI_ERROR);
+
+    int before = s_evaluated;
+    ELITE_LOG_WARN("warn %d", evaluate());
+    EXPECT_EQ(s_evaluated, before);
+    EXPECT_TRUE(messages.empty());
+
+    // The macros are single statements
+    if (messages.empty())
+        ELITE_LOG_ERROR("error");
+    else
+        ELITE_LOG_INFO("unreachable");
+    EXPECT_EQ(messages.size(), 1u);
+
+    unregisterLogHandler();
+    setLogLevel(LogLevel::ELI_INFO);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
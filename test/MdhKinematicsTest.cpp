@@ -0,0 +1,251 @@
+#include <Elite/JacobianAlgebra.hpp>
+#include <Elite/KinematicsBase.hpp>
+#include <Elite/MdhKinematics.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ELITE;
+
+namespace {
+
+typedef std::array<std::array<double, 4>, 4> Matrix4;
+
+// MDH of a CS63 like arm
+const vector6d_t TEST_ALPHA = {0, M_PI / 2, 0, 0, M_PI / 2, -M_PI / 2};
+const vector6d_t TEST_A = {0, 0, -0.427, -0.357, 0, 0};
+const vector6d_t TEST_D = {0.1215, 0, 0, 0.1225, 0.1025, 0.094};
+
+Matrix4 multiply(const Matrix4& l, const Matrix4& r) {
+    Matrix4 out{};
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            for (int k = 0; k < 4; k++) {
+                out[i][j] += l[i][k] * r[k][j];
+            }
+        }
+    }
+    return out;
+}
+
+// Straightforward product of the homogeneous matrices of the chain
+Matrix4 referenceFK(const vector6d_t& q) {
+    Matrix4 t = {{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}}};
+    for (int i = 0; i < 6; i++) {
+        double ca = std::cos(TEST_ALPHA[i]), sa = std::sin(TEST_ALPHA[i]);
+        double c = std::cos(q[i]), s = std::sin(q[i]);
+        Matrix4 rot_x = {{{1, 0, 0, 0}, {0, ca, -sa, 0}, {0, sa, ca, 0}, {0, 0, 0, 1}}};
+        Matrix4 trans = {{{1, 0, 0, TEST_A[i]}, {0, 1, 0, 0}, {0, 0, 1, TEST_D[i]}, {0, 0, 0, 1}}};
+        Matrix4 rot_z = {{{c, -s, 0, 0}, {s, c, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}}};
+        t = multiply(multiply(multiply(t, rot_x), trans), rot_z);
+    }
+    return t;
+}
+
+Matrix4 poseToMatrix(const vector6d_t& pose) {
+    double cr = std::cos(pose[3]), sr = std::sin(pose[3]);
+    double cp = std::cos(pose[4]), sp = std::sin(pose[4]);
+    double cy = std::cos(pose[5]), sy = std::sin(pose[5]);
+    return {{{cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr, pose[0]},
+             {sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr, pose[1]},
+             {-sp, cp * sr, cp * cr, pose[2]},
+             {0, 0, 0, 1}}};
+}
+
+void expectMatrixNear(const Matrix4& expected, const Matrix4& actual) {
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 4; j++) {
+            EXPECT_NEAR(expected[i][j], actual[i][j], 1e-9) << "[" << i << "][" << j << "]";
+        }
+    }
+}
+
+std::vector<vector6d_t> randomConfigurations(size_t n) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-M_PI, M_PI);
+    std::vector<vector6d_t> q(n);
+    for (auto& one : q) {
+        for (auto& v : one) {
+            v = dist(gen);
+        }
+    }
+    return q;
+}
+
+// A solver with only the scalar FK, to check the default batch and Jacobian implementations
+class ScalarKinematics : public KinematicsBase {
+   public:
+    MdhKinematics mdh_;
+    size_t fail_at_ = static_cast<size_t>(-1);
+    mutable size_t calls_ = 0;
+
+    void setMDH(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d) override {
+        mdh_ = MdhKinematics(alpha, a, d);
+    }
+
+    bool getPositionFK(const vector6d_t& joint_angles, vector6d_t& poses) const override {
+        if (calls_++ == fail_at_) {
+            return false;
+        }
+        mdh_.forward(joint_angles, poses);
+        return true;
+    }
+
+    bool getPositionIK(const vector6d_t&, const vector6d_t&, vector6d_t&, KinematicsResult& result) const override {
+        result.kinematic_error = KinematicError::NO_SOLUTION;
+        return false;
+    }
+
+    bool getPositionIK(const vector6d_t&, const vector6d_t&, std::vector<vector6d_t>&,
+                       KinematicsResult& result) const override {
+        result.kinematic_error = KinematicError::NO_SOLUTION;
+        return false;
+    }
+};
+
+}  // namespace
+
+TEST(MdhKinematicsTest, ForwardMatchesMatrixChain) {
+    MdhKinematics mdh(TEST_ALPHA, TEST_A, TEST_D);
+    for (auto& q : randomConfigurations(100)) {
+        vector6d_t pose;
+        mdh.forward(q, pose);
+        expectMatrixNear(referenceFK(q), poseToMatrix(pose));
+    }
+}
+
+TEST(MdhKinematicsTest, ZeroPose) {
+    MdhKinematics mdh(TEST_ALPHA, TEST_A, TEST_D);
+    vector6d_t pose;
+    mdh.forward(vector6d_t{0, 0, 0, 0, 0, 0}, pose);
+    expectMatrixNear(referenceFK(vector6d_t{0, 0, 0, 0, 0, 0}), poseToMatrix(pose));
+}
+
+TEST(MdhKinematicsTest, BatchMatchesScalar) {
+    MdhKinematics mdh(TEST_ALPHA, TEST_A, TEST_D);
+    // Not a multiple of the block size, so the last block is partial
+    auto q = randomConfigurations(MdhKinematics::BLOCK * 5 + 3);
+    std::vector<vector6d_t> poses(q.size());
+    mdh.forwardBatch(q.data(), poses.data(), q.size());
+    for (size_t i = 0; i < q.size(); i++) {
+        vector6d_t expected;
+        mdh.forward(q[i], expected);
+        for (size_t j = 0; j < 6; j++) {
+            EXPECT_NEAR(expected[j], poses[i][j], 1e-12) << "configuration " << i << " element " << j;
+        }
+    }
+}
+
+TEST(MdhKinematicsTest, ThreadedBatchMatchesSingleThread) {
+    MdhKinematics mdh(TEST_ALPHA, TEST_A, TEST_D);
+    auto q = randomConfigurations(MdhKinematics::MIN_CONFIGS_PER_THREAD * 4 + 5);
+    std::vector<vector6d_t> single(q.size());
+    std::vector<vector6d_t> threaded(q.size());
+    mdh.forwardBatch(q.data(), single.data(), q.size(), 1);
+    mdh.forwardBatch(q.data(), threaded.data(), q.size(), 4);
+    EXPECT_EQ(single, threaded);
+}
+
+TEST(MdhKinematicsTest, DefaultBatchCallsScalarFK) {
+    ScalarKinematics solver;
+    solver.setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    auto q = randomConfigurations(10);
+    std::vector<vector6d_t> poses(q.size());
+    ASSERT_TRUE(solver.getPositionFKBatch(q.data(), poses.data(), q.size()));
+    EXPECT_EQ(solver.calls_, q.size());
+    for (size_t i = 0; i < q.size(); i++) {
+        expectMatrixNear(referenceFK(q[i]), poseToMatrix(poses[i]));
+    }
+
+    solver.calls_ = 0;
+    solver.fail_at_ = 3;
+    EXPECT_FALSE(solver.getPositionFKBatch(q.data(), poses.data(), q.size()));
+    EXPECT_EQ(solver.calls_, 4u);
+}
+
+TEST(MdhKinematicsTest, JacobianMatchesNumericDefault) {
+    MdhKinematics mdh(TEST_ALPHA, TEST_A, TEST_D);
+    ScalarKinematics solver;
+    solver.setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    for (auto& q : randomConfigurations(50)) {
+        matrix6d_t closed_form;
+        matrix6d_t numeric;
+        mdh.jacobian(q, closed_form);
+        ASSERT_TRUE(solver.getJacobian(q, numeric));
+        for (size_t i = 0; i < 6; i++) {
+            for (size_t j = 0; j < 6; j++) {
+                EXPECT_NEAR(closed_form[i][j], numeric[i][j], 1e-6) << "[" << i << "][" << j << "]";
+            }
+        }
+    }
+}
+
+TEST(MdhKinematicsTest, JointVelocityInvertsTwist) {
+    ScalarKinematics solver;
+    solver.setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    const vector6d_t q = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+    const vector6d_t qd = {0.1, -0.2, 0.3, 0.05, -0.4, 0.25};
+    vector6d_t twist;
+    ASSERT_TRUE(solver.getTwist(q, qd, twist));
+
+    vector6d_t exact;
+    ASSERT_TRUE(solver.getJointVelocity(q, twist, exact, 0));
+    vector6d_t damped;
+    ASSERT_TRUE(solver.getJointVelocity(q, twist, damped));
+    for (size_t i = 0; i < 6; i++) {
+        EXPECT_NEAR(qd[i], exact[i], 1e-9);
+        EXPECT_NEAR(qd[i], damped[i], 1e-3);
+    }
+}
+
+TEST(MdhKinematicsTest, ManipulabilityAndConditionNumber) {
+    MdhKinematics mdh(TEST_ALPHA, TEST_A, TEST_D);
+    for (auto& q : randomConfigurations(20)) {
+        matrix6d_t jacobian;
+        mdh.jacobian(q, jacobian);
+        vector6d_t sigma;
+        JacobianAlgebra::singularValues(jacobian, sigma);
+        // The squared singular values sum to the squared Frobenius norm
+        double frobenius = 0;
+        double sum = 0;
+        double product = 1;
+        for (size_t i = 0; i < 6; i++) {
+            sum += sigma[i] * sigma[i];
+            product *= sigma[i];
+            for (size_t j = 0; j < 6; j++) {
+                frobenius += jacobian[i][j] * jacobian[i][j];
+            }
+        }
+        EXPECT_NEAR(frobenius, sum, 1e-9);
+        EXPECT_NEAR(JacobianAlgebra::manipulability(jacobian), product, 1e-9);
+        EXPECT_NEAR(JacobianAlgebra::conditionNumber(jacobian), sigma[0] / sigma[5], 1e-6 * sigma[0] / sigma[5]);
+    }
+}
+
+TEST(MdhKinematicsTest, WristSingularityBoundsJointVelocity) {
+    ScalarKinematics solver;
+    solver.setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    // Joints 4 and 6 are aligned at q5 = 0
+    const vector6d_t q = {0.3, -1.2, 1.4, -1.6, 0.0, 0.2};
+    double manipulability = 1;
+    double condition_number = 0;
+    ASSERT_TRUE(solver.getManipulability(q, manipulability));
+    ASSERT_TRUE(solver.getConditionNumber(q, condition_number));
+    EXPECT_NEAR(manipulability, 0, 1e-8);
+    EXPECT_GT(condition_number, 1e6);
+
+    vector6d_t qd;
+    ASSERT_TRUE(solver.getJointVelocity(q, vector6d_t{0, 0, 0, 0.1, 0.1, 0.1}, qd));
+    for (double v : qd) {
+        EXPECT_LT(std::fabs(v), 1e3);
+    }
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,383 @@
+#include <gtest/gtest.h>
+#include <boost/asio.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Elite/ModbusRtuClient.hpp"
+#include "Elite/SerialCommunicationImpl.hpp"
+
+using namespace ELITE;
+using namespace std::chrono;
+
+// A local stand-in of the socat TCP port of the robot, with Modbus RTU slaves on the serial line.
+// The frames are cut from the stream by their length, and answered in order after a delay.
+class FakeModbusSlaves {
+   public:
+    explicit FakeModbusSlaves(int response_delay_ms = 0)
+        : response_delay_(response_delay_ms),
+          acceptor_(io_context_, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)) {
+        reader_ = std::thread([this]() { readLoop(); });
+        responder_ = std::thread([this]() { respondLoop(); });
+    }
+
+    ~FakeModbusSlaves() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        boost::system::error_code ec;
+        acceptor_.close(ec);
+        socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+        reader_.join();
+        responder_.join();
+    }
+
+    int port() { return acceptor_.local_endpoint().port(); }
+
+    void setRegister(uint8_t slave, uint16_t address, uint16_t value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        registers_[slave][address] = value;
+    }
+
+    uint16_t getRegister(uint8_t slave, uint16_t address) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return registers_[slave][address];
+    }
+
+    // Slaves that are not on the line
+    void setAbsent(uint8_t slave) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        absent_.insert(slave);
+    }
+
+    void corruptNextResponse() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        corrupt_next_ = true;
+    }
+
+    // The next write response echoes a wrong value, with a valid CRC
+    void wrongNextEcho() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wrong_echo_next_ = true;
+    }
+
+    size_t requestCount() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return responses_at_arrival_.size();
+    }
+
+    // For each request, the number of responses sent before it arrived
+    std::vector<int> responsesAtArrival() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return responses_at_arrival_;
+    }
+
+   private:
+    static uint16_t crc(const std::vector<uint8_t>& data) { return ModbusRtuClient::crc16(data.data(), data.size()); }
+
+    static size_t frameSize(const std::vector<uint8_t>& stream) {
+        if (stream.size() < 2) {
+            return 0;
+        }
+        if (stream[1] == 0x0F || stream[1] == 0x10) {
+            return stream.size() < 7 ? 0 : 9 + stream[6];
+        }
+        return 8;
+    }
+
+    void readLoop() {
+        boost::system::error_code ec;
+        acceptor_.accept(socket_, ec);
+        std::vector<uint8_t> stream;
+        uint8_t buffer[256];
+        while (!ec) {
+            size_t n = socket_.read_some(boost::asio::buffer(buffer), ec);
+            stream.insert(stream.end(), buffer, buffer + n);
+            size_t size;
+            while ((size = frameSize(stream)) > 0 && stream.size() >= size) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                frames_.emplace_back(stream.begin(), stream.begin() + size);
+                responses_at_arrival_.push_back(responses_sent_);
+                stream.erase(stream.begin(), stream.begin() + size);
+                cv_.notify_all();
+            }
+        }
+    }
+
+    void respondLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this]() { return stopping_ || !frames_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            std::vector<uint8_t> frame = frames_.front();
+            frames_.pop_front();
+            lock.unlock();
+            std::this_thread::sleep_for(milliseconds(response_delay_));
+            lock.lock();
+            std::vector<uint8_t> response = answer(frame);
+            if (response.empty()) {
+                continue;
+            }
+            if (corrupt_next_) {
+                corrupt_next_ = false;
+                response.back() ^= 0xFF;
+            }
+            responses_sent_++;
+            lock.unlock();
+            boost::system::error_code ec;
+            boost::asio::write(socket_, boost::asio::buffer(response), ec);
+            lock.lock();
+        }
+    }
+
+    // Called with the lock held
+    std::vector<uint8_t> answer(const std::vector<uint8_t>& frame) {
+        uint8_t slave = frame[0];
+        uint8_t function = frame[1];
+        if (absent_.count(slave) || crc(std::vector<uint8_t>(frame.begin(), frame.end() - 2)) !=
+                                        (frame[frame.size() - 2] | (frame[frame.size() - 1] << 8))) {
+            return {};
+        }
+        uint16_t address = (frame[2] << 8) | frame[3];
+        uint16_t value = (frame[4] << 8) | frame[5];
+        auto& table = registers_[slave];
+        std::vector<uint8_t> response = {slave, function};
+        if (address >= 1000) {
+            // Illegal data address
+            response[1] |= 0x80;
+            response.push_back(0x02);
+        } else if (function == 0x03 || function == 0x01) {
+            if (function == 0x03) {
+                response.push_back(static_cast<uint8_t>(value * 2));
+                for (uint16_t i = 0; i < value; i++) {
+                    response.push_back(table[address + i] >> 8);
+                    response.push_back(table[address + i] & 0xFF);
+                }
+            } else {
+                response.push_back(static_cast<uint8_t>((value + 7) / 8));
+                response.resize(3 + (value + 7) / 8, 0);
+                for (uint16_t i = 0; i < value; i++) {
+                    if (table[address + i]) {
+                        response[3 + i / 8] |= 1 << (i % 8);
+                    }
+                }
+            }
+        } else {
+            if (function == 0x06) {
+                table[address] = value;
+            } else if (function == 0x05) {
+                table[address] = value == 0xFF00 ? 1 : 0;
+            } else if (function == 0x10) {
+                for (uint16_t i = 0; i < value; i++) {
+                    table[address + i] = (frame[7 + i * 2] << 8) | frame[8 + i * 2];
+                }
+            } else if (function == 0x0F) {
+                for (uint16_t i = 0; i < value; i++) {
+                    table[address + i] = (frame[7 + i / 8] >> (i % 8)) & 1;
+                }
+            }
+            response.insert(response.end(), frame.begin() + 2, frame.begin() + 6);
+            if (wrong_echo_next_) {
+                wrong_echo_next_ = false;
+                response[5] ^= 0x01;
+            }
+        }
+        uint16_t response_crc = crc(response);
+        response.push_back(response_crc & 0xFF);
+        response.push_back(response_crc >> 8);
+        return response;
+    }
+
+    int response_delay_;
+    boost::asio::io_context io_context_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    boost::asio::ip::tcp::socket socket_{io_context_};
+    std::thread reader_;
+    std::thread responder_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::vector<uint8_t>> frames_;
+    std::map<uint8_t, std::map<uint16_t, uint16_t>> registers_;
+    std::set<uint8_t> absent_;
+    std::vector<int> responses_at_arrival_;
+    int responses_sent_ = 0;
+    bool corrupt_next_ = false;
+    bool wrong_echo_next_ = false;
+    bool stopping_ = false;
+};
+
+static std::shared_ptr<SerialCommunication> connectSerial(FakeModbusSlaves& slaves) {
+    auto serial = std::make_shared<SerialCommunicationImpl>(slaves.port(), "127.0.0.1", -1);
+    EXPECT_TRUE(serial->connect(1000));
+    return serial;
+}
+
+TEST(ModbusRtuClientTest, crc16) {
+    const uint8_t request[] = {0x01, 0x03, 0x00, 0x00, 0x00, 0x0A};
+    EXPECT_EQ(ModbusRtuClient::crc16(request, sizeof(request)), 0xCDC5);
+    const std::string check = "123456789";
+    EXPECT_EQ(ModbusRtuClient::crc16(reinterpret_cast<const uint8_t*>(check.data()), check.size()), 0x4B37);
+}
+
+TEST(ModbusRtuClientTest, read_write) {
+    FakeModbusSlaves slaves;
+    ModbusRtuClient client(connectSerial(slaves));
+
+    ASSERT_TRUE(client.writeMultipleRegisters(1, 10, {100, 200, 0xBEEF}));
+    ASSERT_TRUE(client.writeSingleRegister(1, 13, 7));
+    EXPECT_EQ(slaves.getRegister(1, 12), 0xBEEF);
+    std::vector<uint16_t> registers;
+    ASSERT_TRUE(client.readHoldingRegisters(1, 10, 4, registers));
+    EXPECT_EQ(registers, std::vector<uint16_t>({100, 200, 0xBEEF, 7}));
+
+    ASSERT_TRUE(client.writeMultipleCoils(2, 0, {true, false, true, true, false, false, false, false, true}));
+    ASSERT_TRUE(client.writeSingleCoil(2, 1, true));
+    std::vector<bool> coils;
+    ASSERT_TRUE(client.readCoils(2, 0, 9, coils));
+    EXPECT_EQ(coils, std::vector<bool>({true, true, true, true, false, false, false, false, true}));
+
+    uint16_t value = 0;
+    ASSERT_TRUE(client.getCachedValue(1, ModbusTable::HOLDING_REGISTER, 11, value));
+    EXPECT_EQ(value, 200);
+    ASSERT_TRUE(client.getCachedValue(2, ModbusTable::COIL, 1, value));
+    EXPECT_EQ(value, 1);
+    EXPECT_FALSE(client.getCachedValue(3, ModbusTable::COIL, 1, value));
+
+    // Out of the range of the function, nothing is sent
+    size_t sent = slaves.requestCount();
+    EXPECT_FALSE(client.readHoldingRegisters(1, 0, 126, registers));
+    // Past the last address
+    EXPECT_FALSE(client.readHoldingRegisters(1, 0xFFF0, 17, registers));
+    EXPECT_FALSE(client.writeMultipleRegisters(1, 0xFFFF, {1, 2}));
+    EXPECT_EQ(client.addPoll(1, ModbusTable::COIL, 0xFFFF, 2, 100), -1);
+    EXPECT_EQ(slaves.requestCount(), sent);
+}
+
+TEST(ModbusRtuClientTest, exception_response) {
+    FakeModbusSlaves slaves;
+    ModbusRtuClient client(connectSerial(slaves));
+    std::vector<uint16_t> registers;
+    EXPECT_FALSE(client.readHoldingRegisters(1, 1000, 1, registers));
+    EXPECT_EQ(client.getLastException(), 0x02);
+    // Not retried
+    EXPECT_EQ(slaves.requestCount(), 1);
+    EXPECT_TRUE(client.readHoldingRegisters(1, 0, 1, registers));
+    EXPECT_EQ(client.getLastException(), 0);
+}
+
+TEST(ModbusRtuClientTest, retry_and_timeout) {
+    FakeModbusSlaves slaves;
+    ModbusRtuOptions options;
+    options.response_timeout_ms = 100;
+    options.retries = 1;
+    ModbusRtuClient client(connectSerial(slaves), options);
+    slaves.setRegister(1, 0, 42);
+
+    // A broken CRC is retried
+    slaves.corruptNextResponse();
+    std::vector<uint16_t> registers;
+    ASSERT_TRUE(client.readHoldingRegisters(1, 0, 1, registers));
+    EXPECT_EQ(registers[0], 42);
+    EXPECT_EQ(slaves.requestCount(), 2);
+
+    // A write response echoing another value is retried
+    slaves.wrongNextEcho();
+    ASSERT_TRUE(client.writeSingleRegister(1, 1, 7));
+    EXPECT_EQ(slaves.requestCount(), 4);
+    slaves.wrongNextEcho();
+    ASSERT_TRUE(client.writeMultipleCoils(1, 2, {true, false, true}));
+    EXPECT_EQ(slaves.requestCount(), 6);
+
+    // An absent slave times out after the retries, the next request works
+    slaves.setAbsent(9);
+    auto start = steady_clock::now();
+    EXPECT_FALSE(client.readHoldingRegisters(9, 0, 1, registers));
+    EXPECT_GE(steady_clock::now() - start, milliseconds(200));
+    EXPECT_EQ(slaves.requestCount(), 8);
+    EXPECT_TRUE(client.readHoldingRegisters(1, 0, 1, registers));
+}
+
+TEST(ModbusRtuClientTest, pipelining) {
+    FakeModbusSlaves slaves(20);
+    std::vector<ModbusRequest> requests(4);
+    for (size_t i = 0; i < requests.size(); i++) {
+        slaves.setRegister(static_cast<uint8_t>(i + 1), 5, static_cast<uint16_t>(i * 10));
+        requests[i].slave = static_cast<uint8_t>(i + 1);
+        requests[i].address = 5;
+        requests[i].count = 1;
+    }
+
+    {
+        // One request at a time
+        ModbusRtuClient client(connectSerial(slaves));
+        ASSERT_TRUE(client.transact(requests));
+        EXPECT_EQ(slaves.responsesAtArrival(), std::vector<int>({0, 1, 2, 3}));
+    }
+
+    FakeModbusSlaves pipelined_slaves(20);
+    for (size_t i = 0; i < requests.size(); i++) {
+        pipelined_slaves.setRegister(static_cast<uint8_t>(i + 1), 5, static_cast<uint16_t>(i * 10));
+    }
+    ModbusRtuOptions options;
+    options.pipeline_depth = 4;
+    ModbusRtuClient client(connectSerial(pipelined_slaves), options);
+    ASSERT_TRUE(client.transact(requests));
+    // All the requests were sent before the first response
+    EXPECT_EQ(pipelined_slaves.responsesAtArrival(), std::vector<int>({0, 0, 0, 0}));
+    for (size_t i = 0; i < requests.size(); i++) {
+        ASSERT_TRUE(requests[i].success);
+        EXPECT_EQ(requests[i].result, std::vector<uint16_t>({static_cast<uint16_t>(i * 10)}));
+    }
+}
+
+TEST(ModbusRtuClientTest, polling) {
+    FakeModbusSlaves slaves;
+    ModbusRtuClient client(connectSerial(slaves));
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::map<uint16_t, uint16_t> changes;
+    client.setChangeCallback([&](uint8_t slave, ModbusTable table, uint16_t address, uint16_t value) {
+        if (slave == 3 && table == ModbusTable::HOLDING_REGISTER) {
+            std::lock_guard<std::mutex> lock(mutex);
+            changes[address] = value;
+            cv.notify_all();
+        }
+    });
+    slaves.setRegister(3, 20, 1);
+    ASSERT_GE(client.addPoll(3, ModbusTable::HOLDING_REGISTER, 20, 2, 10), 0);
+    EXPECT_EQ(client.addPoll(3, ModbusTable::HOLDING_REGISTER, 20, 0, 10), -1);
+    client.startPolling();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, seconds(2), [&]() { return changes.size() == 2; }));
+    EXPECT_EQ(changes[20], 1);
+    EXPECT_EQ(changes[21], 0);
+    changes.clear();
+    lock.unlock();
+
+    // Only the changed value is reported
+    slaves.setRegister(3, 21, 5);
+    lock.lock();
+    ASSERT_TRUE(cv.wait_for(lock, seconds(2), [&]() { return !changes.empty(); }));
+    EXPECT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes[21], 5);
+    lock.unlock();
+    client.stopPolling();
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,310 @@
+#include <Elite/KinematicsBase.hpp>
+#include <Elite/MdhKinematics.hpp>
+#include <Elite/PathSimplifier.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace ELITE;
+
+namespace {
+
+// MDH of a CS63 like arm
+const vector6d_t TEST_ALPHA = {0, M_PI / 2, 0, 0, M_PI / 2, -M_PI / 2};
+const vector6d_t TEST_A = {0, 0, -0.427, -0.357, 0, 0};
+const vector6d_t TEST_D = {0.1215, 0, 0, 0.1225, 0.1025, 0.094};
+
+// A solver with only the FK
+class FkKinematics : public KinematicsBase {
+   public:
+    MdhKinematics mdh_;
+
+    void setMDH(const vector6d_t& alpha, const vector6d_t& a, const vector6d_t& d) override {
+        mdh_ = MdhKinematics(alpha, a, d);
+    }
+
+    bool getPositionFK(const vector6d_t& joint_angles, vector6d_t& poses) const override {
+        mdh_.forward(joint_angles, poses);
+        return true;
+    }
+
+    bool getPositionIK(const vector6d_t&, const vector6d_t&, vector6d_t&, KinematicsResult& result) const override {
+        result.kinematic_error = KinematicError::NO_SOLUTION;
+        return false;
+    }
+
+    bool getPositionIK(const vector6d_t&, const vector6d_t&, std::vector<vector6d_t>&,
+                       KinematicsResult& result) const override {
+        result.kinematic_error = KinematicError::NO_SOLUTION;
+        return false;
+    }
+};
+
+// A straight line along x, then a quarter circle in the xy plane, at a constant orientation
+std::vector<vector6d_t> makeCartesianPath() {
+    std::vector<vector6d_t> path;
+    for (int k = 0; k < 200; k++) {
+        path.push_back({0.3 * k / 200, 0.4, 0.3, M_PI, 0.0, 0.5});
+    }
+    for (int k = 0; k <= 300; k++) {
+        const double a = 0.5 * M_PI * k / 300;
+        path.push_back({0.3 + 0.1 * std::sin(a), 0.5 - 0.1 * std::cos(a), 0.3, M_PI, 0.0, 0.5});
+    }
+    return path;
+}
+
+std::vector<vector6d_t> makeJointPath() {
+    std::vector<vector6d_t> path(1000);
+    for (size_t k = 0; k < path.size(); k++) {
+        const double s = k / 999.0;
+        for (size_t j = 0; j < 6; j++) {
+            path[k][j] = 0.3 * j - 0.8 + (0.9 - 0.1 * j) * s + 0.15 * std::sin(4 * s + j);
+        }
+    }
+    return path;
+}
+
+double distanceToSegment(const vector6d_t& a, const vector6d_t& b, const vector6d_t& p) {
+    double dot = 0;
+    double length_squared = 0;
+    for (size_t j = 0; j < 3; j++) {
+        dot += (p[j] - a[j]) * (b[j] - a[j]);
+        length_squared += (b[j] - a[j]) * (b[j] - a[j]);
+    }
+    const double t = length_squared > 0 ? std::min(1.0, std::max(0.0, dot / length_squared)) : 0.0;
+    double sum = 0;
+    for (size_t j = 0; j < 3; j++) {
+        const double d = p[j] - (a[j] + t * (b[j] - a[j]));
+        sum += d * d;
+    }
+    return std::sqrt(sum);
+}
+
+// The largest deviation of a pose from the input path, scaled by the tolerances: the position from the closest point
+// of a segment, the orientation from the orientation interpolated at that point
+double scaledDeviation(const std::vector<vector6d_t>& path, const std::vector<QuaternionPose>& orientations,
+                       const vector6d_t& position, const QuaternionPose& orientation, const PathSimplifierOptions& options) {
+    double best = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+        double dot = 0;
+        double length_squared = 0;
+        for (size_t j = 0; j < 3; j++) {
+            dot += (position[j] - path[i][j]) * (path[i + 1][j] - path[i][j]);
+            length_squared += (path[i + 1][j] - path[i][j]) * (path[i + 1][j] - path[i][j]);
+        }
+        const double t = length_squared > 0 ? std::min(1.0, std::max(0.0, dot / length_squared)) : 0.0;
+        double sum = 0;
+        for (size_t j = 0; j < 3; j++) {
+            const double d = position[j] - (path[i][j] + t * (path[i + 1][j] - path[i][j]));
+            sum += d * d;
+        }
+        const QuaternionPose d =
+            QuaternionPose::interpolate(orientations[i], orientations[i + 1], t).inverse() * orientation;
+        const double sin_half = std::sqrt(d.orientation[1] * d.orientation[1] + d.orientation[2] * d.orientation[2] +
+                                          d.orientation[3] * d.orientation[3]);
+        const double angle = 2 * std::atan2(sin_half, std::fabs(d.orientation[0]));
+        best = std::min(best, std::max(std::sqrt(sum) / options.position_tolerance, angle / options.orientation_tolerance));
+    }
+    return best;
+}
+
+}  // namespace
+
+TEST(PathSimplifierTest, CartesianDecimationAndBlends) {
+    PathSimplifierOptions options;
+    PathSimplifier simplifier(options);
+    const std::vector<vector6d_t> path = makeCartesianPath();
+    std::vector<SimplifiedWaypoint> waypoints;
+    ASSERT_TRUE(simplifier.simplify(path, true, waypoints));
+
+    const PathSimplifierStats& stats = simplifier.getStats();
+    EXPECT_EQ(stats.input_points, path.size());
+    EXPECT_EQ(stats.output_points, waypoints.size());
+    EXPECT_GT(stats.reduction(), 0.9);
+    ASSERT_GE(waypoints.size(), 3u);
+    EXPECT_EQ(waypoints.front().index, 0u);
+    EXPECT_EQ(waypoints.back().index, path.size() - 1);
+    // The line is one motion, the arc leaves it tangentially
+    EXPECT_GE(waypoints[1].index, 199u);
+
+    const double decimation_tolerance = options.position_tolerance * (1 - options.blend_share);
+    EXPECT_LE(stats.max_position_deviation, decimation_tolerance);
+    EXPECT_NEAR(stats.max_orientation_deviation, 0.0, 1e-9);
+    for (size_t k = 0; k + 1 < waypoints.size(); k++) {
+        for (size_t i = waypoints[k].index; i <= waypoints[k + 1].index; i++) {
+            EXPECT_LE(distanceToSegment(waypoints[k].positions, waypoints[k + 1].positions, path[i]), decimation_tolerance);
+        }
+    }
+
+    EXPECT_DOUBLE_EQ(waypoints.front().blend_radius, 0.0);
+    EXPECT_DOUBLE_EQ(waypoints.back().blend_radius, 0.0);
+    for (size_t k = 1; k + 1 < waypoints.size(); k++) {
+        const vector6d_t& previous = waypoints[k - 1].positions;
+        const vector6d_t& current = waypoints[k].positions;
+        const vector6d_t& next = waypoints[k + 1].positions;
+        const double previous_length = distanceToSegment(current, current, previous);
+        const double next_length = distanceToSegment(current, current, next);
+        const double radius = waypoints[k].blend_radius;
+        EXPECT_GT(radius, 0.0);
+        EXPECT_LE(radius, options.max_blend_radius);
+        EXPECT_LE(radius, 0.5 * std::min(previous_length, next_length) + 1e-12);
+        // The blend stays within the rest of the tolerance
+        double cos_corner = 0;
+        for (size_t j = 0; j < 3; j++) {
+            cos_corner += (previous[j] - current[j]) * (next[j] - current[j]);
+        }
+        cos_corner /= previous_length * next_length;
+        EXPECT_LE(decimation_tolerance + radius * std::sqrt((1 + cos_corner) / 2) / 2, options.position_tolerance + 1e-12);
+    }
+}
+
+TEST(PathSimplifierTest, CartesianBlendsStayWithinTheTolerances) {
+    // A zigzag whose orientation turns back at each corner, so a blend cuts the orientation as well as the position
+    std::vector<vector6d_t> path;
+    for (int leg = 0; leg < 4; leg++) {
+        for (int k = 0; k < 200; k++) {
+            const double s = k / 200.0;
+            const double x = 0.3 + 0.1 * ((leg + 1) / 2 + ((leg % 2) ? 0.0 : s));
+            const double y = 0.1 * (leg / 2 + ((leg % 2) ? s : 0.0));
+            path.push_back({x, y, 0.3, M_PI, 0.0, (leg % 2) ? 1.5 * (1 - s) : 1.5 * s});
+        }
+    }
+    path.push_back({0.5, 0.2, 0.3, M_PI, 0.0, 0.0});
+    std::vector<QuaternionPose> orientations(path.size());
+    QuaternionPose::fromRpyBatch(path.data(), orientations.data(), path.size());
+
+    PathSimplifierOptions options;
+    PathSimplifier simplifier(options);
+    std::vector<SimplifiedWaypoint> waypoints;
+    ASSERT_TRUE(simplifier.simplify(path, true, waypoints));
+    ASSERT_EQ(waypoints.size(), 5u);
+
+    // Run the simplified path: movel between the blends, and a blend from where it enters the radius of a point to
+    // where it leaves it, on a quadratic Bezier curve with the orientation interpolated along it
+    std::vector<QuaternionPose> kept(waypoints.size());
+    for (size_t k = 0; k < waypoints.size(); k++) {
+        kept[k] = QuaternionPose::fromRpy(waypoints[k].positions);
+    }
+    auto length = [&](size_t k) {
+        return distanceToSegment(waypoints[k].positions, waypoints[k].positions, waypoints[k + 1].positions);
+    };
+    auto onSegment = [&](size_t k, double t, vector6d_t& position, QuaternionPose& orientation) {
+        for (size_t j = 0; j < 3; j++) {
+            position[j] = waypoints[k].positions[j] + t * (waypoints[k + 1].positions[j] - waypoints[k].positions[j]);
+        }
+        orientation = QuaternionPose::interpolate(kept[k], kept[k + 1], t);
+    };
+    const int samples = 50;
+    double worst = 0;
+    for (size_t k = 0; k + 1 < waypoints.size(); k++) {
+        const double first = waypoints[k].blend_radius / length(k);
+        const double last = 1 - waypoints[k + 1].blend_radius / length(k);
+        for (int i = 0; i <= samples; i++) {
+            vector6d_t position;
+            QuaternionPose orientation;
+            onSegment(k, first + (last - first) * i / samples, position, orientation);
+            worst = std::max(worst, scaledDeviation(path, orientations, position, orientation, options));
+        }
+    }
+    for (size_t k = 1; k + 1 < waypoints.size(); k++) {
+        const double radius = waypoints[k].blend_radius;
+        EXPECT_GT(radius, 0.0);
+        // The orientation limits the radius, the position alone allows about 1.4 mm at these right angles
+        EXPECT_LT(radius, options.position_tolerance);
+        vector6d_t enter;
+        vector6d_t leave;
+        QuaternionPose enter_orientation;
+        QuaternionPose leave_orientation;
+        onSegment(k - 1, 1 - radius / length(k - 1), enter, enter_orientation);
+        onSegment(k, radius / length(k), leave, leave_orientation);
+        for (int i = 0; i <= samples; i++) {
+            const double s = static_cast<double>(i) / samples;
+            vector6d_t position;
+            for (size_t j = 0; j < 3; j++) {
+                position[j] = (1 - s) * (1 - s) * enter[j] + 2 * s * (1 - s) * waypoints[k].positions[j] + s * s * leave[j];
+            }
+            const QuaternionPose orientation = QuaternionPose::interpolate(enter_orientation, leave_orientation, s);
+            worst = std::max(worst, scaledDeviation(path, orientations, position, orientation, options));
+        }
+    }
+    EXPECT_LE(worst, 1.0 + 1e-9);
+}
+
+TEST(PathSimplifierTest, CartesianOrientation) {
+    PathSimplifier simplifier;
+    std::vector<SimplifiedWaypoint> waypoints;
+
+    // A rotation in place at a varying rate is one motion
+    std::vector<vector6d_t> path;
+    for (int k = 0; k <= 100; k++) {
+        const double s = k / 100.0;
+        path.push_back({0.4, 0.1, 0.3, M_PI, 0.0, s * s});
+    }
+    ASSERT_TRUE(simplifier.simplify(path, true, waypoints));
+    EXPECT_EQ(waypoints.size(), 2u);
+
+    // Turning back needs the turning point
+    for (int k = 1; k <= 100; k++) {
+        const double s = 1 - k / 100.0;
+        path.push_back({0.4, 0.1, 0.3, M_PI, 0.0, s * s});
+    }
+    ASSERT_TRUE(simplifier.simplify(path, true, waypoints));
+    ASSERT_EQ(waypoints.size(), 3u);
+    EXPECT_EQ(waypoints[1].index, 100u);
+    EXPECT_DOUBLE_EQ(waypoints[1].blend_radius, 0.0);
+}
+
+TEST(PathSimplifierTest, JointDecimation) {
+    PathSimplifierOptions options;
+    PathSimplifier simplifier(options);
+    const std::vector<vector6d_t> path = makeJointPath();
+    std::vector<SimplifiedWaypoint> waypoints;
+    ASSERT_TRUE(simplifier.simplify(path, false, waypoints));
+    EXPECT_GT(simplifier.getStats().reduction(), 0.9);
+    EXPECT_LE(simplifier.getStats().max_joint_deviation, options.joint_tolerance);
+    // No TCP positions, no blends
+    for (const auto& waypoint : waypoints) {
+        EXPECT_DOUBLE_EQ(waypoint.blend_radius, 0.0);
+        EXPECT_EQ(waypoint.positions, path[waypoint.index]);
+    }
+
+    // With the kinematics the TCP positions are bounded too, and the inner points get blends
+    auto kinematics = std::make_shared<FkKinematics>();
+    kinematics->setMDH(TEST_ALPHA, TEST_A, TEST_D);
+    PathSimplifier tcp_simplifier(options, kinematics);
+    std::vector<SimplifiedWaypoint> tcp_waypoints;
+    ASSERT_TRUE(tcp_simplifier.simplify(path, false, tcp_waypoints));
+    const PathSimplifierStats& stats = tcp_simplifier.getStats();
+    EXPECT_GE(tcp_waypoints.size(), waypoints.size());
+    EXPECT_LE(stats.max_joint_deviation, options.joint_tolerance);
+    EXPECT_LE(stats.max_position_deviation, options.position_tolerance * (1 - options.blend_share));
+    for (size_t k = 1; k + 1 < tcp_waypoints.size(); k++) {
+        EXPECT_GT(tcp_waypoints[k].blend_radius, 0.0);
+    }
+}
+
+TEST(PathSimplifierTest, RejectsInvalidInput) {
+    PathSimplifier simplifier;
+    std::vector<SimplifiedWaypoint> waypoints;
+    const vector6d_t q = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    EXPECT_FALSE(simplifier.simplify({q}, false, waypoints));
+    vector6d_t nan = q;
+    nan[4] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(simplifier.simplify({q, nan}, false, waypoints));
+    EXPECT_DOUBLE_EQ(simplifier.getStats().reduction(), 0.0);
+
+    PathSimplifierOptions options;
+    options.position_tolerance = 0;
+    PathSimplifier invalid(options);
+    EXPECT_FALSE(invalid.simplify({q, q}, true, waypoints));
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -5,10 +5,13 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cmath>
 #include <cstdlib>
 #include <filesystem>
+#include <limits>
 #include <string>
 #include <iostream>
+#include <vector>
 
 using namespace ELITE;
 
@@ -35,8 +38,250 @@ std::string findPluginLibraryPath(const std::string& lib_name) {
     return "";
 }
 
+// 13 elements, a full block of the kernels and a partial one
+std::vector<vector6d_t> makeBatchPoses() {
+    std::vector<vector6d_t> poses;
+    for (int i = 0; i < 13; ++i) {
+        poses.push_back({0.1 * i - 0.4, 0.3 - 0.05 * i, 0.2 + 0.02 * i, 0.7 * std::sin(i), 0.6 * std::cos(1.3 * i),
+                         1.1 * std::sin(0.7 * i + 0.5)});
+    }
+    return poses;
+}
+
+void expectNear(const vector6d_t& expected, const vector6d_t& actual) {
+    for (size_t k = 0; k < 6; ++k) {
+        EXPECT_NEAR(expected[k], actual[k], 1e-9);
+    }
+}
+
+void expectNear(const PoseMatrix& expected, const PoseMatrix& actual) {
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            EXPECT_NEAR(expected.data[i][j], actual.data[i][j], 1e-12);
+        }
+    }
+}
+
+// The batch kernels of a plugin give the results of its single pose operations and of the default batch loops
+void checkBatchMatchesSingle(const PoseAlgebraBase& algebra) {
+    const std::vector<vector6d_t> vectors = makeBatchPoses();
+    const size_t n = vectors.size();
+    const vector6d_t ref = {0.5, -0.2, 0.3, 0.2, -0.4, 1.3};
+    PoseAlgebraResult result;
+
+    PoseMatrix ref_matrix;
+    ASSERT_TRUE(algebra.vectorToMatrix(ref, ref_matrix, result));
+    std::vector<PoseMatrix> matrices(n);
+    ASSERT_TRUE(algebra.vectorToMatrixBatch(vectors.data(), matrices.data(), n, result)) << result.message();
+    std::vector<PoseMatrix> default_matrices(n);
+    ASSERT_TRUE(algebra.PoseAlgebraBase::vectorToMatrixBatch(vectors.data(), default_matrices.data(), n, result));
+    std::vector<vector6d_t> round_trip(n);
+    ASSERT_TRUE(algebra.matrixToVectorBatch(matrices.data(), round_trip.data(), n, result)) << result.message();
+    for (size_t i = 0; i < n; ++i) {
+        expectNear(default_matrices[i], matrices[i]);
+        vector6d_t single;
+        ASSERT_TRUE(algebra.matrixToVector(matrices[i], single, result));
+        expectNear(single, round_trip[i]);
+    }
+
+    std::vector<PoseMatrix> out_matrices(n);
+    std::vector<vector6d_t> out_vectors(n);
+    ASSERT_TRUE(algebra.multiplyBatch(ref_matrix, matrices.data(), out_matrices.data(), n, result)) << result.message();
+    ASSERT_TRUE(algebra.multiplyBatch(ref, vectors.data(), out_vectors.data(), n, result)) << result.message();
+    for (size_t i = 0; i < n; ++i) {
+        PoseMatrix single_matrix;
+        vector6d_t single_vector;
+        ASSERT_TRUE(algebra.multiply(ref_matrix, matrices[i], single_matrix, result));
+        ASSERT_TRUE(algebra.multiply(ref, vectors[i], single_vector, result));
+        expectNear(single_matrix, out_matrices[i]);
+        expectNear(single_vector, out_vectors[i]);
+    }
+
+    ASSERT_TRUE(algebra.worldToLocalBatch(ref_matrix, matrices.data(), out_matrices.data(), n, result)) << result.message();
+    ASSERT_TRUE(algebra.worldToLocalBatch(ref, vectors.data(), out_vectors.data(), n, result)) << result.message();
+    for (size_t i = 0; i < n; ++i) {
+        PoseMatrix single_matrix;
+        vector6d_t single_vector;
+        ASSERT_TRUE(algebra.worldToLocal(ref_matrix, matrices[i], single_matrix, result));
+        ASSERT_TRUE(algebra.worldToLocal(ref, vectors[i], single_vector, result));
+        expectNear(single_matrix, out_matrices[i]);
+        expectNear(single_vector, out_vectors[i]);
+    }
+
+    ASSERT_TRUE(algebra.localToWorldBatch(ref_matrix, matrices.data(), out_matrices.data(), n, result)) << result.message();
+    ASSERT_TRUE(algebra.localToWorldBatch(ref, vectors.data(), out_vectors.data(), n, result)) << result.message();
+    for (size_t i = 0; i < n; ++i) {
+        PoseMatrix single_matrix;
+        vector6d_t single_vector;
+        ASSERT_TRUE(algebra.localToWorld(ref_matrix, matrices[i], single_matrix, result));
+        ASSERT_TRUE(algebra.localToWorld(ref, vectors[i], single_vector, result));
+        expectNear(single_matrix, out_matrices[i]);
+        expectNear(single_vector, out_vectors[i]);
+    }
+
+    // In place, as the scan of a sensor converted to the base frame
+    std::vector<vector3d_t> points(n);
+    for (size_t i = 0; i < n; ++i) {
+        points[i] = {vectors[i][0], vectors[i][1], vectors[i][2]};
+    }
+    std::vector<vector3d_t> default_points(n);
+    ASSERT_TRUE(algebra.PoseAlgebraBase::transformPointsBatch(ref_matrix, points.data(), default_points.data(), n, result));
+    ASSERT_TRUE(algebra.transformPointsBatch(ref_matrix, points.data(), points.data(), n, result)) << result.message();
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            EXPECT_NEAR(default_points[i][k], points[i][k], 1e-12);
+        }
+    }
+
+    // The first failing element is reported, the shared pose is validated once
+    std::vector<vector6d_t> bad_vectors = vectors;
+    bad_vectors[9][4] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(algebra.multiplyBatch(ref, bad_vectors.data(), out_vectors.data(), n, result));
+    EXPECT_EQ(result.error, PoseAlgebraError::NUMERICAL_ERROR);
+    EXPECT_EQ(result.batch_index, 9u);
+    EXPECT_EQ(result.message().rfind("element 9: ", 0), 0u) << result.message();
+
+    PoseMatrix bad_ref = ref_matrix;
+    bad_ref.data[0][0] = 2.0;
+    EXPECT_FALSE(algebra.multiplyBatch(bad_ref, matrices.data(), out_matrices.data(), n, result));
+    EXPECT_EQ(result.error, PoseAlgebraError::INVALID_ROTATION_MATRIX);
+
+    EXPECT_TRUE(algebra.multiplyBatch(ref, vectors.data(), out_vectors.data(), 0, result));
+}
+
+// CHECKED rejects a scaled rotation with a static message, UNCHECKED composes it without validation
+void checkValidationPolicy(PoseAlgebraBase& algebra) {
+    EXPECT_EQ(algebra.getValidation(), PoseAlgebraValidation::CHECKED);
+    PoseMatrix scaled;
+    scaled.data[0][0] = 2.0;
+    scaled.data[0][3] = 0.5;
+    PoseMatrix translation;
+    translation.data[1][3] = 1.0;
+    PoseMatrix out;
+    PoseAlgebraResult result;
+    EXPECT_FALSE(algebra.multiply(scaled, translation, out, result));
+    EXPECT_EQ(result.error, PoseAlgebraError::INVALID_ROTATION_MATRIX);
+    EXPECT_STREQ(result.operand, "left pose");
+    EXPECT_STREQ(result.detail, PoseAlgebraBase::NON_ORTHONORMAL_DETAIL);
+    EXPECT_EQ(result.message(), "left pose contains a non-orthonormal rotation matrix");
+    std::vector<PoseMatrix> batch(3, translation);
+    EXPECT_FALSE(algebra.multiplyBatch(scaled, batch.data(), batch.data(), batch.size(), result));
+
+    algebra.setValidation(PoseAlgebraValidation::UNCHECKED);
+    EXPECT_FALSE(algebra.isChecked());
+    ASSERT_TRUE(algebra.multiply(scaled, translation, out, result));
+    EXPECT_EQ(result.error, PoseAlgebraError::SUCCESS);
+    EXPECT_DOUBLE_EQ(out.data[0][0], 2.0);
+    EXPECT_DOUBLE_EQ(out.data[0][3], 0.5);
+    EXPECT_DOUBLE_EQ(out.data[1][3], 1.0);
+    ASSERT_TRUE(algebra.multiplyBatch(scaled, batch.data(), batch.data(), batch.size(), result));
+    for (const auto& pose : batch) {
+        EXPECT_DOUBLE_EQ(pose.data[0][0], 2.0);
+        EXPECT_DOUBLE_EQ(pose.data[1][3], 1.0);
+    }
+
+    // The results of valid inputs do not depend on the policy
+    const vector6d_t left = {0.1, 0.2, 0.3, 0.4, -0.5, 0.6};
+    const vector6d_t right = {-0.3, 0.1, 0.2, -0.2, 0.3, 1.1};
+    vector6d_t unchecked;
+    ASSERT_TRUE(algebra.worldToLocal(left, right, unchecked, result));
+    algebra.setValidation(PoseAlgebraValidation::CHECKED);
+    vector6d_t checked;
+    ASSERT_TRUE(algebra.worldToLocal(left, right, checked, result));
+    for (size_t k = 0; k < 6; ++k) {
+        EXPECT_DOUBLE_EQ(checked[k], unchecked[k]);
+    }
+}
+
+// The kernel table of a plugin gives the results of its batch operations
+void checkKernelTable(const PoseAlgebraBase& algebra) {
+    const PoseAlgebraKernels kernels = algebra.getKernelTable();
+    ASSERT_TRUE(kernels.complete());
+    EXPECT_FALSE(algebra.PoseAlgebraBase::getKernelTable().complete());
+
+    const std::vector<vector6d_t> vectors = makeBatchPoses();
+    const size_t n = vectors.size();
+    const vector6d_t ref = {0.5, -0.2, 0.3, 0.2, -0.4, 1.3};
+    PoseAlgebraResult result;
+    PoseMatrix ref_matrix;
+    ASSERT_TRUE(algebra.vectorToMatrix(ref, ref_matrix, result));
+
+    std::vector<PoseMatrix> matrices(n);
+    std::vector<PoseMatrix> kernel_matrices(n);
+    ASSERT_TRUE(algebra.vectorToMatrixBatch(vectors.data(), matrices.data(), n, result));
+    kernels.vector_to_matrix(vectors.data(), kernel_matrices.data(), n);
+    std::vector<vector6d_t> out_vectors(n);
+    std::vector<vector6d_t> kernel_vectors(n);
+    ASSERT_TRUE(algebra.matrixToVectorBatch(matrices.data(), out_vectors.data(), n, result));
+    kernels.matrix_to_vector(matrices.data(), kernel_vectors.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        expectNear(matrices[i], kernel_matrices[i]);
+        expectNear(out_vectors[i], kernel_vectors[i]);
+    }
+
+    std::vector<PoseMatrix> out_matrices(n);
+    ASSERT_TRUE(algebra.multiplyBatch(ref_matrix, matrices.data(), out_matrices.data(), n, result));
+    kernels.compose_matrices(ref_matrix, matrices.data(), kernel_matrices.data(), n);
+    ASSERT_TRUE(algebra.multiplyBatch(ref, vectors.data(), out_vectors.data(), n, result));
+    kernels.compose_vectors(ref, vectors.data(), kernel_vectors.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        expectNear(out_matrices[i], kernel_matrices[i]);
+        expectNear(out_vectors[i], kernel_vectors[i]);
+    }
+
+    std::vector<vector3d_t> points(n);
+    for (size_t i = 0; i < n; ++i) {
+        points[i] = {vectors[i][0], vectors[i][1], vectors[i][2]};
+    }
+    std::vector<vector3d_t> out_points(n);
+    ASSERT_TRUE(algebra.transformPointsBatch(ref_matrix, points.data(), out_points.data(), n, result));
+    kernels.transform_points(ref_matrix, points.data(), points.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            EXPECT_NEAR(out_points[i][k], points[i][k], 1e-12);
+        }
+    }
+}
+
 }  // namespace
 
+// A failure keeps static strings and indices, the text is built by message()
+TEST(PoseAlgebraTest, ResultFormatsTheFailureOnRequest) {
+    PoseAlgebraResult result;
+    EXPECT_EQ(result.message(), "");
+
+    vector6d_t pose{};
+    pose[4] = std::numeric_limits<double>::infinity();
+    EXPECT_FALSE(PoseAlgebraBase::validateVectorFinite(pose, result, "pose"));
+    EXPECT_EQ(result.error, PoseAlgebraError::INVALID_INPUT);
+    EXPECT_STREQ(result.operand, "pose");
+    EXPECT_EQ(result.value_index, 4u);
+    EXPECT_EQ(result.batch_index, PoseAlgebraResult::NO_INDEX);
+    EXPECT_TRUE(result.text.empty());
+    EXPECT_EQ(result.message(), "pose contains a non-finite value at index 4");
+    PoseAlgebraBase::setBatchError(result, 12);
+    EXPECT_EQ(result.message(), "element 12: pose contains a non-finite value at index 4");
+
+    PoseMatrix matrix;
+    matrix.data[1][2] = std::numeric_limits<double>::quiet_NaN();
+    const std::string name = "tool pose";
+    EXPECT_FALSE(PoseAlgebraBase::validateMatrixFinite(matrix, result, name));
+    EXPECT_EQ(result.operand, nullptr);
+    EXPECT_EQ(result.value_index, 6u);
+    EXPECT_EQ(result.message(), "tool pose contains a non-finite value at index 6");
+
+    PoseAlgebraBase::setError(result, PoseAlgebraError::SINGULAR_MATRIX, static_cast<const char*>(nullptr));
+    EXPECT_EQ(result.message(), "singular matrix");
+    PoseAlgebraBase::setError(result, PoseAlgebraError::INTERNAL_ERROR, std::string("solver failed"));
+    EXPECT_EQ(result.message(), "solver failed");
+
+    PoseAlgebraBase::setSuccess(result);
+    EXPECT_EQ(result.error, PoseAlgebraError::SUCCESS);
+    EXPECT_EQ(result.operand, nullptr);
+    EXPECT_TRUE(result.text.empty());
+    EXPECT_EQ(result.message(), "");
+}
+
 TEST(PoseAlgebraTest, EigenPluginWorks) {
     const std::string plugin_path = findPluginLibraryPath("libelite_eigen_pose_algebra.so");
     if (plugin_path.empty()) {
@@ -67,6 +312,105 @@ TEST(PoseAlgebraTest, ElitePluginWorks) {
     ASSERT_NE(algebra, nullptr) << "Failed to create ELITE::ElitePoseAlgebra instance";
 }
 
+TEST(PoseAlgebraTest, EigenBatchMatchesSingle) {
+    const std::string plugin_path = findPluginLibraryPath("libelite_eigen_pose_algebra.so");
+    if (plugin_path.empty()) {
+        GTEST_SKIP() << "Eigen pose algebra plugin library not found in expected build paths";
+    }
+
+    ClassLoader loader(plugin_path);
+    ASSERT_TRUE(loader.loadLib()) << "Failed to load plugin: " << plugin_path;
+    auto algebra = loader.createUniqueInstance<PoseAlgebraBase>("ELITE::EigenPoseAlgebra");
+    ASSERT_NE(algebra, nullptr);
+    checkBatchMatchesSingle(*algebra);
+}
+
+TEST(PoseAlgebraTest, EliteBatchMatchesSingle) {
+    const std::string plugin_path = findPluginLibraryPath("libelite_pose_algebra.so");
+    if (plugin_path.empty()) {
+        GTEST_SKIP() << "Elite pose algebra plugin library not found in expected build paths";
+    }
+
+    ClassLoader loader(plugin_path);
+    ASSERT_TRUE(loader.loadLib()) << "Failed to load plugin: " << plugin_path;
+    auto algebra = loader.createUniqueInstance<PoseAlgebraBase>("ELITE::ElitePoseAlgebra");
+    ASSERT_NE(algebra, nullptr);
+    checkBatchMatchesSingle(*algebra);
+}
+
+TEST(PoseAlgebraTest, EigenValidationPolicy) {
+    const std::string plugin_path = findPluginLibraryPath("libelite_eigen_pose_algebra.so");
+    if (plugin_path.empty()) {
+        GTEST_SKIP() << "Eigen pose algebra plugin library not found in expected build paths";
+    }
+
+    ClassLoader loader(plugin_path);
+    ASSERT_TRUE(loader.loadLib()) << "Failed to load plugin: " << plugin_path;
+    auto algebra = loader.createUniqueInstance<PoseAlgebraBase>("ELITE::EigenPoseAlgebra");
+    ASSERT_NE(algebra, nullptr);
+    checkValidationPolicy(*algebra);
+}
+
+TEST(PoseAlgebraTest, EliteValidationPolicy) {
+    const std::string plugin_path = findPluginLibraryPath("libelite_pose_algebra.so");
+    if (plugin_path.empty()) {
+        GTEST_SKIP() << "Elite pose algebra plugin library not found in expected build paths";
+    }
+
+    ClassLoader loader(plugin_path);
+    ASSERT_TRUE(loader.loadLib()) << "Failed to load plugin: " << plugin_path;
+    auto algebra = loader.createUniqueInstance<PoseAlgebraBase>("ELITE::ElitePoseAlgebra");
+    ASSERT_NE(algebra, nullptr);
+    checkValidationPolicy(*algebra);
+}
+
+TEST(PoseAlgebraTest, EigenKernelTable) {
+    const std::string plugin_path = findPluginLibraryPath("libelite_eigen_pose_algebra.so");
+    if (plugin_path.empty()) {
+        GTEST_SKIP() << "Eigen pose algebra plugin library not found in expected build paths";
+    }
+
+    ClassLoader loader(plugin_path);
+    ASSERT_TRUE(loader.loadLib()) << "Failed to load plugin: " << plugin_path;
+    auto algebra = loader.createUniqueInstance<PoseAlgebraBase>("ELITE::EigenPoseAlgebra");
+    ASSERT_NE(algebra, nullptr);
+    checkKernelTable(*algebra);
+}
+
+TEST(PoseAlgebraTest, EliteKernelTable) {
+    const std::string plugin_path = findPluginLibraryPath("libelite_pose_algebra.so");
+    if (plugin_path.empty()) {
+        GTEST_SKIP() << "Elite pose algebra plugin library not found in expected build paths";
+    }
+
+    ClassLoader loader(plugin_path);
+    ASSERT_TRUE(loader.loadLib()) << "Failed to load plugin: " << plugin_path;
+    auto algebra = loader.createUniqueInstance<PoseAlgebraBase>("ELITE::ElitePoseAlgebra");
+    ASSERT_NE(algebra, nullptr);
+    checkKernelTable(*algebra);
+}
+
+TEST(PoseAlgebraTest, ClassFactoryCreatesInstances) {
+    const std::string plugin_path = findPluginLibraryPath("libelite_pose_algebra.so");
+    if (plugin_path.empty()) {
+        GTEST_SKIP() << "Elite pose algebra plugin library not found in expected build paths";
+    }
+
+    ClassLoader loader(plugin_path);
+    EXPECT_FALSE(loader.getClassFactory<PoseAlgebraBase>("ELITE::ElitePoseAlgebra"));
+    ASSERT_TRUE(loader.loadLib()) << "Failed to load plugin: " << plugin_path;
+    EXPECT_FALSE(loader.getClassFactory<PoseAlgebraBase>("ELITE::UnknownPoseAlgebra"));
+
+    const ClassFactory<PoseAlgebraBase> factory = loader.getClassFactory<PoseAlgebraBase>("ELITE::ElitePoseAlgebra");
+    ASSERT_TRUE(factory);
+    auto first = factory.createUniqueInstance();
+    auto second = factory.createUniqueInstance();
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_EQ(first->getKernelTable().compose_matrices, second->getKernelTable().compose_matrices);
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,251 @@
+#include "Primary/PrimaryPort.hpp"
+#include "Primary/ReconnectBackoff.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/asio.hpp>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace ELITE;
+using namespace std::chrono;
+
+static bool waitUntil(const std::function<bool()>& predicate, milliseconds timeout, milliseconds poll = milliseconds(5)) {
+    auto start = steady_clock::now();
+    while (!predicate()) {
+        if (steady_clock::now() - start >= timeout) {
+            return false;
+        }
+        std::this_thread::sleep_for(poll);
+    }
+    return true;
+}
+
+// A local stand-in of the robot primary port. It accepts clients and can drop them on demand.
+class FakePrimaryServer {
+   public:
+    FakePrimaryServer() : acceptor_(io_context_, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)) {
+        port_ = acceptor_.local_endpoint().port();
+        doAccept();
+        thread_ = std::thread([this]() { io_context_.run(); });
+    }
+
+    ~FakePrimaryServer() { stop(); }
+
+    int port() const { return port_; }
+
+    int acceptCount() const { return accept_count_; }
+
+    // Close all accepted clients but keep listening
+    void dropClients() {
+        boost::asio::post(io_context_, [this]() {
+            boost::system::error_code ignore_ec;
+            for (auto& sock : clients_) {
+                sock->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignore_ec);
+                sock->close(ignore_ec);
+            }
+            clients_.clear();
+        });
+    }
+
+    void stop() {
+        if (!thread_.joinable()) {
+            return;
+        }
+        boost::asio::post(io_context_, [this]() {
+            boost::system::error_code ignore_ec;
+            acceptor_.close(ignore_ec);
+            for (auto& sock : clients_) {
+                sock->close(ignore_ec);
+            }
+            clients_.clear();
+        });
+        io_context_.stop();
+        thread_.join();
+    }
+
+   private:
+    void doAccept() {
+        auto sock = std::make_shared<boost::asio::ip::tcp::socket>(io_context_);
+        acceptor_.async_accept(*sock, [this, sock](boost::system::error_code ec) {
+            if (ec) {
+                return;
+            }
+            clients_.push_back(sock);
+            accept_count_++;
+            doAccept();
+        });
+    }
+
+    boost::asio::io_context io_context_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> clients_;
+    std::atomic<int> accept_count_{0};
+    std::thread thread_;
+    int port_;
+};
+
+TEST(ReconnectBackoffTest, exponential_growth_and_cap) {
+    PrimaryReconnectPolicy policy;
+    policy.initial_delay_ms = 100;
+    policy.max_delay_ms = 1000;
+    policy.multiplier = 2.0;
+    policy.jitter = 0;
+    ReconnectBackoff backoff(policy);
+
+    EXPECT_EQ(backoff.nextDelay().count(), 100);
+    EXPECT_EQ(backoff.nextDelay().count(), 200);
+    EXPECT_EQ(backoff.nextDelay().count(), 400);
+    EXPECT_EQ(backoff.nextDelay().count(), 800);
+    EXPECT_EQ(backoff.nextDelay().count(), 1000);
+    EXPECT_EQ(backoff.nextDelay().count(), 1000);
+    EXPECT_EQ(backoff.attempts(), 6u);
+
+    backoff.reset();
+    EXPECT_EQ(backoff.nextDelay().count(), 100);
+}
+
+TEST(ReconnectBackoffTest, jitter_bounds) {
+    PrimaryReconnectPolicy policy;
+    policy.initial_delay_ms = 1000;
+    policy.max_delay_ms = 1000;
+    policy.jitter = 0.25;
+    ReconnectBackoff backoff(policy, 42);
+
+    bool spread = false;
+    for (int i = 0; i < 200; i++) {
+        auto delay = backoff.nextDelay().count();
+        EXPECT_GE(delay, 750);
+        EXPECT_LE(delay, 1000);
+        spread |= (delay < 990);
+    }
+    EXPECT_TRUE(spread);
+}
+
+TEST(ReconnectBackoffTest, invalid_policy_is_clamped) {
+    PrimaryReconnectPolicy policy;
+    policy.initial_delay_ms = -5;
+    policy.max_delay_ms = -10;
+    policy.multiplier = 0.5;
+    policy.jitter = 3;
+    ReconnectBackoff backoff(policy);
+    EXPECT_EQ(backoff.getPolicy().initial_delay_ms, 0);
+    EXPECT_EQ(backoff.getPolicy().max_delay_ms, 0);
+    EXPECT_DOUBLE_EQ(backoff.getPolicy().multiplier, 1.0);
+    EXPECT_DOUBLE_EQ(backoff.getPolicy().jitter, 1.0);
+    EXPECT_EQ(backoff.nextDelay().count(), 0);
+}
+
+TEST(PrimaryPortReconnectTest, reconnect_after_drop) {
+    FakePrimaryServer server;
+    PrimaryPort primary;
+    PrimaryReconnectPolicy policy;
+    policy.initial_delay_ms = 20;
+    policy.max_delay_ms = 200;
+    policy.jitter = 0;
+    primary.setReconnectPolicy(policy);
+
+    std::mutex states_mutex;
+    std::vector<PrimaryConnectionState> states;
+    primary.registerConnectionStateCallback([&](PrimaryConnectionState state) {
+        std::lock_guard<std::mutex> lock(states_mutex);
+        states.push_back(state);
+    });
+    std::atomic<int> disconnect_reports{0};
+    primary.registerRobotExceptionCallback([&](RobotExceptionSharedPtr ex) {
+        if (ex->getType() == RobotException::Type::ROBOT_DISCONNECTED) {
+            disconnect_reports++;
+        }
+    });
+
+    ASSERT_TRUE(primary.connect("127.0.0.1", server.port()));
+    EXPECT_EQ(primary.getConnectionState(), PrimaryConnectionState::CONNECTED);
+    ASSERT_TRUE(waitUntil([&]() { return server.acceptCount() == 1; }, 1000ms));
+
+    server.dropClients();
+    ASSERT_TRUE(waitUntil([&]() { return primary.getConnectionMetrics().reconnect_successes == 1; }, 3000ms));
+    EXPECT_EQ(primary.getConnectionState(), PrimaryConnectionState::CONNECTED);
+    EXPECT_EQ(disconnect_reports, 1);
+
+    auto metrics = primary.getConnectionMetrics();
+    EXPECT_EQ(metrics.disconnections, 1u);
+    EXPECT_EQ(metrics.consecutive_failures, 0u);
+    EXPECT_GE(metrics.connect_attempts, 2u);
+    {
+        std::lock_guard<std::mutex> lock(states_mutex);
+        std::vector<PrimaryConnectionState> expected = {
+            PrimaryConnectionState::CONNECTING, PrimaryConnectionState::CONNECTED, PrimaryConnectionState::DISCONNECTED,
+            PrimaryConnectionState::BACKOFF,    PrimaryConnectionState::CONNECTING, PrimaryConnectionState::CONNECTED};
+        EXPECT_EQ(states, expected);
+    }
+
+    primary.disconnect();
+    EXPECT_EQ(primary.getConnectionState(), PrimaryConnectionState::DISCONNECTED);
+}
+
+TEST(PrimaryPortReconnectTest, state_callback_can_use_the_port) {
+    FakePrimaryServer server;
+    PrimaryPort primary;
+
+    // The callback runs outside the socket lock, so it can send to the port it is called from
+    std::atomic<bool> sent{false};
+    primary.registerConnectionStateCallback([&](PrimaryConnectionState state) {
+        if (state == PrimaryConnectionState::CONNECTED) {
+            sent = primary.sendScript("textmsg(\"connected\")");
+        }
+    });
+    ASSERT_TRUE(primary.connect("127.0.0.1", server.port()));
+    EXPECT_TRUE(sent);
+
+    // A refused connection reports DISCONNECTED the same way
+    primary.disconnect();
+    std::atomic<int> disconnected_reports{0};
+    primary.registerConnectionStateCallback([&](PrimaryConnectionState state) {
+        if (state == PrimaryConnectionState::DISCONNECTED) {
+            disconnected_reports++;
+            EXPECT_FALSE(primary.sendScript("textmsg(\"disconnected\")"));
+        }
+    });
+    int port = server.port();
+    server.stop();
+    EXPECT_FALSE(primary.connect("127.0.0.1", port));
+    EXPECT_EQ(disconnected_reports, 1);
+}
+
+TEST(PrimaryPortReconnectTest, backoff_grows_and_disconnect_interrupts) {
+    auto server = std::make_unique<FakePrimaryServer>();
+    int port = server->port();
+    PrimaryPort primary;
+    PrimaryReconnectPolicy policy;
+    policy.initial_delay_ms = 10;
+    policy.max_delay_ms = 10000;
+    policy.multiplier = 4;
+    policy.jitter = 0;
+    primary.setReconnectPolicy(policy);
+
+    ASSERT_TRUE(primary.connect("127.0.0.1", port));
+    // No robot anymore, every reconnect attempt is refused
+    server.reset();
+
+    // Delays are 10, 40, 160, 640 ms
+    ASSERT_TRUE(waitUntil([&]() { return primary.getConnectionMetrics().current_backoff_ms >= 640; }, 3000ms));
+    auto metrics = primary.getConnectionMetrics();
+    EXPECT_GE(metrics.consecutive_failures, 3u);
+    EXPECT_EQ(metrics.reconnect_successes, 0u);
+    EXPECT_EQ(metrics.disconnections, 1u);
+
+    // The backoff wait is long now, disconnect() must not wait for it
+    ASSERT_TRUE(waitUntil([&]() { return primary.getConnectionState() == PrimaryConnectionState::BACKOFF; }, 1000ms));
+    auto start = steady_clock::now();
+    primary.disconnect();
+    EXPECT_LT(duration_cast<milliseconds>(steady_clock::now() - start).count(), 1000);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
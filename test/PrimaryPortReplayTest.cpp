@@ -0,0 +1,228 @@
+#include "Primary/PrimaryMessageCapture.hpp"
+#include "Primary/PrimaryPort.hpp"
+#include "Primary/PrimaryReplayServer.hpp"
+#include "Primary/RobotConfPackage.hpp"
+#include "benchmark/common/PrimaryMessageCorpus.hpp"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ELITE;
+using namespace ELITE::PRIMARY_CORPUS;
+using namespace std::chrono;
+
+static bool waitUntil(const std::function<bool()>& predicate, milliseconds timeout, milliseconds poll = milliseconds(5)) {
+    auto start = steady_clock::now();
+    while (!predicate()) {
+        if (steady_clock::now() - start >= timeout) {
+            return false;
+        }
+        std::this_thread::sleep_for(poll);
+    }
+    return true;
+}
+
+static std::vector<PrimaryCaptureRecord> toRecords(const std::vector<std::vector<uint8_t>>& messages) {
+    std::vector<PrimaryCaptureRecord> records;
+    uint64_t ts = 1000;
+    for (auto& msg : messages) {
+        PrimaryCaptureRecord record;
+        record.timestamp_us = ts;
+        record.data = msg;
+        records.push_back(record);
+        ts += 100000;
+    }
+    return records;
+}
+
+static const std::array<double, 6> TEST_DH_A = {0, -0.427, -0.357, 0, 0, 0};
+static const std::array<double, 6> TEST_DH_D = {0.1215, 0, 0, 0.1225, 0.1025, 0.094};
+static const std::array<double, 6> TEST_DH_ALPHA = {0, 1.5707963, 0, 0, 1.5707963, -1.5707963};
+
+static std::vector<uint8_t> kinematicsMessage() {
+    return makeRobotStateMessage({makeFillerSubPackage(0, 10), makeKinematicsSubPackage(TEST_DH_A, TEST_DH_D, TEST_DH_ALPHA)});
+}
+
+static void expectKinematics(const KinematicsInfo& ki) {
+    for (int i = 0; i < 6; i++) {
+        EXPECT_DOUBLE_EQ(ki.dh_a_[i], TEST_DH_A[i]);
+        EXPECT_DOUBLE_EQ(ki.dh_d_[i], TEST_DH_D[i]);
+        EXPECT_DOUBLE_EQ(ki.dh_alpha_[i], TEST_DH_ALPHA[i]);
+    }
+}
+
+TEST(PrimaryCaptureTest, write_and_read) {
+    std::string path = "primary_capture_test.bin";
+    auto records = toRecords({kinematicsMessage(), makeRobotErrorMessage(5, 1, 2, 3, 0, 4)});
+    {
+        PrimaryCaptureWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        for (auto& r : records) {
+            ASSERT_TRUE(writer.write(r.timestamp_us, r.data.data(), 5, r.data.data() + 5, r.data.size() - 5));
+        }
+    }
+    std::vector<PrimaryCaptureRecord> loaded;
+    ASSERT_TRUE(PrimaryCaptureReader::load(path, loaded));
+    ASSERT_EQ(loaded.size(), records.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        EXPECT_EQ(loaded[i].timestamp_us, records[i].timestamp_us);
+        EXPECT_EQ(loaded[i].data, records[i].data);
+    }
+    std::remove(path.c_str());
+
+    PrimaryCaptureReader reader;
+    EXPECT_FALSE(reader.open("primary_capture_not_exist.bin"));
+}
+
+TEST(PrimaryReplayTest, parse_replayed_state) {
+    PrimaryReplayServer server(toRecords({kinematicsMessage()}));
+    server.setRepeat(0);
+    int port = server.start();
+    ASSERT_GT(port, 0);
+
+    PrimaryPort primary;
+    ASSERT_TRUE(primary.connect("127.0.0.1", port));
+    auto ki = std::make_shared<KinematicsInfo>();
+    ASSERT_TRUE(primary.getPackage(ki, 1000));
+    expectKinematics(*ki);
+    primary.disconnect();
+}
+
+TEST(PrimaryReplayTest, parse_replayed_joint_limits) {
+    PrimaryReplayServer server(toRecords({kinematicsMessage()}));
+    server.setRepeat(0);
+    int port = server.start();
+    ASSERT_GT(port, 0);
+
+    PrimaryPort primary;
+    ASSERT_TRUE(primary.connect("127.0.0.1", port));
+    auto limits = std::make_shared<JointLimitsInfo>();
+    ASSERT_TRUE(primary.getPackage(limits, 1000));
+    // makeKinematicsSubPackage() fills the values before the DH parameters with 0, 0.5, 1...
+    for (int i = 0; i < 6; i++) {
+        EXPECT_DOUBLE_EQ(limits->joint_min_[i], 0.5 * (2 * i));
+        EXPECT_DOUBLE_EQ(limits->joint_max_[i], 0.5 * (2 * i + 1));
+        EXPECT_DOUBLE_EQ(limits->max_velocity_[i], 0.5 * (12 + 2 * i));
+        EXPECT_DOUBLE_EQ(limits->max_acceleration_[i], 0.5 * (13 + 2 * i));
+    }
+    EXPECT_DOUBLE_EQ(limits->default_velocity_, 12.0);
+    EXPECT_DOUBLE_EQ(limits->eq_radius_, 14.0);
+    primary.disconnect();
+}
+
+TEST(PrimaryReplayTest, parse_replayed_exceptions) {
+    PrimaryReplayServer server(
+        toRecords({makeRobotErrorMessage(77, 1234, 5, 2, 1, 99), makeRuntimeExceptionMessage(78, 12, 3, "undefined variable")}));
+    int port = server.start();
+    ASSERT_GT(port, 0);
+
+    std::mutex ex_mutex;
+    std::vector<RobotExceptionSharedPtr> exceptions;
+    PrimaryPort primary;
+    primary.registerRobotExceptionCallback([&](RobotExceptionSharedPtr ex) {
+        std::lock_guard<std::mutex> lock(ex_mutex);
+        exceptions.push_back(ex);
+    });
+    ASSERT_TRUE(primary.connect("127.0.0.1", port));
+    ASSERT_TRUE(waitUntil(
+        [&]() {
+            std::lock_guard<std::mutex> lock(ex_mutex);
+            return exceptions.size() == 2;
+        },
+        2000ms));
+    primary.disconnect();
+
+    ASSERT_EQ(exceptions[0]->getType(), RobotException::Type::ROBOT_ERROR);
+    auto error = std::static_pointer_cast<RobotError>(exceptions[0]);
+    EXPECT_EQ(error->getTimestamp(), 77u);
+    EXPECT_EQ(error->getErrorCode(), 1234);
+    EXPECT_EQ(error->getSubErrorCode(), 5);
+    ASSERT_EQ(exceptions[1]->getType(), RobotException::Type::SCRIPT_RUNTIME);
+    auto runtime = std::static_pointer_cast<RobotRuntimeException>(exceptions[1]);
+    EXPECT_EQ(runtime->getLine(), 12);
+    EXPECT_EQ(runtime->getColumn(), 3);
+    EXPECT_EQ(runtime->getMessage(), "undefined variable");
+}
+
+TEST(PrimaryReplayTest, capture_received_messages) {
+    std::vector<std::vector<uint8_t>> messages = {kinematicsMessage(), makeTypicalRobotStateMessage(),
+                                                  makeRobotErrorMessage(1, 2, 3, 1, 0, 0)};
+    PrimaryReplayServer server(toRecords(messages));
+    int port = server.start();
+    ASSERT_GT(port, 0);
+
+    std::string path = "primary_port_capture_test.bin";
+    PrimaryPort primary;
+    ASSERT_TRUE(primary.startCapture(path));
+    ASSERT_TRUE(primary.connect("127.0.0.1", port));
+    ASSERT_TRUE(waitUntil([&]() { return server.sentMessages() == messages.size(); }, 2000ms));
+    // Let the port drain the socket
+    std::this_thread::sleep_for(100ms);
+    primary.disconnect();
+    primary.stopCapture();
+
+    std::vector<PrimaryCaptureRecord> loaded;
+    ASSERT_TRUE(PrimaryCaptureReader::load(path, loaded));
+    ASSERT_EQ(loaded.size(), messages.size());
+    for (size_t i = 0; i < messages.size(); i++) {
+        EXPECT_EQ(loaded[i].data, messages[i]);
+        EXPECT_GT(loaded[i].timestamp_us, 0u);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(PrimaryReplayTest, malformed_corpus) {
+    for (auto& malformed : makeMalformedCorpus()) {
+        SCOPED_TRACE(malformed.name);
+        // A stream breaking message is sent after the valid one, otherwise every session would stop before the valid one.
+        std::vector<std::vector<uint8_t>> messages;
+        if (malformed.breaks_stream) {
+            messages = {kinematicsMessage(), malformed.data};
+        } else {
+            messages = {malformed.data, kinematicsMessage()};
+        }
+        PrimaryReplayServer server(toRecords(messages));
+        // Keep the stream going while the connection is kept
+        server.setRepeat(malformed.breaks_stream ? 1 : 0);
+        int port = server.start();
+        ASSERT_GT(port, 0);
+
+        PrimaryPort primary;
+        PrimaryReconnectPolicy policy;
+        policy.initial_delay_ms = 10;
+        policy.jitter = 0;
+        primary.setReconnectPolicy(policy);
+        ASSERT_TRUE(primary.connect("127.0.0.1", port));
+        // A truncated configuration sub-package is skipped by the parser but still answers the request, so ask again
+        std::shared_ptr<KinematicsInfo> ki;
+        for (int i = 0; i < 20; i++) {
+            ki = std::make_shared<KinematicsInfo>();
+            ASSERT_TRUE(primary.getPackage(ki, 1000));
+            if (ki->dh_d_[0] == TEST_DH_D[0]) {
+                break;
+            }
+        }
+        expectKinematics(*ki);
+
+        if (malformed.breaks_stream) {
+            EXPECT_TRUE(waitUntil([&]() { return primary.getConnectionMetrics().disconnections >= 1; }, 1000ms));
+        } else {
+            std::this_thread::sleep_for(50ms);
+            EXPECT_EQ(primary.getConnectionMetrics().disconnections, 0u);
+        }
+        primary.disconnect();
+    }
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,156 @@
+#include <Elite/PoseAlgebraBase.hpp>
+#include <Elite/QuaternionPose.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace ELITE;
+
+namespace {
+
+// R = Rz(yaw) * Ry(pitch) * Rx(roll), the convention of the controller
+PoseMatrix rpyMatrix(const vector6d_t& pose) {
+    const double cr = std::cos(pose[3]), sr = std::sin(pose[3]);
+    const double cp = std::cos(pose[4]), sp = std::sin(pose[4]);
+    const double cy = std::cos(pose[5]), sy = std::sin(pose[5]);
+    PoseMatrix m;
+    m.data[0] = {cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr, pose[0]};
+    m.data[1] = {sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr, pose[1]};
+    m.data[2] = {-sp, cp * sr, cp * cr, pose[2]};
+    return m;
+}
+
+PoseMatrix multiply(const PoseMatrix& l, const PoseMatrix& r) {
+    PoseMatrix out;
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            out.data[i][j] = 0.0;
+            for (size_t k = 0; k < 4; ++k) {
+                out.data[i][j] += l.data[i][k] * r.data[k][j];
+            }
+        }
+    }
+    return out;
+}
+
+void expectNear(const PoseMatrix& expected, const PoseMatrix& actual, double tolerance) {
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            EXPECT_NEAR(expected.data[i][j], actual.data[i][j], tolerance) << "[" << i << "][" << j << "]";
+        }
+    }
+}
+
+const std::vector<vector6d_t> POSES = {
+    {0.4, -0.1, 0.3, 0.2, -0.5, 1.1},
+    {-0.2, 0.35, 0.6, -2.9, 0.3, -0.7},
+    {0.1, 0.0, -0.4, 1.2, 1.3, 2.8},
+    {0.0, 0.2, 0.1, 3.1, -1.1, -3.0},
+};
+
+}  // namespace
+
+TEST(QuaternionPoseTest, RpyConversionMatchesTheControllerConvention) {
+    for (const auto& pose : POSES) {
+        const QuaternionPose q = QuaternionPose::fromRpy(pose);
+        expectNear(rpyMatrix(pose), q.toMatrix(), 1e-12);
+        const vector6d_t back = q.toRpy();
+        for (size_t k = 0; k < 6; ++k) {
+            EXPECT_NEAR(pose[k], back[k], 1e-12);
+        }
+    }
+}
+
+TEST(QuaternionPoseTest, ComposeAndInverseMatchMatrices) {
+    const QuaternionPose a = QuaternionPose::fromRpy(POSES[0]);
+    const QuaternionPose b = QuaternionPose::fromRpy(POSES[1]);
+    expectNear(multiply(rpyMatrix(POSES[0]), rpyMatrix(POSES[1])), (a * b).toMatrix(), 1e-12);
+    expectNear(PoseMatrix(), (a * a.inverse()).toMatrix(), 1e-12);
+    expectNear(PoseMatrix(), (b.inverse() * b).toMatrix(), 1e-12);
+
+    const vector3d_t point = {0.3, -0.2, 0.5};
+    const vector3d_t moved = a.transform(point);
+    const vector3d_t back = a.inverse().transform(moved);
+    for (size_t k = 0; k < 3; ++k) {
+        EXPECT_NEAR(point[k], back[k], 1e-12);
+    }
+}
+
+TEST(QuaternionPoseTest, LongChainStaysAccurate) {
+    // 1000 small steps of a screw motion, chained without conversions
+    const vector6d_t step_rpy = {0.001, 0.0005, -0.0002, 0.002, -0.001, 0.003};
+    const QuaternionPose step = QuaternionPose::fromRpy(step_rpy);
+    const PoseMatrix step_matrix = rpyMatrix(step_rpy);
+    QuaternionPose chain;
+    PoseMatrix chain_matrix;
+    for (int i = 0; i < 1000; ++i) {
+        chain = chain * step;
+        chain_matrix = multiply(chain_matrix, step_matrix);
+    }
+    expectNear(chain_matrix, chain.toMatrix(), 1e-10);
+    const double norm = std::sqrt(chain.orientation[0] * chain.orientation[0] + chain.orientation[1] * chain.orientation[1] +
+                                  chain.orientation[2] * chain.orientation[2] + chain.orientation[3] * chain.orientation[3]);
+    EXPECT_NEAR(norm, 1.0, 1e-12);
+}
+
+TEST(QuaternionPoseTest, InterpolateOnTheShortestArc) {
+    const QuaternionPose from = QuaternionPose::fromRpy({0.0, 0.0, 0.0, 0.0, 0.0, 0.2});
+    QuaternionPose to = QuaternionPose::fromRpy({1.0, 2.0, 0.0, 0.0, 0.0, 1.2});
+    expectNear(from.toMatrix(), QuaternionPose::interpolate(from, to, 0.0).toMatrix(), 1e-12);
+    expectNear(to.toMatrix(), QuaternionPose::interpolate(from, to, 1.0).toMatrix(), 1e-12);
+    const vector6d_t middle = QuaternionPose::interpolate(from, to, 0.5).toRpy();
+    EXPECT_NEAR(middle[0], 0.5, 1e-12);
+    EXPECT_NEAR(middle[1], 1.0, 1e-12);
+    EXPECT_NEAR(middle[5], 0.7, 1e-12);
+
+    // -q is the same rotation, the result does not take the long way around
+    for (auto& q : to.orientation) {
+        q = -q;
+    }
+    EXPECT_NEAR(QuaternionPose::interpolate(from, to, 0.25).toRpy()[5], 0.45, 1e-12);
+
+    // Close orientations
+    const QuaternionPose near_to = QuaternionPose::fromRpy({0.0, 0.0, 0.0, 0.0, 0.0, 0.2 + 1e-9});
+    EXPECT_NEAR(QuaternionPose::interpolate(from, near_to, 0.5).toRpy()[5], 0.2 + 5e-10, 1e-14);
+}
+
+TEST(QuaternionPoseTest, RotationVectorAndMatrixRoundTrips) {
+    const std::vector<vector6d_t> rotation_vectors = {
+        {0.1, 0.2, 0.3, 0.3, -0.2, 0.5},
+        {0.0, 0.0, 0.0, 1e-9, 0.0, -2e-9},
+        {0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        // Half turns about each axis, the branches of fromMatrix()
+        {0.0, 0.0, 0.0, M_PI - 1e-6, 0.0, 0.0},
+        {0.0, 0.0, 0.0, 0.0, M_PI - 1e-6, 0.0},
+        {0.0, 0.0, 0.0, 0.0, 0.0, M_PI - 1e-6},
+    };
+    for (const auto& vector : rotation_vectors) {
+        const QuaternionPose q = QuaternionPose::fromRotationVector(vector);
+        const vector6d_t back = q.toRotationVector();
+        for (size_t k = 0; k < 6; ++k) {
+            EXPECT_NEAR(vector[k], back[k], 1e-12);
+        }
+        const QuaternionPose from_matrix = QuaternionPose::fromMatrix(q.toMatrix());
+        expectNear(q.toMatrix(), from_matrix.toMatrix(), 1e-12);
+    }
+}
+
+TEST(QuaternionPoseTest, BatchConversion) {
+    std::vector<QuaternionPose> quaternions(POSES.size());
+    std::vector<vector6d_t> back(POSES.size());
+    QuaternionPose::fromRpyBatch(POSES.data(), quaternions.data(), POSES.size());
+    QuaternionPose::toRpyBatch(quaternions.data(), back.data(), POSES.size());
+    for (size_t i = 0; i < POSES.size(); ++i) {
+        for (size_t k = 0; k < 6; ++k) {
+            EXPECT_NEAR(POSES[i][k], back[i][k], 1e-12);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ScriptCommandInterface.hpp"
+#include "TcpServer.hpp"
+
+#define SCRIPT_COMMAND_TEST_PORT 50005
+
+using namespace ELITE;
+using namespace std::chrono;
+
+// The script command socket of the external control script
+class FakeScript {
+   public:
+    FakeScript() : socket_(io_context_) {
+        socket_.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), SCRIPT_COMMAND_TEST_PORT));
+    }
+
+    std::vector<int32_t> readCommand() {
+        std::vector<int32_t> command(ScriptCommandInterface::SCRIPT_COMMAND_DATA_SIZE);
+        boost::asio::read(socket_, boost::asio::buffer(command.data(), command.size() * sizeof(int32_t)));
+        for (auto& value : command) {
+            value = ::ntohl(value);
+        }
+        return command;
+    }
+
+    void sendInts(const std::vector<int32_t>& values) {
+        std::vector<int32_t> data;
+        for (auto value : values) {
+            data.push_back(::htonl(value));
+        }
+        boost::asio::write(socket_, boost::asio::buffer(data.data(), data.size() * sizeof(int32_t)));
+    }
+
+   private:
+    boost::asio::io_context io_context_;
+    boost::asio::ip::tcp::socket socket_;
+};
+
+class ScriptCommandInterfaceTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        resource_ = std::make_shared<TcpServer::StaticResource>();
+        interface_.reset(new ScriptCommandInterface(SCRIPT_COMMAND_TEST_PORT, resource_));
+        script_.reset(new FakeScript());
+        while (!interface_->isRobotConnect()) {
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    void TearDown() override {
+        script_.reset();
+        interface_.reset();
+        resource_->shutdown();
+    }
+
+    std::shared_ptr<TcpServer::StaticResource> resource_;
+    std::unique_ptr<ScriptCommandInterface> interface_;
+    std::unique_ptr<FakeScript> script_;
+};
+
+TEST_F(ScriptCommandInterfaceTest, start_tool_rs485) {
+    std::thread script([&]() {
+        auto command = script_->readCommand();
+        EXPECT_EQ(command[0], 5);
+        EXPECT_EQ(command[1], 115200);
+        EXPECT_EQ(command[2], 2);
+        EXPECT_EQ(command[3], 1);
+        EXPECT_EQ(command[4], 54321);
+        // Accepted, then socat started and listening
+        script_->sendInts({3, 5});
+        script_->sendInts({1, 4321});
+    });
+    SerialConfig config;
+    config.parity = SerialConfig::Parity::EVEN;
+    EXPECT_EQ(interface_->startToolRs485(config, 54321, 1000, 1000), 4321);
+    script.join();
+}
+
+TEST_F(ScriptCommandInterfaceTest, start_fail_and_end) {
+    std::thread script([&]() {
+        EXPECT_EQ(script_->readCommand()[0], 7);
+        // socat does not listen
+        script_->sendInts({3, 7, 1, -1});
+        EXPECT_EQ(script_->readCommand()[0], 8);
+        script_->sendInts({3, 8, 2, 0});
+    });
+    EXPECT_EQ(interface_->startBoardRs485(SerialConfig(), 54322, 1000, 1000), -1);
+    EXPECT_TRUE(interface_->endBoardRs485(1000, 1000));
+    script.join();
+}
+
+TEST_F(ScriptCommandInterfaceTest, acknowledgement_timeout) {
+    auto start = steady_clock::now();
+    EXPECT_FALSE(interface_->endToolRs485(100, 1000));
+    EXPECT_GE(steady_clock::now() - start, milliseconds(90));
+    EXPECT_EQ(script_->readCommand()[0], 6);
+
+    // The late acknowledgement is not taken for the next command
+    script_->sendInts({3, 6, 2, 0});
+    std::this_thread::sleep_for(50ms);
+    std::thread script([&]() {
+        EXPECT_EQ(script_->readCommand()[0], 5);
+        script_->sendInts({3, 5, 1, 99});
+    });
+    EXPECT_EQ(interface_->startToolRs485(SerialConfig(), 54321, 1000, 1000), 99);
+    script.join();
+}
+
+TEST_F(ScriptCommandInterfaceTest, script_without_serial_commands) {
+    // Never accepted, only the accept timeout is waited
+    auto start = steady_clock::now();
+    EXPECT_EQ(interface_->startToolRs485(SerialConfig(), 54321, 100, 3000), -1);
+    EXPECT_LT(steady_clock::now() - start, milliseconds(1000));
+    EXPECT_EQ(script_->readCommand()[0], 5);
+
+    // Accepted, the result is waited with its own timeout
+    std::thread script([&]() {
+        EXPECT_EQ(script_->readCommand()[0], 6);
+        script_->sendInts({3, 6});
+        std::this_thread::sleep_for(300ms);
+        script_->sendInts({2, 0});
+    });
+    EXPECT_TRUE(interface_->endToolRs485(100, 1000));
+    script.join();
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
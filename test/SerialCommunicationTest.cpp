@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Elite/SerialCommunicationImpl.hpp"
+
+using namespace ELITE;
+using namespace std::chrono;
+
+// A local stand-in of the socat TCP port of the robot. It accepts one client, the test sends and receives by hand.
+class FakeSocatServer {
+   public:
+    FakeSocatServer() : acceptor_(io_context_, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)) {
+        thread_ = std::thread([this]() {
+            client_.reset(new boost::asio::ip::tcp::socket(io_context_));
+            boost::system::error_code ec;
+            acceptor_.accept(*client_, ec);
+        });
+    }
+
+    ~FakeSocatServer() { close(); }
+
+    int port() { return acceptor_.local_endpoint().port(); }
+
+    void waitClient() {
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    void send(const std::string& data) {
+        waitClient();
+        boost::asio::write(*client_, boost::asio::buffer(data));
+    }
+
+    std::string receive(size_t size) {
+        waitClient();
+        std::string data(size, '\0');
+        boost::asio::read(*client_, boost::asio::buffer(&data[0], size));
+        return data;
+    }
+
+    void close() {
+        waitClient();
+        boost::system::error_code ec;
+        if (client_) {
+            client_->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+            client_->close(ec);
+        }
+        acceptor_.close(ec);
+    }
+
+   private:
+    boost::asio::io_context io_context_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    std::unique_ptr<boost::asio::ip::tcp::socket> client_;
+    std::thread thread_;
+};
+
+class SerialCommunicationTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        server_.reset(new FakeSocatServer());
+        serial_.reset(new SerialCommunicationImpl(server_->port(), "127.0.0.1", -1));
+        ASSERT_TRUE(serial_->connect(1000));
+        server_->waitClient();
+    }
+
+    void TearDown() override {
+        serial_.reset();
+        server_.reset();
+    }
+
+    std::unique_ptr<FakeSocatServer> server_;
+    std::unique_ptr<SerialCommunicationImpl> serial_;
+};
+
+TEST_F(SerialCommunicationTest, read_some) {
+    uint8_t data[16];
+    EXPECT_EQ(serial_->readSome(data, sizeof(data), 50), 0);
+
+    server_->send("abc");
+    ASSERT_EQ(serial_->readSome(data, sizeof(data), 1000), 3);
+    EXPECT_EQ(std::string(reinterpret_cast<char*>(data), 3), "abc");
+
+    // Data larger than the buffer is left for the next call
+    server_->send("0123456789");
+    while (serial_->available() < 10) {
+        std::this_thread::sleep_for(milliseconds(1));
+    }
+    ASSERT_EQ(serial_->readSome(data, 4, 1000), 4);
+    EXPECT_EQ(std::string(reinterpret_cast<char*>(data), 4), "0123");
+    EXPECT_EQ(serial_->available(), 6);
+    ASSERT_EQ(serial_->readSome(data, sizeof(data), 1000), 6);
+    EXPECT_EQ(std::string(reinterpret_cast<char*>(data), 6), "456789");
+}
+
+TEST_F(SerialCommunicationTest, read_until) {
+    uint8_t data[32];
+    server_->send("OK\r");
+    EXPECT_EQ(serial_->readUntil(data, sizeof(data), "\r\n", 50), 0);
+    // Nothing is consumed by the timeout
+    EXPECT_EQ(serial_->available(), 3);
+
+    server_->send("\nNEXT\r\n");
+    ASSERT_EQ(serial_->readUntil(data, sizeof(data), "\r\n", 1000), 4);
+    EXPECT_EQ(std::string(reinterpret_cast<char*>(data), 4), "OK\r\n");
+    ASSERT_EQ(serial_->readUntil(data, sizeof(data), "\r\n", 1000), 6);
+    EXPECT_EQ(std::string(reinterpret_cast<char*>(data), 6), "NEXT\r\n");
+
+    // The delimiter does not fit in the buffer
+    server_->send("0123456789\r\n");
+    EXPECT_EQ(serial_->readUntil(data, 8, "\r\n", 1000), -1);
+    ASSERT_EQ(serial_->readUntil(data, sizeof(data), "\r\n", 1000), 12);
+}
+
+TEST_F(SerialCommunicationTest, read_until_overflow) {
+    std::vector<uint8_t> data(8192);
+    // More than the 64 KiB receive buffer without a delimiter
+    server_->send(std::string(70000, 'x') + "\r\nOK\r\n");
+    EXPECT_EQ(serial_->readUntil(data.data(), data.size(), "\r\n", 1000), -2);
+
+    int n = serial_->readUntil(data.data(), data.size(), "\r\n", 1000);
+    ASSERT_GT(n, 2);
+    EXPECT_EQ(std::string(reinterpret_cast<char*>(data.data()) + n - 2, 2), "\r\n");
+    ASSERT_EQ(serial_->readUntil(data.data(), data.size(), "\r\n", 1000), 4);
+    EXPECT_EQ(std::string(reinterpret_cast<char*>(data.data()), 4), "OK\r\n");
+}
+
+TEST_F(SerialCommunicationTest, read_exact_timeout_keeps_data) {
+    uint8_t data[8];
+    server_->send("1234");
+    auto start = steady_clock::now();
+    EXPECT_EQ(serial_->readExact(data, 8, 100), 0);
+    EXPECT_GE(steady_clock::now() - start, milliseconds(90));
+
+    // The bytes of the timed out call are read by the next call, with the rest
+    server_->send("5678");
+    ASSERT_EQ(serial_->read(data, 8, 1000), 8);
+    EXPECT_EQ(std::string(reinterpret_cast<char*>(data), 8), "12345678");
+    EXPECT_EQ(serial_->available(), 0);
+}
+
+TEST_F(SerialCommunicationTest, disconnect_wakes_reader) {
+    uint8_t data[8];
+    int result = 1;
+    std::thread reader([&]() { result = serial_->readSome(data, sizeof(data), 0); });
+    std::this_thread::sleep_for(milliseconds(50));
+    server_->close();
+    reader.join();
+    EXPECT_EQ(result, -1);
+    EXPECT_FALSE(serial_->isConnected());
+
+    // A local disconnect wakes the reader too
+    SetUp();
+    std::thread local_reader([&]() { result = serial_->readExact(data, sizeof(data), 0); });
+    std::this_thread::sleep_for(milliseconds(50));
+    serial_->disconnect();
+    local_reader.join();
+    EXPECT_EQ(result, -1);
+}
+
+TEST_F(SerialCommunicationTest, write) {
+    std::string text = "hello";
+    EXPECT_EQ(serial_->write(reinterpret_cast<const uint8_t*>(text.data()), text.size()), 5);
+    EXPECT_EQ(server_->receive(5), "hello");
+    EXPECT_TRUE(serial_->isConnected());
+
+    serial_->disconnect();
+    EXPECT_FALSE(serial_->isConnected());
+    EXPECT_EQ(serial_->write(reinterpret_cast<const uint8_t*>(text.data()), text.size()), -1);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/SshSessionPool.hpp"
+#include "Common/SshTransfer.hpp"
+
+using namespace ELITE;
+using namespace ELITE::SSH_UTILS;
+using namespace std::chrono;
+
+struct Counters {
+    std::atomic<int> logins{0};
+    std::atomic<int> closed{0};
+    std::atomic<int> keep_alives{0};
+};
+
+// Stands in for a logged in session, the commands run in a local shell.
+class FakeConnection : public SshConnection {
+   public:
+    std::atomic<bool> alive{true};
+
+    FakeConnection(Counters& counters, const std::string& user) : counters_(counters), user_(user) { counters_.logins++; }
+
+    ~FakeConnection() { counters_.closed++; }
+
+    std::unique_ptr<SshChannel> exec(const std::string& cmd) override {
+        if (!alive) {
+            return nullptr;
+        }
+        return spawnProcess({"/bin/sh", "-c", "echo " + user_ + "; " + cmd});
+    }
+
+    bool keepAlive() override {
+        counters_.keep_alives++;
+        return alive;
+    }
+
+   private:
+    Counters& counters_;
+    std::string user_;
+};
+
+static SshSessionPool::Connector fakeConnector(Counters& counters, std::vector<std::weak_ptr<FakeConnection>>* sessions) {
+    return [&counters, sessions](const std::string& host, const std::string& user,
+                                 const std::string& password) -> std::shared_ptr<SshConnection> {
+        if (password != "right" && password != "new") {
+            return nullptr;
+        }
+        auto connection = std::make_shared<FakeConnection>(counters, user);
+        if (sessions) {
+            sessions->push_back(connection);
+        }
+        return connection;
+    };
+}
+
+TEST(SshSessionPoolTest, reuse_session) {
+    Counters counters;
+    SshSessionPool pool(fakeConnector(counters, nullptr));
+
+    auto root = pool.acquire("192.168.1.1", "root", "right");
+    ASSERT_NE(root, nullptr);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(SshTransfer(pool.acquire("192.168.1.1", "root", "right")).execute("echo " + std::to_string(i)),
+                  "root\n" + std::to_string(i) + "\n");
+    }
+    EXPECT_EQ(counters.logins, 1);
+
+    // Keyed by host and user
+    auto user = pool.acquire("192.168.1.1", "user", "right");
+    EXPECT_EQ(SshTransfer(user).execute("true"), "user\n");
+    pool.acquire("192.168.1.2", "root", "right");
+    EXPECT_EQ(counters.logins, 3);
+    EXPECT_EQ(pool.size(), 3u);
+
+    // A new password logs in again
+    EXPECT_EQ(pool.acquire("192.168.1.1", "root", "wrong"), nullptr);
+    ASSERT_NE(pool.acquire("192.168.1.1", "root", "new"), nullptr);
+    EXPECT_EQ(counters.logins, 4);
+    EXPECT_EQ(counters.closed, 1);
+
+    pool.clear();
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_EQ(counters.closed, 4);
+}
+
+TEST(SshSessionPoolTest, lost_session) {
+    Counters counters;
+    std::vector<std::weak_ptr<FakeConnection>> sessions;
+    SshSessionPool pool(fakeConnector(counters, &sessions));
+
+    auto connection = pool.acquire("192.168.1.1", "root", "right");
+    SshTransfer transfer(connection);
+    EXPECT_EQ(transfer.execute("true"), "root\n");
+    sessions.back().lock()->alive = false;
+    int status = -1;
+    EXPECT_EQ(transfer.execute("exit 2", &status), "root\n");
+    EXPECT_EQ(status, 2);
+    EXPECT_EQ(counters.logins, 2);
+    EXPECT_EQ(pool.size(), 1u);
+}
+
+TEST(SshSessionPoolTest, concurrent_channels) {
+    Counters counters;
+    SshSessionPool pool(fakeConnector(counters, nullptr));
+    auto connection = pool.acquire("192.168.1.1", "root", "right");
+
+    std::atomic<int> right{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t]() {
+            SshTransfer transfer(connection);
+            for (int i = 0; i < 10; i++) {
+                std::string expected = "root\n" + std::to_string(t * 100 + i) + "\n";
+                if (transfer.execute("echo " + std::to_string(t * 100 + i)) == expected) {
+                    right++;
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(right, 40);
+    EXPECT_EQ(counters.logins, 1);
+}
+
+TEST(SshSessionPoolTest, idle_eviction_and_keep_alive) {
+    Counters counters;
+    std::vector<std::weak_ptr<FakeConnection>> sessions;
+    SshSessionPool pool(fakeConnector(counters, &sessions), milliseconds(300), milliseconds(50));
+
+    auto idle = pool.acquire("192.168.1.1", "root", "right");
+    auto busy = pool.acquire("192.168.1.2", "root", "right");
+    // A running command keeps its session
+    auto channel = busy->exec("cat");
+    ASSERT_NE(channel, nullptr);
+    std::this_thread::sleep_for(milliseconds(150));
+    EXPECT_GT(counters.keep_alives, 0);
+    EXPECT_EQ(pool.size(), 2u);
+
+    std::this_thread::sleep_for(milliseconds(400));
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(counters.closed, 1);
+    channel->closeInput();
+    EXPECT_EQ(channel->wait(), 0);
+    channel.reset();
+    std::this_thread::sleep_for(milliseconds(400));
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_EQ(counters.closed, 2);
+
+    // The pooled connection logs in again
+    EXPECT_EQ(SshTransfer(idle).execute("true"), "root\n");
+    EXPECT_EQ(counters.logins, 3);
+
+    // A session failing the keep-alive is closed
+    sessions.back().lock()->alive = false;
+    std::this_thread::sleep_for(milliseconds(150));
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
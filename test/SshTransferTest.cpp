@@ -0,0 +1,340 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Common/SshTransfer.hpp"
+
+using namespace ELITE;
+using namespace ELITE::SSH_UTILS;
+
+// Stands in for the SSH server: the commands run in a local shell. The channels of the first `fail_channels` transfer
+// commands stop after `fail_after` bytes, like a dropped connection. The first `stall_channels` download commands send
+// `stall_after` bytes, then stay connected without sending.
+class LocalConnection : public SshConnection {
+   public:
+    std::vector<std::string> commands;
+    int fail_channels = 0;
+    int fail_after = 0;
+    int stall_channels = 0;
+    int stall_after = 0;
+    // A server without sha256sum
+    bool no_sha256sum = false;
+
+    std::unique_ptr<SshChannel> exec(const std::string& cmd) override {
+        commands.push_back(cmd);
+        std::string local_cmd = cmd;
+        size_t pos = local_cmd.find("sha256sum");
+        if (no_sha256sum && pos != std::string::npos) {
+            local_cmd.replace(pos, 9, "sha256sum_not_installed");
+        }
+        if (stall_channels > 0 && cmd.compare(0, 5, "tail ") == 0) {
+            stall_channels--;
+            local_cmd = local_cmd + " | head -c " + std::to_string(stall_after) + "; sleep 5";
+        }
+        auto channel = spawnProcess({"/bin/sh", "-c", local_cmd});
+        bool transfer = cmd.compare(0, 5, "tail ") == 0 || cmd.compare(0, 4, "cat ") == 0;
+        if (transfer && fail_channels > 0) {
+            fail_channels--;
+            return std::unique_ptr<SshChannel>(new BrokenChannel(std::move(channel), fail_after));
+        }
+        return channel;
+    }
+
+   private:
+    class BrokenChannel : public SshChannel {
+       public:
+        BrokenChannel(std::unique_ptr<SshChannel> channel, int limit) : channel_(std::move(channel)), limit_(limit) {}
+
+        int read(char* buffer, int size, int timeout_ms) override {
+            if (limit_ <= 0) {
+                return -1;
+            }
+            int n = channel_->read(buffer, std::min(size, limit_), timeout_ms);
+            limit_ -= n;
+            return n;
+        }
+
+        bool write(const char* buffer, int size) override {
+            if (size > limit_) {
+                channel_->write(buffer, limit_);
+                limit_ = 0;
+                return false;
+            }
+            limit_ -= size;
+            return channel_->write(buffer, size);
+        }
+
+        void closeInput() override { channel_->closeInput(); }
+
+        int wait() override { return channel_->wait(); }
+
+       private:
+        std::unique_ptr<SshChannel> channel_;
+        int limit_;
+    };
+};
+
+static void writeFile(const std::string& path, const std::string& content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+static bool fileExists(const std::string& path) { return std::ifstream(path).good(); }
+
+static std::string testContent(size_t size) {
+    std::string content(size, '\0');
+    uint32_t x = 12345;
+    for (auto& c : content) {
+        x = x * 1103515245 + 12345;
+        c = static_cast<char>(x >> 16);
+    }
+    return content;
+}
+
+struct ProgressRecord {
+    uint64_t total = 0;
+    uint64_t last = 0;
+    bool monotonic = true;
+    int errors = 0;
+};
+
+static TransferProgress recordProgress(ProgressRecord& record) {
+    return [&record](uint64_t total, uint64_t done, const char* err) {
+        record.total = total;
+        if (done < record.last) {
+            record.monotonic = false;
+        }
+        record.last = done;
+        if (err) {
+            record.errors++;
+        }
+    };
+}
+
+TEST(SshTransferTest, sha256) {
+    writeFile("ssh_transfer_sha.txt", "abc");
+    EXPECT_EQ(sha256File("ssh_transfer_sha.txt"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    writeFile("ssh_transfer_sha.txt", "");
+    EXPECT_EQ(sha256File("ssh_transfer_sha.txt"), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    writeFile("ssh_transfer_sha.txt", std::string(1000, 'a'));
+    EXPECT_EQ(sha256File("ssh_transfer_sha.txt"), "41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3");
+    std::remove("ssh_transfer_sha.txt");
+    EXPECT_EQ(sha256File("ssh_transfer_missing.txt"), "");
+    EXPECT_EQ(shellQuote("it's"), "'it'\\''s'");
+}
+
+TEST(SshTransferTest, execute) {
+    auto connection = std::make_shared<LocalConnection>();
+    SshTransfer transfer(connection);
+    int status = -1;
+    EXPECT_EQ(transfer.execute("echo hello", &status), "hello\n");
+    EXPECT_EQ(status, 0);
+    transfer.execute("exit 3", &status);
+    EXPECT_EQ(status, 3);
+}
+
+TEST(SshTransferTest, download_resume) {
+    const std::string content = testContent(300 * 1024 + 17);
+    writeFile("ssh_transfer_remote.bin", content);
+    std::remove("ssh_transfer_local.bin");
+
+    auto connection = std::make_shared<LocalConnection>();
+    connection->fail_channels = 2;
+    connection->fail_after = 100 * 1024;
+    TransferOptions options;
+    options.chunk_size = 16 * 1024;
+    SshTransfer transfer(connection, options);
+    ProgressRecord record;
+    ASSERT_TRUE(transfer.download("ssh_transfer_remote.bin", "ssh_transfer_local.bin", recordProgress(record)));
+    EXPECT_EQ(readFile("ssh_transfer_local.bin"), content);
+    EXPECT_FALSE(fileExists("ssh_transfer_local.bin.part"));
+
+    // Each attempt continues from the bytes already received
+    std::vector<std::string> tails;
+    for (auto& cmd : connection->commands) {
+        if (cmd.compare(0, 5, "tail ") == 0) {
+            tails.push_back(cmd);
+        }
+    }
+    ASSERT_EQ(tails.size(), 3u);
+    EXPECT_EQ(tails[0].find("tail -c +1 "), 0u);
+    EXPECT_EQ(tails[1].find("tail -c +102401 "), 0u);
+    EXPECT_EQ(tails[2].find("tail -c +204801 "), 0u);
+    EXPECT_EQ(record.total, content.size());
+    EXPECT_EQ(record.last, content.size());
+    EXPECT_TRUE(record.monotonic);
+    EXPECT_EQ(record.errors, 0);
+
+    std::remove("ssh_transfer_remote.bin");
+    std::remove("ssh_transfer_local.bin");
+}
+
+TEST(SshTransferTest, stalled_server) {
+    const std::string content = testContent(100 * 1024);
+    writeFile("ssh_transfer_remote.bin", content);
+    std::remove("ssh_transfer_local.bin");
+
+    auto connection = std::make_shared<LocalConnection>();
+    connection->stall_channels = 1;
+    connection->stall_after = 40 * 1024;
+    TransferOptions options;
+    options.read_timeout_ms = 200;
+    SshTransfer transfer(connection, options);
+    // The stalled download times out and continues from the bytes received
+    ASSERT_TRUE(transfer.download("ssh_transfer_remote.bin", "ssh_transfer_local.bin", nullptr));
+    EXPECT_EQ(readFile("ssh_transfer_local.bin"), content);
+    std::vector<std::string> tails;
+    for (auto& cmd : connection->commands) {
+        if (cmd.compare(0, 5, "tail ") == 0) {
+            tails.push_back(cmd);
+        }
+    }
+    ASSERT_EQ(tails.size(), 2u);
+    EXPECT_EQ(tails[1].find("tail -c +40961 "), 0u);
+
+    // A command without output fails instead of waiting
+    auto start = std::chrono::steady_clock::now();
+    int status = 0;
+    transfer.execute("sleep 5", &status);
+    EXPECT_EQ(status, -1);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(3));
+
+    std::remove("ssh_transfer_remote.bin");
+    std::remove("ssh_transfer_local.bin");
+}
+
+TEST(SshTransferTest, download_checksum_mismatch) {
+    const std::string content = testContent(50000);
+    writeFile("ssh_transfer_remote.bin", content);
+    // A stale partial download of another file
+    std::string stale = content.substr(0, 20000);
+    stale[100] ^= 0x55;
+    writeFile("ssh_transfer_local.bin.part", stale);
+
+    auto connection = std::make_shared<LocalConnection>();
+    SshTransfer transfer(connection);
+    ASSERT_TRUE(transfer.download("ssh_transfer_remote.bin", "ssh_transfer_local.bin", nullptr));
+    EXPECT_EQ(readFile("ssh_transfer_local.bin"), content);
+
+    std::remove("ssh_transfer_remote.bin");
+    std::remove("ssh_transfer_local.bin");
+}
+
+TEST(SshTransferTest, download_fail) {
+    auto connection = std::make_shared<LocalConnection>();
+    SshTransfer transfer(connection);
+    ProgressRecord record;
+    EXPECT_FALSE(transfer.download("ssh_transfer_missing.bin", "ssh_transfer_local.bin", recordProgress(record)));
+    EXPECT_EQ(record.errors, 1);
+    EXPECT_FALSE(fileExists("ssh_transfer_local.bin"));
+
+    const std::string content = testContent(10000);
+    writeFile("ssh_transfer_remote.bin", content);
+    connection->fail_channels = 10;
+    connection->fail_after = 1000;
+    TransferOptions options;
+    options.retries = 2;
+    SshTransfer limited(connection, options);
+    EXPECT_FALSE(limited.download("ssh_transfer_remote.bin", "ssh_transfer_local.bin", recordProgress(record)));
+    EXPECT_EQ(record.errors, 2);
+    EXPECT_EQ(record.last, 3000u);
+    // Continued by the next call
+    connection->fail_channels = 0;
+    EXPECT_TRUE(limited.download("ssh_transfer_remote.bin", "ssh_transfer_local.bin", nullptr));
+    EXPECT_EQ(connection->commands.back().find("head -c 10000 "), 0u);
+    EXPECT_EQ(readFile("ssh_transfer_local.bin"), content);
+
+    std::remove("ssh_transfer_remote.bin");
+    std::remove("ssh_transfer_local.bin");
+}
+
+TEST(SshTransferTest, upload_resume) {
+    const std::string content = testContent(200 * 1024 + 5);
+    writeFile("ssh_transfer_local.bin", content);
+    std::remove("ssh_transfer_remote.bin");
+
+    auto connection = std::make_shared<LocalConnection>();
+    connection->fail_channels = 1;
+    connection->fail_after = 64 * 1024;
+    TransferOptions options;
+    options.chunk_size = 8 * 1024;
+    SshTransfer transfer(connection, options);
+    ProgressRecord record;
+    ASSERT_TRUE(transfer.upload("ssh_transfer_local.bin", "ssh_transfer_remote.bin", recordProgress(record)));
+    EXPECT_EQ(readFile("ssh_transfer_remote.bin"), content);
+    EXPECT_FALSE(fileExists("ssh_transfer_remote.bin.part"));
+
+    std::vector<std::string> cats;
+    for (auto& cmd : connection->commands) {
+        if (cmd.compare(0, 4, "cat ") == 0) {
+            cats.push_back(cmd);
+        }
+    }
+    ASSERT_EQ(cats.size(), 2u);
+    EXPECT_EQ(cats[0].find("cat > "), 0u);
+    EXPECT_EQ(cats[1].find("cat >> "), 0u);
+    EXPECT_EQ(record.last, content.size());
+    EXPECT_EQ(record.errors, 0);
+
+    // An empty file
+    writeFile("ssh_transfer_local.bin", "");
+    ASSERT_TRUE(transfer.upload("ssh_transfer_local.bin", "ssh_transfer_remote.bin", nullptr));
+    EXPECT_TRUE(fileExists("ssh_transfer_remote.bin"));
+    EXPECT_EQ(readFile("ssh_transfer_remote.bin"), "");
+
+    std::remove("ssh_transfer_remote.bin");
+    std::remove("ssh_transfer_local.bin");
+}
+
+TEST(SshTransferTest, unverified) {
+    const std::string content = testContent(30000);
+    writeFile("ssh_transfer_local.bin", content);
+    std::remove("ssh_transfer_remote.bin");
+
+    // An upgrade package that can't be verified is not accepted
+    auto connection = std::make_shared<LocalConnection>();
+    connection->no_sha256sum = true;
+    SshTransfer transfer(connection);
+    ProgressRecord record;
+    EXPECT_FALSE(transfer.upload("ssh_transfer_local.bin", "ssh_transfer_remote.bin", recordProgress(record)));
+    EXPECT_EQ(record.errors, 1);
+    EXPECT_FALSE(fileExists("ssh_transfer_remote.bin"));
+    EXPECT_TRUE(fileExists("ssh_transfer_remote.bin.part"));
+
+    // Nor a download, the complete ".part" file is kept for the next call
+    std::remove("ssh_transfer_remote.bin.part");
+    writeFile("ssh_transfer_remote.bin", content);
+    EXPECT_FALSE(transfer.download("ssh_transfer_remote.bin", "ssh_transfer_local_copy.bin", recordProgress(record)));
+    EXPECT_EQ(record.errors, 2);
+    EXPECT_FALSE(fileExists("ssh_transfer_local_copy.bin"));
+    EXPECT_EQ(readFile("ssh_transfer_local_copy.bin.part"), content);
+
+    // Unless it is allowed
+    TransferOptions options;
+    options.allow_unverified = true;
+    SshTransfer unverified(connection, options);
+    EXPECT_TRUE(unverified.download("ssh_transfer_remote.bin", "ssh_transfer_local_copy.bin", nullptr));
+    EXPECT_EQ(readFile("ssh_transfer_local_copy.bin"), content);
+
+    std::remove("ssh_transfer_remote.bin");
+    std::remove("ssh_transfer_local.bin");
+    std::remove("ssh_transfer_local_copy.bin");
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
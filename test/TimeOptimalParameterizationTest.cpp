@@ -0,0 +1,151 @@
+#include <Elite/TimeOptimalParameterization.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace ELITE;
+
+namespace {
+
+const vector6d_t MAX_VELOCITY = {2.0, 2.0, 3.0, 3.0, 3.0, 3.0};
+const vector6d_t MAX_ACCELERATION = {4.0, 4.0, 6.0, 8.0, 8.0, 8.0};
+
+TimeOptimalOptions makeOptions() {
+    TimeOptimalOptions options;
+    options.max_velocity = MAX_VELOCITY;
+    options.max_acceleration = MAX_ACCELERATION;
+    return options;
+}
+
+// A dense joint path of a pick motion
+std::vector<vector6d_t> makePath(size_t n) {
+    std::vector<vector6d_t> path(n);
+    for (size_t k = 0; k < n; k++) {
+        const double s = static_cast<double>(k) / (n - 1);
+        for (size_t j = 0; j < 6; j++) {
+            path[k][j] = 0.3 * j - 0.5 + (1.2 - 0.15 * j) * s + 0.2 * std::sin(3 * s + j);
+        }
+    }
+    return path;
+}
+
+}  // namespace
+
+TEST(TimeOptimalParameterizationTest, RespectsTheLimits) {
+    TimeOptimalParameterization topp(makeOptions());
+    const std::vector<vector6d_t> path = makePath(1000);
+    ASSERT_TRUE(topp.compute(path));
+    const double duration = topp.getDuration();
+    ASSERT_GT(duration, 0.0);
+
+    const double dt = 0.001;
+    vector6d_t position;
+    vector6d_t previous_velocity;
+    ASSERT_TRUE(topp.sample(0.0, position, previous_velocity));
+    for (size_t j = 0; j < 6; j++) {
+        EXPECT_DOUBLE_EQ(position[j], path.front()[j]);
+        EXPECT_DOUBLE_EQ(previous_velocity[j], 0.0);
+    }
+    // Some joint runs at a limit most of the time
+    size_t saturated = 0;
+    size_t samples = 0;
+    for (double t = dt; t <= duration; t += dt) {
+        vector6d_t velocity;
+        ASSERT_TRUE(topp.sample(t, position, velocity));
+        bool at_limit = false;
+        for (size_t j = 0; j < 6; j++) {
+            EXPECT_LE(std::fabs(velocity[j]), MAX_VELOCITY[j] * 1.001) << "t " << t << " joint " << j;
+            // The limits hold at the grid points, the acceleration is constant in between
+            const double acceleration = (velocity[j] - previous_velocity[j]) / dt;
+            EXPECT_LE(std::fabs(acceleration), MAX_ACCELERATION[j] * 1.05) << "t " << t << " joint " << j;
+            at_limit = at_limit || std::fabs(velocity[j]) > 0.98 * MAX_VELOCITY[j] ||
+                       std::fabs(acceleration) > 0.98 * MAX_ACCELERATION[j];
+        }
+        saturated += at_limit ? 1 : 0;
+        samples++;
+        previous_velocity = velocity;
+    }
+    EXPECT_GT(saturated, samples * 9 / 10);
+
+    ASSERT_TRUE(topp.sample(duration, position, previous_velocity));
+    for (size_t j = 0; j < 6; j++) {
+        EXPECT_NEAR(position[j], path.back()[j], 1e-12);
+        EXPECT_NEAR(previous_velocity[j], 0.0, 1e-12);
+    }
+}
+
+TEST(TimeOptimalParameterizationTest, StraightMoveIsTrapezoidal) {
+    TimeOptimalOptions options = makeOptions();
+    options.grid_step = 0.001;
+    TimeOptimalParameterization topp(options);
+    // Joint 0 alone over 2 rad: accelerate for 0.5 s, cruise at 2 rad/s for 0.5 s, decelerate for 0.5 s
+    ASSERT_TRUE(topp.compute({vector6d_t{0, 0, 0, 0, 0, 0}, vector6d_t{2, 0, 0, 0, 0, 0}}));
+    EXPECT_NEAR(topp.getDuration(), 1.5, 1e-3);
+
+    // Half the acceleration: accelerate for 1 s, cruise for 0 s
+    options.acceleration_scale = 0.5;
+    topp.setOptions(options);
+    ASSERT_TRUE(topp.compute({vector6d_t{0, 0, 0, 0, 0, 0}, vector6d_t{2, 0, 0, 0, 0, 0}}));
+    EXPECT_NEAR(topp.getDuration(), 2.0, 1e-3);
+}
+
+TEST(TimeOptimalParameterizationTest, WaypointTimesAndSamples) {
+    TimeOptimalParameterization topp(makeOptions());
+    std::vector<vector6d_t> path = makePath(50);
+    // A repeated waypoint is reached once
+    path.insert(path.begin() + 20, path[20]);
+    ASSERT_TRUE(topp.compute(path));
+
+    const std::vector<double>& times = topp.getWaypointTimes();
+    ASSERT_EQ(times.size(), path.size());
+    EXPECT_DOUBLE_EQ(times.front(), 0.0);
+    EXPECT_DOUBLE_EQ(times.back(), topp.getDuration());
+    EXPECT_DOUBLE_EQ(times[20], times[21]);
+    for (size_t w = 1; w < times.size(); w++) {
+        if (w != 21) {
+            EXPECT_GT(times[w], times[w - 1]);
+        }
+        vector6d_t position;
+        vector6d_t velocity;
+        ASSERT_TRUE(topp.sample(times[w], position, velocity));
+        for (size_t j = 0; j < 6; j++) {
+            EXPECT_NEAR(position[j], path[w][j], 1e-9);
+        }
+    }
+
+    const double period = 0.004;
+    std::vector<vector6d_t> samples;
+    ASSERT_TRUE(topp.sampleUniform(period, samples));
+    EXPECT_EQ(samples.size(), static_cast<size_t>(std::ceil(topp.getDuration() / period)) + 1);
+    for (size_t j = 0; j < 6; j++) {
+        EXPECT_DOUBLE_EQ(samples.front()[j], path.front()[j]);
+        EXPECT_NEAR(samples.back()[j], path.back()[j], 1e-12);
+    }
+    EXPECT_FALSE(topp.sampleUniform(0.0, samples));
+}
+
+TEST(TimeOptimalParameterizationTest, RejectsInvalidInput) {
+    TimeOptimalParameterization topp(makeOptions());
+    const vector6d_t q = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    EXPECT_FALSE(topp.compute({q}));
+    EXPECT_FALSE(topp.compute({q, q}));
+    vector6d_t nan = q;
+    nan[2] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(topp.compute({q, nan}));
+    EXPECT_DOUBLE_EQ(topp.getDuration(), 0.0);
+    vector6d_t position;
+    vector6d_t velocity;
+    EXPECT_FALSE(topp.sample(0.0, position, velocity));
+
+    // The limits of a JointLimitsInfo not received yet are 0
+    TimeOptimalParameterization unset((TimeOptimalOptions(JointLimitsInfo())));
+    EXPECT_FALSE(unset.compute(makePath(10)));
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
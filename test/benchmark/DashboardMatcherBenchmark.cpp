@@ -0,0 +1,98 @@
+// Dashboard response matcher benchmark.
+// Compares matching and parsing typical dashboard responses the old way, constructing a std::regex for every
+// response and parsing with substr()/stoi(), with the precompiled DashboardResponseMatcher and the typed parsers.
+//
+// Usage: DashboardMatcherBenchmark [iterations]
+// Configure with -DCMAKE_BUILD_TYPE=Release, the numbers of an unoptimized build say little.
+#include "Dashboard/DashboardResponseMatcher.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace ELITE;
+using namespace std::chrono;
+
+struct Case {
+    const char* name;
+    std::string response;
+    std::string regex;
+    DashboardResponseMatcher matcher;
+};
+
+static double nsPerOp(int iterations, const std::function<int()>& op) {
+    volatile int sink = 0;
+    auto start = steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        sink += op();
+    }
+    auto ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+    (void)sink;
+    return static_cast<double>(ns) / iterations;
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc >= 2 ? std::atoi(argv[1]) : 100000;
+    if (iterations <= 0) {
+        iterations = 100000;
+    }
+
+    std::vector<Case> cases = {
+        {"robotMode", "robotMode: RUNNING\r\n", "robotMode:.*", DashboardResponseMatcher::linePrefix("robotMode:")},
+        {"safety -s", "Safety status: NORMAL\r\n", "Safety status:.*", DashboardResponseMatcher::linePrefix("Safety status:")},
+        {"status speed", "Target Speed Fraction: 80\r\n", "Target Speed Fraction:.*",
+         DashboardResponseMatcher::linePrefix("Target Speed Fraction:")},
+        {"echo", "Hello ELITE ROBOTS.\r\n", "Hello ELITE ROBOTS.\r\n", DashboardResponseMatcher::literal("Hello ELITE ROBOTS.\r\n")},
+        {"poll task -s", "Task is running\r\n", "Task is running\r\n", DashboardResponseMatcher::literal("Task is running\r\n")},
+        {"brakeRelease", "Brake is released\r\n", "Brake (Releasing.*|is released).*",
+         DashboardResponseMatcher::regex("Brake (Releasing.*|is released).*")},
+    };
+
+    std::printf("%-16s %18s %18s %18s %9s\n", "case", "regex/call ns", "precompiled ns", "matcher ns", "speedup");
+    for (auto& c : cases) {
+        double per_call = nsPerOp(iterations / 10 + 1, [&]() {
+            std::smatch match;
+            return std::regex_search(c.response, match, std::regex(c.regex)) ? 1 : 0;
+        });
+        std::regex compiled(c.regex);
+        double precompiled = nsPerOp(iterations, [&]() {
+            std::smatch match;
+            return std::regex_search(c.response, match, compiled) ? 1 : 0;
+        });
+        std::string matched;
+        double matcher = nsPerOp(iterations, [&]() { return c.matcher.search(c.response, &matched) ? 1 : 0; });
+        std::printf("%-16s %18.1f %18.1f %18.1f %8.1fx\n", c.name, per_call, precompiled, matcher, per_call / matcher);
+    }
+
+    std::printf("\n%-16s %18s %18s\n", "typed parsing", "substr/stoi ns", "parser ns");
+    std::string mode_response = "robotMode: WAITING_CALIBRATION";
+    // The if-chain DashboardClient::robotMode() used before
+    double substr_parse = nsPerOp(iterations, [&]() {
+        std::string mode = mode_response.substr(mode_response.find(": ") + 2);
+        static const char* const MODES[] = {"NO_CONTROLLER", "DISCONNECTED", "CONFIRM_SAFETY", "BOOTING",
+                                            "POWER_OFF",     "POWER_ON",     "IDLE",           "BACK_DRIVE",
+                                            "RUNNING",       "UPDATING",     "WAITING_CALIBRATION"};
+        for (int i = 0; i < 11; i++) {
+            if (mode == MODES[i]) {
+                return i;
+            }
+        }
+        return -1;
+    });
+    double typed_parse = nsPerOp(iterations, [&]() { return static_cast<int>(DASHBOARD_RESPONSE::parseRobotMode(mode_response)); });
+    std::printf("%-16s %18.1f %18.1f\n", "robotMode", substr_parse, typed_parse);
+
+    std::string speed_response = "Target Speed Fraction: 80";
+    double stoi_parse = nsPerOp(iterations, [&]() { return std::stoi(speed_response.substr(speed_response.find(": ") + 2)); });
+    double int_parse = nsPerOp(iterations, [&]() {
+        int value = 0;
+        DASHBOARD_RESPONSE::parseIntValue(speed_response, value);
+        return value;
+    });
+    std::printf("%-16s %18.1f %18.1f\n", "speedScaling", stoi_parse, int_parse);
+    return 0;
+}
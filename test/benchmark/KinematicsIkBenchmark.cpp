@@ -0,0 +1,142 @@
+// Kinematics IK benchmark.
+// Solves the poses of random configurations with the closed-form AnalyticKinematicsPlugin and, when it was built,
+// the iterative KdlKinematicsPlugin, and reports the mean, 99th percentile and maximum time per IK call and the
+// number of poses solved. Then streams a smooth path through ContinuousIkSolver on the analytic plugin and
+// through its cold getPositionIK() calls, like the targets of a servo loop.
+//
+// Usage: KinematicsIkBenchmark [plugin_directory] [poses]
+// Configure with -DCMAKE_BUILD_TYPE=Release, the numbers of an unoptimized build say little.
+#include <Elite/ClassLoader.hpp>
+#include <Elite/ContinuousIkSolver.hpp>
+#include <Elite/KinematicsBase.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ELITE;
+using namespace std::chrono;
+
+// MDH of a CS63 like arm
+static const vector6d_t BENCH_ALPHA = {0, M_PI / 2, 0, 0, M_PI / 2, -M_PI / 2};
+static const vector6d_t BENCH_A = {0, 0, -0.427, -0.357, 0, 0};
+static const vector6d_t BENCH_D = {0.1215, 0, 0, 0.1225, 0.1025, 0.094};
+
+struct Sample {
+    vector6d_t pose;
+    vector6d_t seed;
+};
+
+static void printTimes(const char* name, std::vector<double>& us, size_t solved) {
+    double mean = 0;
+    for (double v : us) {
+        mean += v;
+    }
+    mean /= us.size();
+    std::sort(us.begin(), us.end());
+    std::printf("%-28s %10.2f %10.2f %10.2f %8zu/%zu\n", name, mean, us[us.size() * 99 / 100], us.back(), solved, us.size());
+}
+
+static void runPlugin(const std::string& directory, const char* library, const char* class_name,
+                      const std::vector<Sample>& samples) {
+    ClassLoader loader(directory + "/" + library);
+    if (!loader.loadLib()) {
+        std::printf("%-28s not found in %s\n", class_name, directory.c_str());
+        return;
+    }
+    auto solver = loader.createUniqueInstance<KinematicsBase>(class_name);
+    if (!solver) {
+        std::printf("%-28s failed to create\n", class_name);
+        return;
+    }
+    solver->setMDH(BENCH_ALPHA, BENCH_A, BENCH_D);
+
+    std::vector<double> us(samples.size());
+    size_t solved = 0;
+    for (size_t i = 0; i < samples.size(); i++) {
+        vector6d_t solution;
+        KinematicsResult result;
+        auto start = steady_clock::now();
+        bool ok = solver->getPositionIK(samples[i].pose, samples[i].seed, solution, result);
+        us[i] = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1000.0;
+        solved += ok ? 1 : 0;
+    }
+    printTimes(class_name, us, solved);
+}
+
+static void runStream(const KinematicsBaseSharedPtr& kinematics, int steps) {
+    // 2 ms cycles of a joint motion
+    std::vector<vector6d_t> path(steps);
+    for (int n = 0; n < steps; n++) {
+        vector6d_t q = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+        for (size_t i = 0; i < 6; i++) {
+            q[i] += 0.4 * std::sin(0.004 * n + i);
+        }
+        kinematics->getPositionFK(q, path[n]);
+    }
+    ContinuousIkSolver continuous(kinematics);
+    std::vector<double> warm_us(steps);
+    std::vector<double> cold_us(steps);
+    size_t warm_solved = 0;
+    size_t cold_solved = 0;
+    vector6d_t previous = {0.3, -1.2, 1.4, -1.6, -1.3, 0.2};
+    for (int n = 0; n < steps; n++) {
+        vector6d_t solution;
+        KinematicsResult result;
+        auto start = steady_clock::now();
+        warm_solved += continuous.solve(path[n], previous, solution, result) ? 1 : 0;
+        warm_us[n] = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1000.0;
+
+        start = steady_clock::now();
+        vector6d_t cold;
+        cold_solved += kinematics->getPositionIK(path[n], previous, cold, result) ? 1 : 0;
+        cold_us[n] = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1000.0;
+        previous = cold;
+    }
+    std::printf("\nstreamed path of %d poses\n", steps);
+    printTimes("getPositionIK", cold_us, cold_solved);
+    printTimes("ContinuousIkSolver", warm_us, warm_solved);
+    const auto& stats = continuous.getStats();
+    std::printf("warm %.1f%%, %.2f iterations and %.2f factorizations per call\n", 100.0 * stats.warmRate(),
+                static_cast<double>(stats.iterations) / stats.calls, static_cast<double>(stats.factorizations) / stats.calls);
+}
+
+int main(int argc, char** argv) {
+    std::string directory = argc >= 2 ? argv[1] : "../plugin/kinematics";
+    int poses = argc >= 3 ? std::atoi(argv[2]) : 2000;
+    if (poses <= 0) {
+        poses = 2000;
+    }
+
+    // The seed is the configuration moved a little, like the previous cycle of a servo loop
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> joint(-M_PI, M_PI);
+    std::uniform_real_distribution<double> offset(-0.05, 0.05);
+    ClassLoader fk_loader(directory + "/libelite_analytic_kinematics.so");
+    std::vector<Sample> samples(poses);
+    if (!fk_loader.loadLib()) {
+        std::printf("libelite_analytic_kinematics.so not found in %s\n", directory.c_str());
+        return 1;
+    }
+    auto fk = fk_loader.createUniqueInstance<KinematicsBase>("ELITE::AnalyticKinematicsPlugin");
+    fk->setMDH(BENCH_ALPHA, BENCH_A, BENCH_D);
+    for (auto& s : samples) {
+        vector6d_t q;
+        for (size_t i = 0; i < 6; i++) {
+            q[i] = joint(gen);
+            s.seed[i] = q[i] + offset(gen);
+        }
+        fk->getPositionFK(q, s.pose);
+    }
+
+    std::printf("%-28s %10s %10s %10s %10s\n", "plugin", "mean us", "p99 us", "max us", "solved");
+    runPlugin(directory, "libelite_analytic_kinematics.so", "ELITE::AnalyticKinematicsPlugin", samples);
+    runPlugin(directory, "libelite_kdl_kinematics.so", "ELITE::KdlKinematicsPlugin", samples);
+    runStream(KinematicsBaseSharedPtr(std::move(fk)), poses);
+    return 0;
+}
@@ -0,0 +1,113 @@
+// Pose algebra batch benchmark.
+// Converts random poses from a local reference frame to world coordinates with each pose algebra plugin, once with a
+// localToWorld() call per pose and once with localToWorldBatch(), for the matrix and the vector forms, then transforms
+// a scan of points with transformPointsBatch(). The per pose calls are repeated with PoseAlgebraValidation::UNCHECKED.
+// Reports the mean time per pose or point.
+//
+// Usage: PoseAlgebraBatchBenchmark [plugin_directory] [poses]
+// Configure with -DCMAKE_BUILD_TYPE=Release, the numbers of an unoptimized build say little.
+#include <Elite/ClassLoader.hpp>
+#include <Elite/PoseAlgebraBase.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ELITE;
+using namespace std::chrono;
+
+static double elapsedNs(steady_clock::time_point start, size_t n) {
+    return static_cast<double>(duration_cast<nanoseconds>(steady_clock::now() - start).count()) / n;
+}
+
+static void runPlugin(const std::string& directory, const char* library, const char* class_name,
+                      const std::vector<vector6d_t>& vectors) {
+    ClassLoader loader(directory + "/" + library);
+    if (!loader.loadLib()) {
+        std::printf("%-24s not found in %s\n", class_name, directory.c_str());
+        return;
+    }
+    auto algebra = loader.createUniqueInstance<PoseAlgebraBase>(class_name);
+    if (!algebra) {
+        std::printf("%-24s failed to create\n", class_name);
+        return;
+    }
+
+    const size_t n = vectors.size();
+    const vector6d_t ref = {0.5, -0.2, 0.3, 0.2, -0.4, 1.3};
+    PoseAlgebraResult result;
+    PoseMatrix ref_matrix;
+    std::vector<PoseMatrix> matrices(n);
+    algebra->vectorToMatrix(ref, ref_matrix, result);
+    algebra->vectorToMatrixBatch(vectors.data(), matrices.data(), n, result);
+    std::vector<PoseMatrix> out_matrices(n);
+    std::vector<vector6d_t> out_vectors(n);
+
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        algebra->localToWorld(ref_matrix, matrices[i], out_matrices[i], result);
+    }
+    const double matrix_single = elapsedNs(start, n);
+    start = steady_clock::now();
+    algebra->localToWorldBatch(ref_matrix, matrices.data(), out_matrices.data(), n, result);
+    const double matrix_batch = elapsedNs(start, n);
+
+    algebra->setValidation(PoseAlgebraValidation::UNCHECKED);
+    start = steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        algebra->localToWorld(ref_matrix, matrices[i], out_matrices[i], result);
+    }
+    const double matrix_unchecked = elapsedNs(start, n);
+    start = steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        algebra->localToWorld(ref, vectors[i], out_vectors[i], result);
+    }
+    const double vector_unchecked = elapsedNs(start, n);
+    algebra->setValidation(PoseAlgebraValidation::CHECKED);
+
+    start = steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        algebra->localToWorld(ref, vectors[i], out_vectors[i], result);
+    }
+    const double vector_single = elapsedNs(start, n);
+    start = steady_clock::now();
+    algebra->localToWorldBatch(ref, vectors.data(), out_vectors.data(), n, result);
+    const double vector_batch = elapsedNs(start, n);
+
+    std::vector<vector3d_t> points(n);
+    for (size_t i = 0; i < n; i++) {
+        points[i] = {vectors[i][0], vectors[i][1], vectors[i][2]};
+    }
+    start = steady_clock::now();
+    algebra->transformPointsBatch(ref_matrix, points.data(), points.data(), n, result);
+    const double points_batch = elapsedNs(start, n);
+
+    std::printf("%-24s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", class_name, matrix_single, matrix_unchecked,
+                matrix_batch, vector_single, vector_unchecked, vector_batch, points_batch);
+}
+
+int main(int argc, char** argv) {
+    std::string directory = argc >= 2 ? argv[1] : "../plugin/pose_algebra";
+    int poses = argc >= 3 ? std::atoi(argv[2]) : 100000;
+    if (poses <= 0) {
+        poses = 100000;
+    }
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> position(-1.0, 1.0);
+    std::uniform_real_distribution<double> angle(-3.0, 3.0);
+    std::vector<vector6d_t> vectors(poses);
+    for (auto& v : vectors) {
+        v = {position(gen), position(gen), position(gen), angle(gen), angle(gen) / 2, angle(gen)};
+    }
+
+    std::printf("ns per pose, %d poses\n", poses);
+    std::printf("%-24s %10s %10s %10s %10s %10s %10s %10s\n", "plugin", "matrix", "unchecked", "batch", "vector", "unchecked",
+                "batch", "points");
+    runPlugin(directory, "libelite_pose_algebra.so", "ELITE::ElitePoseAlgebra", vectors);
+    runPlugin(directory, "libelite_eigen_pose_algebra.so", "ELITE::EigenPoseAlgebra", vectors);
+    return 0;
+}
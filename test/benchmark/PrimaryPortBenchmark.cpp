@@ -0,0 +1,173 @@
+// Primary port parser benchmark.
+// Replays synthetic (or captured) primary port messages through a local PrimaryReplayServer and reports
+// the parsed messages per second and the heap allocations per message of the state and exception parsers.
+// It also runs the malformed-length corpus and reports how the port recovered.
+//
+// Usage: PrimaryPortBenchmark [capture_file]
+#include "Primary/PrimaryPort.hpp"
+#include "Primary/PrimaryReplayServer.hpp"
+#include "Elite/Log.hpp"
+#include "common/PrimaryMessageCorpus.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ELITE;
+using namespace ELITE::PRIMARY_CORPUS;
+using namespace std::chrono;
+
+static std::atomic<uint64_t> s_allocations{0};
+
+void* operator new(std::size_t size) {
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// Counts the robot state messages through the first sub-package of every message
+class CountingPackage : public PrimaryPackage {
+   public:
+    std::atomic<uint64_t> count{0};
+    explicit CountingPackage(int type) : PrimaryPackage(type) {}
+    void parser(int len, const std::vector<uint8_t>::const_iterator& iter) override { count++; }
+};
+
+struct BenchResult {
+    uint64_t messages = 0;
+    double seconds = 0;
+    uint64_t allocations = 0;
+    bool complete = false;
+};
+
+static std::vector<PrimaryCaptureRecord> repeatRecord(const std::vector<uint8_t>& msg, size_t n) {
+    std::vector<PrimaryCaptureRecord> records(n);
+    for (auto& r : records) {
+        r.data = msg;
+    }
+    return records;
+}
+
+static BenchResult runReplay(std::vector<PrimaryCaptureRecord> records, int repeat, int counting_sub_type, bool count_exceptions) {
+    BenchResult result;
+    uint64_t expected = records.size() * repeat;
+    PrimaryReplayServer server(std::move(records));
+    server.setRepeat(repeat);
+    int port = server.start();
+    if (port <= 0) {
+        return result;
+    }
+
+    PrimaryPort primary;
+    auto counter = std::make_shared<CountingPackage>(counting_sub_type);
+    std::atomic<uint64_t> exceptions{0};
+    if (count_exceptions) {
+        primary.registerRobotExceptionCallback([&](RobotExceptionSharedPtr) { exceptions++; });
+    } else {
+        primary.subscribePackage(counter);
+    }
+    auto parsed = [&]() -> uint64_t { return count_exceptions ? exceptions.load() : counter->count.load(); };
+
+    uint64_t alloc_start = s_allocations.load();
+    auto start = steady_clock::now();
+    if (!primary.connect("127.0.0.1", port)) {
+        return result;
+    }
+    while (parsed() < expected && steady_clock::now() - start < seconds(30)) {
+        std::this_thread::sleep_for(microseconds(200));
+    }
+    result.seconds = duration_cast<duration<double>>(steady_clock::now() - start).count();
+    result.allocations = s_allocations.load() - alloc_start;
+    result.messages = parsed();
+    result.complete = (result.messages == expected);
+    primary.disconnect();
+    return result;
+}
+
+static void printResult(const char* name, const BenchResult& r) {
+    double rate = r.seconds > 0 ? r.messages / r.seconds : 0;
+    double alloc_per_msg = r.messages > 0 ? static_cast<double>(r.allocations) / r.messages : 0;
+    std::printf("%-28s %10llu msgs %10.0f msgs/s %8.2f allocs/msg%s\n", name, static_cast<unsigned long long>(r.messages), rate,
+                alloc_per_msg, r.complete ? "" : "  (incomplete)");
+}
+
+static void runMalformedCorpus() {
+    std::printf("\nMalformed corpus\n");
+    for (auto& malformed : makeMalformedCorpus()) {
+        std::vector<PrimaryCaptureRecord> records(2);
+        records[0].data = makeTypicalRobotStateMessage();
+        records[1].data = malformed.data;
+        PrimaryReplayServer server(records);
+        server.setRepeat(malformed.breaks_stream ? 1 : 0);
+        int port = server.start();
+
+        PrimaryPort primary;
+        PrimaryReconnectPolicy policy;
+        policy.initial_delay_ms = 5;
+        policy.jitter = 0;
+        primary.setReconnectPolicy(policy);
+        auto counter = std::make_shared<CountingPackage>(0);
+        primary.subscribePackage(counter);
+        bool connected = port > 0 && primary.connect("127.0.0.1", port);
+        std::this_thread::sleep_for(milliseconds(200));
+        auto metrics = primary.getConnectionMetrics();
+        std::printf("%-28s connected:%d parsed:%llu reconnects:%llu\n", malformed.name.c_str(), connected ? 1 : 0,
+                    static_cast<unsigned long long>(counter->count.load()),
+                    static_cast<unsigned long long>(metrics.reconnect_successes));
+        primary.disconnect();
+    }
+}
+
+int main(int argc, char** argv) {
+    // Parse errors of the malformed corpus are expected
+    setLogLevel(LogLevel::ELI_FATAL);
+
+    std::printf("%-28s %15s %17s %15s\n", "case", "messages", "rate", "allocations");
+    if (argc >= 2) {
+        std::vector<PrimaryCaptureRecord> records;
+        if (!PrimaryCaptureReader::load(argv[1], records) || records.empty()) {
+            std::printf("Load capture \"%s\" fail\n", argv[1]);
+            return 1;
+        }
+        // Count messages through the first sub-package type of the first robot state message
+        int sub_type = -1;
+        size_t state_messages = 0;
+        for (auto& r : records) {
+            if (r.data.size() > 10 && r.data[4] == ROBOT_STATE_MSG_TYPE) {
+                if (sub_type < 0) {
+                    sub_type = r.data[9];
+                }
+                state_messages++;
+            }
+        }
+        std::printf("Capture \"%s\": %zu records, %zu robot state\n", argv[1], records.size(), state_messages);
+        if (sub_type >= 0) {
+            std::vector<PrimaryCaptureRecord> states;
+            for (auto& r : records) {
+                if (r.data.size() > 10 && r.data[4] == ROBOT_STATE_MSG_TYPE && r.data[9] == sub_type) {
+                    states.push_back(r);
+                }
+            }
+            printResult("capture robot state", runReplay(states, 10, sub_type, false));
+        }
+    }
+
+    printResult("robot state (8 sub-pkgs)", runReplay(repeatRecord(makeTypicalRobotStateMessage(), 1000), 50, 0, false));
+    printResult("robot error exception", runReplay(repeatRecord(makeRobotErrorMessage(1, 1234, 5, 2, 1, 99), 1000), 20, 0, true));
+    printResult("runtime exception",
+                runReplay(repeatRecord(makeRuntimeExceptionMessage(1, 12, 3, "undefined variable 'foo'"), 1000), 20, 0, true));
+    runMalformedCorpus();
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Time-optimal parameterization benchmark.
+// Times dense joint paths of increasing length with TimeOptimalParameterization, as a planner re-timing the path of
+// each pick, and reports the mean, 99th percentile and maximum time per compute() and per sampling of the result at
+// the servoj period, with the duration of the timed path.
+//
+// Usage: TimeOptimalParameterizationBenchmark [runs]
+// Configure with -DCMAKE_BUILD_TYPE=Release, the numbers of an unoptimized build say little.
+#include <Elite/TimeOptimalParameterization.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace ELITE;
+using namespace std::chrono;
+
+static void printTimes(const char* name, size_t waypoints, std::vector<double>& us, double duration) {
+    double mean = 0;
+    for (double v : us) {
+        mean += v;
+    }
+    mean /= us.size();
+    std::sort(us.begin(), us.end());
+    std::printf("%-12s %10zu %10.1f %10.1f %10.1f %10.3f\n", name, waypoints, mean, us[us.size() * 99 / 100], us.back(),
+                duration);
+}
+
+int main(int argc, char** argv) {
+    int runs = argc >= 2 ? std::atoi(argv[1]) : 200;
+    if (runs <= 0) {
+        runs = 200;
+    }
+
+    TimeOptimalOptions options;
+    options.max_velocity = {2.0, 2.0, 3.0, 3.0, 3.0, 3.0};
+    options.max_acceleration = {4.0, 4.0, 6.0, 8.0, 8.0, 8.0};
+    TimeOptimalParameterization topp(options);
+
+    std::printf("%-12s %10s %10s %10s %10s %10s\n", "stage", "waypoints", "mean us", "p99 us", "max us", "path s");
+    for (size_t n : {100, 1000, 10000}) {
+        // A pick motion sampled densely, moved a little on every run like the next pick
+        std::vector<vector6d_t> path(n);
+        std::vector<double> compute_us(runs);
+        std::vector<double> sample_us(runs);
+        std::vector<vector6d_t> samples;
+        for (int r = 0; r < runs; r++) {
+            for (size_t k = 0; k < n; k++) {
+                const double s = static_cast<double>(k) / (n - 1);
+                for (size_t j = 0; j < 6; j++) {
+                    path[k][j] = 0.3 * j - 0.5 + (1.2 + 0.001 * r - 0.15 * j) * s + 0.2 * std::sin(3 * s + j);
+                }
+            }
+            auto start = steady_clock::now();
+            if (!topp.compute(path)) {
+                std::printf("compute failed\n");
+                return 1;
+            }
+            compute_us[r] = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1000.0;
+
+            start = steady_clock::now();
+            topp.sampleUniform(0.004, samples);
+            sample_us[r] = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1000.0;
+        }
+        printTimes("compute", n, compute_us, topp.getDuration());
+        printTimes("sample 4ms", n, sample_us, topp.getDuration());
+    }
+    return 0;
+}
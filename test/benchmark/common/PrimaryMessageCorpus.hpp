@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+//
+// PrimaryMessageCorpus.hpp
+// Builds synthetic primary port messages, including a malformed corpus, for tests and benchmarks.
+#ifndef __ELITE__PRIMARY_MESSAGE_CORPUS_HPP__
+#define __ELITE__PRIMARY_MESSAGE_CORPUS_HPP__
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace ELITE {
+namespace PRIMARY_CORPUS {
+
+constexpr uint8_t ROBOT_STATE_MSG_TYPE = 16;
+constexpr uint8_t ROBOT_EXCEPTION_MSG_TYPE = 20;
+constexpr uint8_t ROBOT_CONFIG_SUB_TYPE = 6;
+
+template <typename T>
+inline void appendBigEndian(std::vector<uint8_t>& out, T value) {
+    uint8_t bytes[sizeof(T)];
+    memcpy(bytes, &value, sizeof(T));
+    for (int i = sizeof(T) - 1; i >= 0; i--) {
+        out.push_back(bytes[i]);
+    }
+}
+
+template <typename T>
+inline void writeBigEndian(std::vector<uint8_t>& out, size_t offset, T value) {
+    uint8_t bytes[sizeof(T)];
+    memcpy(bytes, &value, sizeof(T));
+    for (size_t i = 0; i < sizeof(T); i++) {
+        out[offset + i] = bytes[sizeof(T) - 1 - i];
+    }
+}
+
+// Prefix a body with the 5 bytes package head
+inline std::vector<uint8_t> makeMessage(uint8_t type, const std::vector<uint8_t>& body) {
+    std::vector<uint8_t> msg;
+    appendBigEndian<uint32_t>(msg, static_cast<uint32_t>(body.size() + 5));
+    msg.push_back(type);
+    msg.insert(msg.end(), body.begin(), body.end());
+    return msg;
+}
+
+// The robot configuration sub-package of controller 2.11.0, see RobotConfPackage.cpp
+inline std::vector<uint8_t> makeKinematicsSubPackage(const std::array<double, 6>& a, const std::array<double, 6>& d,
+                                                     const std::array<double, 6>& alpha) {
+    std::vector<uint8_t> sub;
+    appendBigEndian<uint32_t>(sub, 0);
+    sub.push_back(ROBOT_CONFIG_SUB_TYPE);
+    // Joint limits, joint velocity and acceleration limits, defaults
+    for (int i = 0; i < 6 * 2 + 6 * 2 + 5; i++) {
+        appendBigEndian<double>(sub, 0.5 * i);
+    }
+    for (double v : a) appendBigEndian<double>(sub, v);
+    for (double v : d) appendBigEndian<double>(sub, v);
+    for (double v : alpha) appendBigEndian<double>(sub, v);
+    for (int i = 0; i < 6; i++) appendBigEndian<double>(sub, 0);
+    for (int i = 0; i < 4; i++) appendBigEndian<uint32_t>(sub, i);
+    writeBigEndian<uint32_t>(sub, 0, static_cast<uint32_t>(sub.size()));
+    return sub;
+}
+
+// A sub-package the SDK does not parse
+inline std::vector<uint8_t> makeFillerSubPackage(uint8_t type, size_t payload_len) {
+    std::vector<uint8_t> sub;
+    appendBigEndian<uint32_t>(sub, static_cast<uint32_t>(payload_len + 5));
+    sub.push_back(type);
+    for (size_t i = 0; i < payload_len; i++) {
+        sub.push_back(static_cast<uint8_t>(i));
+    }
+    return sub;
+}
+
+inline std::vector<uint8_t> makeRobotStateMessage(const std::vector<std::vector<uint8_t>>& subs) {
+    std::vector<uint8_t> body;
+    for (auto& sub : subs) {
+        body.insert(body.end(), sub.begin(), sub.end());
+    }
+    return makeMessage(ROBOT_STATE_MSG_TYPE, body);
+}
+
+// A robot state message shaped like the controller's 10Hz message: several sub-packages and the configuration.
+inline std::vector<uint8_t> makeTypicalRobotStateMessage() {
+    std::array<double, 6> a = {0, -0.427, -0.357, 0, 0, 0};
+    std::array<double, 6> d = {0.1215, 0, 0, 0.1225, 0.1025, 0.094};
+    std::array<double, 6> alpha = {0, 1.5707963, 0, 0, 1.5707963, -1.5707963};
+    return makeRobotStateMessage({makeFillerSubPackage(0, 42), makeFillerSubPackage(1, 6 * 41), makeFillerSubPackage(2, 37),
+                                  makeFillerSubPackage(3, 66), makeFillerSubPackage(4, 96), makeFillerSubPackage(5, 48),
+                                  makeKinematicsSubPackage(a, d, alpha), makeFillerSubPackage(7, 56)});
+}
+
+inline std::vector<uint8_t> makeRobotErrorMessage(uint64_t timestamp, int32_t code, int32_t sub_code, int32_t level,
+                                                  uint32_t data_type, uint32_t data) {
+    std::vector<uint8_t> body;
+    appendBigEndian<uint64_t>(body, timestamp);
+    body.push_back(104);  // Controller
+    body.push_back(6);    // ROBOT_ERROR
+    appendBigEndian<int32_t>(body, code);
+    appendBigEndian<int32_t>(body, sub_code);
+    appendBigEndian<int32_t>(body, level);
+    appendBigEndian<uint32_t>(body, data_type);
+    appendBigEndian<uint32_t>(body, data);
+    return makeMessage(ROBOT_EXCEPTION_MSG_TYPE, body);
+}
+
+inline std::vector<uint8_t> makeRuntimeExceptionMessage(uint64_t timestamp, int32_t line, int32_t column,
+                                                        const std::string& text) {
+    std::vector<uint8_t> body;
+    appendBigEndian<uint64_t>(body, timestamp);
+    body.push_back(104);
+    body.push_back(10);  // SCRIPT_RUNTIME
+    appendBigEndian<int32_t>(body, line);
+    appendBigEndian<int32_t>(body, column);
+    body.insert(body.end(), text.begin(), text.end());
+    return makeMessage(ROBOT_EXCEPTION_MSG_TYPE, body);
+}
+
+struct MalformedMessage {
+    std::string name;
+    std::vector<uint8_t> data;
+    // The package head is broken, the port can't find the next message and has to reconnect
+    bool breaks_stream;
+};
+
+inline std::vector<MalformedMessage> makeMalformedCorpus() {
+    std::vector<MalformedMessage> corpus;
+    auto head_only = [](uint32_t len, uint8_t type) {
+        std::vector<uint8_t> msg;
+        appendBigEndian<uint32_t>(msg, len);
+        msg.push_back(type);
+        return msg;
+    };
+    corpus.push_back({"package_len_zero", head_only(0, ROBOT_STATE_MSG_TYPE), true});
+    corpus.push_back({"package_len_head_only", head_only(5, ROBOT_STATE_MSG_TYPE), true});
+    corpus.push_back({"package_len_huge", head_only(0x7FFFFFFF, ROBOT_STATE_MSG_TYPE), true});
+    corpus.push_back({"package_len_max", head_only(0xFFFFFFFF, ROBOT_EXCEPTION_MSG_TYPE), true});
+
+    // Sub-package length 0 used to loop forever
+    auto sub_zero = makeFillerSubPackage(3, 8);
+    writeBigEndian<uint32_t>(sub_zero, 0, 0);
+    corpus.push_back({"sub_len_zero", makeRobotStateMessage({sub_zero}), false});
+
+    auto sub_over = makeFillerSubPackage(3, 8);
+    writeBigEndian<uint32_t>(sub_over, 0, 4096);
+    corpus.push_back({"sub_len_overflow", makeRobotStateMessage({makeFillerSubPackage(0, 4), sub_over}), false});
+
+    corpus.push_back({"sub_len_truncated_head", makeRobotStateMessage({makeFillerSubPackage(0, 4), {0, 0, 0}}), false});
+
+    // A configuration sub-package that ends before the DH parameters
+    corpus.push_back({"kinematics_truncated", makeRobotStateMessage({makeFillerSubPackage(ROBOT_CONFIG_SUB_TYPE, 20)}), false});
+
+    auto error = makeRobotErrorMessage(1, 2, 3, 1, 1, 4);
+    error.resize(5 + 12);
+    writeBigEndian<uint32_t>(error, 0, static_cast<uint32_t>(error.size()));
+    corpus.push_back({"robot_error_truncated", error, false});
+
+    auto runtime = makeRuntimeExceptionMessage(1, 2, 3, "");
+    runtime.resize(5 + 10 + 2);
+    writeBigEndian<uint32_t>(runtime, 0, static_cast<uint32_t>(runtime.size()));
+    corpus.push_back({"runtime_exception_truncated", runtime, false});
+
+    corpus.push_back({"exception_body_tiny", makeMessage(ROBOT_EXCEPTION_MSG_TYPE, {1, 2, 3}), false});
+    return corpus;
+}
+
+}  // namespace PRIMARY_CORPUS
+}  // namespace ELITE
+
+#endif